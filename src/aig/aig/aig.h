@@ -628,8 +628,8 @@ extern void            Aig_ManStartReverseLevels( Aig_Man_t * p, int nMaxLevelIn
 extern void            Aig_ManStopReverseLevels( Aig_Man_t * p );
 extern void            Aig_ManUpdateLevel( Aig_Man_t * p, Aig_Obj_t * pObjNew );
 extern void            Aig_ManUpdateReverseLevel( Aig_Man_t * p, Aig_Obj_t * pObjNew );
-extern void            Aig_ManVerifyLevel( Aig_Man_t * p );
-extern void            Aig_ManVerifyReverseLevel( Aig_Man_t * p );
+extern int             Aig_ManVerifyLevel( Aig_Man_t * p );
+extern int             Aig_ManVerifyReverseLevel( Aig_Man_t * p );
 /*=== aigTruth.c ========================================================*/
 extern unsigned *      Aig_ManCutTruth( Aig_Obj_t * pRoot, Vec_Ptr_t * vLeaves, Vec_Ptr_t * vNodes, Vec_Ptr_t * vTruthElem, Vec_Ptr_t * vTruthStore );
 /*=== aigTsim.c ========================================================*/
@@ -494,6 +494,9 @@ void Aig_ObjReplace( Aig_Man_t * p, Aig_Obj_t * pObjOld, Aig_Obj_t * pObjNew, in
         pObjOld->Type = AIG_OBJ_BUF;
         Aig_ObjConnect( p, pObjOld, pObjNew, NULL );
         p->nBufReplaces++;
+        // the new object (and its new fanins) may not have reverse levels yet
+        if ( fUpdateLevel && Aig_ObjIsNode(pObjNewR) )
+            Aig_ManUpdateReverseLevel( p, pObjNewR );
     }
     else
     {
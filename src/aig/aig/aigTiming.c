@@ -297,14 +297,15 @@ void Aig_ManUpdateReverseLevel( Aig_Man_t * p, Aig_Obj_t * pObjNew )
 
   Synopsis    [Verifies direct level of the nodes.]
 
-  Description []
+  Description [Returns the number of nodes whose level differs from
+  the one recomputed from the fanins.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Aig_ManVerifyLevel( Aig_Man_t * p )
+int Aig_ManVerifyLevel( Aig_Man_t * p )
 {
     Aig_Obj_t * pObj;
     int i, Counter = 0;
@@ -318,33 +319,52 @@ void Aig_ManVerifyLevel( Aig_Man_t * p )
         }
     if ( Counter )
     printf( "Levels of %d nodes are incorrect.\n", Counter );
+    return Counter;
 }
 
 /**Function*************************************************************
 
   Synopsis    [Verifies reverse level of the nodes.]
 
-  Description []
+  Description [Recomputes the reverse levels from scratch and returns 
+  the number of nodes whose reverse level is smaller than the exact one.
+  Such levels are optimistic and may lead to violating the delay.
+  Larger reverse levels are allowed because the incremental update does 
+  not decrease them for the fanins of the removed nodes.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Aig_ManVerifyReverseLevel( Aig_Man_t * p )
+int Aig_ManVerifyReverseLevel( Aig_Man_t * p )
 {
-    Aig_Obj_t * pObj;
-    int i, Counter = 0;
+    Vec_Ptr_t * vNodes;
+    Vec_Int_t * vLevelR;
+    Aig_Obj_t * pObj, * pFanout;
+    int i, k, iFanout = -1, LevelR, Counter = 0;
     assert( p->vLevelR );
-    Aig_ManForEachNode( p, pObj, i )
-        if ( Aig_ObjLevel(pObj) != Aig_ObjLevelNew(pObj) )
+    // recompute reverse levels in reverse topological order
+    vLevelR = Vec_IntStart( Aig_ManObjNumMax(p) );
+    vNodes = Aig_ManDfsReverse( p );
+    Vec_PtrForEachEntry( Aig_Obj_t *, vNodes, pObj, i )
+    {
+        LevelR = 0;
+        Aig_ObjForEachFanout( p, pObj, pFanout, iFanout, k )
+            LevelR = Abc_MaxInt( LevelR, Vec_IntEntry(vLevelR, pFanout->Id) );
+        Vec_IntWriteEntry( vLevelR, pObj->Id, LevelR + 1 );
+        if ( Aig_ObjReverseLevel(p, pObj) < LevelR + 1 )
         {
             printf( "Reverse level of node %6d should be %4d instead of %4d.\n", 
-                pObj->Id, Aig_ObjReverseLevelNew(p, pObj), Aig_ObjReverseLevel(p, pObj) );
+                pObj->Id, LevelR + 1, Aig_ObjReverseLevel(p, pObj) );
             Counter++;
         }
+    }
+    Vec_PtrFree( vNodes );
+    Vec_IntFree( vLevelR );
     if ( Counter )
     printf( "Reverse levels of %d nodes are incorrect.\n", Counter );
+    return Counter;
 }
 
 ////////////////////////////////////////////////////////////////////////
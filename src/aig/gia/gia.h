@@ -337,6 +337,7 @@ struct Jf_Par_t_
     int            nAreaTuner;
     int            nReqTimeFlex;
     int            nVerbLimit;
+    int            nMemLimit;
     int            nDelayLut1;
     int            nDelayLut2;
     int            nFastEdges;
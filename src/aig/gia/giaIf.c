@@ -79,6 +79,8 @@ void Gia_ManSetIfParsDefault( void * pp )
     p->fEdge       =  1;
     p->fPower      =  0;
     p->fCutMin     =  0;
+    p->nCacheLimit =  0;
+    p->fCacheKeep  =  1;
     p->fVerbose    =  0;
     p->pLutStruct  =  NULL;
     // internal parameters
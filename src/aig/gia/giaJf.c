@@ -27,6 +27,16 @@
 #include "opt/dau/dau.h"
 #include "sat/cnf/cnf.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -37,6 +47,10 @@ ABC_NAMESPACE_IMPL_START
 #define JF_WORD_MAX  ((JF_LEAF_MAX > 6) ? 1 << (JF_LEAF_MAX-6) : 1)
 #define JF_CUT_MAX   16
 #define JF_EPSILON 0.005
+#define JF_PROC_MAX  64   // the max number of threads
+#define JF_PAR_MIN  256   // the smallest level processed by several threads
+#define JF_PAR_CHUNK 32   // the number of nodes taken by a thread at a time
+#define JF_MEM_STEP 1024  // the number of nodes between memory budget checks
 
 typedef struct Jf_Cut_t_ Jf_Cut_t; 
 struct Jf_Cut_t_
@@ -68,6 +82,7 @@ struct Jf_Man_t_
     abctime          clkStart;    // starting time
     word             CutCount[4]; // statistics
     int              nCoarse;     // coarse nodes
+    int              nCutNumCur;  // the cut limit (reduced under memory budget)
 };
 
 static inline int    Jf_ObjIsUnit( Gia_Obj_t * p )          { return !p->fMark0;                                       }
@@ -391,6 +406,7 @@ Jf_Man_t * Jf_ManAlloc( Gia_Man_t * pGia, Jf_Par_t * pPars )
     Vec_SetAlloc_( &p->pMem, 20 );
     p->vTemp     = Vec_IntAlloc( 1000 );
     p->clkStart  = Abc_Clock();
+    p->nCutNumCur = pPars->nCutNum;
     return p;
 }
 void Jf_ManFree( Jf_Man_t * p )
@@ -1116,6 +1132,22 @@ static inline void Jf_ObjPropagateBuf( Jf_Man_t * p, Gia_Obj_t * pObj, int fReve
     Vec_IntWriteEntry( &p->vArr,  iObj, Jf_ObjArr(p, iFanin) );
     Vec_FltWriteEntry( &p->vFlow, iObj, Jf_ObjFlow(p, iFanin) );
 }
+static inline int Jf_ObjCutsSize( int * pCuts )
+{
+    int i, * pCut, nSize = 1;
+    Jf_ObjForEachCut( pCuts, pCut, i )
+        nSize += Jf_CutSize(pCut) + 1;
+    return nSize;
+}
+static inline int Jf_ManUseThreads( Jf_Man_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    // truth tables and DSD functions are hashed in shared managers
+    return p->pPars->nProcNum > 1 && !p->pPars->fCutMin;
+#else
+    return 0;
+#endif
+}
 static inline int Jf_ObjHasCutWithSize( Jf_Cut_t ** pSto, int c, int nSize )
 {
     int i;
@@ -1124,10 +1156,10 @@ static inline int Jf_ObjHasCutWithSize( Jf_Cut_t ** pSto, int c, int nSize )
             return 1;
     return 0;
 }
-void Jf_ObjComputeCuts( Jf_Man_t * p, Gia_Obj_t * pObj, int fEdge )
+int Jf_ObjComputeCutsInt( Jf_Man_t * p, Gia_Obj_t * pObj, int fEdge, Vec_Set_t * pMem, Vec_Int_t * vTemp, word * pCutCount )
 {
     int        LutSize = p->pPars->nLutSize;
-    int        CutNum = p->pPars->nCutNum;
+    int        CutNum = p->nCutNumCur;
     int        iObj = Gia_ObjId(p->pGia, pObj);
     word       Sign0[JF_CUT_MAX+2]; // signatures of the first cut
     word       Sign1[JF_CUT_MAX+2]; // signatures of the second cut
@@ -1147,13 +1179,13 @@ void Jf_ObjComputeCuts( Jf_Man_t * p, Gia_Obj_t * pObj, int fEdge )
     Jf_ObjForEachCut( pCuts1, pCut1, i )
         Sign1[i] = Jf_CutGetSign( pCut1 );
     // merge cuts
-    p->CutCount[0] += pCuts0[0] * pCuts1[0];
+    pCutCount[0] += pCuts0[0] * pCuts1[0];
     Jf_ObjForEachCut( pCuts0, pCut0, i )
     Jf_ObjForEachCut( pCuts1, pCut1, k )
     {
         if ( Jf_CountBits(Sign0[i] | Sign1[k]) > LutSize )
             continue;
-        p->CutCount[1]++;        
+        pCutCount[1]++;        
         if ( !p->pPars->fCutMin )
         {
             if ( !Jf_CutMergeOrder(pCut0, pCut1, pSto[c]->pCut, LutSize) )
@@ -1188,7 +1220,7 @@ void Jf_ObjComputeCuts( Jf_Man_t * p, Gia_Obj_t * pObj, int fEdge )
             if ( pSto[c]->iFunc >= (1 << 24) )
                 printf( "Hard limit on the number of different Boolean functions (2^23) is reached. Quitting...\n" ), exit(1);
         }
-        p->CutCount[2]++;
+        pCutCount[2]++;
         pSto[c]->Time = p->pPars->fAreaOnly ? 0 : Jf_CutArr(p, pSto[c]->pCut);
         pSto[c]->Flow = Jf_CutFlow(p, pSto[c]->pCut);
         c = Jf_ObjAddCutToStore( p, pSto, c, CutNum );
@@ -1225,37 +1257,236 @@ void Jf_ObjComputeCuts( Jf_Man_t * p, Gia_Obj_t * pObj, int fEdge )
     Vec_IntWriteEntry( &p->vArr,  iObj, pSto[0]->Time );
     Vec_FltWriteEntry( &p->vFlow, iObj, (pSto[0]->Flow + (fEdge ? pSto[0]->pCut[0] : pSto[0]->Cost)) / Jf_ObjRefs(p, iObj) );
     // add cuts to storage cuts
-    Vec_IntClear( p->vTemp );
-    Vec_IntPush( p->vTemp, c );
+    Vec_IntClear( vTemp );
+    Vec_IntPush( vTemp, c );
     for ( i = 0; i < c; i++ )
     {
         pSto[i]->Cost = p->pPars->fGenCnf ? Jf_CutCnfSizeF(p, Abc_Lit2Var(pSto[i]->iFunc)) : 1;
-        Vec_IntPush( p->vTemp, Jf_CutSetAll(pSto[i]->iFunc, pSto[i]->Cost, pSto[i]->pCut[0]) );
+        Vec_IntPush( vTemp, Jf_CutSetAll(pSto[i]->iFunc, pSto[i]->Cost, pSto[i]->pCut[0]) );
         for ( k = 1; k <= pSto[i]->pCut[0]; k++ )
-            Vec_IntPush( p->vTemp, pSto[i]->pCut[k] );
+            Vec_IntPush( vTemp, pSto[i]->pCut[k] );
     }
-    Vec_IntWriteEntry( &p->vCuts, iObj, Vec_SetAppend(&p->pMem, Vec_IntArray(p->vTemp), Vec_IntSize(p->vTemp)) );
-    p->CutCount[3] += c;
+    pCutCount[3] += c;
+    return Vec_SetAppend( pMem, Vec_IntArray(vTemp), Vec_IntSize(vTemp) );
+}
+void Jf_ObjComputeCuts( Jf_Man_t * p, Gia_Obj_t * pObj, int fEdge )
+{
+    int iObj = Gia_ObjId( p->pGia, pObj );
+    Vec_IntWriteEntry( &p->vCuts, iObj, Jf_ObjComputeCutsInt(p, pObj, fEdge, &p->pMem, p->vTemp, p->CutCount) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reduces the number of cuts to stay within the memory budget.]
+
+  Description [Estimates the memory needed for the cuts of the remaining
+  nRemain nodes using the average memory per cut of the nDone nodes 
+  computed so far, and sets the cut limit to the largest value, for which
+  the estimate fits into the budget. If the budget is already exceeded, 
+  only one cut (besides the trivial ones) is kept for the remaining nodes.
+  The budget is best-effort: the estimate may be off, and even one cut 
+  per node may not fit, which is reported by Jf_ManComputeCuts().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Jf_ManUpdateCutNum( Jf_Man_t * p, int nDone, int nRemain )
+{
+    // the last page may be filled only partially
+    double Budget = (double)p->pPars->nMemLimit * (1 << 20) - (double)sizeof(word) * (1 << p->pMem.nPageSize);
+    double Used   = Vec_SetMemory( &p->pMem );
+    double PerCut = Used / (1 + p->CutCount[3] + Gia_ManCiNum(p->pGia));
+    int nCutNum   = p->nCutNumCur;
+    if ( p->pPars->nMemLimit == 0 || p->nCutNumCur == 1 || nDone < JF_MEM_STEP )
+        return;
+    while ( nCutNum > 1 && Used + PerCut * (nCutNum + 1) * nRemain > Budget )
+        nCutNum--;
+    if ( nCutNum == p->nCutNumCur )
+        return;
+    if ( p->pPars->fVerbose )
+        printf( "Memory budget %d MB: reducing the cut limit from %d to %d with %d nodes left.\n", p->pPars->nMemLimit, p->nCutNumCur, nCutNum, nRemain );
+    p->nCutNumCur = nCutNum;
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Computes cuts for one level of the AIG using several threads.]
+
+  Description [Each thread takes chunks of nodes of the current level from
+  a shared index and saves their cuts in its own paged memory. After the 
+  level is done, the cuts are compacted into the shared cut memory in the
+  order of nodes, so that the next level finds the fanin cuts there.
+  The nodes only read the cuts, arrival times and flows of the fanins,
+  which are on the lower levels, so the result is the same as for the
+  serial computation.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+typedef struct Jf_ThData_t_ Jf_ThData_t;
+struct Jf_ThData_t_
+{
+    Jf_Man_t *        p;              // mapping manager
+    Vec_Int_t *       vLevel;         // nodes of the current level
+    Vec_Int_t *       vOwner;         // the thread, which computed each node
+    int *             piNext;         // the next node to process
+    pthread_mutex_t * pMutex;         // protects the next node
+    int               fEdge;          // edge mode
+    int               iThread;        // the thread number
+    Vec_Set_t         pMem;           // cut storage of this thread
+    Vec_Int_t *       vTemp;          // temporary
+    word              CutCount[4];    // statistics
+};
+void * Jf_ManCutsWorkerThread( void * pArg )
+{
+    Jf_ThData_t * pThData = (Jf_ThData_t *)pArg;
+    Jf_Man_t * p = pThData->p;
+    int i, iStart, iStop, iObj;
+    while ( 1 )
+    {
+        pthread_mutex_lock( pThData->pMutex );
+        iStart = *pThData->piNext;
+        *pThData->piNext += JF_PAR_CHUNK;
+        pthread_mutex_unlock( pThData->pMutex );
+        if ( iStart >= Vec_IntSize(pThData->vLevel) )
+            break;
+        iStop = Abc_MinInt( iStart + JF_PAR_CHUNK, Vec_IntSize(pThData->vLevel) );
+        for ( i = iStart; i < iStop; i++ )
+        {
+            iObj = Vec_IntEntry( pThData->vLevel, i );
+            Vec_IntWriteEntry( &p->vCuts, iObj, Jf_ObjComputeCutsInt(p, Gia_ManObj(p->pGia, iObj), pThData->fEdge, &pThData->pMem, pThData->vTemp, pThData->CutCount) );
+            Vec_IntWriteEntry( pThData->vOwner, i, pThData->iThread );
+        }
+    }
+    return NULL;
+}
+void Jf_ManComputeCutsPar( Jf_Man_t * p, int fEdge )
+{
+    pthread_t WorkerThread[JF_PROC_MAX];
+    Jf_ThData_t ThData[JF_PROC_MAX];
+    pthread_mutex_t Mutex;
+    Vec_Wec_t * vLevels = Vec_WecAlloc( 100 );
+    Vec_Int_t * vObjLevs = Vec_IntStart( Gia_ManObjNum(p->pGia) );
+    Vec_Int_t * vLevel, * vOwner = Vec_IntAlloc( 1000 );
+    Gia_Obj_t * pObj;
+    int nProcs = Abc_MinInt( p->pPars->nProcNum, JF_PROC_MAX );
+    int i, k, c, iObj, iNext, Level, status, nDone = 0;
+    int * pCuts;
+    // collect the nodes by levels
+    Gia_ManForEachObj( p->pGia, pObj, i )
+    {
+        if ( Gia_ObjIsCi(pObj) )
+            Jf_ObjAssignCut( p, pObj );
+        else if ( Gia_ObjIsAnd(pObj) )
+        {
+            Level = Abc_MaxInt( Vec_IntEntry(vObjLevs, Gia_ObjFaninId0(pObj, i)), Vec_IntEntry(vObjLevs, Gia_ObjFaninId1(pObj, i)) );
+            Vec_IntWriteEntry( vObjLevs, i, Level + 1 );
+            Vec_WecPush( vLevels, Level, i );
+        }
+    }
+    Vec_IntFree( vObjLevs );
+    pthread_mutex_init( &Mutex, NULL );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].p       = p;
+        ThData[i].vOwner  = vOwner;
+        ThData[i].piNext  = &iNext;
+        ThData[i].pMutex  = &Mutex;
+        ThData[i].fEdge   = fEdge;
+        ThData[i].iThread = i;
+        ThData[i].vTemp   = Vec_IntAlloc( 1000 );
+        memset( ThData[i].CutCount, 0, sizeof(word) * 4 );
+        Vec_SetAlloc_( &ThData[i].pMem, 20 );
+    }
+    Vec_WecForEachLevel( vLevels, vLevel, k )
+    {
+        if ( Vec_IntSize(vLevel) == 0 )
+            continue;
+        Jf_ManUpdateCutNum( p, nDone, Gia_ManAndNum(p->pGia) - nDone );
+        nDone += Vec_IntSize(vLevel);
+        if ( Vec_IntSize(vLevel) < JF_PAR_MIN )
+        {
+            Vec_IntForEachEntry( vLevel, iObj, i )
+                Jf_ObjComputeCuts( p, Gia_ManObj(p->pGia, iObj), fEdge );
+            continue;
+        }
+        // compute the cuts of this level
+        iNext = 0;
+        Vec_IntFill( vOwner, Vec_IntSize(vLevel), -1 );
+        for ( i = 0; i < nProcs; i++ )
+        {
+            ThData[i].vLevel = vLevel;
+            status = pthread_create( WorkerThread + i, NULL, Jf_ManCutsWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+        }
+        for ( i = 0; i < nProcs; i++ )
+        {
+            status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+        }
+        // compact the cuts into the shared memory
+        Vec_IntForEachEntry( vLevel, iObj, i )
+        {
+            pCuts = (int *)Vec_SetEntry( &ThData[Vec_IntEntry(vOwner, i)].pMem, Jf_ObjCutH(p, iObj) );
+            Vec_IntWriteEntry( &p->vCuts, iObj, Vec_SetAppend(&p->pMem, pCuts, Jf_ObjCutsSize(pCuts)) );
+        }
+        // collect the statistics, which are used by the memory budget
+        for ( i = 0; i < nProcs; i++ )
+        {
+            for ( c = 0; c < 4; c++ )
+                p->CutCount[c] += ThData[i].CutCount[c];
+            memset( ThData[i].CutCount, 0, sizeof(word) * 4 );
+            Vec_SetRestart( &ThData[i].pMem );
+        }
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        Vec_IntFree( ThData[i].vTemp );
+        Vec_SetFree_( &ThData[i].pMem );
+    }
+    pthread_mutex_destroy( &Mutex );
+    Vec_WecFree( vLevels );
+    Vec_IntFree( vOwner );
+}
+#else
+void Jf_ManComputeCutsPar( Jf_Man_t * p, int fEdge )
+{
+}
+#endif
 void Jf_ManComputeCuts( Jf_Man_t * p, int fEdge )
 {
-    Gia_Obj_t * pObj; int i;
+    Gia_Obj_t * pObj; int i, nDone = 0;
     if ( p->pPars->fVerbose )
     {
         printf( "Aig: CI = %d  CO = %d  AND = %d    ", Gia_ManCiNum(p->pGia), Gia_ManCoNum(p->pGia), Gia_ManAndNum(p->pGia) );
-        printf( "LutSize = %d  CutMax = %d  Rounds = %d\n", p->pPars->nLutSize, p->pPars->nCutNum, p->pPars->nRounds );
+        printf( "LutSize = %d  CutMax = %d  Rounds = %d  Threads = %d\n", p->pPars->nLutSize, p->pPars->nCutNum, p->pPars->nRounds, Jf_ManUseThreads(p) ? Abc_MinInt(p->pPars->nProcNum, JF_PROC_MAX) : 1 );
         printf( "Computing cuts...\r" );
         fflush( stdout );
     }
-    Gia_ManForEachObj( p->pGia, pObj, i )
+    if ( Jf_ManUseThreads(p) )
+        Jf_ManComputeCutsPar( p, fEdge );
+    else
     {
-        if ( Gia_ObjIsCi(pObj) || Gia_ObjIsBuf(pObj) )
-            Jf_ObjAssignCut( p, pObj );
-        if ( Gia_ObjIsBuf(pObj) )
-            Jf_ObjPropagateBuf( p, pObj, 0 );
-        else if ( Gia_ObjIsAnd(pObj) )
-            Jf_ObjComputeCuts( p, pObj, fEdge );
+        Gia_ManForEachObj( p->pGia, pObj, i )
+        {
+            if ( Gia_ObjIsCi(pObj) || Gia_ObjIsBuf(pObj) )
+                Jf_ObjAssignCut( p, pObj );
+            if ( Gia_ObjIsBuf(pObj) )
+                Jf_ObjPropagateBuf( p, pObj, 0 );
+            else if ( Gia_ObjIsAnd(pObj) )
+            {
+                if ( nDone % JF_MEM_STEP == 0 )
+                    Jf_ManUpdateCutNum( p, nDone, Gia_ManAndNum(p->pGia) - nDone );
+                nDone++;
+                Jf_ObjComputeCuts( p, pObj, fEdge );
+            }
+        }
     }
+    if ( p->pPars->nMemLimit && Vec_ReportMemory(&p->pMem) > (double)p->pPars->nMemLimit * (1 << 20) )
+        printf( "Warning: The cuts take %.2f MB, which exceeds the memory budget of %d MB.\n", Vec_ReportMemory(&p->pMem) / (1<<20), p->pPars->nMemLimit );
     if ( p->pPars->fVerbose )
     {
         printf( "CutPair = %lu  ", (long)p->CutCount[0] );
@@ -1685,6 +1916,7 @@ void Jf_ManSetDefaultPars( Jf_Par_t * pPars )
     pPars->nLutSize     =  6;
     pPars->nCutNum      =  8;
     pPars->nRounds      =  1;
+    pPars->nProcNum     =  1;
     pPars->nVerbLimit   =  5;
     pPars->DelayTarget  = -1;
     pPars->fAreaOnly    =  1;
@@ -1698,6 +1930,7 @@ void Jf_ManSetDefaultPars( Jf_Par_t * pPars )
     pPars->fVeryVerbose =  0;
     pPars->nLutSizeMax  =  JF_LEAF_MAX;
     pPars->nCutNumMax   =  JF_CUT_MAX;
+    pPars->nProcNumMax  =  JF_PROC_MAX;
 }
 void Jf_ManPrintStats( Jf_Man_t * p, char * pTitle )
 {
@@ -1924,6 +1924,78 @@ Gia_Man_t * Lf_ManDeriveMappingGia( Lf_Man_t * p )
     return pNew;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Reduces the number of cuts to stay within the memory budget.]
+
+  Description [The cutsets are only kept for the nodes on the frontier, 
+  while two cuts are stored for each node in the current and previous 
+  iteration. Estimates the max frontier by traversing the nodes in the 
+  order of mapping and reduces the number of cuts per node until the 
+  memory of the cutsets and the stored cuts fits into the budget.
+  The number of cuts does not go below two. The budget is best-effort:
+  a warning is printed if even two cuts per node do not fit.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Lf_ObjCollectFanins( Gia_Man_t * pGia, int i, int * pFanins )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( pGia, i );
+    int nFanins = 0;
+    pFanins[nFanins++] = Gia_ObjFaninId0(pObj, i);
+    pFanins[nFanins++] = Gia_ObjFaninId1(pObj, i);
+    if ( Gia_ObjIsMuxId(pGia, i) )
+        pFanins[nFanins++] = Gia_ObjFaninId2(pGia, i);
+    if ( Gia_ObjSibl(pGia, i) )
+        pFanins[nFanins++] = Gia_ObjSibl(pGia, i);
+    return nFanins;
+}
+void Lf_ManFitMemLimit( Gia_Man_t * pGia, Jf_Par_t * pPars, int nCutWords )
+{
+    Vec_Int_t * vRefs = Vec_IntStart( Gia_ManObjNum(pGia) );
+    Gia_Obj_t * pObj;
+    double Budget = (double)pPars->nMemLimit * (1 << 20), Fixed;
+    int i, k, nFanins, pFanins[4], nFront = 0, nFrontMax = 0, nSets, nCutNum = pPars->nCutNum;
+    Gia_ManForEachAnd( pGia, pObj, i )
+    {
+        if ( Gia_ObjIsBuf(pObj) )
+            continue;
+        nFanins = Lf_ObjCollectFanins( pGia, i, pFanins );
+        for ( k = 0; k < nFanins; k++ )
+            if ( Gia_ObjIsAndNotBuf(Gia_ManObj(pGia, pFanins[k])) )
+                Vec_IntAddToEntry( vRefs, pFanins[k], 1 );
+    }
+    Gia_ManForEachAnd( pGia, pObj, i )
+    {
+        if ( Gia_ObjIsBuf(pObj) )
+            continue;
+        nFanins = Lf_ObjCollectFanins( pGia, i, pFanins );
+        for ( k = 0; k < nFanins; k++ )
+            if ( Gia_ObjIsAndNotBuf(Gia_ManObj(pGia, pFanins[k])) && Vec_IntAddToEntry(vRefs, pFanins[k], -1) == 0 )
+                nFront--;
+        if ( Vec_IntEntry(vRefs, i) > 0 )
+            nFrontMax = Abc_MaxInt( nFrontMax, ++nFront );
+    }
+    Vec_IntFree( vRefs );
+    // the best cuts and two compressed cuts stored for each node in two iterations
+    Fixed  = (double)Gia_ManAndNotBufNum(pGia) * (sizeof(Lf_Bst_t) + 4 * (pPars->nLutSize + 2));
+    // the cutsets are allocated in pages
+    nSets  = ((nFrontMax >> LF_LOG_PAGE) + 1) << LF_LOG_PAGE;
+    while ( nCutNum > 2 && Fixed + (double)nSets * sizeof(word) * nCutWords * nCutNum > Budget )
+        nCutNum--;
+    if ( Fixed + (double)nSets * sizeof(word) * nCutWords * nCutNum > Budget )
+        printf( "Warning: The cuts are expected to take %.2f MB, which exceeds the memory budget of %d MB.\n", 
+            (Fixed + (double)nSets * sizeof(word) * nCutWords * nCutNum) / (1 << 20), pPars->nMemLimit );
+    if ( nCutNum == pPars->nCutNum )
+        return;
+    if ( pPars->fVerbose )
+        printf( "Memory budget %d MB: reducing the cut limit from %d to %d (frontier = %d nodes).\n", pPars->nMemLimit, pPars->nCutNum, nCutNum, nFrontMax );
+    pPars->nCutNum = nCutNum;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -1940,6 +2012,8 @@ Lf_Man_t * Lf_ManAlloc( Gia_Man_t * pGia, Jf_Par_t * pPars )
     Lf_Man_t * p; int i, k = 0;
     assert( pPars->nCutNum > 1  && pPars->nCutNum <= LF_CUT_MAX );
     assert( pPars->nLutSize > 1 && pPars->nLutSize <= LF_LEAF_MAX );
+    if ( pPars->nMemLimit )
+        Lf_ManFitMemLimit( pGia, pPars, (sizeof(Lf_Cut_t)/sizeof(int) + pPars->nLutSize + 1) >> 1 );
     ABC_FREE( pGia->pRefs );
     Vec_IntFreeP( &pGia->vMapping );
     Gia_ManCleanValue( pGia );
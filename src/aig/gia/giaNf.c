@@ -37,6 +37,16 @@
 #  define __builtin_popcount __popcnt
 #endif
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -48,6 +58,14 @@ ABC_NAMESPACE_IMPL_START
 #define NF_NO_LEAF  31
 #define NF_NO_FUNC  0x3FFFFFF
 #define NF_EPSILON  0.001
+#define NF_PROC_MAX 64              // the max number of threads
+#define NF_PAR_MIN  64              // the smallest level processed by several threads
+#define NF_PAR_CHUNK 16             // the number of nodes taken by a thread at a time
+#define NF_TT_BLOCK 1024            // the number of new truth tables numbered by a thread at a time
+
+#define NF_LIB_MAGIC   0x4D464E41   // "ANFM"
+#define NF_LIB_VERSION 2            // should be incremented when Nf_Cfg_t or the matching changes
+#define NF_LIB_HEADER  4            // the number of ints in the payload header
 
 typedef struct Nf_Cut_t_ Nf_Cut_t; 
 struct Nf_Cut_t_
@@ -83,6 +101,15 @@ struct Nf_Obj_t_
 {
     Nf_Mat_t        M[2][2];         // del/area (2x)
 };
+typedef struct Nf_Thr_t_ Nf_Thr_t; 
+struct Nf_Thr_t_
+{
+    int             iCur;           // current position in the cut memory
+    double          CutCount[6];    // cut counts
+    int             nCutUseAll;     // objects with useful cuts
+    Vec_Mem_t *     vTtNew;         // truth tables not in the shared table (parallel levels only)
+    Vec_Int_t *     vTtBlocks;      // the numbers reserved for them, one block at a time
+};
 typedef struct Nf_Man_t_ Nf_Man_t; 
 struct Nf_Man_t_
 {
@@ -105,17 +132,20 @@ struct Nf_Man_t_
     Vec_Flt_t       vCutFlows;      // temporary cut area
     Vec_Int_t       vCutDelays;     // temporary cut delay
     Vec_Int_t       vBackup;        // backup literals
-    int             iCur;           // current position
     int             Iter;           // mapping iterations
     int             fUseEla;        // use exact area
     int             nInvs;          // the inverter count
     int             InvDelayI;      // inverter delay
     word            InvAreaW;       // inverter delay
     float           InvAreaF;       // inverter area 
+    // parallel computation
+    Vec_Wec_t *     vLevels;        // internal nodes by level
+    void *          pMutex;         // protects cut memory and the numbers of new truth tables
+    int             nTtShared;      // the number of truth tables when the level started
+    int             nTtReserved;    // the numbers reserved for new truth tables of the level
     // statistics
     abctime         clkStart;       // starting time
-    double          CutCount[6];    // cut counts
-    int             nCutUseAll;     // objects with useful cuts
+    Nf_Thr_t        Thr;            // cut computation data
 };
 
 static inline int          Nf_Cfg2Int( Nf_Cfg_t Mat )                                { union { int x; Nf_Cfg_t y; } v; v.y = Mat; return v.x;           }
@@ -161,6 +191,14 @@ static inline int          Nf_CfgCompl( Nf_Cfg_t Cfg, int i )
 #define Nf_CutForEachVarCompl( pCut, Cfg, iVar, fCompl, i )  for ( i = 0; i < Nf_CutSize(pCut) && (iVar = Nf_CutLeaves(pCut)[Nf_CfgVar(Cfg, i)]) && ((fCompl = Nf_CfgCompl(Cfg, i)), 1); i++ )
 #define Nf_CfgForEachVarCompl( Cfg, Size, iVar, fCompl, i )  for ( i = 0; i < Size && ((iVar = Nf_CfgVar(Cfg, i)), 1) && ((fCompl = Nf_CfgCompl(Cfg, i)), 1); i++ )
 
+#ifdef ABC_USE_PTHREADS
+static inline void         Nf_ManLock( Nf_Man_t * p )                                { if ( p->pMutex ) pthread_mutex_lock( (pthread_mutex_t *)p->pMutex );   }
+static inline void         Nf_ManUnlock( Nf_Man_t * p )                              { if ( p->pMutex ) pthread_mutex_unlock( (pthread_mutex_t *)p->pMutex ); }
+#else
+static inline void         Nf_ManLock( Nf_Man_t * p )                                {}
+static inline void         Nf_ManUnlock( Nf_Man_t * p )                              {}
+#endif
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -285,6 +323,179 @@ void Nf_StoCreateGateMaches( Vec_Mem_t * vTtMem, Vec_Wec_t * vTt2Match, Mio_Cell
     }
     assert( tTemp1 == tCur );
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the content hash of the library cells.]
+
+  Description [The hash covers everything the matches depend on: the
+  gate names, functions, areas, pin delays, and the matching flags.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+word Nf_StoLibraryHash( Mio_Cell2_t * pCells, int nCells, int fPinFilter, int fPinPerm, int fPinQuick )
+{
+    word Hash = Abc_CacheHashWord( NF_LIB_VERSION, (fPinFilter << 2) | (fPinPerm << 1) | fPinQuick );
+    int i, k;
+    Hash = Abc_CacheHashWord( Hash, nCells );
+    for ( i = 0; i < nCells; i++ )
+    {
+        Mio_Cell2_t * pCell = pCells + i;
+        for ( k = 0; pCell->pName && pCell->pName[k]; k++ )
+            Hash = Abc_CacheHashWord( Hash, (word)(unsigned char)pCell->pName[k] );
+        Hash = Abc_CacheHashWord( Hash, ((word)pCell->Id << 8) | (pCell->Type << 4) | pCell->nFanins );
+        Hash = Abc_CacheHashWord( Hash, (word)(unsigned)Abc_Float2Int(pCell->AreaF) );
+        Hash = Abc_CacheHashWord( Hash, pCell->uTruth );
+        for ( k = 0; k < (int)pCell->nFanins; k++ )
+            Hash = Abc_CacheHashWord( Hash, (word)(unsigned)pCell->iDelays[k] );
+    }
+    return Hash;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks the precompiled matches before they are loaded.]
+
+  Description [The truth tables should be distinct and normalized, the
+  match lists should add up to the number of ints, and each match should
+  refer to a library cell and permute only its inputs.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Nf_StoCacheCheck( word * pTruths, int nFuncs, int * pSizes, int * pMatches, int nInts, Mio_Cell2_t * pCells, int nCells )
+{
+    Vec_Wrd_t * vTruths;
+    Nf_Cfg_t Cfg;
+    int i, k, v, nTotal = 0, RetValue;
+    for ( i = 0; i < nFuncs; i++ )
+    {
+        if ( (pTruths[i] & 1) || pSizes[i] < 0 || pSizes[i] % 2 || pSizes[i] > nInts - nTotal )
+            return 0;
+        nTotal += pSizes[i];
+    }
+    if ( nTotal != nInts )
+        return 0;
+    for ( k = 0; k < nInts; k += 2 )
+    {
+        if ( pMatches[k] < 0 || pMatches[k] >= nCells )
+            return 0;
+        Cfg = Nf_Int2Cfg( pMatches[k+1] );
+        if ( Cfg.Phase >> pCells[pMatches[k]].nFanins )
+            return 0;
+        for ( v = 0; v < NF_LEAF_MAX; v++ )
+            if ( ((Cfg.Perm >> (v << 2)) & 15) >= Abc_MaxInt(1, (int)pCells[pMatches[k]].nFanins) )
+                return 0;
+    }
+    vTruths = Vec_WrdAllocArrayCopy( pTruths, nFuncs );
+    Vec_WrdUniqify( vTruths );
+    RetValue = Vec_WrdSize(vTruths) == nFuncs;
+    Vec_WrdFree( vTruths );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads precompiled matches for the library.]
+
+  Description [The entry of the cache directory (see Abc_CacheMap()) is
+  found by the content hash of the library. The payload has the header
+  (the number of cells, functions, and match ints), the truth tables,
+  the number of match ints of each function, and the matches. The truth
+  tables are inserted into vTtMem in the original order, so the function
+  IDs are the same as after derivation. Returns 0 if there is no usable
+  entry.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Nf_StoCacheRead( Vec_Mem_t * vTtMem, Vec_Wec_t * vTt2Match, Mio_Cell2_t * pCells, int nCells, word Hash )
+{
+    int * pData, * pSizes, * pMatches;
+    word * pTruths;
+    int i, k, nFuncs, nInts, nStart = Vec_MemEntryNum(vTtMem);
+    size_t nSize;
+    pData = (int *)Abc_CacheMap( (char *)"nfm", NF_LIB_MAGIC, NF_LIB_VERSION, Hash, &nSize );
+    if ( pData == NULL )
+        return 0;
+    if ( nSize < NF_LIB_HEADER * sizeof(int) || pData[0] != nCells ||
+         (nFuncs = pData[1]) < nStart || (nInts = pData[2]) < 0 || nInts % 2 ||
+         nSize != sizeof(int) * ((size_t)NF_LIB_HEADER + 3 * (size_t)nFuncs + (size_t)nInts) )
+    {
+        Abc_CacheUnmap( pData, nSize );
+        return 0;
+    }
+    // the payload header is 16 bytes, so the truth tables are aligned
+    pTruths  = (word *)(pData + NF_LIB_HEADER);
+    pSizes   = pData + NF_LIB_HEADER + 2 * nFuncs;
+    pMatches = pSizes + nFuncs;
+    for ( i = 0; i < nStart; i++ )
+        if ( *Vec_MemReadEntry(vTtMem, i) != pTruths[i] )
+            break;
+    if ( i < nStart || !Nf_StoCacheCheck(pTruths, nFuncs, pSizes, pMatches, nInts, pCells, nCells) )
+    {
+        Abc_CacheUnmap( pData, nSize );
+        return 0;
+    }
+    for ( i = nStart; i < nFuncs; i++ )
+    {
+        Vec_MemHashInsert( vTtMem, pTruths + i );
+        assert( Vec_MemEntryNum(vTtMem) == i + 1 );
+    }
+    for ( i = 0; i < nFuncs; i++ )
+    {
+        Vec_Int_t * vArray = i < Vec_WecSize(vTt2Match) ? Vec_WecEntry(vTt2Match, i) : Vec_WecPushLevel(vTt2Match);
+        Vec_IntGrow( vArray, pSizes[i] );
+        for ( k = 0; k < pSizes[i]; k++ )
+            Vec_IntPush( vArray, *pMatches++ );
+    }
+    assert( pMatches == pData + nSize / sizeof(int) );
+    Abc_CacheUnmap( pData, nSize );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Saves precompiled matches for the library.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Nf_StoCacheWrite( Vec_Mem_t * vTtMem, Vec_Wec_t * vTt2Match, int nCells, word Hash )
+{
+    Vec_Int_t * vData, * vArray;
+    int i, nFuncs = Vec_MemEntryNum(vTtMem);
+    assert( Vec_WecSize(vTt2Match) == nFuncs );
+    vData = Vec_IntAlloc( NF_LIB_HEADER + 3 * nFuncs + Vec_WecSizeSize(vTt2Match) );
+    Vec_IntPush( vData, nCells );
+    Vec_IntPush( vData, nFuncs );
+    Vec_IntPush( vData, Vec_WecSizeSize(vTt2Match) );
+    Vec_IntPush( vData, 0 );
+    assert( Vec_IntSize(vData) == NF_LIB_HEADER );
+    for ( i = 0; i < nFuncs; i++ )
+    {
+        word uTruth = *Vec_MemReadEntry( vTtMem, i );
+        Vec_IntPush( vData, (int)(unsigned)uTruth );
+        Vec_IntPush( vData, (int)(unsigned)(uTruth >> 32) );
+    }
+    Vec_WecForEachLevel( vTt2Match, vArray, i )
+        Vec_IntPush( vData, Vec_IntSize(vArray) );
+    Vec_WecForEachLevel( vTt2Match, vArray, i )
+        Vec_IntAppend( vData, vArray );
+    Abc_CacheWrite( (char *)"nfm", NF_LIB_MAGIC, NF_LIB_VERSION, Hash, Vec_IntArray(vData), sizeof(int) * Vec_IntSize(vData) );
+    Vec_IntFree( vData );
+}
 Mio_Cell2_t * Nf_StoDeriveMatches( Vec_Mem_t * vTtMem, Vec_Wec_t * vTt2Match, int * pnCells, int fPinFilter, int fPinPerm, int fPinQuick )
 {
     int fVerbose = 0;
@@ -293,6 +504,7 @@ Mio_Cell2_t * Nf_StoDeriveMatches( Vec_Mem_t * vTtMem, Vec_Wec_t * vTt2Match, in
     Vec_Int_t * vStore = Vec_IntAlloc( 10000 );
     int * pComp[7], * pPerm[7], nPerms[7], i;
     Mio_Cell2_t * pCells;
+    word Hash = 0;
     Vec_WecPushLevel( vProfs );
     Vec_WecPushLevel( vProfs );
     for ( i = 1; i <= 6; i++ )
@@ -303,8 +515,13 @@ Mio_Cell2_t * Nf_StoDeriveMatches( Vec_Mem_t * vTtMem, Vec_Wec_t * vTt2Match, in
         nPerms[i] = Extra_Factorial( i );
     pCells = Mio_CollectRootsNewDefault2( 6, pnCells, fVerbose );
     if ( pCells != NULL )
-    for ( i = 2; i < *pnCells; i++ )
-        Nf_StoCreateGateMaches( vTtMem, vTt2Match, pCells+i, pComp, pPerm, nPerms, vProfs, vStore, fPinFilter, fPinPerm, fPinQuick );
+        Hash = Nf_StoLibraryHash( pCells, *pnCells, fPinFilter, fPinPerm, fPinQuick );
+    if ( pCells != NULL && !Nf_StoCacheRead( vTtMem, vTt2Match, pCells, *pnCells, Hash ) )
+    {
+        for ( i = 2; i < *pnCells; i++ )
+            Nf_StoCreateGateMaches( vTtMem, vTt2Match, pCells+i, pComp, pPerm, nPerms, vProfs, vStore, fPinFilter, fPinPerm, fPinQuick );
+        Nf_StoCacheWrite( vTtMem, vTt2Match, *pnCells, Hash );
+    }
     for ( i = 1; i <= 6; i++ )
         ABC_FREE( pComp[i] );
     for ( i = 1; i <= 6; i++ )
@@ -389,7 +606,7 @@ Nf_Man_t * Nf_StoCreate( Gia_Man_t * pGia, Jf_Par_t * pPars )
     p->pManTim  = (Tim_Man_t *)pGia->pManTime;
     p->pPars    = pPars;
     p->pNfObjs  = ABC_CALLOC( Nf_Obj_t, Gia_ManObjNum(pGia) );
-    p->iCur     = 2;
+    p->Thr.iCur = -1;
     // other
     Vec_PtrGrow( &p->vPages, 256 );                                    // cut memory
     Vec_IntFill( &p->vMapRefs,  2*Gia_ManObjNum(pGia), 0 );            // mapping refs   (2x)
@@ -424,6 +641,12 @@ void Nf_StoDelete( Nf_Man_t * p )
 {
     Vec_PtrFreeData( &p->vPages );
     ABC_FREE( p->vPages.pArray );
+    Vec_WecFreeP( &p->vLevels );
+#ifdef ABC_USE_PTHREADS
+    if ( p->pMutex )
+        pthread_mutex_destroy( (pthread_mutex_t *)p->pMutex );
+#endif
+    ABC_FREE( p->pMutex );
     ABC_FREE( p->vMapRefs.pArray );
     ABC_FREE( p->vFlowRefs.pArray );
     ABC_FREE( p->vRequired.pArray );
@@ -449,12 +672,33 @@ void Nf_StoDelete( Nf_Man_t * p )
   SeeAlso     []
 
 ***********************************************************************/
-static inline int Nf_CutComputeTruth6( Nf_Man_t * p, Nf_Cut_t * pCut0, Nf_Cut_t * pCut1, int fCompl0, int fCompl1, Nf_Cut_t * pCutR, int fIsXor )
+static inline int Nf_ManTruthInsert( Nf_Man_t * p, Nf_Thr_t * pThr, word * pTruth )
+{
+    int * pSpot, iEntry;
+    if ( pThr->vTtNew == NULL )
+        return Vec_MemHashInsert( p->vTtMem, pTruth );
+    // while the threads run, the shared table is only read, and the new truth
+    // tables are numbered after it until Nf_ManTruthMerge() adds them to it
+    pSpot = Vec_MemHashLookup( p->vTtMem, pTruth );
+    if ( *pSpot != -1 )
+        return *pSpot;
+    iEntry = Vec_MemHashInsert( pThr->vTtNew, pTruth );
+    if ( iEntry / NF_TT_BLOCK == Vec_IntSize(pThr->vTtBlocks) )
+    {
+        Nf_ManLock( p );
+        Vec_IntPush( pThr->vTtBlocks, p->nTtReserved );
+        p->nTtReserved += NF_TT_BLOCK;
+        assert( p->nTtShared + p->nTtReserved < (1 << 25) );
+        Nf_ManUnlock( p );
+    }
+    return p->nTtShared + Vec_IntEntry(pThr->vTtBlocks, iEntry / NF_TT_BLOCK) + iEntry % NF_TT_BLOCK;
+}
+static inline int Nf_CutComputeTruth6( Nf_Man_t * p, Nf_Thr_t * pThr, Nf_Cut_t * pCut0, Nf_Cut_t * pCut1, int fCompl0, int fCompl1, Nf_Cut_t * pCutR, int fIsXor )
 {
 //    extern int Nf_ManTruthCanonicize( word * t, int nVars );
-    int nOldSupp = pCutR->nLeaves, truthId, fCompl; word t;
-    word t0 = *Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCut0->iFunc));
-    word t1 = *Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCut1->iFunc));
+    int nOldSupp = pCutR->nLeaves, truthId, fCompl; word t, t0, t1;
+    t0 = *Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCut0->iFunc));
+    t1 = *Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCut1->iFunc));
     if ( Abc_LitIsCompl(pCut0->iFunc) ^ fCompl0 ) t0 = ~t0;
     if ( Abc_LitIsCompl(pCut1->iFunc) ^ fCompl1 ) t1 = ~t1;
     t0 = Abc_Tt6Expand( t0, pCut0->pLeaves, pCut0->nLeaves, pCutR->pLeaves, pCutR->nLeaves );
@@ -463,18 +707,18 @@ static inline int Nf_CutComputeTruth6( Nf_Man_t * p, Nf_Cut_t * pCut0, Nf_Cut_t
     if ( (fCompl = (int)(t & 1)) ) t = ~t;
     pCutR->nLeaves = Abc_Tt6MinBase( &t, pCutR->pLeaves, pCutR->nLeaves );
     assert( (int)(t & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, &t);
+    truthId        = Nf_ManTruthInsert(p, pThr, &t);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     pCutR->Useless = Nf_ObjCutUseless( p, truthId );
     assert( (int)pCutR->nLeaves <= nOldSupp );
     return (int)pCutR->nLeaves < nOldSupp;
 }
-static inline int Nf_CutComputeTruthMux6( Nf_Man_t * p, Nf_Cut_t * pCut0, Nf_Cut_t * pCut1, Nf_Cut_t * pCutC, int fCompl0, int fCompl1, int fComplC, Nf_Cut_t * pCutR )
+static inline int Nf_CutComputeTruthMux6( Nf_Man_t * p, Nf_Thr_t * pThr, Nf_Cut_t * pCut0, Nf_Cut_t * pCut1, Nf_Cut_t * pCutC, int fCompl0, int fCompl1, int fComplC, Nf_Cut_t * pCutR )
 {
-    int nOldSupp = pCutR->nLeaves, truthId, fCompl; word t;
-    word t0 = *Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCut0->iFunc));
-    word t1 = *Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCut1->iFunc));
-    word tC = *Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCutC->iFunc));
+    int nOldSupp = pCutR->nLeaves, truthId, fCompl; word t, t0, t1, tC;
+    t0 = *Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCut0->iFunc));
+    t1 = *Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCut1->iFunc));
+    tC = *Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCutC->iFunc));
     if ( Abc_LitIsCompl(pCut0->iFunc) ^ fCompl0 ) t0 = ~t0;
     if ( Abc_LitIsCompl(pCut1->iFunc) ^ fCompl1 ) t1 = ~t1;
     if ( Abc_LitIsCompl(pCutC->iFunc) ^ fComplC ) tC = ~tC;
@@ -485,7 +729,7 @@ static inline int Nf_CutComputeTruthMux6( Nf_Man_t * p, Nf_Cut_t * pCut0, Nf_Cut
     if ( (fCompl = (int)(t & 1)) ) t = ~t;
     pCutR->nLeaves = Abc_Tt6MinBase( &t, pCutR->pLeaves, pCutR->nLeaves );
     assert( (int)(t & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, &t);
+    truthId        = Nf_ManTruthInsert(p, pThr, &t);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     pCutR->Useless = Nf_ObjCutUseless( p, truthId );
     assert( (int)pCutR->nLeaves <= nOldSupp );
@@ -566,17 +810,25 @@ static inline int Nf_ManPrepareCuts( Nf_Cut_t * pCuts, Nf_Man_t * p, int iObj, i
     }
     return Nf_CutCreateUnit( pCuts, iObj );
 }
-static inline int Nf_ManSaveCuts( Nf_Man_t * p, Nf_Cut_t ** pCuts, int nCuts, int fUseful )
+static inline int Nf_ManStartPage( Nf_Man_t * p )
+{
+    int iPage;
+    Nf_ManLock( p );
+    assert( !p->pMutex || Vec_PtrSize(&p->vPages) < Vec_PtrCap(&p->vPages) );
+    iPage = Vec_PtrSize(&p->vPages);
+    Vec_PtrPush( &p->vPages, ABC_ALLOC(int, (1<<16)) );
+    Nf_ManUnlock( p );
+    return iPage ? iPage << 16 : 2;
+}
+static inline int Nf_ManSaveCuts( Nf_Man_t * p, Nf_Thr_t * pThr, Nf_Cut_t ** pCuts, int nCuts, int fUseful )
 {
     int i, * pPlace, iCur, nInts = 1, nCutsNew = 0;
     for ( i = 0; i < nCuts; i++ )
         if ( !fUseful || !pCuts[i]->Useless )
             nInts += pCuts[i]->nLeaves + 1, nCutsNew++;
-    if ( (p->iCur & 0xFFFF) + nInts > 0xFFFF )
-        p->iCur = ((p->iCur >> 16) + 1) << 16;
-    if ( Vec_PtrSize(&p->vPages) == (p->iCur >> 16) )
-        Vec_PtrPush( &p->vPages, ABC_ALLOC(int, (1<<16)) );
-    iCur = p->iCur; p->iCur += nInts;
+    if ( (pThr->iCur & 0xFFFF) + nInts > 0xFFFF )
+        pThr->iCur = Nf_ManStartPage( p );
+    iCur = pThr->iCur; pThr->iCur += nInts;
     pPlace = Nf_ManCutSet( p, iCur );
     *pPlace++ = nCutsNew;
     for ( i = 0; i < nCuts; i++ )
@@ -860,7 +1112,7 @@ static inline void Nf_CutParams( Nf_Man_t * p, Nf_Cut_t * pCut, float FlowRefs )
     pCut->Delay += (int)(nLeaves > 1);
     pCut->Flow = (pCut->Flow + Nf_CutArea(p, nLeaves)) / FlowRefs;
 }
-void Nf_ObjMergeOrder( Nf_Man_t * p, int iObj )
+void Nf_ObjMergeOrder( Nf_Man_t * p, Nf_Thr_t * pThr, int iObj )
 {
     Nf_Cut_t pCuts0[NF_CUT_MAX], pCuts1[NF_CUT_MAX], pCuts[NF_CUT_MAX], * pCutsR[NF_CUT_MAX];
     Gia_Obj_t * pObj = Gia_ManObj(p->pGia, iObj);
@@ -899,20 +1151,20 @@ void Nf_ObjMergeOrder( Nf_Man_t * p, int iObj )
         int nCuts2  = Nf_ManPrepareCuts(pCuts2, p, Gia_ObjFaninId2(p->pGia, iObj), 1);
         int fComp2  = Gia_ObjFaninC2(p->pGia, pObj);
         Nf_Cut_t * pCut2, * pCut2Lim = pCuts2 + nCuts2;
-        p->CutCount[0] += nCuts0 * nCuts1 * nCuts2;
+        pThr->CutCount[0] += nCuts0 * nCuts1 * nCuts2;
         for ( pCut0 = pCuts0; pCut0 < pCut0Lim; pCut0++ )
         for ( pCut1 = pCuts1; pCut1 < pCut1Lim; pCut1++ )
         for ( pCut2 = pCuts2; pCut2 < pCut2Lim; pCut2++ )
         {
             if ( Nf_CutCountBits(pCut0->Sign | pCut1->Sign | pCut2->Sign) > nLutSize )
                 continue;
-            p->CutCount[1]++; 
+            pThr->CutCount[1]++; 
             if ( !Nf_CutMergeOrderMux(pCut0, pCut1, pCut2, pCutsR[nCutsR], nLutSize) )
                 continue;
             if ( Nf_SetLastCutIsContained(pCutsR, nCutsR) )
                 continue;
-            p->CutCount[2]++;
-            if ( Nf_CutComputeTruthMux6(p, pCut0, pCut1, pCut2, fComp0, fComp1, fComp2, pCutsR[nCutsR]) )
+            pThr->CutCount[2]++;
+            if ( Nf_CutComputeTruthMux6(p, pThr, pCut0, pCut1, pCut2, fComp0, fComp1, fComp2, pCutsR[nCutsR]) )
                 pCutsR[nCutsR]->Sign = Nf_CutGetSign(pCutsR[nCutsR]->pLeaves, pCutsR[nCutsR]->nLeaves);
             Nf_CutParams( p, pCutsR[nCutsR], dFlowRefs );
             nCutsR = Nf_SetAddCut( pCutsR, nCutsR, nCutNum );
@@ -921,19 +1173,19 @@ void Nf_ObjMergeOrder( Nf_Man_t * p, int iObj )
     else
     {
         int fIsXor = Gia_ObjIsXor(pObj);
-        p->CutCount[0] += nCuts0 * nCuts1;
+        pThr->CutCount[0] += nCuts0 * nCuts1;
         for ( pCut0 = pCuts0; pCut0 < pCut0Lim; pCut0++ )
         for ( pCut1 = pCuts1; pCut1 < pCut1Lim; pCut1++ )
         {
             if ( (int)(pCut0->nLeaves + pCut1->nLeaves) > nLutSize && Nf_CutCountBits(pCut0->Sign | pCut1->Sign) > nLutSize )
                 continue;
-            p->CutCount[1]++; 
+            pThr->CutCount[1]++; 
             if ( !Nf_CutMergeOrder(pCut0, pCut1, pCutsR[nCutsR], nLutSize) )
                 continue;
             if ( Nf_SetLastCutIsContained(pCutsR, nCutsR) )
                 continue;
-            p->CutCount[2]++;
-            if ( Nf_CutComputeTruth6(p, pCut0, pCut1, fComp0, fComp1, pCutsR[nCutsR], fIsXor) )
+            pThr->CutCount[2]++;
+            if ( Nf_CutComputeTruth6(p, pThr, pCut0, pCut1, fComp0, fComp1, pCutsR[nCutsR], fIsXor) )
                 pCutsR[nCutsR]->Sign = Nf_CutGetSign(pCutsR[nCutsR]->pLeaves, pCutsR[nCutsR]->nLeaves);
             Nf_CutParams( p, pCutsR[nCutsR], dFlowRefs );
             nCutsR = Nf_SetAddCut( pCutsR, nCutsR, nCutNum );
@@ -955,12 +1207,12 @@ void Nf_ObjMergeOrder( Nf_Man_t * p, int iObj )
     // store the cutset
     Nf_ObjSetCutFlow( p, iObj, pCutsR[0]->Flow );
     Nf_ObjSetCutDelay( p, iObj, pCutsR[0]->Delay );
-    *Vec_IntEntryP(&p->vCutSets, iObj) = Nf_ManSaveCuts(p, pCutsR, nCutsR, 0);
-    p->CutCount[3] += nCutsR;
+    *Vec_IntEntryP(&p->vCutSets, iObj) = Nf_ManSaveCuts(p, pThr, pCutsR, nCutsR, 0);
+    pThr->CutCount[3] += nCutsR;
     nCutsUse = Nf_ManCountUseful(pCutsR, nCutsR);
-    p->CutCount[4] += nCutsUse;
-    p->nCutUseAll  += nCutsUse == nCutsR;
-    p->CutCount[5] += Nf_ManCountMatches(p, pCutsR, nCutsR);
+    pThr->CutCount[4] += nCutsUse;
+    pThr->nCutUseAll  += nCutsUse == nCutsR;
+    pThr->CutCount[5] += Nf_ManCountMatches(p, pCutsR, nCutsR);
 }
 void Nf_ManComputeCuts( Nf_Man_t * p )
 {
@@ -976,7 +1228,7 @@ void Nf_ManComputeCuts( Nf_Man_t * p )
             Nf_ObjSetCutDelay( p, i, Nf_ObjCutDelay(p, iFanin) );
         }
         else if ( Gia_ObjIsAnd(pObj) )
-            Nf_ObjMergeOrder( p, i );
+            Nf_ObjMergeOrder( p, &p->Thr, i );
         else if ( Gia_ObjIsCi(pObj) ) 
         {
             if ( fFirstCi ) {
@@ -1033,6 +1285,8 @@ void Nf_ManPrintInit( Nf_Man_t * p )
     printf( "CutNum = %d  ",  p->pPars->nCutNum );
     printf( "Iter = %d  ",    p->pPars->nRounds );//+ p->pPars->nRoundsEla );
     printf( "Coarse = %d   ", p->pPars->fCoarsen );
+    if ( p->vLevels )
+    printf( "Threads = %d  ", Abc_MinInt(p->pPars->nProcNum, NF_PROC_MAX) );
     printf( "Cells = %d  ",   p->nCells );
     printf( "Funcs = %d  ",   Vec_MemEntryNum(p->vTtMem) );
     printf( "Matches = %d  ", Vec_WecSizeSize(p->vTt2Match)/2 );
@@ -1050,17 +1304,17 @@ void Nf_ManPrintQuit( Nf_Man_t * p )
     float MemMan   =(1.0 * sizeof(Nf_Obj_t) + 8.0 * sizeof(int)) * Gia_ManObjNum(p->pGia) / (1<<20);
     float MemCuts  = 1.0 * sizeof(int) * (1 << 16) * Vec_PtrSize(&p->vPages) / (1<<20);
     float MemTt    = p->vTtMem ? Vec_MemMemory(p->vTtMem) / (1<<20) : 0;
-    if ( p->CutCount[0] == 0 )
-        p->CutCount[0] = 1;
+    if ( p->Thr.CutCount[0] == 0 )
+        p->Thr.CutCount[0] = 1;
     if ( !p->pPars->fVerbose )
         return;
-    printf( "CutPair = %.0f  ",         p->CutCount[0] );
-    printf( "Merge = %.0f (%.1f)  ",    p->CutCount[1], 1.0*p->CutCount[1]/Gia_ManAndNum(p->pGia) );
-    printf( "Eval = %.0f (%.1f)  ",     p->CutCount[2], 1.0*p->CutCount[2]/Gia_ManAndNum(p->pGia) );
-    printf( "Cut = %.0f (%.1f)  ",      p->CutCount[3], 1.0*p->CutCount[3]/Gia_ManAndNum(p->pGia) );
-    printf( "Use = %.0f (%.1f)  ",      p->CutCount[4], 1.0*p->CutCount[4]/Gia_ManAndNum(p->pGia) );
-    printf( "Mat = %.0f (%.1f)  ",      p->CutCount[5], 1.0*p->CutCount[5]/Gia_ManAndNum(p->pGia) );
-//    printf( "Equ = %d (%.2f %%)  ",     p->nCutUseAll,  100.0*p->nCutUseAll /p->CutCount[0] );
+    printf( "CutPair = %.0f  ",         p->Thr.CutCount[0] );
+    printf( "Merge = %.0f (%.1f)  ",    p->Thr.CutCount[1], 1.0*p->Thr.CutCount[1]/Gia_ManAndNum(p->pGia) );
+    printf( "Eval = %.0f (%.1f)  ",     p->Thr.CutCount[2], 1.0*p->Thr.CutCount[2]/Gia_ManAndNum(p->pGia) );
+    printf( "Cut = %.0f (%.1f)  ",      p->Thr.CutCount[3], 1.0*p->Thr.CutCount[3]/Gia_ManAndNum(p->pGia) );
+    printf( "Use = %.0f (%.1f)  ",      p->Thr.CutCount[4], 1.0*p->Thr.CutCount[4]/Gia_ManAndNum(p->pGia) );
+    printf( "Mat = %.0f (%.1f)  ",      p->Thr.CutCount[5], 1.0*p->Thr.CutCount[5]/Gia_ManAndNum(p->pGia) );
+//    printf( "Equ = %d (%.2f %%)  ",     p->Thr.nCutUseAll,  100.0*p->Thr.nCutUseAll /p->Thr.CutCount[0] );
     printf( "\n" );
     printf( "Gia = %.2f MB  ",          MemGia );
     printf( "Man = %.2f MB  ",          MemMan ); 
@@ -1443,6 +1697,225 @@ void Nf_ManComputeMapping( Nf_Man_t * p )
         }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Collects internal nodes by level for parallel mapping.]
+
+  Description [Sibling nodes are treated as fanins, so that the nodes
+  of the same level can be processed independently. Returns NULL if
+  the network contains boxes or buffers, which are handled in the
+  topological order by the serial mapper.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wec_t * Nf_ManLevelize( Nf_Man_t * p )
+{
+    Gia_Obj_t * pObj; 
+    Vec_Wec_t * vLevels;
+    Vec_Int_t * vLevel = Vec_IntStart( Gia_ManObjNum(p->pGia) );
+    int i, Level, LevelMax = 0;
+    Gia_ManForEachObjWithBoxes( p->pGia, pObj, i )
+    {
+        if ( !Gia_ObjIsAnd(pObj) || Gia_ObjIsBuf(pObj) )
+        {
+            Vec_IntFree( vLevel );
+            return NULL;
+        }
+        Level = Abc_MaxInt( Vec_IntEntry(vLevel, Gia_ObjFaninId0(pObj, i)), Vec_IntEntry(vLevel, Gia_ObjFaninId1(pObj, i)) );
+        if ( Gia_ObjIsMuxId(p->pGia, i) )
+            Level = Abc_MaxInt( Level, Vec_IntEntry(vLevel, Gia_ObjFaninId2(p->pGia, i)) );
+        if ( Gia_ObjSibl(p->pGia, i) )
+        {
+            assert( Gia_ObjSibl(p->pGia, i) < i );
+            Level = Abc_MaxInt( Level, Vec_IntEntry(vLevel, Gia_ObjSibl(p->pGia, i)) );
+        }
+        Vec_IntWriteEntry( vLevel, i, Level + 1 );
+        LevelMax = Abc_MaxInt( LevelMax, Level + 1 );
+    }
+    vLevels = Vec_WecStart( LevelMax );
+    Gia_ManForEachObjWithBoxes( p->pGia, pObj, i )
+        Vec_WecPush( vLevels, Vec_IntEntry(vLevel, i) - 1, i );
+    Vec_IntFree( vLevel );
+    return vLevels;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Processes internal nodes level by level using several threads.]
+
+  Description [Replaces Nf_ManComputeCuts() and Nf_ManComputeMapping()
+  when the network has no boxes and buffers. Each node depends only on 
+  the nodes of the lower levels, so the results do not depend on the order,
+  in which the nodes of the same level are processed, and are the same as
+  those of the serial mapper. While computing the cuts of a level, each
+  thread keeps the truth tables that are not in the shared table in its
+  own table. They are added to the shared table after the level, and the
+  functions of the cuts of the level are renumbered accordingly.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+typedef struct Nf_ThData_t_ Nf_ThData_t;
+struct Nf_ThData_t_
+{
+    Nf_Man_t *      p;              // mapping manager
+    Vec_Int_t *     vObjs;          // nodes of the current level
+    int *           piNext;         // the next node to process
+    pthread_mutex_t * pMutex;       // protects the next node
+    int             fMatch;         // performs matching instead of cut computation
+    Nf_Thr_t        Thr;            // cut computation data
+};
+void Nf_ManTruthMerge( Nf_Man_t * p, Nf_ThData_t * ThData, int nProcs, Vec_Int_t * vObjs )
+{
+    Vec_Int_t * vMap = Vec_IntStartFull( p->nTtReserved );
+    Vec_Mem_t * vTtNew;
+    int i, k, e, iObj, iFunc, * pList, * pCut;
+    for ( i = 0; i < nProcs; i++ )
+    {
+        vTtNew = ThData[i].Thr.vTtNew;
+        for ( e = 0; e < Vec_MemEntryNum(vTtNew); e++ )
+            Vec_IntWriteEntry( vMap, Vec_IntEntry(ThData[i].Thr.vTtBlocks, e / NF_TT_BLOCK) + e % NF_TT_BLOCK, Vec_MemHashInsert(p->vTtMem, Vec_MemReadEntry(vTtNew, e)) );
+        Vec_IntClear( ThData[i].Thr.vTtBlocks );
+        if ( Vec_MemEntryNum(vTtNew) == 0 )
+            continue;
+        // keeps the first page, which is not allocated before the first entry
+        Vec_MemShrink( vTtNew, 0 );
+        Vec_IntFill( vTtNew->vTable, Vec_IntSize(vTtNew->vTable), -1 );
+        Vec_IntClear( vTtNew->vNexts );
+    }
+    Vec_IntForEachEntry( vObjs, iObj, i )
+    {
+        pList = Nf_ObjCutSet( p, iObj );
+        Nf_SetForEachCut( pList, pCut, k )
+            if ( Abc_Lit2Var(iFunc = Nf_CutFunc(pCut)) >= p->nTtShared )
+                pCut[0] = Nf_CutSetBoth( Nf_CutSize(pCut), Abc_Var2Lit(Vec_IntEntry(vMap, Abc_Lit2Var(iFunc) - p->nTtShared), Abc_LitIsCompl(iFunc)) );
+    }
+    p->nTtReserved = 0;
+    Vec_IntFree( vMap );
+}
+void * Nf_ManWorkerThread( void * pArg )
+{
+    Nf_ThData_t * pThData = (Nf_ThData_t *)pArg;
+    int i, iStart, iStop;
+    while ( 1 )
+    {
+        pthread_mutex_lock( pThData->pMutex );
+        iStart = *pThData->piNext;
+        iStop  = Abc_MinInt( iStart + NF_PAR_CHUNK, Vec_IntSize(pThData->vObjs) );
+        *pThData->piNext = iStop;
+        pthread_mutex_unlock( pThData->pMutex );
+        if ( iStart >= iStop )
+            break;
+        for ( i = iStart; i < iStop; i++ )
+            if ( pThData->fMatch )
+                Nf_ManCutMatch( pThData->p, Vec_IntEntry(pThData->vObjs, i) );
+            else
+                Nf_ObjMergeOrder( pThData->p, &pThData->Thr, Vec_IntEntry(pThData->vObjs, i) );
+    }
+    return NULL;
+}
+void Nf_ManProcessLevels( Nf_Man_t * p, int fMatch )
+{
+    pthread_t WorkerThread[NF_PROC_MAX];
+    Nf_ThData_t ThData[NF_PROC_MAX];
+    pthread_mutex_t Mutex;
+    Vec_Int_t * vObjs;
+    int nProcs = Abc_MinInt( p->pPars->nProcNum, NF_PROC_MAX );
+    int i, k, iObj, iNext, status;
+    if ( p->pManTim )
+        Tim_ManIncrementTravId( p->pManTim );    
+    pthread_mutex_init( &Mutex, NULL );
+    memset( ThData, 0, sizeof(Nf_ThData_t) * nProcs );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].p        = p;
+        ThData[i].piNext   = &iNext;
+        ThData[i].pMutex   = &Mutex;
+        ThData[i].fMatch   = fMatch;
+        ThData[i].Thr.iCur = -1;
+    }
+    if ( !fMatch )
+        for ( i = 0; i < nProcs; i++ )
+        {
+            ThData[i].Thr.vTtNew = Vec_MemAlloc( 1, 12 );
+            Vec_MemHashAlloc( ThData[i].Thr.vTtNew, 1 << 12 );
+            ThData[i].Thr.vTtBlocks = Vec_IntAlloc( 16 );
+        }
+    Vec_WecForEachLevel( p->vLevels, vObjs, k )
+    {
+        if ( Vec_IntSize(vObjs) < NF_PAR_MIN )
+        {
+            Vec_IntForEachEntry( vObjs, iObj, i )
+                if ( fMatch )
+                    Nf_ManCutMatch( p, iObj );
+                else
+                    Nf_ObjMergeOrder( p, &p->Thr, iObj );
+            continue;
+        }
+        iNext = 0;
+        p->nTtShared = Vec_MemEntryNum( p->vTtMem );
+        for ( i = 0; i < nProcs; i++ )
+        {
+            ThData[i].vObjs = vObjs;
+            status = pthread_create( WorkerThread + i, NULL, Nf_ManWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+        }
+        for ( i = 0; i < nProcs; i++ )
+        {
+            status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+        }
+        if ( !fMatch )
+            Nf_ManTruthMerge( p, ThData, nProcs, vObjs );
+    }
+    pthread_mutex_destroy( &Mutex );
+    if ( fMatch )
+        return;
+    for ( i = 0; i < nProcs; i++ )
+    {
+        Vec_MemHashFree( ThData[i].Thr.vTtNew );
+        Vec_MemFree( ThData[i].Thr.vTtNew );
+        Vec_IntFree( ThData[i].Thr.vTtBlocks );
+        for ( k = 0; k < 6; k++ )
+            p->Thr.CutCount[k] += ThData[i].Thr.CutCount[k];
+        p->Thr.nCutUseAll += ThData[i].Thr.nCutUseAll;
+    }
+}
+#else
+void Nf_ManProcessLevels( Nf_Man_t * p, int fMatch ) {}
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Prepares the manager for parallel mapping.]
+
+  Description [Leaves the manager unchanged if parallel mapping cannot
+  be used, either because the number of threads is less than two, or 
+  because the network has boxes or buffers.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Nf_ManStartParallel( Nf_Man_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    int nProcs = Abc_MinInt( p->pPars->nProcNum, NF_PROC_MAX );
+    int nIntsMax = 1 + (p->pPars->nCutNum - 1) * (p->pPars->nLutSize + 1);
+    double nInts = (double)nIntsMax * Gia_ManAndNum(p->pGia);
+    if ( nProcs < 2 || (p->vLevels = Nf_ManLevelize(p)) == NULL )
+        return;
+    // cut memory pages are never reallocated while the threads are running
+    Vec_PtrGrow( &p->vPages, (int)(nInts / (0xFFFF - nIntsMax)) + nProcs + 2 );
+    p->pMutex = ABC_ALLOC( pthread_mutex_t, 1 );
+    pthread_mutex_init( (pthread_mutex_t *)p->pMutex, NULL );
+#endif
+}
 
 /**Function*************************************************************
 
@@ -2440,6 +2913,7 @@ void Nf_ManSetDefaultPars( Jf_Par_t * pPars )
     pPars->fVeryVerbose =  0;
     pPars->nLutSizeMax  =  NF_LEAF_MAX;
     pPars->nCutNumMax   =  NF_CUT_MAX;
+    pPars->nProcNumMax  =  NF_PROC_MAX;
     pPars->MapDelayTarget = 0;
 }
 Gia_Man_t * Nf_ManPerformMappingInt( Gia_Man_t * pGia, Jf_Par_t * pPars )
@@ -2464,8 +2938,12 @@ Gia_Man_t * Nf_ManPerformMappingInt( Gia_Man_t * pGia, Jf_Par_t * pPars )
         printf( "Initial " );  Gia_ManPrintMuxStats( pGia );  printf( "\n" );
         printf( "Derived " );  Gia_ManPrintMuxStats( pCls );  printf( "\n" );
     }
+    Nf_ManStartParallel( p );
     Nf_ManPrintInit( p );
-    Nf_ManComputeCuts( p );
+    if ( p->vLevels )
+        Nf_ManProcessLevels( p, 0 );
+    else
+        Nf_ManComputeCuts( p );
     Nf_ManPrintQuit( p );
     if ( Scl_ConIsRunning() )
     {
@@ -2480,7 +2958,10 @@ Gia_Man_t * Nf_ManPerformMappingInt( Gia_Man_t * pGia, Jf_Par_t * pPars )
     }
     for ( p->Iter = 0; p->Iter < p->pPars->nRounds; p->Iter++ )
     {
-        Nf_ManComputeMapping( p );
+        if ( p->vLevels )
+            Nf_ManProcessLevels( p, 1 );
+        else
+            Nf_ManComputeMapping( p );
         Nf_ManSetMapRefs( p );
         Nf_ManPrintStats( p, (char *)(p->Iter ? "Area " : "Delay") );
     }
@@ -65,6 +65,8 @@ struct Saig_ParBbr_t_
     int         iFrame;       // explored up to this frame
 };
 
+typedef struct Saig_Ter_t_ Saig_Ter_t;
+
 
 ////////////////////////////////////////////////////////////////////////
 ///                      MACRO DEFINITIONS                           ///
@@ -87,6 +89,17 @@ static inline Aig_Obj_t *  Saig_ObjLoToLi( Aig_Man_t * p, Aig_Obj_t * pObj )  {
 static inline Aig_Obj_t *  Saig_ObjLiToLo( Aig_Man_t * p, Aig_Obj_t * pObj )  { assert(Saig_ObjIsLi(p, pObj)); return (Aig_Obj_t *)Vec_PtrEntry(p->vCis, Saig_ManPiNum(p)+Aig_ObjCioId(pObj)-Saig_ManPoNum(p));   }
 static inline int          Saig_ObjRegId( Aig_Man_t * p, Aig_Obj_t * pObj )   { if ( Saig_ObjIsLo(p, pObj) ) return Aig_ObjCioId(pObj)-Saig_ManPiNum(p); if ( Saig_ObjIsLi(p, pObj) ) return Aig_ObjCioId(pObj)-Saig_ManPoNum(p); else assert(0);  return -1; }
 
+// ternary values
+#define SAIG_TER_NON  0
+#define SAIG_TER_ZER  1
+#define SAIG_TER_ONE  2
+#define SAIG_TER_UND  3
+
+static inline int          Saig_TerNot( int Value )                           { return ((Value & 1) << 1) | ((Value >> 1) & 1);      }
+static inline int          Saig_TerNotCond( int Value, int fCompl )           { return fCompl ? Saig_TerNot(Value) : Value;          }
+static inline int          Saig_TerAnd( int Value0, int Value1 )              { return ((Value0 | Value1) & 1) | (Value0 & Value1 & 2); }
+static inline int          Saig_TerStateValue( word * pState, int nRegWords, int i ) { return (int)(((pState[i >> 6] >> (i & 63)) & 1) | (((pState[nRegWords + (i >> 6)] >> (i & 63)) & 1) << 1)); }
+
 // iterator over the primary inputs/outputs
 #define Saig_ManForEachPi( p, pObj, i )                                           \
     Vec_PtrForEachEntryStop( Aig_Obj_t *, p->vCis, pObj, i, Saig_ManPiNum(p) )
@@ -173,6 +186,19 @@ extern int               Saig_ManRetimeSteps( Aig_Man_t * p, int nSteps, int fFo
 extern void              Saig_ManReportUselessRegisters( Aig_Man_t * pAig );
 /*=== saigSimMv.c ==========================================================*/
 extern Vec_Ptr_t *       Saig_MvManSimulate( Aig_Man_t * pAig, int nFramesSymb, int nFramesSatur, int fVerbose, int fVeryVerbose );
+/*=== saigSimTer.c ==========================================================*/
+extern Saig_Ter_t *      Saig_TerStart( Aig_Man_t * pAig );
+extern void              Saig_TerStop( Saig_Ter_t * p );
+extern void              Saig_TerSimulateFrame( Saig_Ter_t * p, word * pState );
+extern int               Saig_TerObjValue( Saig_Ter_t * p, Aig_Obj_t * pObj );
+extern int               Saig_TerStateAdd( Saig_Ter_t * p );
+extern int               Saig_TerSimulateOne( Saig_Ter_t * p );
+extern int               Saig_TerSimulate( Saig_Ter_t * p, int nFramesMax );
+extern int               Saig_TerPrefix( Saig_Ter_t * p );
+extern int               Saig_TerCycle( Saig_Ter_t * p );
+extern word *            Saig_TerState( Saig_Ter_t * p, int iFrame );
+extern int               Saig_TerStateCountBinary( Saig_Ter_t * p, word * pState );
+extern void              Saig_TerPrintStats( Saig_Ter_t * p );
 /*=== saigStrSim.c ==========================================================*/
 extern Vec_Int_t *       Saig_StrSimPerformMatching( Aig_Man_t * p0, Aig_Man_t * p1, int nDist, int fVerbose, Aig_Man_t ** ppMiter );
 /*=== saigSwitch.c ==========================================================*/
@@ -0,0 +1,529 @@
+/**CFile****************************************************************
+
+  FileName    [saigSimTer.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Sequential AIG package.]
+
+  Synopsis    [Ternary simulation with compact storage of states.]
+
+  Author      [LSV-PA contributors]
+  
+  Affiliation []
+
+  Date        [Ver. 1.0.]
+
+  Revision    [$Id: saigSimTer.c $]
+
+***********************************************************************/
+
+#include "saig.h"
+#include "misc/util/utilTruth.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+/*
+    Ternary values are kept in two bit-planes: the first plane has 1 if
+    the object can be 0, the second plane has 1 if the object can be 1.
+    The state of a frame (the values of the flops) is stored in the same
+    form, 64 flops per word. The nodes are evaluated 64 at a time: they
+    are placed into slots ordered by level, each level starting a new
+    word, so that the fanins of a word of nodes are in the earlier words.
+    The fanin values of a word are gathered bit by bit, then AND and
+    complementation are computed by word operations on both planes.
+    The flop outputs occupy the first words, so that a state is copied
+    in directly. Only the first state is stored in full.
+    For other frames, only the words that changed in comparison with
+    the previous frame are stored, with a full copy of the state saved
+    once in a while to bound the time of restoring a state.
+    Each new state is hashed and compared with the previous ones.
+    When it is found, the state sequence has reached its cycle, and
+    the simulation stops: the states of later frames repeat the cycle.
+*/
+
+#define SAIG_TER_CHECK  64   // the distance between full copies of states
+
+struct Saig_Ter_t_
+{
+    Aig_Man_t *      pAig;          // the AIG manager
+    int              nObjWords;     // the number of words in an object plane
+    int              nRegWords;     // the number of words in a state plane
+    int              nCiWords;      // the number of words used by the combinational inputs
+    int *            pPos;          // the slot of each object
+    Vec_Int_t *      vFanins;       // the fanin slots of the nodes (64 first and 64 second fanins per word)
+    Vec_Wrd_t *      vCompls;       // the fanin complements of the nodes (two words per word)
+    Vec_Int_t *      vLiFanins;     // the fanin slots of the flop inputs
+    Vec_Wrd_t *      vLiCompls;     // the fanin complements of the flop inputs
+    word *           pSims;         // simulation info of the slots (two planes interleaved by word)
+    word *           pState;        // the state of the last frame
+    word *           pTemp;         // the state of the last restored frame
+    int              iTemp;         // the last restored frame
+    int              nFrames;       // the number of simulated frames
+    int              nPrefix;       // the first frame on the cycle
+    int              nCycle;        // the length of the cycle (0 if not reached)
+    Vec_Wrd_t *      vSigns;        // signatures of the states
+    Vec_Int_t *      vStarts;       // the first delta of each frame
+    Vec_Wrd_t *      vDeltas;       // deltas (word number, change in plane 0, change in plane 1)
+    Vec_Wrd_t *      vChecks;       // full copies of the states
+    Vec_Int_t *      vBins;         // hash table for the states
+    Vec_Int_t *      vNexts;        // the next frame in the same bin
+};
+
+static inline int  Saig_TerSlotGet( word * pSims, int iPos )
+{
+    word * pSim = pSims + 2 * (iPos >> 6);
+    return (int)(((pSim[0] >> (iPos & 63)) & 1) | (((pSim[1] >> (iPos & 63)) & 1) << 1));
+}
+static inline void Saig_TerSlotSet( word * pSims, int iPos, int Value )
+{
+    word Mask = (word)1 << (iPos & 63);
+    word * pSim = pSims + 2 * (iPos >> 6);
+    pSim[0] ^= (pSim[0] ^ (~(word)0 * (word)(Value & 1))) & Mask;
+    pSim[1] ^= (pSim[1] ^ (~(word)0 * (word)(Value >> 1))) & Mask;
+}
+// collects the values of 64 slots into two words; complemented fanins exchange the planes
+static inline void Saig_TerSlotGather( word * pSims, int * pFans, word Compl, word * pRes0, word * pRes1 )
+{
+    word Res0 = 0, Res1 = 0, Swap, * pSim;
+    int k;
+    for ( k = 0; k < 64; k++ )
+    {
+        pSim  = pSims + 2 * (pFans[k] >> 6);
+        Res0 |= ((pSim[0] >> (pFans[k] & 63)) & 1) << k;
+        Res1 |= ((pSim[1] >> (pFans[k] & 63)) & 1) << k;
+    }
+    Swap   = (Res0 ^ Res1) & Compl;
+    *pRes0 = Res0 ^ Swap;
+    *pRes1 = Res1 ^ Swap;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Places the objects into slots.]
+
+  Description [The flop outputs come first, followed by the constant
+  and the primary inputs. The nodes follow by level. The unused slots
+  of the nodes and the flop inputs point to the constant.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Saig_TerSlotsStart( Saig_Ter_t * p )
+{
+    Aig_Man_t * pAig = p->pAig;
+    Vec_Int_t * vLevels = Vec_IntStart( Aig_ManObjNumMax(pAig) );
+    Vec_Int_t * vStarts;
+    Aig_Obj_t * pObj;
+    int i, iPos, iConst, Level, nLevels = 0, nWords;
+    p->pPos = ABC_FALLOC( int, Aig_ManObjNumMax(pAig) );
+    Saig_ManForEachLo( pAig, pObj, i )
+        p->pPos[Aig_ObjId(pObj)] = i;
+    iPos = iConst = 64 * p->nRegWords;
+    p->pPos[Aig_ObjId(Aig_ManConst1(pAig))] = iPos++;
+    Saig_ManForEachPi( pAig, pObj, i )
+        p->pPos[Aig_ObjId(pObj)] = iPos++;
+    p->nCiWords = Abc_Bit6WordNum( iPos );
+    // count the nodes on each level
+    Aig_ManForEachNode( pAig, pObj, i )
+    {
+        Level = 1 + Abc_MaxInt( Vec_IntEntry(vLevels, Aig_ObjFaninId0(pObj)), Vec_IntEntry(vLevels, Aig_ObjFaninId1(pObj)) );
+        Vec_IntWriteEntry( vLevels, i, Level );
+        nLevels = Abc_MaxInt( nLevels, Level );
+    }
+    vStarts = Vec_IntStart( nLevels + 1 );
+    Aig_ManForEachNode( pAig, pObj, i )
+        Vec_IntAddToEntry( vStarts, Vec_IntEntry(vLevels, i), 1 );
+    // each level starts a new word
+    nWords = p->nCiWords;
+    for ( Level = 1; Level <= nLevels; Level++ )
+    {
+        int nNodes = Vec_IntEntry( vStarts, Level );
+        Vec_IntWriteEntry( vStarts, Level, 64 * nWords );
+        nWords += Abc_Bit6WordNum( nNodes );
+    }
+    p->nObjWords = nWords;
+    Aig_ManForEachNode( pAig, pObj, i )
+    {
+        p->pPos[i] = Vec_IntEntry( vStarts, Vec_IntEntry(vLevels, i) );
+        Vec_IntAddToEntry( vStarts, Vec_IntEntry(vLevels, i), 1 );
+    }
+    // record the fanins of the nodes
+    p->vFanins = Vec_IntAlloc( 0 );
+    Vec_IntFill( p->vFanins, 128 * (p->nObjWords - p->nCiWords), iConst );
+    p->vCompls = Vec_WrdStart( 2 * (p->nObjWords - p->nCiWords) );
+    Aig_ManForEachNode( pAig, pObj, i )
+    {
+        int iSlot = p->pPos[i] - 64 * p->nCiWords, iWord = iSlot >> 6;
+        Vec_IntWriteEntry( p->vFanins, 128 * iWord + (iSlot & 63),      p->pPos[Aig_ObjFaninId0(pObj)] );
+        Vec_IntWriteEntry( p->vFanins, 128 * iWord + (iSlot & 63) + 64, p->pPos[Aig_ObjFaninId1(pObj)] );
+        if ( Aig_ObjFaninC0(pObj) )
+            Abc_TtSetBit( Vec_WrdEntryP(p->vCompls, 2 * iWord), iSlot & 63 );
+        if ( Aig_ObjFaninC1(pObj) )
+            Abc_TtSetBit( Vec_WrdEntryP(p->vCompls, 2 * iWord + 1), iSlot & 63 );
+    }
+    // record the fanins of the flop inputs
+    p->vLiFanins = Vec_IntAlloc( 0 );
+    Vec_IntFill( p->vLiFanins, 64 * p->nRegWords, iConst );
+    p->vLiCompls = Vec_WrdStart( p->nRegWords );
+    Saig_ManForEachLi( pAig, pObj, i )
+    {
+        Vec_IntWriteEntry( p->vLiFanins, i, p->pPos[Aig_ObjFaninId0(pObj)] );
+        if ( Aig_ObjFaninC0(pObj) )
+            Abc_TtSetBit( Vec_WrdArray(p->vLiCompls), i );
+    }
+    Vec_IntFree( vStarts );
+    Vec_IntFree( vLevels );
+    // the values of the constant and the primary inputs do not change
+    p->pSims = ABC_CALLOC( word, 2 * p->nObjWords );
+    Saig_TerSlotSet( p->pSims, iConst, SAIG_TER_ONE );
+    Saig_ManForEachPi( pAig, pObj, i )
+        Saig_TerSlotSet( p->pSims, p->pPos[Aig_ObjId(pObj)], SAIG_TER_UND );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the simulation manager.]
+
+  Description [The first state is the initial state of the AIG.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Saig_Ter_t * Saig_TerStart( Aig_Man_t * pAig )
+{
+    Saig_Ter_t * p;
+    int i;
+    p = ABC_CALLOC( Saig_Ter_t, 1 );
+    p->pAig      = pAig;
+    p->nRegWords = Abc_Bit6WordNum( Saig_ManRegNum(pAig) );
+    Saig_TerSlotsStart( p );
+    p->pState    = ABC_CALLOC( word, 2 * p->nRegWords );
+    p->pTemp     = ABC_CALLOC( word, 2 * p->nRegWords );
+    p->iTemp     = -1;
+    p->vSigns    = Vec_WrdAlloc( 100 );
+    p->vStarts   = Vec_IntAlloc( 100 );
+    p->vDeltas   = Vec_WrdAlloc( 100 );
+    p->vChecks   = Vec_WrdAlloc( 100 );
+    p->vBins     = Vec_IntStartFull( Abc_PrimeCudd(1000) );
+    p->vNexts    = Vec_IntAlloc( 100 );
+    // the flops are zero in the first frame
+    for ( i = 0; i < Saig_ManRegNum(pAig); i++ )
+        Abc_TtSetBit( p->pState, i );
+    Vec_IntPush( p->vStarts, 0 );
+    Saig_TerStateAdd( p );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the simulation manager.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Saig_TerStop( Saig_Ter_t * p )
+{
+    Vec_WrdFree( p->vSigns );
+    Vec_IntFree( p->vStarts );
+    Vec_WrdFree( p->vDeltas );
+    Vec_WrdFree( p->vChecks );
+    Vec_IntFree( p->vBins );
+    Vec_IntFree( p->vNexts );
+    Vec_IntFree( p->vFanins );
+    Vec_WrdFree( p->vCompls );
+    Vec_IntFree( p->vLiFanins );
+    Vec_WrdFree( p->vLiCompls );
+    ABC_FREE( p->pPos );
+    ABC_FREE( p->pSims );
+    ABC_FREE( p->pState );
+    ABC_FREE( p->pTemp );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates the objects in the given state.]
+
+  Description [Primary inputs are undefined. Results are stored in the
+  simulation info of the slots. The values of the combinational outputs
+  are read from their fanins.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Saig_TerSimulateFrame( Saig_Ter_t * p, word * pState )
+{
+    word * pSims = p->pSims, * pCompls = Vec_WrdArray(p->vCompls);
+    word Fan00, Fan01, Fan10, Fan11;
+    int * pFans = Vec_IntArray(p->vFanins);
+    int w;
+    for ( w = 0; w < p->nRegWords; w++ )
+    {
+        pSims[2*w]   = pState[w];
+        pSims[2*w+1] = pState[p->nRegWords + w];
+    }
+    for ( w = p->nCiWords; w < p->nObjWords; w++, pFans += 128, pCompls += 2 )
+    {
+        Saig_TerSlotGather( pSims, pFans,      pCompls[0], &Fan00, &Fan01 );
+        Saig_TerSlotGather( pSims, pFans + 64, pCompls[1], &Fan10, &Fan11 );
+        pSims[2*w]   = Fan00 | Fan10;
+        pSims[2*w+1] = Fan01 & Fan11;
+    }
+}
+int Saig_TerObjValue( Saig_Ter_t * p, Aig_Obj_t * pObj )
+{
+    if ( Aig_ObjIsCo(pObj) )
+        return Saig_TerNotCond( Saig_TerSlotGet(p->pSims, p->pPos[Aig_ObjFaninId0(pObj)]), Aig_ObjFaninC0(pObj) );
+    return Saig_TerSlotGet( p->pSims, p->pPos[Aig_ObjId(pObj)] );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Hashing and comparing states.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline word Saig_TerStateSign( word * pState, int nWords )
+{
+    word Sign = 0;
+    int i;
+    for ( i = 0; i < 2 * nWords; i++ )
+        Sign = (Sign ^ pState[i]) * ABC_CONST(0x9E3779B97F4A7C15) + (Sign >> 29);
+    return Sign;
+}
+static inline void Saig_TerTableResize( Saig_Ter_t * p )
+{
+    int i, * pBin;
+    Vec_IntFill( p->vBins, Abc_PrimeCudd(2 * Vec_IntSize(p->vBins)), -1 );
+    for ( i = 0; i < Vec_WrdSize(p->vSigns); i++ )
+    {
+        pBin = Vec_IntEntryP( p->vBins, (int)(Vec_WrdEntry(p->vSigns, i) % (word)Vec_IntSize(p->vBins)) );
+        Vec_IntWriteEntry( p->vNexts, i, *pBin );
+        *pBin = i;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the new state or detects the cycle.]
+
+  Description [Returns 1 if the state has been seen before.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Saig_TerStateAdd( Saig_Ter_t * p )
+{
+    word Sign = Saig_TerStateSign( p->pState, p->nRegWords );
+    word * pPrev, Xor0, Xor1;
+    int i, iFrame, * pBin;
+    // look for the state among the previous ones
+    pBin = Vec_IntEntryP( p->vBins, (int)(Sign % (word)Vec_IntSize(p->vBins)) );
+    for ( iFrame = *pBin; iFrame >= 0; iFrame = Vec_IntEntry(p->vNexts, iFrame) )
+    {
+        if ( Vec_WrdEntry(p->vSigns, iFrame) != Sign )
+            continue;
+        if ( !memcmp(Saig_TerState(p, iFrame), p->pState, sizeof(word) * 2 * p->nRegWords) )
+        {
+            p->nPrefix = iFrame;
+            p->nCycle  = p->nFrames - iFrame;
+            return 1;
+        }
+    }
+    // record the changes with respect to the previous state
+    if ( p->nFrames > 0 )
+    {
+        pPrev = Saig_TerState( p, p->nFrames - 1 );
+        for ( i = 0; i < p->nRegWords; i++ )
+        {
+            Xor0 = pPrev[i] ^ p->pState[i];
+            Xor1 = pPrev[p->nRegWords + i] ^ p->pState[p->nRegWords + i];
+            if ( !(Xor0 | Xor1) )
+                continue;
+            Vec_WrdPush( p->vDeltas, (word)i );
+            Vec_WrdPush( p->vDeltas, Xor0 );
+            Vec_WrdPush( p->vDeltas, Xor1 );
+        }
+    }
+    Vec_IntPush( p->vStarts, Vec_WrdSize(p->vDeltas) );
+    if ( p->nFrames % SAIG_TER_CHECK == 0 )
+        for ( i = 0; i < 2 * p->nRegWords; i++ )
+            Vec_WrdPush( p->vChecks, p->pState[i] );
+    // add the state to the table
+    Vec_WrdPush( p->vSigns, Sign );
+    Vec_IntPush( p->vNexts, *pBin );
+    *pBin = p->nFrames++;
+    if ( p->nFrames > 2 * Vec_IntSize(p->vBins) )
+        Saig_TerTableResize( p );
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates one more frame.]
+
+  Description [Returns 0 if the cycle of the state sequence is reached.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Saig_TerSimulateOne( Saig_Ter_t * p )
+{
+    int w, nRegs = Saig_ManRegNum(p->pAig);
+    if ( p->nCycle )
+        return 0;
+    Saig_TerSimulateFrame( p, p->pState );
+    for ( w = 0; w < p->nRegWords; w++ )
+        Saig_TerSlotGather( p->pSims, Vec_IntEntryP(p->vLiFanins, 64 * w), Vec_WrdEntry(p->vLiCompls, w), p->pState + w, p->pState + p->nRegWords + w );
+    // the unused bits of the state stay zero
+    if ( nRegs & 63 )
+    {
+        p->pState[p->nRegWords - 1]     &= Abc_Tt6Mask( nRegs & 63 );
+        p->pState[2 * p->nRegWords - 1] &= Abc_Tt6Mask( nRegs & 63 );
+    }
+    return !Saig_TerStateAdd( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates until the cycle is reached or the limit is exceeded.]
+
+  Description [Returns the number of different states.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Saig_TerSimulate( Saig_Ter_t * p, int nFramesMax )
+{
+    while ( p->nFrames < nFramesMax && Saig_TerSimulateOne(p) );
+    return p->nFrames;
+}
+int Saig_TerPrefix( Saig_Ter_t * p )
+{
+    return p->nCycle ? p->nPrefix : -1;
+}
+int Saig_TerCycle( Saig_Ter_t * p )
+{
+    return p->nCycle;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the state of the given frame.]
+
+  Description [Simulates more frames if needed. Frames beyond the cycle
+  are mapped into the cycle. The state is restored from the closest
+  full copy and the deltas following it. Without flops, no copies are
+  saved and the state is empty. The returned state is valid until the
+  next call.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+word * Saig_TerState( Saig_Ter_t * p, int iFrame )
+{
+    word * pDelta, * pStop;
+    int iCheck, f;
+    assert( iFrame >= 0 );
+    while ( iFrame >= p->nFrames && Saig_TerSimulateOne(p) );
+    if ( iFrame >= p->nFrames )
+        iFrame = p->nPrefix + (iFrame - p->nPrefix) % p->nCycle;
+    if ( iFrame == p->iTemp || p->nRegWords == 0 )
+        return p->pTemp;
+    // start from the full copy unless the restored frame is closer
+    iCheck = iFrame - iFrame % SAIG_TER_CHECK;
+    if ( p->iTemp > iFrame || p->iTemp < iCheck )
+    {
+        memcpy( p->pTemp, Vec_WrdEntryP(p->vChecks, 2 * p->nRegWords * (iCheck / SAIG_TER_CHECK)), sizeof(word) * 2 * p->nRegWords );
+        p->iTemp = iCheck;
+    }
+    for ( f = p->iTemp + 1; f <= iFrame; f++ )
+    {
+        pDelta = Vec_WrdArray(p->vDeltas) + Vec_IntEntry(p->vStarts, f);
+        pStop  = Vec_WrdArray(p->vDeltas) + Vec_IntEntry(p->vStarts, f+1);
+        for ( ; pDelta < pStop; pDelta += 3 )
+        {
+            p->pTemp[(int)pDelta[0]] ^= pDelta[1];
+            p->pTemp[p->nRegWords + (int)pDelta[0]] ^= pDelta[2];
+        }
+    }
+    p->iTemp = iFrame;
+    return p->pTemp;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Counts flops with binary values in the state.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Saig_TerStateCountBinary( Saig_Ter_t * p, word * pState )
+{
+    int i, Counter = 0;
+    for ( i = 0; i < p->nRegWords; i++ )
+        Counter += Abc_TtCountOnes( pState[i] ^ pState[p->nRegWords + i] );
+    return Counter;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints statistics of ternary simulation.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Saig_TerPrintStats( Saig_Ter_t * p )
+{
+    Abc_Print( 1, "Ternary states = %d. Prefix = %d. Cycle = %d. Deltas = %d. Memory = %.2f MB.\n",
+        p->nFrames, Saig_TerPrefix(p), p->nCycle, Vec_WrdSize(p->vDeltas) / 3,
+        1.0 * (Vec_WrdCap(p->vSigns) + Vec_WrdCap(p->vDeltas) + Vec_WrdCap(p->vChecks)) * sizeof(word) / (1<<20) );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -107,6 +107,15 @@ typedef enum {
     ABC_INIT_OTHER      // 4:  unused
 } Abc_InitType_t;
 
+// operators of the orchestration policy
+typedef enum { 
+    ABC_ORCH_RWR = 0,   // 0:  rewrite
+    ABC_ORCH_RES,       // 1:  resub
+    ABC_ORCH_REF,       // 2:  refactor
+    ABC_ORCH_NONE,      // 3:  no operator had gain
+    ABC_ORCH_NUM        // 4:  unused
+} Abc_OrchOp_t;
+
 ////////////////////////////////////////////////////////////////////////
 ///                         BASIC TYPES                              ///
 ////////////////////////////////////////////////////////////////////////
@@ -115,6 +124,7 @@ typedef struct Abc_Des_t_       Abc_Des_t;
 typedef struct Abc_Ntk_t_       Abc_Ntk_t;
 typedef struct Abc_Obj_t_       Abc_Obj_t;
 typedef struct Abc_Aig_t_       Abc_Aig_t;
+typedef struct Abc_Undo_t_      Abc_Undo_t;
 typedef struct Abc_ManTime_t_   Abc_ManTime_t;
 typedef struct Abc_ManCut_t_    Abc_ManCut_t;
 typedef struct Abc_Time_t_      Abc_Time_t;
@@ -215,6 +225,7 @@ struct Abc_Ntk_t_
     Vec_Int_t *       vNameIds;      // name IDs
     Vec_Int_t *       vFins;         // obj/type info
     Vec_Int_t *       vOrigNodeIds;  // original node IDs
+    Abc_Undo_t *      pUndo;         // undo log of the open checkpoint (for AIGs)
 };
 
 struct Abc_Des_t_ 
@@ -341,7 +352,8 @@ static inline Abc_Obj_t * Abc_ObjEquiv( Abc_Obj_t * pObj )           { return (A
 static inline Abc_Obj_t * Abc_ObjCopyCond( Abc_Obj_t * pObj )        { return Abc_ObjRegular(pObj)->pCopy? Abc_ObjNotCond(Abc_ObjRegular(pObj)->pCopy, Abc_ObjIsComplement(pObj)) : NULL;  }
 
 // setting data members of the network
-static inline void        Abc_ObjSetLevel( Abc_Obj_t * pObj, int Level )         { pObj->Level =  Level;    } 
+extern ABC_DLL void Abc_NtkUndoSaveObj( Abc_Obj_t * pObj );
+static inline void        Abc_ObjSetLevel( Abc_Obj_t * pObj, int Level )         { if ( pObj->pNtk->pUndo ) Abc_NtkUndoSaveObj( pObj ); pObj->Level = Level; }
 static inline void        Abc_ObjSetCopy( Abc_Obj_t * pObj, Abc_Obj_t * pCopy )  { pObj->pCopy =  pCopy;    } 
 static inline void        Abc_ObjSetData( Abc_Obj_t * pObj, void * pData )       { pObj->pData =  pData;    } 
 
@@ -380,8 +392,8 @@ static inline Abc_Obj_t * Abc_ObjFanout0Ntk( Abc_Obj_t * pObj )      { return (A
 static inline int         Abc_ObjFaninC0( Abc_Obj_t * pObj )         { return pObj->fCompl0;                                                }
 static inline int         Abc_ObjFaninC1( Abc_Obj_t * pObj )         { return pObj->fCompl1;                                                }
 static inline int         Abc_ObjFaninC( Abc_Obj_t * pObj, int i )   { assert( i >=0 && i < 2 ); return i? pObj->fCompl1 : pObj->fCompl0;   }
-static inline void        Abc_ObjSetFaninC( Abc_Obj_t * pObj, int i ){ assert( i >=0 && i < 2 ); if ( i ) pObj->fCompl1 = 1; else pObj->fCompl0 = 1; }
-static inline void        Abc_ObjXorFaninC( Abc_Obj_t * pObj, int i ){ assert( i >=0 && i < 2 ); if ( i ) pObj->fCompl1^= 1; else pObj->fCompl0^= 1; }
+static inline void        Abc_ObjSetFaninC( Abc_Obj_t * pObj, int i ){ assert( i >=0 && i < 2 ); if ( pObj->pNtk->pUndo ) Abc_NtkUndoSaveObj( pObj ); if ( i ) pObj->fCompl1 = 1; else pObj->fCompl0 = 1; }
+static inline void        Abc_ObjXorFaninC( Abc_Obj_t * pObj, int i ){ assert( i >=0 && i < 2 ); if ( pObj->pNtk->pUndo ) Abc_NtkUndoSaveObj( pObj ); if ( i ) pObj->fCompl1^= 1; else pObj->fCompl0^= 1; }
 static inline Abc_Obj_t * Abc_ObjChild( Abc_Obj_t * pObj, int i )    { return Abc_ObjNotCond( Abc_ObjFanin(pObj,i), Abc_ObjFaninC(pObj,i) );}
 static inline Abc_Obj_t * Abc_ObjChild0( Abc_Obj_t * pObj )          { return Abc_ObjNotCond( Abc_ObjFanin0(pObj), Abc_ObjFaninC0(pObj) );  }
 static inline Abc_Obj_t * Abc_ObjChild1( Abc_Obj_t * pObj )          { return Abc_ObjNotCond( Abc_ObjFanin1(pObj), Abc_ObjFaninC1(pObj) );  }
@@ -563,6 +575,9 @@ extern ABC_DLL Abc_Obj_t *        Abc_AigMiter( Abc_Aig_t * pMan, Vec_Ptr_t * vP
 extern ABC_DLL int                Abc_AigReplace( Abc_Aig_t * pMan, Abc_Obj_t * pOld, Abc_Obj_t * pNew, int  fUpdateLevel );
 extern ABC_DLL void               Abc_AigDeleteNode( Abc_Aig_t * pMan, Abc_Obj_t * pOld );
 extern ABC_DLL void               Abc_AigRehash( Abc_Aig_t * pMan );
+extern ABC_DLL void               Abc_AigAndInsert( Abc_Aig_t * pMan, Abc_Obj_t * pAnd );
+extern ABC_DLL void               Abc_AigAndDelete( Abc_Aig_t * pMan, Abc_Obj_t * pThis );
+extern ABC_DLL int                Abc_AigAndRemove( Abc_Aig_t * pMan, Abc_Obj_t * pThis );
 extern ABC_DLL int                Abc_AigNodeHasComplFanoutEdge( Abc_Obj_t * pNode );
 extern ABC_DLL int                Abc_AigNodeHasComplFanoutEdgeTrav( Abc_Obj_t * pNode );
 extern ABC_DLL void               Abc_AigPrintNode( Abc_Obj_t * pNode );
@@ -572,6 +587,8 @@ extern ABC_DLL void               Abc_AigSetNodePhases( Abc_Ntk_t * pNtk );
 extern ABC_DLL Vec_Ptr_t *        Abc_AigUpdateStart( Abc_Aig_t * pMan, Vec_Ptr_t ** pvUpdatedNets );
 extern ABC_DLL void               Abc_AigUpdateStop( Abc_Aig_t * pMan );
 extern ABC_DLL void               Abc_AigUpdateReset( Abc_Aig_t * pMan );
+extern ABC_DLL void               Abc_AigSetCheckLevels( Abc_Aig_t * pMan, int fCheck );
+extern ABC_DLL void               Abc_AigPrintCheckLevels( Abc_Aig_t * pMan );
 /*=== abcAttach.c ==========================================================*/
 extern ABC_DLL int                Abc_NtkAttach( Abc_Ntk_t * pNtk );
 /*=== abcBarBuf.c ==========================================================*/
@@ -676,6 +693,7 @@ extern ABC_DLL int                Abc_NtkBddToSop( Abc_Ntk_t * pNtk, int fMode,
 extern ABC_DLL void               Abc_NodeBddToCnf( Abc_Obj_t * pNode, Mem_Flex_t * pMmMan, Vec_Str_t * vCube, int fAllPrimes, char ** ppSop0, char ** ppSop1 );
 extern ABC_DLL void               Abc_NtkLogicMakeDirectSops( Abc_Ntk_t * pNtk );
 extern ABC_DLL int                Abc_NtkSopToAig( Abc_Ntk_t * pNtk );
+extern ABC_DLL Hop_Obj_t *        Abc_ConvertSopToAigMan( Hop_Man_t * pMan, void * pManDec, char * pSop );
 extern ABC_DLL int                Abc_NtkAigToBdd( Abc_Ntk_t * pNtk );
 extern ABC_DLL Gia_Man_t *        Abc_NtkAigToGia( Abc_Ntk_t * p, int fGiaSimple );
 extern ABC_DLL int                Abc_NtkMapToSopUsingLibrary( Abc_Ntk_t * pNtk, void* library );
@@ -832,6 +850,16 @@ extern ABC_DLL Odc_Man_t *        Abc_NtkDontCareAlloc( int nVarsMax, int nLevel
 extern ABC_DLL void               Abc_NtkDontCareClear( Odc_Man_t * p );
 extern ABC_DLL void               Abc_NtkDontCareFree( Odc_Man_t * p );
 extern ABC_DLL int                Abc_NtkDontCareCompute( Odc_Man_t * p, Abc_Obj_t * pNode, Vec_Ptr_t * vLeaves, unsigned * puTruth );
+/*=== abcOrchPolicy.c ==========================================================*/
+extern ABC_DLL void               Abc_OrchPolicyQuit();
+extern ABC_DLL int                Abc_OrchPolicyLoad( char * pFileName );
+extern ABC_DLL int                Abc_OrchPolicySave( char * pFileName );
+extern ABC_DLL void               Abc_OrchPolicyRunStart();
+extern ABC_DLL void               Abc_OrchPolicyRunPrint();
+extern ABC_DLL int                Abc_OrchPolicyClassify( Abc_Obj_t * pNode );
+extern ABC_DLL int                Abc_OrchPolicyPredict( int iClass, int nMinVisits );
+extern ABC_DLL void               Abc_OrchPolicyRecord( int iClass, int Op );
+extern ABC_DLL void               Abc_OrchPolicyPrint();
 /*=== abcPrint.c ==========================================================*/
 extern ABC_DLL float              Abc_NtkMfsTotalSwitching( Abc_Ntk_t * pNtk );
 extern ABC_DLL float              Abc_NtkMfsTotalGlitching( Abc_Ntk_t * pNtk, int nPats, int Prob, int fVerbose );
@@ -937,6 +965,7 @@ extern ABC_DLL void               Abc_SopToTruthBig( char * pSop, int nInputs, w
 extern ABC_DLL Abc_Ntk_t *        Abc_NtkRestrash( Abc_Ntk_t * pNtk, int fCleanup );
 extern ABC_DLL Abc_Ntk_t *        Abc_NtkRestrashZero( Abc_Ntk_t * pNtk, int fCleanup );
 extern ABC_DLL Abc_Ntk_t *        Abc_NtkStrash( Abc_Ntk_t * pNtk, int fAllNodes, int fCleanup, int fRecord );
+extern ABC_DLL Abc_Ntk_t *        Abc_NtkStrashPar( Abc_Ntk_t * pNtk, int fAllNodes, int fCleanup, int fRecord, int nProcs );
 extern ABC_DLL Abc_Obj_t *        Abc_NodeStrash( Abc_Ntk_t * pNtkNew, Abc_Obj_t * pNode, int fRecord );
 extern ABC_DLL int                Abc_NtkAppend( Abc_Ntk_t * pNtk1, Abc_Ntk_t * pNtk2, int fAddPos );
 extern ABC_DLL Abc_Ntk_t *        Abc_NtkTopmost( Abc_Ntk_t * pNtk, int nLevels );
@@ -990,6 +1019,19 @@ extern ABC_DLL void               Abc_NtkStopReverseLevels( Abc_Ntk_t * pNtk );
 extern ABC_DLL void               Abc_NtkUpdateLevel( Abc_Obj_t * pObjNew, Vec_Vec_t * vLevels );
 extern ABC_DLL void               Abc_NtkUpdateReverseLevel( Abc_Obj_t * pObjNew, Vec_Vec_t * vLevels );
 extern ABC_DLL void               Abc_NtkUpdate( Abc_Obj_t * pObj, Abc_Obj_t * pObjNew, Vec_Vec_t * vLevels );
+extern ABC_DLL int                Abc_NtkCheckLevels( Abc_Ntk_t * pNtk );
+/*=== abcUndo.c ==========================================================*/
+extern ABC_DLL void               Abc_NtkUndoStart( Abc_Ntk_t * pNtk );
+extern ABC_DLL void               Abc_NtkUndoStop( Abc_Ntk_t * pNtk );
+extern ABC_DLL int                Abc_NtkUndoRollback( Abc_Ntk_t * pNtk );
+extern ABC_DLL void               Abc_NtkUndoInvalidate( Abc_Ntk_t * pNtk );
+extern ABC_DLL int                Abc_NtkUndoIsValid( Abc_Ntk_t * pNtk );
+extern ABC_DLL int                Abc_NtkUndoObjIsOld( Abc_Obj_t * pObj );
+extern ABC_DLL void               Abc_NtkUndoSaveLevels( Abc_Ntk_t * pNtk );
+extern ABC_DLL void               Abc_NtkUndoSaveOrder( Abc_Ntk_t * pNtk );
+extern ABC_DLL void               Abc_NtkUndoSaveIds( Abc_Ntk_t * pNtk, Vec_Ptr_t * vObjsOld );
+extern ABC_DLL void               Abc_NtkUndoDeleteObj( Abc_Obj_t * pObj );
+extern ABC_DLL void               Abc_NtkUndoPrintStats( Abc_Ntk_t * pNtk );
 /*=== abcUtil.c ==========================================================*/
 extern ABC_DLL void *             Abc_NtkAttrFree( Abc_Ntk_t * pNtk, int Attr, int fFreeMan );
 extern ABC_DLL void               Abc_NtkOrderCisCos( Abc_Ntk_t * pNtk );
@@ -63,6 +63,9 @@ struct Abc_Aig_t_
     Vec_Vec_t *       vLevelsR;          // the nodes to be updated
     Vec_Ptr_t *       vAddedCells;       // the added nodes
     Vec_Ptr_t *       vUpdatedNets;      // the nodes whose fanouts have changed
+    int               fCheckLevels;      // verifies the levels after each replacement
+    int               nLevelChecks;      // the number of verified replacements
+    int               nLevelErrors;      // the number of incorrect levels found
 
     int               nStrash0;
     int               nStrash1;
@@ -100,7 +103,6 @@ static unsigned Abc_HashKey2( Abc_Obj_t * p0, Abc_Obj_t * p1, int TableSize )
 // structural hash table procedures
 static Abc_Obj_t * Abc_AigAndCreate( Abc_Aig_t * pMan, Abc_Obj_t * p0, Abc_Obj_t * p1 );
 static Abc_Obj_t * Abc_AigAndCreateFrom( Abc_Aig_t * pMan, Abc_Obj_t * p0, Abc_Obj_t * p1, Abc_Obj_t * pAnd );
-static void        Abc_AigAndDelete( Abc_Aig_t * pMan, Abc_Obj_t * pThis );
 static void        Abc_AigResize( Abc_Aig_t * pMan );
 // incremental AIG procedures
 static void        Abc_AigReplace_int( Abc_Aig_t * pMan, Abc_Obj_t * pOld, Abc_Obj_t * pNew, int fUpdateLevel );
@@ -541,15 +543,35 @@ Abc_Obj_t * Abc_AigMuxLookup( Abc_Aig_t * pMan, Abc_Obj_t * pC, Abc_Obj_t * pT,
 ***********************************************************************/
 void Abc_AigAndDelete( Abc_Aig_t * pMan, Abc_Obj_t * pThis )
 {
-    Abc_Obj_t * pAnd, * pAnd0, * pAnd1, ** ppPlace;
+    int RetValue = Abc_AigAndRemove( pMan, pThis );
+    assert( RetValue );
+    // delete the cuts if defined
+    if ( pThis->pNtk->pManCut )
+        Abc_NodeFreeCuts( pThis->pNtk->pManCut, pThis );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Removes an AIG node from the hash table if it is there.]
+
+  Description [Looks for the node under the key of its current fanins.
+  Returns 0 if the node is not found there, for example, when the
+  complemented attributes of its fanins were changed in place.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_AigAndRemove( Abc_Aig_t * pMan, Abc_Obj_t * pThis )
+{
+    Abc_Obj_t * pAnd, ** ppPlace;
     unsigned Key;
     assert( !Abc_ObjIsComplement(pThis) );
     assert( Abc_ObjIsNode(pThis) );
     assert( Abc_ObjFaninNum(pThis) == 2 );
     assert( pMan->pNtkAig == pThis->pNtk );
     // get the hash key for these two nodes
-    pAnd0 = Abc_ObjRegular( Abc_ObjChild0(pThis) );
-    pAnd1 = Abc_ObjRegular( Abc_ObjChild1(pThis) );
     Key = Abc_HashKey2( Abc_ObjChild0(pThis), Abc_ObjChild1(pThis), pMan->nBins );
     // find the matching node in the table
     ppPlace = pMan->pBins + Key;
@@ -561,13 +583,36 @@ void Abc_AigAndDelete( Abc_Aig_t * pMan, Abc_Obj_t * pThis )
             continue;
         }
         *ppPlace = pAnd->pNext;
-        break;
+        pMan->nEntries--;
+        return 1;
     }
-    assert( pAnd == pThis );
-    pMan->nEntries--;
-    // delete the cuts if defined
-    if ( pThis->pNtk->pManCut )
-        Abc_NodeFreeCuts( pThis->pNtk->pManCut, pThis );
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the existing AND node to the structural hashing table.]
+
+  Description [The node should not be in the table.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_AigAndInsert( Abc_Aig_t * pMan, Abc_Obj_t * pAnd )
+{
+    unsigned Key;
+    assert( !Abc_ObjIsComplement(pAnd) );
+    assert( Abc_ObjFaninNum(pAnd) == 2 );
+    assert( pMan->pNtkAig == pAnd->pNtk );
+    // check if it is a good time for table resizing
+    if ( pMan->nEntries > 2 * pMan->nBins )
+        Abc_AigResize( pMan );
+    Key = Abc_HashKey2( Abc_ObjChild0(pAnd), Abc_ObjChild1(pAnd), pMan->nBins );
+    pAnd->pNext      = pMan->pBins[Key];
+    pMan->pBins[Key] = pAnd;
+    pMan->nEntries++;
 }
 
 /**Function*************************************************************
@@ -869,10 +914,39 @@ int Abc_AigReplace( Abc_Aig_t * pMan, Abc_Obj_t * pOld, Abc_Obj_t * pNew, int fU
         Abc_AigUpdateLevel_int( pMan );
         if ( pMan->pNtkAig->vLevelsR ) 
             Abc_AigUpdateLevelR_int( pMan );
+        if ( pMan->fCheckLevels )
+        {
+            pMan->nLevelChecks++;
+            pMan->nLevelErrors += Abc_NtkCheckLevels( pMan->pNtkAig );
+        }
     }
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Enables verification of levels after each replacement.]
+
+  Description [This is a debugging mode, which compares the incrementally
+  updated levels with those recomputed from scratch, taking linear time
+  for each replacement.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_AigSetCheckLevels( Abc_Aig_t * pMan, int fCheck )
+{
+    pMan->fCheckLevels = fCheck;
+    pMan->nLevelChecks = 0;
+    pMan->nLevelErrors = 0;
+}
+void Abc_AigPrintCheckLevels( Abc_Aig_t * pMan )
+{
+    printf( "Level check: Verified %d replacements. Found %d incorrect levels.\n", pMan->nLevelChecks, pMan->nLevelErrors );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Performs internal replacement step.]
@@ -968,7 +1042,11 @@ void Abc_AigReplace_int( Abc_Aig_t * pMan, Abc_Obj_t * pOld, Abc_Obj_t * pNew, i
         // the fanout has changed, update EXOR status of its fanouts
         Abc_ObjForEachFanout( pFanout, pFanoutFanout, v )
             if ( Abc_AigNodeIsAnd(pFanoutFanout) )
+            {
+                if ( pFanoutFanout->pNtk->pUndo )
+                    Abc_NtkUndoSaveObj( pFanoutFanout );
                 pFanoutFanout->fExor = Abc_NodeIsExorType(pFanoutFanout);
+            }
     }
     // if the node has no fanouts left, remove its MFFC
     if ( Abc_ObjFanoutNum(pOld) == 0 )
@@ -1094,6 +1172,8 @@ void Abc_AigUpdateLevel_int( Abc_Aig_t * pMan )
                 if ( pFanout->fMarkA )
                     Abc_AigRemoveFromLevelStructure( pMan->vLevels, pFanout );
                 // update the fanout level
+                if ( pFanout->pNtk->pUndo )
+                    Abc_NtkUndoSaveObj( pFanout );
                 pFanout->Level = LevelNew;
                 // add the fanout to the data structure to update its fanouts
                 assert( pFanout->fMarkA == 0 );
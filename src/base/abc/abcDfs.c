@@ -1450,6 +1450,8 @@ int Abc_NtkLevel( Abc_Ntk_t * pNtk )
 {
     Abc_Obj_t * pNode;
     int i, LevelsMax;
+    if ( pNtk->pUndo )
+        Abc_NtkUndoSaveLevels( pNtk );
     // set the CI levels
     if ( pNtk->pManTime == NULL || pNtk->AndGateDelay <= 0 )
         Abc_NtkForEachCi( pNtk, pNode, i )
@@ -1500,6 +1502,8 @@ int Abc_NtkLevelReverse( Abc_Ntk_t * pNtk )
 {
     Abc_Obj_t * pNode;
     int i, LevelsMax;
+    if ( pNtk->pUndo )
+        Abc_NtkUndoSaveLevels( pNtk );
     // set the CO levels to zero
     Abc_NtkForEachCo( pNtk, pNode, i )
         pNode->Level = 0;
@@ -90,6 +90,11 @@ void Abc_ObjAddFanin( Abc_Obj_t * pObj, Abc_Obj_t * pFanin )
     assert( !Abc_ObjIsPi(pObj) && !Abc_ObjIsPo(pFaninR) );    // fanin of PI or fanout of PO
     assert( !Abc_ObjIsCo(pObj) || !Abc_ObjFaninNum(pObj) );  // CO with two fanins
     assert( !Abc_ObjIsNet(pObj) || !Abc_ObjFaninNum(pObj) ); // net with two fanins
+    if ( pObj->pNtk->pUndo )
+    {
+        Abc_NtkUndoSaveObj( pObj );
+        Abc_NtkUndoSaveObj( pFaninR );
+    }
     Vec_IntPushMem( pObj->pNtk->pMmStep, &pObj->vFanins,     pFaninR->Id );
     Vec_IntPushMem( pObj->pNtk->pMmStep, &pFaninR->vFanouts, pObj->Id    );
     if ( Abc_ObjIsComplement(pFanin) )
@@ -114,6 +119,11 @@ void Abc_ObjDeleteFanin( Abc_Obj_t * pObj, Abc_Obj_t * pFanin )
     assert( !Abc_ObjIsComplement(pFanin) );
     assert( pObj->pNtk == pFanin->pNtk );
     assert( pObj->Id >= 0 && pFanin->Id >= 0 );
+    if ( pObj->pNtk->pUndo )
+    {
+        Abc_NtkUndoSaveObj( pObj );
+        Abc_NtkUndoSaveObj( pFanin );
+    }
     if ( !Vec_IntRemove( &pObj->vFanins, pFanin->Id ) )
     {
         printf( "The obj %d is not found among the fanins of obj %d ...\n", pFanin->Id, pObj->Id );
@@ -187,6 +197,12 @@ void Abc_ObjPatchFanin( Abc_Obj_t * pObj, Abc_Obj_t * pFaninOld, Abc_Obj_t * pFa
         return;
     }
 
+    if ( pObj->pNtk->pUndo )
+    {
+        Abc_NtkUndoSaveObj( pObj );
+        Abc_NtkUndoSaveObj( pFaninOld );
+        Abc_NtkUndoSaveObj( pFaninNewR );
+    }
     // remember the attributes of the old fanin
 //    fCompl = Abc_ObjFaninC(pObj, iFanin);
     // replace the old fanin entry by the new fanin entry (removes attributes)
@@ -227,6 +243,8 @@ void Abc_ObjPatchFanoutFanin( Abc_Obj_t * pObj, int iObjNew )
     // update fanouts of the node to point to this one
     Abc_ObjForEachFanout( pObj, pFanout, i )
     {
+        if ( pObj->pNtk->pUndo )
+            Abc_NtkUndoSaveObj( pFanout );
         Vec_IntForEachEntry( &pFanout->vFanins, Entry, k )
             if ( Entry == (int)Abc_ObjId(pObj) )
             {
@@ -266,6 +284,11 @@ Abc_Obj_t * Abc_ObjInsertBetween( Abc_Obj_t * pNodeIn, Abc_Obj_t * pNodeOut, Abc
         printf( " the fanins of node %s...\n", Abc_ObjName(pNodeOut) );
         return NULL;
     }
+    if ( pNodeIn->pNtk->pUndo )
+    {
+        Abc_NtkUndoSaveObj( pNodeIn );
+        Abc_NtkUndoSaveObj( pNodeOut );
+    }
     // create the new node
     pNodeNew = Abc_NtkCreateObj( pNodeIn->pNtk, Type );
     // add pNodeIn as fanin and pNodeOut as fanout
@@ -21,6 +21,7 @@
 #include "abc.h"
 #include "base/main/main.h"
 #include "map/mio/mio.h"
+#include "bool/dec/dec.h"
 
 #ifdef ABC_USE_CUDD
 #include "bdd/extrab/extraBdd.h"
@@ -982,14 +983,32 @@ Hop_Obj_t * Abc_ConvertSopToAigInternal( Hop_Man_t * pMan, char * pSop )
 ***********************************************************************/
 Hop_Obj_t * Abc_ConvertSopToAig( Hop_Man_t * pMan, char * pSop )
 {
-    extern Hop_Obj_t * Dec_GraphFactorSop( Hop_Man_t * pMan, char * pSop );
+    return Abc_ConvertSopToAigMan( pMan, Abc_FrameReadManDec(), pSop );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Converts the SOP into the AIG using the given factoring manager.]
+
+  Description [The factoring manager (Dec_Man_t) holds the temporary
+  storage, so SOPs can be converted concurrently into different AIG
+  managers if each thread has its own factoring manager.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Hop_Obj_t * Abc_ConvertSopToAigMan( Hop_Man_t * pMan, void * pManDec, char * pSop )
+{
+    extern Hop_Obj_t * Dec_GraphFactorSop( Hop_Man_t * pMan, Dec_Man_t * pManDec, char * pSop );
     int fUseFactor = 1;
     // consider the constant node
     if ( Abc_SopGetVarNum(pSop) == 0 )
         return Hop_NotCond( Hop_ManConst1(pMan), Abc_SopIsConst0(pSop) );
     // decide when to use factoring
     if ( fUseFactor && Abc_SopGetVarNum(pSop) > 2 && Abc_SopGetCubeNum(pSop) > 1 && !Abc_SopIsExorType(pSop) )
-        return Dec_GraphFactorSop( pMan, pSop );
+        return Dec_GraphFactorSop( pMan, (Dec_Man_t *)pManDec, pSop );
     return Abc_ConvertSopToAigInternal( pMan, pSop );
 }
 
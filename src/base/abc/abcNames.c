@@ -326,6 +326,8 @@ void Abc_NtkOrderObjsByName( Abc_Ntk_t * pNtk, int fComb )
     Abc_Obj_t * pObj;
     int i;
     assert( Abc_NtkHasOnlyLatchBoxes(pNtk) );
+    if ( pNtk->pUndo )
+        Abc_NtkUndoSaveOrder( pNtk );
     // temporarily store the names in the copy field
     Abc_NtkForEachPi( pNtk, pObj, i )
         pObj->pCopy = (Abc_Obj_t *)Abc_ObjName(pObj);
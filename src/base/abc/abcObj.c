@@ -171,11 +171,21 @@ void Abc_NtkDeleteObj( Abc_Obj_t * pObj )
 {
     Abc_Ntk_t * pNtk = pObj->pNtk;
     Vec_Ptr_t * vNodes;
-    int i;
+    int i, fUndo = 0;
     assert( !Abc_ObjIsComplement(pObj) );
+    // save the object if the undo log is started
+    if ( pNtk->pUndo )
+    {
+        Abc_NtkUndoSaveObj( pObj );
+        fUndo = Abc_NtkUndoObjIsOld( pObj );
+    }
     // remove from the table of names
     if ( Nm_ManFindNameById(pObj->pNtk->pManName, pObj->Id) )
+    {
+        if ( fUndo )
+            Abc_NtkUndoInvalidate( pNtk );
         Nm_ManDeleteIdName(pObj->pNtk->pManName, pObj->Id);
+    }
     // delete fanins and fanouts
     vNodes = Vec_PtrAlloc( 100 );
     Abc_NodeCollectFanouts( pObj, vNodes );
@@ -187,6 +197,8 @@ void Abc_NtkDeleteObj( Abc_Obj_t * pObj )
     Vec_PtrFree( vNodes );
     // remove from the list of objects
     Vec_PtrWriteEntry( pNtk->vObjs, pObj->Id, NULL );
+    if ( fUndo )
+        Abc_NtkUndoDeleteObj( pObj );
     pObj->Id = (1<<26)-1;
     pNtk->nObjCounts[pObj->Type]--;
     pNtk->nObjs--;
@@ -231,8 +243,9 @@ void Abc_NtkDeleteObj( Abc_Obj_t * pObj )
             assert(0); 
             break;
     }
-    // recycle the object memory
-    Abc_ObjRecycle( pObj );
+    // recycle the object memory (the undo log recycles it later)
+    if ( !fUndo )
+        Abc_ObjRecycle( pObj );
 }
 
 /**Function*************************************************************
@@ -249,6 +262,7 @@ void Abc_NtkDeleteObj( Abc_Obj_t * pObj )
 void Abc_NtkDeleteObjPo( Abc_Obj_t * pObj )
 {
     assert( Abc_ObjIsPo(pObj) );
+    Abc_NtkUndoInvalidate( pObj->pNtk );
     // remove from the table of names
     if ( Nm_ManFindNameById(pObj->pNtk->pManName, pObj->Id) )
         Nm_ManDeleteIdName(pObj->pNtk->pManName, pObj->Id);
@@ -0,0 +1,513 @@
+/**CFile****************************************************************
+
+  FileName    [abcUndo.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Network and node package.]
+
+  Synopsis    [Undo log for in-place changes of the AIG.]
+
+  Author      [LSV-PA contributors]
+  
+  Affiliation []
+
+  Date        [Ver. 1.0.]
+
+  Revision    [$Id: abcUndo.c $]
+
+***********************************************************************/
+
+#include "abc.h"
+#include "misc/vec/vecHsh.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The undo log keeps the state of the network at the checkpoint without
+// copying it. Each object existing at the checkpoint is saved when it is
+// modified for the first time (its fields and its fanin/fanout arrays).
+// The objects deleted after the checkpoint are not recycled until the log
+// is stopped. The objects created after the checkpoint have IDs larger
+// than the mark. Rolling back restores the saved objects and removes the
+// new ones, which takes time proportional to the number of changes.
+// The level passes (Abc_NtkLevel) overwrite all levels; before the first
+// such pass, the levels are copied, so that the network is restored
+// without recomputing them. The saved objects are found by ID in a hash
+// table, so starting the log does not depend on the network size.
+
+struct Abc_Undo_t_
+{
+    int               nObjsMark;     // the number of object IDs at the checkpoint
+    int               nObjs;         // the number of objects at the checkpoint
+    int               nObjCounts[ABC_OBJ_NUMBER]; // the number of objects by type
+    int               fInvalid;      // the log cannot be rolled back
+    int               nFrozen;       // the number of object IDs after renumbering
+    Hsh_Int1Man_t *   pSaved;        // the IDs of the saved objects (in the order of pImages)
+    Vec_Int_t *       vLevels;       // the levels before the first level pass
+    int               nImagesLevel;  // the number of objects saved before the level copy
+    Abc_Obj_t *       pImages;       // the saved objects
+    int               nImages;       // the number of saved objects
+    int               nImagesAlloc;  // the number of allocated saved objects
+    Vec_Int_t *       vArrays;       // the saved fanin/fanout arrays
+    Vec_Ptr_t *       vDead;         // the deleted objects
+    Vec_Int_t *       vDeadIds;      // the IDs of the deleted objects
+    Vec_Ptr_t *       vObjsOld;      // the objects before renumbering
+    Vec_Ptr_t *       vOrders[5];    // the PI/PO/CI/CO/box orders
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the undo log for the AIG.]
+
+  Description [Records the checkpoint, to which the network can be
+  returned by Abc_NtkUndoRollback(). The log is closed by calling
+  Abc_NtkUndoStop() or Abc_NtkUndoRollback().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkUndoStart( Abc_Ntk_t * pNtk )
+{
+    Abc_Undo_t * p;
+    assert( Abc_NtkIsStrash(pNtk) );
+    if ( pNtk->pUndo )
+        Abc_NtkUndoStop( pNtk );
+    p = ABC_CALLOC( Abc_Undo_t, 1 );
+    p->nObjsMark = Abc_NtkObjNumMax( pNtk );
+    p->nObjs     = pNtk->nObjs;
+    memcpy( p->nObjCounts, pNtk->nObjCounts, sizeof(int) * ABC_OBJ_NUMBER );
+    p->pSaved    = Hsh_Int1ManStart( 100 );
+    p->vArrays   = Vec_IntAlloc( 1000 );
+    p->vDead     = Vec_PtrAlloc( 100 );
+    p->vDeadIds  = Vec_IntAlloc( 100 );
+    pNtk->pUndo  = p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the undo log and accepts the changes.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkUndoStop( Abc_Ntk_t * pNtk )
+{
+    Abc_Undo_t * p = pNtk->pUndo;
+    Abc_Obj_t * pObj;
+    int i;
+    if ( p == NULL )
+        return;
+    pNtk->pUndo = NULL;
+    Vec_PtrForEachEntry( Abc_Obj_t *, p->vDead, pObj, i )
+        Abc_ObjRecycle( pObj );
+    for ( i = 0; i < 5; i++ )
+        if ( p->vOrders[i] )
+            Vec_PtrFree( p->vOrders[i] );
+    if ( p->vObjsOld )
+        Vec_PtrFree( p->vObjsOld );
+    Hsh_Int1ManStop( p->pSaved );
+    Vec_IntFreeP( &p->vLevels );
+    Vec_IntFree( p->vArrays );
+    Vec_PtrFree( p->vDead );
+    Vec_IntFree( p->vDeadIds );
+    ABC_FREE( p->pImages );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Marks the undo log as impossible to roll back.]
+
+  Description [Called when the network is changed in a way not recorded
+  by the log.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkUndoInvalidate( Abc_Ntk_t * pNtk )
+{
+    if ( pNtk->pUndo )
+        pNtk->pUndo->fInvalid = 1;
+}
+int Abc_NtkUndoIsValid( Abc_Ntk_t * pNtk )
+{
+    return pNtk->pUndo && !pNtk->pUndo->fInvalid;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the object existed at the checkpoint.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkUndoObjIsOld( Abc_Obj_t * pObj )
+{
+    Abc_Undo_t * p = pObj->pNtk->pUndo;
+    assert( p != NULL );
+    if ( p->vObjsOld )
+        return 0;
+    return pObj->Id < p->nObjsMark;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Saves the object before it is modified for the first time.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkUndoSaveObj( Abc_Obj_t * pObj )
+{
+    Abc_Undo_t * p = pObj->pNtk->pUndo;
+    int i;
+    assert( p != NULL );
+    if ( p->fInvalid )
+        return;
+    // the objects cannot be saved after renumbering
+    if ( p->vObjsOld )
+    {
+        p->fInvalid = 1;
+        return;
+    }
+    if ( pObj->Id >= p->nObjsMark || Hsh_Int1ManLookup(p->pSaved, pObj->Id) >= 0 )
+        return;
+    Hsh_Int1ManAdd( p->pSaved, pObj->Id );
+    assert( Hsh_Int1ManEntryNum(p->pSaved) == p->nImages + 1 );
+    if ( p->nImages == p->nImagesAlloc )
+    {
+        p->nImagesAlloc = Abc_MaxInt( 2 * p->nImagesAlloc, 100 );
+        p->pImages = ABC_REALLOC( Abc_Obj_t, p->pImages, p->nImagesAlloc );
+    }
+    p->pImages[p->nImages++] = *pObj;
+    Vec_IntPush( p->vArrays, Vec_IntSize(&pObj->vFanins) );
+    for ( i = 0; i < Vec_IntSize(&pObj->vFanins); i++ )
+        Vec_IntPush( p->vArrays, Vec_IntEntry(&pObj->vFanins, i) );
+    Vec_IntPush( p->vArrays, Vec_IntSize(&pObj->vFanouts) );
+    for ( i = 0; i < Vec_IntSize(&pObj->vFanouts); i++ )
+        Vec_IntPush( p->vArrays, Vec_IntEntry(&pObj->vFanouts, i) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Saves the levels before they are overwritten by a level pass.]
+
+  Description [Called by Abc_NtkLevel() and Abc_NtkLevelReverse(), which
+  take linear time anyway. Only the first call copies the levels. The
+  objects saved before the copy keep their levels in the saved images.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkUndoSaveLevels( Abc_Ntk_t * pNtk )
+{
+    Abc_Undo_t * p = pNtk->pUndo;
+    Vec_Ptr_t * vObjs;
+    Abc_Obj_t * pObj;
+    int i;
+    assert( p != NULL );
+    if ( p->fInvalid || p->vLevels )
+        return;
+    // after renumbering, the objects existing at the checkpoint are in the old array
+    vObjs = p->vObjsOld ? p->vObjsOld : pNtk->vObjs;
+    p->vLevels = Vec_IntStart( p->nObjsMark );
+    p->nImagesLevel = p->nImages;
+    for ( i = 0; i < p->nObjsMark && i < Vec_PtrSize(vObjs); i++ )
+        if ( (pObj = (Abc_Obj_t *)Vec_PtrEntry(vObjs, i)) )
+            Vec_IntWriteEntry( p->vLevels, i, pObj->Level );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Saves the order of PIs/POs/CIs/COs/boxes.]
+
+  Description [Called before these arrays are permuted.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkUndoSaveOrder( Abc_Ntk_t * pNtk )
+{
+    Abc_Undo_t * p = pNtk->pUndo;
+    assert( p != NULL );
+    if ( p->vOrders[0] )
+        return;
+    p->vOrders[0] = Vec_PtrDup( pNtk->vPis );
+    p->vOrders[1] = Vec_PtrDup( pNtk->vPos );
+    p->vOrders[2] = Vec_PtrDup( pNtk->vCis );
+    p->vOrders[3] = Vec_PtrDup( pNtk->vCos );
+    p->vOrders[4] = Vec_PtrDup( pNtk->vBoxes );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Keeps the object deleted after the checkpoint.]
+
+  Description [Called by Abc_NtkDeleteObj() for the objects existing at
+  the checkpoint, which have been saved before deletion. The object memory
+  is recycled when the log is stopped.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkUndoDeleteObj( Abc_Obj_t * pObj )
+{
+    Abc_Undo_t * p = pObj->pNtk->pUndo;
+    assert( p != NULL );
+    assert( Hsh_Int1ManLookup(p->pSaved, pObj->Id) >= 0 );
+    // the CI/CO/box is still in the ordered arrays
+    if ( !Abc_ObjIsNode(pObj) )
+        Abc_NtkUndoSaveOrder( pObj->pNtk );
+    Vec_PtrPush( p->vDead, pObj );
+    Vec_IntPush( p->vDeadIds, pObj->Id );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Remembers the objects before their IDs are reassigned.]
+
+  Description [Takes the ownership of the old array of objects. After
+  renumbering, the log can only be rolled back or stopped.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkUndoSaveIds( Abc_Ntk_t * pNtk, Vec_Ptr_t * vObjsOld )
+{
+    Abc_Undo_t * p = pNtk->pUndo;
+    assert( p != NULL );
+    if ( p->vObjsOld )
+    {
+        p->fInvalid = 1;
+        Vec_PtrFree( vObjsOld );
+        return;
+    }
+    p->vObjsOld = vObjsOld;
+    p->nFrozen  = pNtk->nObjs; // the renumbered array has no gaps
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Restores the object IDs before renumbering.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_NtkUndoRestoreIds( Abc_Ntk_t * pNtk, Abc_Undo_t * p )
+{
+    Vec_Ptr_t * vObjsNew = pNtk->vObjs;
+    Abc_Obj_t * pObj;
+    int i, k;
+    Vec_PtrForEachEntry( Abc_Obj_t *, p->vObjsOld, pObj, i )
+        if ( pObj )
+            pObj->Id = i;
+    Vec_PtrForEachEntry( Abc_Obj_t *, vObjsNew, pObj, i )
+    {
+        if ( pObj == NULL )
+            continue;
+        for ( k = 0; k < pObj->vFanins.nSize; k++ )
+            pObj->vFanins.pArray[k] = ((Abc_Obj_t *)Vec_PtrEntry(vObjsNew, pObj->vFanins.pArray[k]))->Id;
+        for ( k = 0; k < pObj->vFanouts.nSize; k++ )
+            pObj->vFanouts.pArray[k] = ((Abc_Obj_t *)Vec_PtrEntry(vObjsNew, pObj->vFanouts.pArray[k]))->Id;
+    }
+    pNtk->vObjs = p->vObjsOld;
+    p->vObjsOld = NULL;
+    Vec_PtrFree( vObjsNew );
+    Abc_AigRehash( (Abc_Aig_t *)pNtk->pManFunc );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the network to the state at the checkpoint.]
+
+  Description [Returns 1 if the network was restored. Returns 0 if the
+  log was invalidated by a change it does not record, in which case the
+  network is left as it is. In both cases the log is stopped. The scratch
+  fields (pData, pTemp) are not restored. The levels are taken from the saved
+  objects and, if a level pass was performed, from the copy of the levels.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkUndoRollback( Abc_Ntk_t * pNtk )
+{
+    Abc_Undo_t * p = pNtk->pUndo;
+    Abc_Aig_t * pMan = (Abc_Aig_t *)pNtk->pManFunc;
+    Abc_Obj_t * pObj, * pImage, Temp;
+    int i, k, * pArray, fRehash = 0;
+    char * pHashed;
+    if ( p == NULL )
+        return 0;
+    if ( p->fInvalid || (p->vObjsOld && p->nFrozen != Vec_PtrSize(pNtk->vObjs)) )
+    {
+        Abc_NtkUndoStop( pNtk );
+        return 0;
+    }
+    // disable logging while the network is restored
+    pNtk->pUndo = NULL;
+    if ( p->vObjsOld )
+        Abc_NtkUndoRestoreIds( pNtk, p );
+    // remove the modified and the new nodes from the structural hashing table
+    // (a node whose fanin complements were flipped in place is not found under
+    // its current key; it stays in the table and is rehashed after restoring)
+    pHashed = ABC_ALLOC( char, p->nImages + 1 );
+    for ( i = 0; i < p->nImages; i++ )
+    {
+        pObj = Abc_NtkObj( pNtk, p->pImages[i].Id );
+        pHashed[i] = 0;
+        if ( pObj && Abc_AigNodeIsAnd(pObj) && !Abc_AigAndRemove(pMan, pObj) )
+            pHashed[i] = fRehash = 1;
+    }
+    for ( i = p->nObjsMark; i < Abc_NtkObjNumMax(pNtk); i++ )
+    {
+        pObj = Abc_NtkObj( pNtk, i );
+        if ( pObj && Abc_AigNodeIsAnd(pObj) )
+            Abc_AigAndDelete( pMan, pObj );
+    }
+    // delete the new objects (their connections are restored below)
+    for ( i = p->nObjsMark; i < Abc_NtkObjNumMax(pNtk); i++ )
+    {
+        pObj = Abc_NtkObj( pNtk, i );
+        if ( pObj == NULL )
+            continue;
+        Vec_IntClear( &pObj->vFanins );
+        Vec_IntClear( &pObj->vFanouts );
+        Abc_NtkDeleteObj( pObj );
+    }
+    Vec_PtrShrink( pNtk->vObjs, p->nObjsMark );
+    // bring back the deleted objects
+    Vec_PtrForEachEntry( Abc_Obj_t *, p->vDead, pObj, i )
+        Vec_PtrWriteEntry( pNtk->vObjs, Vec_IntEntry(p->vDeadIds, i), pObj );
+    Vec_PtrClear( p->vDead );
+    // restore the saved objects
+    pArray = Vec_IntArray( p->vArrays );
+    for ( i = 0; i < p->nImages; i++ )
+    {
+        pImage = p->pImages + i;
+        pObj = Abc_NtkObj( pNtk, pImage->Id );
+        assert( pObj != NULL );
+        Temp = *pObj;
+        *pObj = *pImage;
+        pObj->pNext = Temp.pNext;
+        pObj->pData = Temp.pData;
+        pObj->pTemp = Temp.pTemp;
+        pObj->vFanins  = Temp.vFanins;
+        pObj->vFanouts = Temp.vFanouts;
+        pObj->vFanins.nSize = *pArray++;
+        assert( pObj->vFanins.nSize <= pObj->vFanins.nCap );
+        for ( k = 0; k < pObj->vFanins.nSize; k++ )
+            pObj->vFanins.pArray[k] = *pArray++;
+        pObj->vFanouts.nSize = *pArray++;
+        assert( pObj->vFanouts.nSize <= pObj->vFanouts.nCap );
+        for ( k = 0; k < pObj->vFanouts.nSize; k++ )
+            pObj->vFanouts.pArray[k] = *pArray++;
+    }
+    assert( pArray == Vec_IntLimit(p->vArrays) );
+    // restore the levels overwritten by the level passes, except those
+    // of the objects saved before the levels were copied
+    if ( p->vLevels )
+    {
+        for ( i = 0; i < p->nObjsMark; i++ )
+            if ( (pObj = Abc_NtkObj(pNtk, i)) )
+                pObj->Level = Vec_IntEntry( p->vLevels, i );
+        for ( i = 0; i < p->nImagesLevel; i++ )
+            Abc_NtkObj(pNtk, p->pImages[i].Id)->Level = p->pImages[i].Level;
+    }
+    // restore the order of CIs/COs
+    if ( p->vOrders[0] )
+    {
+        Vec_Ptr_t * vArrays[5] = { pNtk->vPis, pNtk->vPos, pNtk->vCis, pNtk->vCos, pNtk->vBoxes };
+        for ( i = 0; i < 5; i++ )
+        {
+            Vec_PtrClear( vArrays[i] );
+            Vec_PtrForEachEntry( Abc_Obj_t *, p->vOrders[i], pObj, k )
+                Vec_PtrPush( vArrays[i], pObj );
+        }
+    }
+    // add the restored nodes to the structural hashing table
+    for ( i = 0; i < p->nImages; i++ )
+    {
+        pObj = Abc_NtkObj( pNtk, p->pImages[i].Id );
+        if ( Abc_AigNodeIsAnd(pObj) && !pHashed[i] )
+            Abc_AigAndInsert( pMan, pObj );
+    }
+    ABC_FREE( pHashed );
+    if ( fRehash )
+        Abc_AigRehash( pMan );
+    pNtk->nObjs = p->nObjs;
+    memcpy( pNtk->nObjCounts, p->nObjCounts, sizeof(int) * ABC_OBJ_NUMBER );
+    pNtk->pUndo = p;
+    Abc_NtkUndoStop( pNtk );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints the statistics of the undo log.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkUndoPrintStats( Abc_Ntk_t * pNtk )
+{
+    Abc_Undo_t * p = pNtk->pUndo;
+    if ( p == NULL )
+    {
+        printf( "Undo log is not started.\n" );
+        return;
+    }
+    printf( "Undo log: Saved = %d.  New = %d.  Deleted = %d.  Mem = %.2f MB.%s\n",
+        p->nImages, Abc_MaxInt(0, Abc_NtkObjNumMax(pNtk) - p->nObjsMark), Vec_PtrSize(p->vDead),
+        1.0 * (sizeof(Abc_Obj_t) * p->nImagesAlloc + 4 * Vec_IntCap(p->vArrays) + 12 * Hsh_Int1ManEntryNum(p->pSaved) + 4 * (p->vLevels ? Vec_IntCap(p->vLevels) : 0)) / (1<<20),
+        p->fInvalid ? "  (invalid)" : "" );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -76,6 +76,8 @@ void Abc_NtkOrderCisCos( Abc_Ntk_t * pNtk )
 {
     Abc_Obj_t * pObj, * pTerm;
     int i, k;
+    if ( pNtk->pUndo )
+        Abc_NtkUndoSaveOrder( pNtk );
     Vec_PtrClear( pNtk->vCis );
     Vec_PtrClear( pNtk->vCos );
     Abc_NtkForEachPi( pNtk, pObj, i )
@@ -1868,8 +1870,11 @@ void Abc_NtkReassignIds( Abc_Ntk_t * pNtk )
             pNode->vFanouts.pArray[k] = pTemp->Id;
     }
 
-    // replace the array of objs
-    Vec_PtrFree( pNtk->vObjs );
+    // replace the array of objs (the undo log keeps the old one)
+    if ( pNtk->pUndo )
+        Abc_NtkUndoSaveIds( pNtk, pNtk->vObjs );
+    else
+        Vec_PtrFree( pNtk->vObjs );
     pNtk->vObjs = vObjsNew;
 
     // rehash the AIG
@@ -1478,10 +1478,22 @@ void Abc_End( Abc_Frame_t * pAbc )
         extern void Npn_ManClean();
         Npn_ManClean();
     }
+    {
+        extern void Abc_OrchPolicyQuit();
+        Abc_OrchPolicyQuit();
+    }
     {
         extern void Sdm_ManQuit();
         Sdm_ManQuit();
     }
+    {
+        extern void Abc_TtCacheQuit();
+        Abc_TtCacheQuit();
+    }
+    {
+        extern void If_ManCacheQuit();
+        If_ManCacheQuit();
+    }
     Abc_NtkFraigStoreClean();
     Gia_ManStopP( &pAbc->pGia );
     Gia_ManStopP( &pAbc->pGia2 );
@@ -3796,17 +3808,30 @@ int Abc_CommandStrash( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fRecord;
     int fCleanup;
     int fComplOuts;
+    int nProcs;
     pNtk = Abc_FrameReadNtk(pAbc);
     // set defaults
     fAllNodes = 0;
     fCleanup  = 1;
     fRecord   = 0;
     fComplOuts= 0;
+    nProcs    = 1;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "acrih" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Pacrih" ) ) != EOF )
     {
         switch ( c )
         {
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nProcs < 1 || nProcs > 100 )
+                goto usage;
+            break;
         case 'a':
             fAllNodes ^= 1;
             break;
@@ -3833,7 +3858,7 @@ int Abc_CommandStrash( Abc_Frame_t * pAbc, int argc, char ** argv )
     }
 
     // get the new network
-    pNtkRes = Abc_NtkStrash( pNtk, fAllNodes, fCleanup, fRecord );
+    pNtkRes = Abc_NtkStrashPar( pNtk, fAllNodes, fCleanup, fRecord, nProcs );
     if ( pNtkRes == NULL )
     {
         Abc_Print( -1, "Strashing has failed.\n" );
@@ -3847,13 +3872,14 @@ int Abc_CommandStrash( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: strash [-acrih]\n" );
+    Abc_Print( -2, "usage: strash [-P num] [-acrih]\n" );
     Abc_Print( -2, "\t        transforms combinational logic into an AIG\n" );
-    Abc_Print( -2, "\t-a    : toggles between using all nodes and DFS nodes [default = %s]\n", fAllNodes? "all": "DFS" );
-    Abc_Print( -2, "\t-c    : toggles cleanup to remove the dagling AIG nodes [default = %s]\n", fCleanup? "all": "DFS" );
-    Abc_Print( -2, "\t-r    : toggles using the record of AIG subgraphs [default = %s]\n", fRecord? "yes": "no" );
-    Abc_Print( -2, "\t-i    : toggles complementing the POs of the AIG [default = %s]\n", fComplOuts? "yes": "no" );
-    Abc_Print( -2, "\t-h    : print the command usage\n");
+    Abc_Print( -2, "\t-P num : the number of concurrent processes used to factor SOPs (1 <= num <= 100) [default = %d]\n", nProcs );
+    Abc_Print( -2, "\t-a     : toggles between using all nodes and DFS nodes [default = %s]\n", fAllNodes? "all": "DFS" );
+    Abc_Print( -2, "\t-c     : toggles cleanup to remove the dagling AIG nodes [default = %s]\n", fCleanup? "all": "DFS" );
+    Abc_Print( -2, "\t-r     : toggles using the record of AIG subgraphs (disables -P) [default = %s]\n", fRecord? "yes": "no" );
+    Abc_Print( -2, "\t-i     : toggles complementing the POs of the AIG [default = %s]\n", fComplOuts? "yes": "no" );
+    Abc_Print( -2, "\t-h     : print the command usage\n");
     return 1;
 }
 
@@ -7537,7 +7563,7 @@ usage:
 ***********************************************************************/
 int Abc_CommandOrchestrate( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
-    Abc_Ntk_t * pNtk = Abc_FrameReadNtk(pAbc), * pDup;
+    Abc_Ntk_t * pNtk = Abc_FrameReadNtk(pAbc);
     int c, RetValue;
 
     int nNodeSizeMax;
@@ -7555,13 +7581,17 @@ int Abc_CommandOrchestrate( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fPrecompute; //rewrite option (not enabled)
     int fPlaceEnable; //rewrite option (not enabled)
 
+    int fUsePolicy; //policy option
+    int nPolicyMin; //policy option
+    char * pPolicyFile = NULL; //policy option
+
     int fVerbose; //rewrite/rs/rf verbose
     int fVeryVerbose; //very verbose option for all 
     //size_t NtkSize;
     extern void Rwr_Precompute();
 
     //local greedy
-    extern int Abc_NtkOrchLocal( Abc_Ntk_t * pNtk, int fUseZeros_rwr, int fUseZeros_ref, int fPlaceEnable, int nCutsMax, int nNodesMax, int nLevelsOdc, int fUpdateLevel, int fVerbose, int fVeryVerbose, int nNodeSizeMax, int nConeSizeMax, int fUseDcs );
+    extern int Abc_NtkOrchLocal( Abc_Ntk_t * pNtk, int fUseZeros_rwr, int fUseZeros_ref, int fPlaceEnable, int nCutsMax, int nNodesMax, int nLevelsOdc, int fUpdateLevel, int fVerbose, int fVeryVerbose, int nNodeSizeMax, int nConeSizeMax, int fUseDcs, int fUsePolicy, int nPolicyMin );
     //priority orch
     extern int Abc_NtkOchestration( Abc_Ntk_t * pNtk, Vec_Int_t **pGain_rwr, Vec_Int_t **pGain_res,Vec_Int_t **pGain_ref, int sOpsOrder, int fUseZeros_rwr, int fUseZeros_ref, int fPlaceEnable, int nCutsMax, int nNodesMax, int nLevelsOdc, int fUpdateLevel, int fVerbose, int fVeryVerbose, int nNodeSizeMax, int nConeSizeMax, int fUseDcs );
     // set defaults
@@ -7578,9 +7608,11 @@ int Abc_CommandOrchestrate( Abc_Frame_t * pAbc, int argc, char ** argv )
     nCutsMax     =  8;
     nNodesMax    =  1;
     nLevelsOdc   =  0;
+    fUsePolicy   =  0;
+    nPolicyMin   =  3;
 
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "KNFZzlvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "KNFMPZzplvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -7617,6 +7649,30 @@ int Abc_CommandOrchestrate( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( nLevelsOdc < 0 )
                 goto usage;
             break;
+        case 'M':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-M\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nPolicyMin = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nPolicyMin < 1 )
+                goto usage;
+            break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by a file name.\n" );
+                goto usage;
+            }
+            pPolicyFile = argv[globalUtilOptind];
+            globalUtilOptind++;
+            fUsePolicy = 1;
+            break;
+        case 'p':
+            fUsePolicy ^= 1;
+            break;
         case 'l':
             fUpdateLevel ^= 1;
             break;
@@ -7674,17 +7730,25 @@ int Abc_CommandOrchestrate( Abc_Frame_t * pAbc, int argc, char ** argv )
         return 1;
     }
 
+    // load the policy learned in the earlier runs
+    if ( pPolicyFile && Abc_OrchPolicyLoad( pPolicyFile ) == -1 && fVerbose )
+        Abc_Print( 0, "Policy file \"%s\" does not exist and will be created.\n", pPolicyFile );
+
     // modify the current network
-    pDup = Abc_NtkDup( pNtk );
-    RetValue = Abc_NtkOrchLocal( pNtk, fUseZeros_rwr, fUseZeros_ref, fPlaceEnable, nCutsMax, nNodesMax, nLevelsOdc, fUpdateLevel, fVerbose, fVeryVerbose, nNodeSizeMax, nConeSizeMax, fUseDcs );
+    Abc_NtkUndoStart( pNtk );
+    RetValue = Abc_NtkOrchLocal( pNtk, fUseZeros_rwr, fUseZeros_ref, fPlaceEnable, nCutsMax, nNodesMax, nLevelsOdc, fUpdateLevel, fVerbose, fVeryVerbose, nNodeSizeMax, nConeSizeMax, fUseDcs, fUsePolicy, nPolicyMin );
+    if ( pPolicyFile && !Abc_OrchPolicySave( pPolicyFile ) )
+        Abc_Print( -1, "Cannot write policy file \"%s\".\n", pPolicyFile );
     if ( RetValue == -1 )
     {
-        Abc_FrameReplaceCurrentNetwork( pAbc, pDup );
-        printf( "An error occurred during computation. The original network is restored.\n" );
+        if ( Abc_NtkUndoRollback( pNtk ) )
+            printf( "An error occurred during computation. The original network is restored.\n" );
+        else
+            printf( "An error occurred during computation. The original network cannot be restored.\n" );
     }
     else
     {
-        Abc_NtkDelete( pDup );
+        Abc_NtkUndoStop( pNtk );
         if ( RetValue == 0 )
         {
             Abc_Print( 0, "Ochestration (local greedy) has failed.\n" );
@@ -7694,11 +7758,15 @@ int Abc_CommandOrchestrate( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: orchestrate [-KNFZzlvwh]\n" );
+    Abc_Print( -2, "usage: orchestrate [-KNFM num] [-P file] [-Zzplvwh]\n" );
     Abc_Print( -2, "\t           performs technology-independent AIG synthesis using orchestration method (currently orchestrating rw/rf/rs)\n" );
     Abc_Print( -2, "\t-K <num> : (resub)the max cut size (%d <= num <= %d) [default = %d]\n", RS_CUT_MIN, RS_CUT_MAX, nCutsMax );
     Abc_Print( -2, "\t-N <num> : (resub)the max number of nodes to add (0 <= num <= 3) [default = %d]\n", nNodesMax );
     Abc_Print( -2, "\t-F <num> : (resub)the number of fanout levels for ODC computation [default = %d]\n", nLevelsOdc );
+    Abc_Print( -2, "\t-M <num> : (policy)the min number of observations of an NPN class before it is trusted [default = %d]\n", nPolicyMin );
+    Abc_Print( -2, "\t-P <file>: (policy)the file to load the policy from and save it to (enables -p) [default = %s]\n", pPolicyFile ? pPolicyFile : "none" );
+    Abc_Print( -2, "\t-p       : (policy)toggle learning the winning operators by NPN class of the node's cut\n" );
+    Abc_Print( -2, "\t           and evaluating only the predicted winner [default = %s]\n", fUsePolicy? "yes": "no" );
     Abc_Print( -2, "\t-l       : (resub/rw/refactor)toggle preserving the number of levels [default = %s]\n", fUpdateLevel? "yes": "no" );
     Abc_Print( -2, "\t-z       : (rw)toggle using zero-cost replacements [default = %s]\n", fUseZeros_rwr? "yes": "no" );
     Abc_Print( -2, "\t-Z       : (refactor)toggle using zero-cost replacements [default = %s]\n", fUseZeros_ref? "yes": "no" );
@@ -7722,7 +7790,7 @@ usage:
 ***********************************************************************/
 int Abc_CommandAIGAugmentation( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
-    Abc_Ntk_t * pNtk = Abc_FrameReadNtk(pAbc), * pDup;
+    Abc_Ntk_t * pNtk = Abc_FrameReadNtk(pAbc);
     int c, RetValue;
     int nNodeSizeMax;
     int nConeSizeMax;
@@ -7840,17 +7908,19 @@ int Abc_CommandAIGAugmentation( Abc_Frame_t * pAbc, int argc, char ** argv )
     for (int i=0; i<NtkSize;i++){
            Vec_IntPush(DecisionMask, atoi("-1"));}
     // modify the current network
-    pDup = Abc_NtkDup( pNtk );
+    Abc_NtkUndoStart( pNtk );
     RetValue = Abc_NtkOrchRand( pNtk, &pGain_rwr, &pGain_res, &pGain_ref, &DecisionMask, DecisionFile, Rand_Seed, fUseZeros_rwr, fUseZeros_ref, fPlaceEnable, nCutsMax, nNodesMax, nLevelsOdc, fUpdateLevel, fVerbose, fVeryVerbose, nNodeSizeMax, nConeSizeMax, fUseDcs );
     //printf("Vector check: %d %d\n", DecisionList->nSize, DecisionList->pArray[0]); 
     if ( RetValue == -1 )
     {
-        Abc_FrameReplaceCurrentNetwork( pAbc, pDup );
-        printf( "An error occurred during computation. The original network is restored.\n" );
+        if ( Abc_NtkUndoRollback( pNtk ) )
+            printf( "An error occurred during computation. The original network is restored.\n" );
+        else
+            printf( "An error occurred during computation. The original network cannot be restored.\n" );
     }
     else
     {
-        Abc_NtkDelete( pDup );
+        Abc_NtkUndoStop( pNtk );
         if ( RetValue == 0 )
         {
             Abc_Print( 0, "Orchestration evaluation for RL has failed.\n" );
@@ -7890,7 +7960,7 @@ usage:
 ***********************************************************************/
 int Abc_CommandRewrite( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
-    Abc_Ntk_t * pNtk = Abc_FrameReadNtk(pAbc), * pDup;
+    Abc_Ntk_t * pNtk = Abc_FrameReadNtk(pAbc);
     int c, RetValue;
     int fUpdateLevel;
     int fPrecompute;
@@ -7898,6 +7968,7 @@ int Abc_CommandRewrite( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fVerbose;
     int fVeryVerbose;
     int fPlaceEnable;
+    int fCheckLevels;
     // external functions
     extern void Rwr_Precompute();
 
@@ -7908,8 +7979,9 @@ int Abc_CommandRewrite( Abc_Frame_t * pAbc, int argc, char ** argv )
     fVerbose     = 0;
     fVeryVerbose = 0;
     fPlaceEnable = 0;
+    fCheckLevels = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "lxzvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "lxzcvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -7922,6 +7994,9 @@ int Abc_CommandRewrite( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 'z':
             fUseZeros ^= 1;
             break;
+        case 'c':
+            fCheckLevels ^= 1;
+            break;
         case 'v':
             fVerbose ^= 1;
             break;
@@ -7961,16 +8036,25 @@ int Abc_CommandRewrite( Abc_Frame_t * pAbc, int argc, char ** argv )
     }
 
     // modify the current network
-    pDup = Abc_NtkDup( pNtk );
+    Abc_NtkUndoStart( pNtk );
+    if ( fCheckLevels && fUpdateLevel )
+        Abc_AigSetCheckLevels( (Abc_Aig_t *)pNtk->pManFunc, 1 );
     RetValue = Abc_NtkRewrite( pNtk, fUpdateLevel, fUseZeros, fVerbose, fVeryVerbose, fPlaceEnable );
+    if ( fCheckLevels && fUpdateLevel )
+    {
+        Abc_AigPrintCheckLevels( (Abc_Aig_t *)pNtk->pManFunc );
+        Abc_AigSetCheckLevels( (Abc_Aig_t *)pNtk->pManFunc, 0 );
+    }
     if ( RetValue == -1 )
     {
-        Abc_FrameReplaceCurrentNetwork( pAbc, pDup );
-        printf( "An error occurred during computation. The original network is restored.\n" );
+        if ( Abc_NtkUndoRollback( pNtk ) )
+            printf( "An error occurred during computation. The original network is restored.\n" );
+        else
+            printf( "An error occurred during computation. The original network cannot be restored.\n" );
     }
     else
     {
-        Abc_NtkDelete( pDup );
+        Abc_NtkUndoStop( pNtk );
         if ( RetValue == 0 )
         {
             Abc_Print( 0, "Rewriting has failed.\n" );
@@ -7980,10 +8064,11 @@ int Abc_CommandRewrite( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: rewrite [-lzvwh]\n" );
+    Abc_Print( -2, "usage: rewrite [-lzcvwh]\n" );
     Abc_Print( -2, "\t         performs technology-independent rewriting of the AIG\n" );
     Abc_Print( -2, "\t-l     : toggle preserving the number of levels [default = %s]\n", fUpdateLevel? "yes": "no" );
     Abc_Print( -2, "\t-z     : toggle using zero-cost replacements [default = %s]\n", fUseZeros? "yes": "no" );
+    Abc_Print( -2, "\t-c     : toggle verifying incremental levels after each move (slow) [default = %s]\n", fCheckLevels? "yes": "no" );
     Abc_Print( -2, "\t-v     : toggle verbose printout [default = %s]\n", fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-w     : toggle printout subgraph statistics [default = %s]\n", fVeryVerbose? "yes": "no" );
 //    Abc_Print( -2, "\t-p     : toggle placement-aware rewriting [default = %s]\n", fPlaceEnable? "yes": "no" );
@@ -8004,7 +8089,7 @@ usage:
 ***********************************************************************/
 int Abc_CommandRefactor( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
-    Abc_Ntk_t * pNtk = Abc_FrameReadNtk(pAbc), * pDup;
+    Abc_Ntk_t * pNtk = Abc_FrameReadNtk(pAbc);
     int c, RetValue;
     int nNodeSizeMax;
     int nMinSaved;
@@ -8112,16 +8197,18 @@ int Abc_CommandRefactor( Abc_Frame_t * pAbc, int argc, char ** argv )
     }
 
     // modify the current network
-    pDup = Abc_NtkDup( pNtk );
+    Abc_NtkUndoStart( pNtk );
     RetValue = Abc_NtkRefactor( pNtk, nNodeSizeMax, nMinSaved, nConeSizeMax, fUpdateLevel, fUseZeros, fUseDcs, fVerbose );
     if ( RetValue == -1 )
     {
-        Abc_FrameReplaceCurrentNetwork( pAbc, pDup );
-        printf( "An error occurred during computation. The original network is restored.\n" );
+        if ( Abc_NtkUndoRollback( pNtk ) )
+            printf( "An error occurred during computation. The original network is restored.\n" );
+        else
+            printf( "An error occurred during computation. The original network cannot be restored.\n" );
     }
     else
     {
-        Abc_NtkDelete( pDup );
+        Abc_NtkUndoStop( pNtk );
         if ( RetValue == 0 )
         {
             Abc_Print( 0, "Refactoring has failed.\n" );
@@ -8267,6 +8354,7 @@ int Abc_CommandResubstitute( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fUseZeros;
     int fVerbose;
     int fVeryVerbose;
+    int fCheckLevels;
     extern int Abc_NtkResubstitute( Abc_Ntk_t * pNtk, int nCutsMax, int nNodesMax, int nMinSaved, int nLevelsOdc, int fUpdateLevel, int fVerbose, int fVeryVerbose );
 
     // set defaults
@@ -8278,8 +8366,9 @@ int Abc_CommandResubstitute( Abc_Frame_t * pAbc, int argc, char ** argv )
     fUseZeros    =  0;
     fVerbose     =  0;
     fVeryVerbose =  0;
+    fCheckLevels =  0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "KNMFlzvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "KNMFlzcvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -8333,6 +8422,9 @@ int Abc_CommandResubstitute( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 'z':
             fUseZeros ^= 1;
             break;
+        case 'c':
+            fCheckLevels ^= 1;
+            break;
         case 'v':
             fVerbose ^= 1;
             break;
@@ -8377,15 +8469,22 @@ int Abc_CommandResubstitute( Abc_Frame_t * pAbc, int argc, char ** argv )
     }
 
     // modify the current network
+    if ( fCheckLevels && fUpdateLevel )
+        Abc_AigSetCheckLevels( (Abc_Aig_t *)pNtk->pManFunc, 1 );
     if ( !Abc_NtkResubstitute( pNtk, nCutsMax, nNodesMax, nMinSaved, nLevelsOdc, fUpdateLevel, fVerbose, fVeryVerbose ) )
     {
         Abc_Print( -1, "Refactoring has failed.\n" );
         return 1;
     }
+    if ( fCheckLevels && fUpdateLevel )
+    {
+        Abc_AigPrintCheckLevels( (Abc_Aig_t *)pNtk->pManFunc );
+        Abc_AigSetCheckLevels( (Abc_Aig_t *)pNtk->pManFunc, 0 );
+    }
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: resub [-KNMF <num>] [-lzvwh]\n" );
+    Abc_Print( -2, "usage: resub [-KNMF <num>] [-lzcvwh]\n" );
     Abc_Print( -2, "\t           performs technology-independent restructuring of the AIG\n" );
     Abc_Print( -2, "\t-K <num> : the max cut size (%d <= num <= %d) [default = %d]\n", RS_CUT_MIN, RS_CUT_MAX, nCutsMax );
     Abc_Print( -2, "\t-N <num> : the max number of nodes to add (0 <= num <= 3) [default = %d]\n", nNodesMax );
@@ -8393,6 +8492,7 @@ usage:
     Abc_Print( -2, "\t-F <num> : the number of fanout levels for ODC computation [default = %d]\n", nLevelsOdc );
     Abc_Print( -2, "\t-l       : toggle preserving the number of levels [default = %s]\n", fUpdateLevel? "yes": "no" );
     Abc_Print( -2, "\t-z       : toggle using zero-cost replacements [default = %s]\n", fUseZeros? "yes": "no" );
+    Abc_Print( -2, "\t-c       : toggle verifying incremental levels after each move (slow) [default = %s]\n", fCheckLevels? "yes": "no" );
     Abc_Print( -2, "\t-v       : toggle verbose printout [default = %s]\n", fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-w       : toggle verbose printout of ODC computation [default = %s]\n", fVeryVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h       : print the command usage\n");
@@ -15921,7 +16021,7 @@ int Abc_CommandDRewrite( Abc_Frame_t * pAbc, int argc, char ** argv )
     // set defaults
     Dar_ManDefaultRwrParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "CNMflzrvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "CNMflzrcvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -15970,6 +16070,9 @@ int Abc_CommandDRewrite( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 'r':
             pPars->fRecycle ^= 1;
             break;
+        case 'c':
+            pPars->fCheckLevels ^= 1;
+            break;
         case 'v':
             pPars->fVerbose ^= 1;
             break;
@@ -16007,7 +16110,7 @@ int Abc_CommandDRewrite( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: drw [-C num] [-NM num] [-lfzrvwh]\n" );
+    Abc_Print( -2, "usage: drw [-C num] [-NM num] [-lfzrcvwh]\n" );
     Abc_Print( -2, "\t         performs combinational AIG rewriting\n" );
     Abc_Print( -2, "\t-C num : the max number of cuts at a node [default = %d]\n", pPars->nCutsMax );
     Abc_Print( -2, "\t-N num : the max number of subgraphs tried [default = %d]\n", pPars->nSubgMax );
@@ -16016,6 +16119,7 @@ usage:
     Abc_Print( -2, "\t-f     : toggle representing fanouts [default = %s]\n", pPars->fFanout? "yes": "no" );
     Abc_Print( -2, "\t-z     : toggle using zero-cost replacements [default = %s]\n", pPars->fUseZeros? "yes": "no" );
     Abc_Print( -2, "\t-r     : toggle using cut recycling [default = %s]\n", pPars->fRecycle? "yes": "no" );
+    Abc_Print( -2, "\t-c     : toggle verifying incremental levels after each move (slow) [default = %s]\n", pPars->fCheckLevels? "yes": "no" );
     Abc_Print( -2, "\t-v     : toggle verbose printout [default = %s]\n", pPars->fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-w     : toggle very verbose printout [default = %s]\n", pPars->fVeryVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
@@ -20083,7 +20187,7 @@ int Abc_CommandIf( Abc_Frame_t * pAbc, int argc, char ** argv )
     If_ManSetDefaultPars( pPars );
     pPars->pLutLib = (If_LibLut_t *)Abc_FrameReadLibLut();
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "KCFAGRNTXYUZDEWSJqaflepmrsdbgxyzuojiktncvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "KCFAGRNTXYUZMDEWSJqaflepmrsdbgxyzuojiktncwvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -20223,6 +20327,17 @@ int Abc_CommandIf( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nLutDecSize < 3 || pPars->nLutDecSize > 6 )
                 goto usage;
             break;
+        case 'M':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-M\" should be followed by a non-negative integer.\n" );
+                goto usage;
+            }
+            pPars->nCacheLimit = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nCacheLimit < 0 )
+                goto usage;
+            break;
         case 'D':
             if ( globalUtilOptind >= argc )
             {
@@ -20351,6 +20466,9 @@ int Abc_CommandIf( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 'c':
             pPars->fUseTtPerm ^= 1;
             break;
+        case 'w':
+            pPars->fCacheKeep ^= 1;
+            break;
         case 'v':
             pPars->fVerbose ^= 1;
             break;
@@ -20662,7 +20780,7 @@ usage:
         sprintf(LutSize, "library" );
     else
         sprintf(LutSize, "%d", pPars->nLutSize );
-    Abc_Print( -2, "usage: if [-KCFAGRNTXYUZ num] [-DEW float] [-SJ str] [-qarlepmsdbgxyuojiktnczvh]\n" );
+    Abc_Print( -2, "usage: if [-KCFAGRNTXYUZM num] [-DEW float] [-SJ str] [-qarlepmsdbgxyuojiktnczwvh]\n" );
     Abc_Print( -2, "\t           performs FPGA technology mapping of the network\n" );
     Abc_Print( -2, "\t-K num   : the number of LUT inputs (2 < num < %d) [default = %s]\n", IF_MAX_LUTSIZE+1, LutSize );
     Abc_Print( -2, "\t-C num   : the max number of priority cuts (0 < num < 2^12) [default = %d]\n", pPars->nCutsMax );
@@ -20676,6 +20794,7 @@ usage:
     Abc_Print( -2, "\t-Y num   : area of AND-gate in LUT library units [default = %d]\n", pPars->nAndArea );
     Abc_Print( -2, "\t-U num   : the number of LUT inputs for delay-driven LUT decomposition [default = not used]\n" );
     Abc_Print( -2, "\t-Z num   : the number of LUT inputs for delay-driven LUT decomposition [default = not used]\n" );
+    Abc_Print( -2, "\t-M num   : the memory limit of the cut-function cache in MB (0 = no cache) [default = %d]\n", pPars->nCacheLimit );
     Abc_Print( -2, "\t-D float : sets the delay constraint for the mapping [default = %s]\n", Buffer );
     Abc_Print( -2, "\t-E float : sets epsilon used for tie-breaking [default = %f]\n", pPars->Epsilon );
     Abc_Print( -2, "\t-W float : sets wire delay between adjects LUTs [default = %f]\n", pPars->WireDelay );
@@ -20703,6 +20822,7 @@ usage:
     Abc_Print( -2, "\t-n       : toggles computing DSDs of the cut functions [default = %s]\n", pPars->fUseDsd? "yes": "no" );
     Abc_Print( -2, "\t-c       : toggles computing truth tables in a new way [default = %s]\n", pPars->fUseTtPerm? "yes": "no" );
     Abc_Print( -2, "\t-z       : toggles deriving LUTs when mapping into LUT structures [default = %s]\n", pPars->fDeriveLuts? "yes": "no" );
+    Abc_Print( -2, "\t-w       : toggles keeping the cut-function cache for the next call [default = %s]\n", pPars->fCacheKeep? "yes": "no" );
     Abc_Print( -2, "\t-v       : toggles verbose output [default = %s]\n", pPars->fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h       : prints the command usage\n");
     return 1;
@@ -27193,7 +27313,7 @@ int Abc_CommandAbc9Satoko( Abc_Frame_t * pAbc, int argc, char ** argv )
     satoko_opts_t opts;
     satoko_default_opts(&opts);
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "Csivh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Csipvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -27214,6 +27334,9 @@ int Abc_CommandAbc9Satoko( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 'i':
             fIncrem ^= 1;
             break;
+        case 'p':
+            opts.inprocess ^= 1;
+            break;
         case 'v':
             opts.verbose ^= 1;
             break;
@@ -27238,11 +27361,12 @@ int Abc_CommandAbc9Satoko( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &satoko [-C num] [-sivh] <file.cnf>\n" );
+    Abc_Print( -2, "usage: &satoko [-C num] [-sipvh] <file.cnf>\n" );
     Abc_Print( -2, "\t             run Satoko by Bruno Schmitt\n" );
     Abc_Print( -2, "\t-C num     : limit on the number of conflicts [default = %d]\n", opts.conf_limit );
     Abc_Print( -2, "\t-s         : split multi-output miter into individual outputs [default = %s]\n", fSplit? "yes": "no" );
     Abc_Print( -2, "\t-i         : split multi-output miter and solve incrementally [default = %s]\n", fIncrem? "yes": "no" );
+    Abc_Print( -2, "\t-p         : toggle vivification, subsumption and variable elimination [default = %s]\n", opts.inprocess? "yes": "no" );
     Abc_Print( -2, "\t-v         : prints verbose information [default = %s]\n", opts.verbose? "yes": "no" );
     Abc_Print( -2, "\t<file.cnf> : (optional) CNF file to solve\n");
     Abc_Print( -2, "\t-h         : print the command usage\n");
@@ -28265,7 +28389,7 @@ int Abc_CommandBmc3( Abc_Frame_t * pAbc, int argc, char ** argv )
     int c;
     Saig_ParBmcSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "SFTHGCDJIPQRLWaxdursgvzh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "SFTHGCDJIPQRNLWaxdursigvzh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -28401,6 +28525,17 @@ int Abc_CommandBmc3( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nLearnedPerce < 0 )
                 goto usage;
             break;
+        case 'N':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-N\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nProcs <= 0 )
+                goto usage;
+            break;
         case 'L':
             if ( globalUtilOptind >= argc )
             {
@@ -28437,6 +28572,9 @@ int Abc_CommandBmc3( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 's':
             pPars->fUseSatoko ^= 1;
             break;
+        case 'i':
+            pPars->fUseInproc ^= 1;
+            break;
         case 'g':
             pPars->fUseGlucose ^= 1;
             break;
@@ -28511,7 +28649,7 @@ int Abc_CommandBmc3( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: bmc3 [-SFTHGCDJIPQR num] [-LW file] [-axdursgvzh]\n" );
+    Abc_Print( -2, "usage: bmc3 [-SFTHGCDJIPQRN num] [-LW file] [-axdursigvzh]\n" );
     Abc_Print( -2, "\t         performs bounded model checking with dynamic unrolling\n" );
     Abc_Print( -2, "\t-S num : the starting time frame [default = %d]\n", pPars->nStart );
     Abc_Print( -2, "\t-F num : the max number of time frames (0 = unused) [default = %d]\n",      pPars->nFramesMax );
@@ -28525,6 +28663,7 @@ usage:
     Abc_Print( -2, "\t-P num : the max number of learned clauses to keep (0=unused) [default = %d]\n", pPars->nLearnedStart );
     Abc_Print( -2, "\t-Q num : delta value for learned clause removal [default = %d]\n",          pPars->nLearnedDelta );
     Abc_Print( -2, "\t-R num : percentage to keep for learned clause removal [default = %d]\n",   pPars->nLearnedPerce );
+    Abc_Print( -2, "\t-N num : the number of threads solving clusters of outputs [default = %d]\n", pPars->nProcs );
     Abc_Print( -2, "\t-L file: the log file name [default = %s]\n",                               pLogFileName ? pLogFileName : "no logging" );
     Abc_Print( -2, "\t-W file: the log file name with per-output details [default = %s]\n",       pPars->pLogFileName ? pPars->pLogFileName : "no logging" );
     Abc_Print( -2, "\t-a     : solve all outputs (do not stop when one is SAT) [default = %s]\n", pPars->fSolveAll? "yes": "no" );
@@ -28533,6 +28672,7 @@ usage:
     Abc_Print( -2, "\t-u     : toggle performing structural OR-decomposition [default = %s]\n",   fOrDecomp? "yes": "not" );
     Abc_Print( -2, "\t-r     : toggle disabling periodic restarts [default = %s]\n",              pPars->fNoRestarts? "yes": "no" );
     Abc_Print( -2, "\t-s     : toggle using Satoko by Bruno Schmitt [default = %s]\n", pPars->fUseSatoko? "yes": "no" );
+    Abc_Print( -2, "\t-i     : toggle inprocessing in Satoko (with \"-s\") [default = %s]\n",   pPars->fUseInproc? "yes": "no" );
     Abc_Print( -2, "\t-g     : toggle using Glucose 3.0 by Gilles Audemard and Laurent Simon [default = %s]\n",pPars->fUseGlucose? "yes": "no" );
     Abc_Print( -2, "\t-v     : toggle verbose output [default = %s]\n",                           pPars->fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-z     : toggle suppressing report about solved outputs [default = %s]\n",  pPars->fNotVerbose? "yes": "no" );
@@ -41146,7 +41286,7 @@ int Abc_CommandAbc9If( Abc_Frame_t * pAbc, int argc, char ** argv )
     }
     pPars->pLutLib = (If_LibLut_t *)pAbc->pLibLut;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "KCFAGRDEWSJTXYZqalepmrsdbgxyofuijkztncvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "KCFAGRDEWSJTXYZMUqalepmrsdbgxyofuijkztncvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -41325,6 +41465,20 @@ int Abc_CommandAbc9If( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nLutDecSize < 3 || pPars->nLutDecSize > 6 )
                 goto usage;
             break;
+        case 'M':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-M\" should be followed by a non-negative integer.\n" );
+                goto usage;
+            }
+            pPars->nCacheLimit = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nCacheLimit < 0 )
+                goto usage;
+            break;
+        case 'U':
+            pPars->fCacheKeep ^= 1;
+            break;
         case 'q':
             pPars->fPreprocess ^= 1;
             break;
@@ -41732,7 +41886,7 @@ usage:
         sprintf(LutSize, "library" );
     else
         sprintf(LutSize, "%d", pPars->nLutSize );
-    Abc_Print( -2, "usage: &if [-KCFAGRTXY num] [-DEW float] [-SJ str] [-qarlepmsdbgxyofuijkztnchvw]\n" );
+    Abc_Print( -2, "usage: &if [-KCFAGRTXYZM num] [-DEW float] [-SJ str] [-Uqarlepmsdbgxyofuijkztnchvw]\n" );
     Abc_Print( -2, "\t           performs FPGA technology mapping of the network\n" );
     Abc_Print( -2, "\t-K num   : the number of LUT inputs (2 < num < %d) [default = %s]\n", IF_MAX_LUTSIZE+1, LutSize );
     Abc_Print( -2, "\t-C num   : the max number of priority cuts (0 < num < 2^12) [default = %d]\n", pPars->nCutsMax );
@@ -41749,6 +41903,8 @@ usage:
     Abc_Print( -2, "\t-S str   : string representing the LUT structure [default = %s]\n", pPars->pLutStruct ? pPars->pLutStruct : "not used" );
     Abc_Print( -2, "\t-J str   : string representing the LUT structure [default = %s]\n", pPars->pLutStruct ? pPars->pLutStruct : "not used" );
     Abc_Print( -2, "\t-Z num   : the number of LUT inputs for delay-driven LUT decomposition [default = not used]\n" );
+    Abc_Print( -2, "\t-M num   : the memory limit of the cut-function cache in MB (0 = no cache) [default = %d]\n", pPars->nCacheLimit );
+    Abc_Print( -2, "\t-U       : toggles keeping the cut-function cache for the next call [default = %s]\n", pPars->fCacheKeep? "yes": "no" );
     Abc_Print( -2, "\t-q       : toggles preprocessing using several starting points [default = %s]\n", pPars->fPreprocess? "yes": "no" );
     Abc_Print( -2, "\t-a       : toggles area-oriented mapping [default = %s]\n", pPars->fArea? "yes": "no" );
     Abc_Print( -2, "\t-r       : enables expansion/reduction of the best cuts [default = %s]\n", pPars->fExpRed? "yes": "no" );
@@ -42193,7 +42349,7 @@ int Abc_CommandAbc9Jf( Abc_Frame_t * pAbc, int argc, char ** argv )
     Gia_Man_t * pNew; int c;
     Jf_ManSetDefaultPars( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "KCDWaekmdcgvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "KCPBDWaekmdcgvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -42225,6 +42381,28 @@ int Abc_CommandAbc9Jf( Abc_Frame_t * pAbc, int argc, char ** argv )
                 goto usage;
             }
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by a positive integer.\n" );
+                goto usage;
+            }
+            pPars->nProcNum = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nProcNum < 1 || pPars->nProcNum > pPars->nProcNumMax )
+                goto usage;
+            break;
+        case 'B':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-B\" should be followed by a non-negative integer.\n" );
+                goto usage;
+            }
+            pPars->nMemLimit = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nMemLimit < 0 )
+                goto usage;
+            break;
         case 'D':
             if ( globalUtilOptind >= argc )
             {
@@ -42316,10 +42494,12 @@ usage:
         sprintf(Buffer, "best possible" );
     else
         sprintf(Buffer, "%d", pPars->DelayTarget );
-    Abc_Print( -2, "usage: &jf [-KCDW num] [-akmdcgvwh]\n" );
+    Abc_Print( -2, "usage: &jf [-KCPBDW num] [-akmdcgvwh]\n" );
     Abc_Print( -2, "\t           performs technology mapping of the network\n" );
     Abc_Print( -2, "\t-K num   : LUT size for the mapping (2 <= K <= %d) [default = %d]\n", pPars->nLutSizeMax, pPars->nLutSize );
     Abc_Print( -2, "\t-C num   : the max number of priority cuts (1 <= C <= %d) [default = %d]\n", pPars->nCutNumMax, pPars->nCutNum );
+    Abc_Print( -2, "\t-P num   : the number of cut computation threads (1 <= P <= %d) [default = %d]\n", pPars->nProcNumMax, pPars->nProcNum );
+    Abc_Print( -2, "\t-B num   : the best-effort memory budget for cuts in MB (0 = no budget) [default = %d]\n", pPars->nMemLimit );
     Abc_Print( -2, "\t-D num   : sets the delay constraint for the mapping [default = %s]\n", Buffer );
     Abc_Print( -2, "\t-W num   : min frequency when printing functions with \"-w\" [default = %d]\n", pPars->nVerbLimit );
     Abc_Print( -2, "\t-a       : toggles area-oriented mapping [default = %s]\n", pPars->fAreaOnly? "yes": "no" );
@@ -42519,7 +42699,7 @@ int Abc_CommandAbc9Lf( Abc_Frame_t * pAbc, int argc, char ** argv )
     Gia_Man_t * pNew; int c;
     Lf_ManSetDefaultPars( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "KCFARLEDWMekmupstgvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "KCFARLEDWMBekmupstgvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -42642,6 +42822,17 @@ int Abc_CommandAbc9Lf( Abc_Frame_t * pAbc, int argc, char ** argv )
                 goto usage;
             }
             break;
+        case 'B':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-B\" should be followed by a non-negative integer.\n" );
+                goto usage;
+            }
+            pPars->nMemLimit = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nMemLimit < 0 )
+                goto usage;
+            break;
         case 'a':
             pPars->fAreaOnly ^= 1;
             break;
@@ -42720,7 +42911,7 @@ usage:
         sprintf(Buffer, "best possible" );
     else
         sprintf(Buffer, "%d", pPars->DelayTarget );
-    Abc_Print( -2, "usage: &lf [-KCFARLEDM num] [-kmupstgvwh]\n" );
+    Abc_Print( -2, "usage: &lf [-KCFARLEDMB num] [-kmupstgvwh]\n" );
     Abc_Print( -2, "\t           performs technology mapping of the network\n" );
     Abc_Print( -2, "\t-K num   : LUT size for the mapping (2 <= K <= %d) [default = %d]\n", pPars->nLutSizeMax, pPars->nLutSize );
     Abc_Print( -2, "\t-C num   : the max number of priority cuts (1 <= C <= %d) [default = %d]\n", pPars->nCutNumMax, pPars->nCutNum );
@@ -42731,6 +42922,7 @@ usage:
     Abc_Print( -2, "\t-E num   : the area/edge tradeoff parameter (0 <= num <= 100) [default = %d]\n", pPars->nAreaTuner );
     Abc_Print( -2, "\t-D num   : sets the delay constraint for the mapping [default = %s]\n", Buffer );
     Abc_Print( -2, "\t-M num   : LUT size when cofactoring is performed (0 <= num <= 100) [default = %d]\n", pPars->nLutSizeMux );
+    Abc_Print( -2, "\t-B num   : the best-effort memory budget for cuts in MB (0 = no budget) [default = %d]\n", pPars->nMemLimit );
 //    Abc_Print( -2, "\t-a       : toggles area-oriented mapping [default = %s]\n", pPars->fAreaOnly? "yes": "no" );
     Abc_Print( -2, "\t-e       : toggles edge vs node minimization [default = %s]\n", pPars->fOptEdge? "yes": "no" );
     Abc_Print( -2, "\t-k       : toggles coarsening the subject graph [default = %s]\n", pPars->fCoarsen? "yes": "no" );
@@ -42972,7 +43164,7 @@ int Abc_CommandAbc9Nf( Abc_Frame_t * pAbc, int argc, char ** argv )
     Gia_Man_t * pNew; int c;
     Nf_ManSetDefaultPars( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "KCFARLEDQWakpqfvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "KCFARLEDQPWakpqfvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -43081,6 +43273,17 @@ int Abc_CommandAbc9Nf( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nReqTimeFlex < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by a positive integer.\n" );
+                goto usage;
+            }
+            pPars->nProcNum = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nProcNum < 0 || pPars->nProcNum > pPars->nProcNumMax )
+                goto usage;
+            break;
         case 'W':
             if ( globalUtilOptind >= argc )
             {
@@ -43145,7 +43348,7 @@ usage:
         sprintf(Buffer, "best possible" );
     else
         sprintf(Buffer, "%d", pPars->DelayTarget );
-    Abc_Print( -2, "usage: &nf [-KCFARLEDQ num] [-akpqfvwh]\n" );
+    Abc_Print( -2, "usage: &nf [-KCFARLEDQP num] [-akpqfvwh]\n" );
     Abc_Print( -2, "\t           performs technology mapping of the network\n" );
     Abc_Print( -2, "\t-K num   : LUT size for the mapping (2 <= K <= %d) [default = %d]\n",                  pPars->nLutSizeMax, pPars->nLutSize );
     Abc_Print( -2, "\t-C num   : the max number of priority cuts (1 <= C <= %d) [default = %d]\n",           pPars->nCutNumMax, pPars->nCutNum );
@@ -43156,6 +43359,7 @@ usage:
     Abc_Print( -2, "\t-E num   : the area/edge tradeoff parameter (0 <= num <= 100) [default = %d]\n",       pPars->nAreaTuner );
     Abc_Print( -2, "\t-D num   : sets the delay constraint for the mapping [default = %s]\n",                Buffer );
     Abc_Print( -2, "\t-Q num   : internal parameter impacting area of the mapping [default = %d]\n",         pPars->nReqTimeFlex );
+    Abc_Print( -2, "\t-P num   : the number of threads used for cuts and matches (P <= %d) [default = %d]\n", pPars->nProcNumMax, pPars->nProcNum );
     Abc_Print( -2, "\t-a       : toggles SAT-based area-oriented mapping (experimental) [default = %s]\n",   pPars->fAreaOnly? "yes": "no" );
     Abc_Print( -2, "\t-k       : toggles coarsening the subject graph [default = %s]\n",                     pPars->fCoarsen? "yes": "no" );
     Abc_Print( -2, "\t-p       : toggles pin permutation (more matches - better quality) [default = %s]\n",  pPars->fPinPerm? "yes": "no" );
@@ -45586,7 +45790,7 @@ int Abc_CommandAbc9ReachP( Abc_Frame_t * pAbc, int argc, char ** argv )
     // set defaults
     Llb_ManSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "NBFTLrbyzdvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "NBFPTLrbyzsdvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -45623,6 +45827,17 @@ int Abc_CommandAbc9ReachP( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nIterMax < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nProcs <= 0 )
+                goto usage;
+            break;
         case 'T':
             if ( globalUtilOptind >= argc )
             {
@@ -45655,6 +45870,9 @@ int Abc_CommandAbc9ReachP( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 'z':
             pPars->fSkipReach ^= 1;
             break;
+        case 's':
+            pPars->fSplitParts ^= 1;
+            break;
         case 'd':
             pPars->fDumpReached ^= 1;
             break;
@@ -45695,17 +45913,19 @@ int Abc_CommandAbc9ReachP( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &reachp [-NFT num] [-L file] [-rbyzdvwh]\n" );
+    Abc_Print( -2, "usage: &reachp [-NFPT num] [-L file] [-rbyzsdvwh]\n" );
     Abc_Print( -2, "\t         model checking via BDD-based reachability (partitioning-based)\n" );
     Abc_Print( -2, "\t-N num : partitioning value (MinVol=nANDs/N/2; MaxVol=nANDs/N) [default = %d]\n", pPars->nPartValue );
 //    Abc_Print( -2, "\t-B num : the BDD node increase when hints kick in [default = %d]\n", pPars->nBddMax );
     Abc_Print( -2, "\t-F num : max number of reachability iterations [default = %d]\n", pPars->nIterMax );
+    Abc_Print( -2, "\t-P num : the number of threads for image computation [default = %d]\n", pPars->nProcs );
     Abc_Print( -2, "\t-T num : approximate time limit in seconds (0=infinite) [default = %d]\n", pPars->TimeLimit );
     Abc_Print( -2, "\t-L file: the log file name [default = %s]\n", pLogFileName ? pLogFileName : "no logging" );
     Abc_Print( -2, "\t-r     : enable additional BDD var reordering before image [default = %s]\n", pPars->fReorder? "yes": "no" );
     Abc_Print( -2, "\t-b     : perform backward reachability analysis [default = %s]\n", pPars->fBackward? "yes": "no" );
     Abc_Print( -2, "\t-y     : skip checking property outputs [default = %s]\n", pPars->fSkipOutCheck? "yes": "no" );
     Abc_Print( -2, "\t-z     : skip reachability (run preparation phase only) [default = %s]\n", pPars->fSkipReach? "yes": "no" );
+    Abc_Print( -2, "\t-s     : toggle dividing partitions rather than states among threads [default = %s]\n", pPars->fSplitParts? "partitions": "states" );
     Abc_Print( -2, "\t-d     : dump BDD of reached states into file \"reached.blif\" [default = %s]\n", pPars->fDumpReached? "yes": "no" );
     Abc_Print( -2, "\t-v     : prints verbose information [default = %s]\n", pPars->fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-w     : prints additional information [default = %s]\n", pPars->fVeryVerbose? "yes": "no" );
@@ -45869,7 +46089,7 @@ int Abc_CommandAbc9ReachY( Abc_Frame_t * pAbc, int argc, char ** argv )
     pPars->nBddMax     = 100;
     pPars->nClusterMax = 500;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "BCFTLbcryzvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "BCFPTLbcryzsvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -45906,6 +46126,17 @@ int Abc_CommandAbc9ReachY( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nIterMax < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nProcs <= 0 )
+                goto usage;
+            break;
         case 'T':
             if ( globalUtilOptind >= argc )
             {
@@ -45941,6 +46172,9 @@ int Abc_CommandAbc9ReachY( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 'z':
             pPars->fSkipReach ^= 1;
             break;
+        case 's':
+            pPars->fSplitParts ^= 1;
+            break;
         case 'v':
             pPars->fVerbose ^= 1;
             break;
@@ -45980,11 +46214,12 @@ int Abc_CommandAbc9ReachY( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &reachy [-BCFT num] [-L file] [-bcryzvh]\n" );
+    Abc_Print( -2, "usage: &reachy [-BCFPT num] [-L file] [-bcryzsvh]\n" );
     Abc_Print( -2, "\t         model checking via BDD-based reachability (non-linear-QS-based)\n" );
     Abc_Print( -2, "\t-B num : the max BDD size to introduce cut points [default = %d]\n", pPars->nBddMax );
     Abc_Print( -2, "\t-C num : the max BDD size to reparameterize/cluster [default = %d]\n", pPars->nClusterMax );
     Abc_Print( -2, "\t-F num : max number of reachability iterations [default = %d]\n", pPars->nIterMax );
+    Abc_Print( -2, "\t-P num : the number of threads for image computation [default = %d]\n", pPars->nProcs );
     Abc_Print( -2, "\t-T num : approximate time limit in seconds (0=infinite) [default = %d]\n", pPars->TimeLimit );
     Abc_Print( -2, "\t-L file: the log file name [default = %s]\n", pLogFileName ? pLogFileName : "no logging" );
     Abc_Print( -2, "\t-b     : enable using backward enumeration [default = %s]\n", pPars->fBackward? "yes": "no" );
@@ -45992,6 +46227,7 @@ usage:
     Abc_Print( -2, "\t-r     : enable additional BDD var reordering before image [default = %s]\n", pPars->fReorder? "yes": "no" );
     Abc_Print( -2, "\t-y     : skip checking property outputs [default = %s]\n", pPars->fSkipOutCheck? "yes": "no" );
     Abc_Print( -2, "\t-z     : skip reachability (run preparation phase only) [default = %s]\n", pPars->fSkipReach? "yes": "no" );
+    Abc_Print( -2, "\t-s     : toggle dividing partitions rather than states among threads [default = %s]\n", pPars->fSplitParts? "partitions": "states" );
     Abc_Print( -2, "\t-v     : prints verbose information [default = %s]\n", pPars->fVerbose? "yes": "no" );
 //    Abc_Print( -2, "\t-w     : prints additional information [default = %s]\n", pPars->fVeryVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
@@ -224,6 +224,8 @@ Abc_Ntk_t * Abc_NtkCollapse( Abc_Ntk_t * pNtk, int fBddSizeMax, int fDualRail, i
 
     // create the new network
     pNtkNew = Abc_NtkFromGlobalBdds( pNtk, fReverse );
+    if ( fVerbose )
+        Extra_PrintManagerProfile( (DdManager *)Abc_NtkGlobalBddMan(pNtk), "Collapse" );
     Abc_NtkFreeGlobalBdds( pNtk, 1 );
     if ( pNtkNew == NULL )
         return NULL;
@@ -0,0 +1,396 @@
+/**CFile****************************************************************
+
+  FileName    [abcOrchPolicy.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Network and node package.]
+
+  Synopsis    [Learned decision policy for orchestration.]
+
+  Author      [LSV-PA contributors]
+  
+  Affiliation []
+
+  Date        [Ver. 1.0.]
+
+  Revision    [$Id: abcOrchPolicy.c $]
+
+***********************************************************************/
+
+#include "base/abc/abc.h"
+#include "misc/vec/vecMem.h"
+#include "misc/util/utilTruth.h"
+#include "opt/dau/dau.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the policy remembers which of the local operators won for the nodes
+// whose small cut function belongs to the given NPN class; the winners
+// are counted in vWins (ABC_ORCH_NUM counters per class, see abc.h)
+
+#define ABC_ORCH_CUT_SIZE    6   // the cut size used to derive the key
+#define ABC_ORCH_EXPLORE    16   // re-evaluate all operators every so many visits
+
+typedef struct Abc_OrchPolicy_t_ Abc_OrchPolicy_t;
+struct Abc_OrchPolicy_t_
+{
+    Vec_Mem_t *    vTtMem;      // NPN canonical forms of the cut functions
+    Vec_Int_t *    vWins;       // the winner counters for each class
+    Vec_Int_t *    vVisits;     // the number of visits of each class
+    Abc_ManCut_t * pManCut;     // the manager for the key cuts
+    Vec_Ptr_t *    vVisited;    // the nodes in the key cut cone
+    Vec_Wrd_t *    vTruths;     // the truth tables of the key cut cone
+    Vec_Int_t *    vObj2Truth;  // mapping of object IDs into vTruths
+    // statistics of the last run
+    int            nLookups;    // the number of classified nodes
+    int            nPredicts;   // the number of nodes evaluated with one operator
+    int            nSkipped;    // the number of nodes skipped altogether
+    int            nClassesBeg; // the number of classes at the start of the run
+};
+
+static Abc_OrchPolicy_t * pOrchPolicy = NULL;
+
+static char * s_OrchOpNames[ABC_ORCH_NUM] = { "rwr", "res", "ref", "none" };
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Creates the policy store.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Abc_OrchPolicy_t * Abc_OrchPolicyStart()
+{
+    Abc_OrchPolicy_t * p;
+    p = ABC_CALLOC( Abc_OrchPolicy_t, 1 );
+    p->vTtMem   = Vec_MemAllocForTTSimple( ABC_ORCH_CUT_SIZE );
+    p->vWins    = Vec_IntAlloc( 1000 * ABC_ORCH_NUM );
+    p->vVisits  = Vec_IntAlloc( 1000 );
+    p->pManCut  = Abc_NtkManCutStart( ABC_ORCH_CUT_SIZE, 16, 2, 1000 );
+    p->vVisited = Vec_PtrAlloc( 100 );
+    p->vTruths  = Vec_WrdAlloc( 100 );
+    p->vObj2Truth = Vec_IntAlloc( 1000 );
+    return p;
+}
+static void Abc_OrchPolicyStop( Abc_OrchPolicy_t * p )
+{
+    Vec_MemHashFree( p->vTtMem );
+    Vec_MemFree( p->vTtMem );
+    Vec_IntFree( p->vWins );
+    Vec_IntFree( p->vVisits );
+    Abc_NtkManCutStop( p->pManCut );
+    Vec_PtrFree( p->vVisited );
+    Vec_WrdFree( p->vTruths );
+    Vec_IntFree( p->vObj2Truth );
+    ABC_FREE( p );
+}
+static Abc_OrchPolicy_t * Abc_OrchPolicyGet()
+{
+    if ( pOrchPolicy == NULL )
+        pOrchPolicy = Abc_OrchPolicyStart();
+    return pOrchPolicy;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Deletes the policy store when the program exits.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_OrchPolicyQuit()
+{
+    if ( pOrchPolicy != NULL )
+    {
+        Abc_OrchPolicyStop( pOrchPolicy );
+        pOrchPolicy = NULL;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finds or adds the class with the given canonical form.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_OrchPolicyFindOrAdd( Abc_OrchPolicy_t * p, word uCanon )
+{
+    int k, iClass = Vec_MemHashInsert( p->vTtMem, &uCanon );
+    if ( iClass == Vec_IntSize(p->vVisits) )
+    {
+        for ( k = 0; k < ABC_ORCH_NUM; k++ )
+            Vec_IntPush( p->vWins, 0 );
+        Vec_IntPush( p->vVisits, 0 );
+    }
+    assert( Vec_IntSize(p->vWins) == ABC_ORCH_NUM * Vec_IntSize(p->vVisits) );
+    return iClass;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the policy from file into the store.]
+
+  Description [Each line contains the canonical truth table in hex
+  followed by the win counters of rewrite, resub, refactor, and none.
+  Lines with malformed truth tables are skipped. The counters in the
+  store are replaced by those in the file, because the file already
+  has the ones learned when it was saved. The store is kept if the
+  file does not exist.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_OrchPolicyLoad( char * pFileName )
+{
+    Abc_OrchPolicy_t * p;
+    char Buffer[1000], TtStr[100];
+    int Wins[ABC_ORCH_NUM], k, iClass, nLines = 0;
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return -1;
+    Abc_OrchPolicyQuit();
+    p = Abc_OrchPolicyGet();
+    while ( fgets( Buffer, 1000, pFile ) != NULL )
+    {
+        word uCanon = 0;
+        if ( Buffer[0] == '#' )
+            continue;
+        if ( sscanf( Buffer, "%99s %d %d %d %d", TtStr, Wins, Wins+1, Wins+2, Wins+3 ) != 5 )
+            continue;
+        // the truth table should fit into one word
+        if ( (int)strlen(TtStr) > (1 << (ABC_ORCH_CUT_SIZE-2)) )
+            continue;
+        Abc_TtReadHexNumber( &uCanon, TtStr );
+        iClass = Abc_OrchPolicyFindOrAdd( p, uCanon );
+        for ( k = 0; k < ABC_ORCH_NUM; k++ )
+            Vec_IntAddToEntry( p->vWins, ABC_ORCH_NUM * iClass + k, Wins[k] );
+        nLines++;
+    }
+    fclose( pFile );
+    return nLines;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the policy into a file.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_OrchPolicySave( char * pFileName )
+{
+    Abc_OrchPolicy_t * p = Abc_OrchPolicyGet();
+    word * pTruth;
+    int i, k;
+    FILE * pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL )
+        return 0;
+    fprintf( pFile, "# Orchestration policy with %d NPN classes of %d-input cuts.\n", Vec_MemEntryNum(p->vTtMem), ABC_ORCH_CUT_SIZE );
+    fprintf( pFile, "# truth rwr res ref none\n" );
+    Vec_MemForEachEntry( p->vTtMem, pTruth, i )
+    {
+        Abc_TtPrintHexRev( pFile, pTruth, ABC_ORCH_CUT_SIZE );
+        for ( k = 0; k < ABC_ORCH_NUM; k++ )
+            fprintf( pFile, " %d", Vec_IntEntry(p->vWins, ABC_ORCH_NUM * i + k) );
+        fprintf( pFile, "\n" );
+    }
+    fclose( pFile );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Resets the statistics before the run.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_OrchPolicyRunStart()
+{
+    Abc_OrchPolicy_t * p = Abc_OrchPolicyGet();
+    p->nLookups    = 0;
+    p->nPredicts   = 0;
+    p->nSkipped    = 0;
+    p->nClassesBeg = Vec_MemEntryNum( p->vTtMem );
+}
+void Abc_OrchPolicyRunPrint()
+{
+    Abc_OrchPolicy_t * p = Abc_OrchPolicyGet();
+    printf( "Policy:  Classes = %d (+%d).  Lookups = %d.  Single-operator = %d (%.2f %%).  Skipped = %d (%.2f %%).\n",
+        Vec_MemEntryNum(p->vTtMem), Vec_MemEntryNum(p->vTtMem) - p->nClassesBeg, p->nLookups,
+        p->nPredicts, 100.0 * p->nPredicts / Abc_MaxInt(p->nLookups, 1),
+        p->nSkipped, 100.0 * p->nSkipped / Abc_MaxInt(p->nLookups, 1) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the NPN class of the node's small cut function.]
+
+  Description [Returns the class ID, or -1 if the cut cannot be used.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_OrchPolicyClassify( Abc_Obj_t * pNode )
+{
+    Abc_OrchPolicy_t * p = Abc_OrchPolicyGet();
+    Vec_Ptr_t * vLeaves;
+    Abc_Obj_t * pObj;
+    word uTruth, uTruth0, uTruth1;
+    char pCanonPerm[16];
+    int i, nLeaves;
+    vLeaves = Abc_NodeFindCut( p->pManCut, pNode, 0 );
+    nLeaves = Vec_PtrSize( vLeaves );
+    if ( nLeaves > ABC_ORCH_CUT_SIZE )
+        return -1;
+    Abc_NodeConeCollect( &pNode, 1, vLeaves, p->vVisited, 0 );
+    // assign elementary truth tables to the leaves and simulate the cone
+    Vec_WrdClear( p->vTruths );
+    Vec_IntFillExtra( p->vObj2Truth, Abc_NtkObjNumMax(pNode->pNtk), -1 );
+    Vec_PtrForEachEntry( Abc_Obj_t *, vLeaves, pObj, i )
+    {
+        Vec_IntWriteEntry( p->vObj2Truth, Abc_ObjId(pObj), Vec_WrdSize(p->vTruths) );
+        Vec_WrdPush( p->vTruths, s_Truths6[i] );
+    }
+    Vec_PtrForEachEntry( Abc_Obj_t *, p->vVisited, pObj, i )
+    {
+        uTruth0 = Vec_WrdEntry( p->vTruths, Vec_IntEntry(p->vObj2Truth, Abc_ObjFaninId0(pObj)) );
+        uTruth1 = Vec_WrdEntry( p->vTruths, Vec_IntEntry(p->vObj2Truth, Abc_ObjFaninId1(pObj)) );
+        uTruth0 = Abc_ObjFaninC0(pObj) ? ~uTruth0 : uTruth0;
+        uTruth1 = Abc_ObjFaninC1(pObj) ? ~uTruth1 : uTruth1;
+        Vec_IntWriteEntry( p->vObj2Truth, Abc_ObjId(pObj), Vec_WrdSize(p->vTruths) );
+        Vec_WrdPush( p->vTruths, uTruth0 & uTruth1 );
+    }
+    uTruth = Vec_WrdEntryLast( p->vTruths );
+    // derive the canonical form
+    Abc_TtCanonicize( &uTruth, ABC_ORCH_CUT_SIZE, pCanonPerm );
+    p->nLookups++;
+    return Abc_OrchPolicyFindOrAdd( p, uTruth );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Predicts the winning operator for the class.]
+
+  Description [Returns the operator to be evaluated alone, or -1 if all
+  operators should be evaluated. The prediction is made if the class has
+  been seen at least nMinVisits times and one operator won in at least
+  3/4 of the cases. Every ABC_ORCH_EXPLORE-th visit of a class evaluates
+  all operators, to let the policy track the changes in the design.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_OrchPolicyPredict( int iClass, int nMinVisits )
+{
+    Abc_OrchPolicy_t * p = Abc_OrchPolicyGet();
+    int * pWins = Vec_IntEntryP( p->vWins, ABC_ORCH_NUM * iClass );
+    int k, Best = 0, nTotal = 0;
+    Vec_IntAddToEntry( p->vVisits, iClass, 1 );
+    if ( Vec_IntEntry(p->vVisits, iClass) % ABC_ORCH_EXPLORE == 0 )
+        return -1;
+    for ( k = 0; k < ABC_ORCH_NUM; k++ )
+    {
+        nTotal += pWins[k];
+        if ( pWins[Best] < pWins[k] )
+            Best = k;
+    }
+    if ( nTotal < nMinVisits || 4 * pWins[Best] < 3 * nTotal )
+        return -1;
+    if ( Best == ABC_ORCH_NONE )
+        p->nSkipped++;
+    else
+        p->nPredicts++;
+    return Best;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the operator that won after evaluating all.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_OrchPolicyRecord( int iClass, int Op )
+{
+    Abc_OrchPolicy_t * p = Abc_OrchPolicyGet();
+    assert( Op >= 0 && Op < ABC_ORCH_NUM );
+    Vec_IntAddToEntry( p->vWins, ABC_ORCH_NUM * iClass + Op, 1 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints the summary of the policy.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_OrchPolicyPrint()
+{
+    Abc_OrchPolicy_t * p = Abc_OrchPolicyGet();
+    int Counts[ABC_ORCH_NUM] = {0}, i, k, Best;
+    for ( i = 0; i < Vec_MemEntryNum(p->vTtMem); i++ )
+    {
+        int * pWins = Vec_IntEntryP( p->vWins, ABC_ORCH_NUM * i );
+        for ( Best = 0, k = 1; k < ABC_ORCH_NUM; k++ )
+            if ( pWins[Best] < pWins[k] )
+                Best = k;
+        Counts[Best]++;
+    }
+    printf( "Policy:  Classes = %d.  Dominant operator:", Vec_MemEntryNum(p->vTtMem) );
+    for ( k = 0; k < ABC_ORCH_NUM; k++ )
+        printf( "  %s = %d", s_OrchOpNames[k], Counts[k] );
+    printf( ".\n" );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
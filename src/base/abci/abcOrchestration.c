@@ -3228,7 +3228,7 @@ s_ResubTime = Abc_Clock() - clkStart;
 }
 
 // local greedy orchestration
-int Abc_NtkOrchLocal( Abc_Ntk_t * pNtk, int fUseZeros_rwr, int fUseZeros_ref, int fPlaceEnable, int nCutMax, int nStepsMax, int nLevelsOdc, int fUpdateLevel, int fVerbose, int fVeryVerbose, int nNodeSizeMax, int nConeSizeMax, int fUseDcs )
+int Abc_NtkOrchLocal( Abc_Ntk_t * pNtk, int fUseZeros_rwr, int fUseZeros_ref, int fPlaceEnable, int nCutMax, int nStepsMax, int nLevelsOdc, int fUpdateLevel, int fVerbose, int fVeryVerbose, int nNodeSizeMax, int nConeSizeMax, int fUseDcs, int fUsePolicy, int nPolicyMin )
 {
     ProgressBar * pProgress;
     // For resub
@@ -3254,6 +3254,7 @@ int Abc_NtkOrchLocal( Abc_Ntk_t * pNtk, int fUseZeros_rwr, int fUseZeros_ref, in
     abctime clk, clkStart = Abc_Clock();
     abctime s_ResubTime;
     int i, nNodes, nGain, fCompl, RetValue = 1;//, nGain_zeros;
+    int iClass = -1, Predict = -1, Winner;
     //int decisionOps = 0;
     int ops_rwr = 0;
     int ops_res = 0;
@@ -3310,6 +3311,9 @@ Rwr_ManAddTimeCuts( pManRwr, Abc_Clock() - clk );
     //if (pGain_ref) *pGain_ref = Vec_IntAlloc(1);
     //if (pGain_rwr) *pGain_rwr = Vec_IntAlloc(1);
 
+    if ( fUsePolicy )
+        Abc_OrchPolicyRunStart();
+
     pProgress = Extra_ProgressBarStart( stdout, nNodes );
 
     Abc_NtkForEachNode( pNtk, pNode, i )
@@ -3334,18 +3338,37 @@ Rwr_ManAddTimeCuts( pManRwr, Abc_Clock() - clk );
         // stop if all nodes have been tried once
         if ( i >= nNodes )
             break;
+
+        // consult the policy to skip the operators that are likely to lose
+        if ( fUsePolicy )
+        {
+            iClass  = Abc_OrchPolicyClassify( pNode );
+            Predict = iClass >= 0 ? Abc_OrchPolicyPredict( iClass, nPolicyMin ) : -1;
+            if ( Predict == ABC_ORCH_NONE )
+            {
+                ops_null++;
+                continue;
+            }
+        }
+        pFFormRef = pFFormRes = NULL;
+        pManRef->nLastGain = pManRes->nLastGain = nGain = -1;
         
 clk = Abc_Clock();
 
 //Refactor
+        if ( Predict == -1 || Predict == ABC_ORCH_REF )
+        {
         vFanins = Abc_NodeFindCut( pManCutRef, pNode, fUseDcs );
 pManRef->timeCut += Abc_Clock() - clk;
 clk = Abc_Clock();
         //pFFormRef = Abc_NodeRefactor_1( pManRef, pNode, vFanins, fUpdateLevel, fUseZeros, fUseDcs, fVerbose );
         pFFormRef = Abc_NodeRefactor_1( pManRef, pNode, vFanins, fUpdateLevel, fUseZeros_ref, fUseDcs, fVerbose );
 pManRef->timeRes += Abc_Clock() - clk;
+        }
 
 // Resub
+        if ( Predict == -1 || Predict == ABC_ORCH_RES )
+        {
         // compute a reconvergence-driven cut
         vLeaves = Abc_NodeFindCut( pManCutRes, pNode, 0 );
 //        vLeaves = Abc_CutFactorLarge( pNode, nCutMax );
@@ -3364,14 +3387,29 @@ clk = Abc_Clock();
 //        Vec_PtrFree( vLeaves );
 //        Abc_ManResubCleanup( pManRes );
 pManRes->timeRes += Abc_Clock() - clk;
+        }
 
 // Rewrite
         //nGain = Rwr_NodeRewrite( pManRwr, pManCutRwr, pNode, fUpdateLevel, fUseZeros, fPlaceEnable );
+        if ( Predict == -1 || Predict == ABC_ORCH_RWR )
         nGain = Rwr_NodeRewrite( pManRwr, pManCutRwr, pNode, fUpdateLevel, fUseZeros_rwr, fPlaceEnable );
 
-     // compare local reward and update
+     // compare local reward
         // if (((! (nGain < 0)) && (! (nGain < pManRes->nLastGain)) && (! (pManRes->nLastGain < pManRef->nLastGain))) || ((! (nGain < 0)) && (! (nGain < pManRef->nLastGain)) && (! (pManRef->nLastGain < pManRes->nLastGain)))){
-        if (((! (nGain < 0)) && (! (nGain < pManRes->nLastGain)) && (! (nGain < pManRef->nLastGain)))){
+        if (((! (nGain < 0)) && (! (nGain < pManRes->nLastGain)) && (! (nGain < pManRef->nLastGain))))
+            Winner = ABC_ORCH_RWR;
+        else if (((! (pManRes->nLastGain < 0)) && (! (pManRes->nLastGain < nGain)) && (! (pManRes->nLastGain < pManRef->nLastGain))))
+            Winner = ABC_ORCH_RES;
+        else if (((! (pManRef->nLastGain < 0)) && (! (pManRef->nLastGain < nGain)) && (! (pManRef->nLastGain < pManRes->nLastGain))))
+            Winner = ABC_ORCH_REF;
+        else
+            Winner = ABC_ORCH_NONE;
+        // remember the winner if all operators were evaluated
+        if ( iClass >= 0 && Predict == -1 )
+            Abc_OrchPolicyRecord( iClass, Winner );
+
+     // update
+        if ( Winner == ABC_ORCH_RWR ){
         // update with rewrite
             pGraph = (Dec_Graph_t *)Rwr_ManReadDecs(pManRwr);
             fCompl = Rwr_ManReadCompl(pManRwr);
@@ -3386,7 +3424,7 @@ Rwr_ManAddTimeUpdate( pManRwr, Abc_Clock() - clk );
             continue;
         } 
         // if (((! (pManRes->nLastGain < 0)) && (! (pManRes->nLastGain < nGain)) && (! (nGain < pManRef->nLastGain))) || ((! (pManRes->nLastGain < 0)) && (! (pManRes->nLastGain < pManRef->nLastGain)) && (! (pManRef->nLastGain < nGain)))){
-        if (((! (pManRes->nLastGain < 0)) && (! (pManRes->nLastGain < nGain)) && (! (pManRes->nLastGain < pManRef->nLastGain)))){
+        if ( Winner == ABC_ORCH_RES ){
         // update with Resub
             if ( pFFormRes == NULL )
                 continue;
@@ -3399,7 +3437,7 @@ pManRes->timeNtk += Abc_Clock() - clk;
             continue;
         }
         // if (((! (pManRef->nLastGain < 0)) && (! (pManRef->nLastGain < nGain)) && (! (nGain < pManRes->nLastGain))) || ((! (pManRef->nLastGain < 0)) && (! (pManRef->nLastGain < pManRes->nLastGain)) && (! (pManRes->nLastGain < nGain)))){
-        if (((! (pManRef->nLastGain < 0)) && (! (pManRef->nLastGain < nGain)) && (! (pManRef->nLastGain < pManRes->nLastGain)))){
+        if ( Winner == ABC_ORCH_REF ){
         // update with Refactor
             if ( pFFormRef == NULL )
                 continue;
@@ -3443,6 +3481,8 @@ pManRef->timeTotal = Abc_Clock() - clkStart;
         Abc_ManResubPrint( pManRes );
         Rwr_ManPrintStats( pManRwr );
         Abc_NtkManRefPrintStats_1( pManRef );
+        if ( fUsePolicy )
+            Abc_OrchPolicyRunPrint();
     }
     if ( fVeryVerbose )
         Rwr_ScoresReport( pManRwr );
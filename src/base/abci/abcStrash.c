@@ -29,6 +29,19 @@ ABC_NAMESPACE_IMPL_START
 ////////////////////////////////////////////////////////////////////////
 
 static void Abc_NtkStrashPerform( Abc_Ntk_t * pNtk, Abc_Ntk_t * pNtkNew, int fAllNodes, int fRecord );
+static void Abc_NtkStrashPerformPar( Abc_Ntk_t * pNtk, Abc_Ntk_t * pNtkNew, int fAllNodes, int nProcs );
+static Abc_Obj_t * Abc_NodeStrashHop( Abc_Ntk_t * pNtkNew, Abc_Obj_t * pNodeOld, Hop_Man_t * pMan, Hop_Obj_t * pRoot );
+
+// one chunk of logic nodes converted from SOPs into AIGs by one thread
+typedef struct Abc_StrashChunk_t_ Abc_StrashChunk_t;
+struct Abc_StrashChunk_t_
+{
+    Abc_Ntk_t *     pNtk;          // the logic network with SOPs
+    Vec_Ptr_t *     vRoots;        // local AIG roots of the nodes (indexed by object ID)
+    Hop_Man_t *     pMan;          // the AIG manager of this chunk
+    int             iStart;        // the first object ID of the chunk
+    int             iStop;         // the object ID following the chunk
+};
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -263,6 +276,27 @@ Abc_Ntk_t * Abc_NtkRestrashZero( Abc_Ntk_t * pNtk, int fCleanup )
 
 ***********************************************************************/
 Abc_Ntk_t * Abc_NtkStrash( Abc_Ntk_t * pNtk, int fAllNodes, int fCleanup, int fRecord )
+{
+    return Abc_NtkStrashPar( pNtk, fAllNodes, fCleanup, fRecord, 1 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Transforms logic network into structurally hashed AIG.]
+
+  Description [If nProcs is more than 1 and the network has SOPs, the
+  SOPs are factored and converted into local AIGs by nProcs threads,
+  and the local AIGs are then hashed into the new AIG in the DFS order.
+  The result is the same as without threads up to the order of the AND
+  nodes. In this case, the original network keeps its SOPs. Strashing
+  with the record of AIG subgraphs (fRecord) is not concurrent.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Ntk_t * Abc_NtkStrashPar( Abc_Ntk_t * pNtk, int fAllNodes, int fCleanup, int fRecord, int nProcs )
 {
     Abc_Ntk_t * pNtkAig;
     int nNodes;
@@ -270,16 +304,25 @@ Abc_Ntk_t * Abc_NtkStrash( Abc_Ntk_t * pNtk, int fAllNodes, int fCleanup, int fR
     // consider the special case when the network is already structurally hashed
     if ( Abc_NtkIsStrash(pNtk) )
         return Abc_NtkRestrash( pNtk, fCleanup );
-    // convert the node representation in the logic network to the AIG form
-    if ( !Abc_NtkToAig(pNtk) )
+    if ( nProcs > 1 && !fRecord && Abc_NtkHasSop(pNtk) )
     {
-        printf( "Converting to AIGs has failed.\n" );
-        return NULL;
+        // convert the SOPs concurrently while strashing
+        pNtkAig = Abc_NtkStartFrom( pNtk, ABC_NTK_STRASH, ABC_FUNC_AIG );
+        Abc_NtkStrashPerformPar( pNtk, pNtkAig, fAllNodes, nProcs );
+    }
+    else
+    {
+        // convert the node representation in the logic network to the AIG form
+        if ( !Abc_NtkToAig(pNtk) )
+        {
+            printf( "Converting to AIGs has failed.\n" );
+            return NULL;
+        }
+        // perform strashing
+//        Abc_NtkCleanCopy( pNtk );
+        pNtkAig = Abc_NtkStartFrom( pNtk, ABC_NTK_STRASH, ABC_FUNC_AIG );
+        Abc_NtkStrashPerform( pNtk, pNtkAig, fAllNodes, fRecord );
     }
-    // perform strashing
-//    Abc_NtkCleanCopy( pNtk );
-    pNtkAig = Abc_NtkStartFrom( pNtk, ABC_NTK_STRASH, ABC_FUNC_AIG );
-    Abc_NtkStrashPerform( pNtk, pNtkAig, fAllNodes, fRecord );
     Abc_NtkFinalize( pNtk, pNtkAig );
     // transfer name IDs
     if ( pNtk->vNameIds )
@@ -293,7 +336,7 @@ Abc_Ntk_t * Abc_NtkStrash( Abc_Ntk_t * pNtk, int fAllNodes, int fCleanup, int fR
 //        printf( "Warning: AIG cleanup removed %d nodes (this is not a bug).\n", nNodes );
     // duplicate EXDC 
     if ( pNtk->pExdc )
-        pNtkAig->pExdc = Abc_NtkStrash( pNtk->pExdc, fAllNodes, fCleanup, fRecord );
+        pNtkAig->pExdc = Abc_NtkStrashPar( pNtk->pExdc, fAllNodes, fCleanup, fRecord, nProcs );
     // make sure everything is okay
     if ( !Abc_NtkCheck( pNtkAig ) )
     {
@@ -431,6 +474,95 @@ void Abc_NtkStrashPerform( Abc_Ntk_t * pNtkOld, Abc_Ntk_t * pNtkNew, int fAllNod
     Vec_PtrFree( vNodes );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Converts the SOPs of one chunk of nodes into local AIGs.]
+
+  Description [Called concurrently for different chunks. Each chunk has
+  its own AIG manager and factoring manager, and writes only the entries
+  of its own nodes in the array of roots.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkStrashChunk( void * pArg )
+{
+    Abc_StrashChunk_t * p = (Abc_StrashChunk_t *)pArg;
+    Dec_Man_t * pManDec = Dec_ManStartFactor();
+    Abc_Obj_t * pNode;
+    int i;
+    for ( i = p->iStart; i < p->iStop; i++ )
+    {
+        pNode = Abc_NtkObj( p->pNtk, i );
+        if ( pNode == NULL || !Abc_ObjIsNode(pNode) || Abc_ObjIsBarBuf(pNode) )
+            continue;
+        Vec_PtrWriteEntry( p->vRoots, i, Abc_ConvertSopToAigMan(p->pMan, pManDec, (char *)pNode->pData) );
+    }
+    Dec_ManStop( pManDec );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Strashes the network with SOPs using several threads.]
+
+  Description [The object IDs are split into chunks, which are converted
+  into local AIGs concurrently. The local AIGs are hashed into the new
+  AIG by the calling thread, because the AIG manager is not thread-safe.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkStrashPerformPar( Abc_Ntk_t * pNtkOld, Abc_Ntk_t * pNtkNew, int fAllNodes, int nProcs )
+{
+    Abc_StrashChunk_t * pChunks;
+    Vec_Ptr_t * vNodes, * vRoots, * vData;
+    Abc_Obj_t * pNodeOld;
+    int i, nChunks, nChunkSize, Max;
+    assert( Abc_NtkIsSopLogic(pNtkOld) );
+    assert( Abc_NtkIsStrash(pNtkNew) );
+    // use several chunks per thread to balance the load
+    nChunks    = 4 * nProcs;
+    nChunkSize = Abc_MaxInt( Abc_NtkObjNumMax(pNtkOld) / nChunks + 1, 1000 );
+    nChunks    = (Abc_NtkObjNumMax(pNtkOld) + nChunkSize - 1) / nChunkSize;
+    Max        = Abc_NtkGetFaninMax( pNtkOld );
+    vRoots     = Vec_PtrStart( Abc_NtkObjNumMax(pNtkOld) );
+    vData      = Vec_PtrAlloc( nChunks );
+    pChunks    = ABC_CALLOC( Abc_StrashChunk_t, nChunks );
+    for ( i = 0; i < nChunks; i++ )
+    {
+        pChunks[i].pNtk   = pNtkOld;
+        pChunks[i].vRoots = vRoots;
+        pChunks[i].pMan   = Hop_ManStart();
+        pChunks[i].iStart = i * nChunkSize;
+        pChunks[i].iStop  = Abc_MinInt( (i + 1) * nChunkSize, Abc_NtkObjNumMax(pNtkOld) );
+        if ( Max ) Hop_IthVar( pChunks[i].pMan, Max-1 );
+        Vec_PtrPush( vData, pChunks + i );
+    }
+    // the calling thread only waits for the workers
+    Util_ProcessThreads( Abc_NtkStrashChunk, vData, nProcs + 1, 0, 0 );
+    // hash the local AIGs in the topological order
+    vNodes = Abc_NtkDfsIter( pNtkOld, fAllNodes );
+    Vec_PtrForEachEntry( Abc_Obj_t *, vNodes, pNodeOld, i )
+    {
+        if ( Abc_ObjIsBarBuf(pNodeOld) )
+            pNodeOld->pCopy = Abc_ObjChild0Copy(pNodeOld);
+        else
+            pNodeOld->pCopy = Abc_NodeStrashHop( pNtkNew, pNodeOld, pChunks[Abc_ObjId(pNodeOld) / nChunkSize].pMan, 
+                (Hop_Obj_t *)Vec_PtrEntry(vRoots, Abc_ObjId(pNodeOld)) );
+    }
+    Vec_PtrFree( vNodes );
+    for ( i = 0; i < nChunks; i++ )
+        Hop_ManStop( pChunks[i].pMan );
+    ABC_FREE( pChunks );
+    Vec_PtrFree( vData );
+    Vec_PtrFree( vRoots );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Transfers the AIG from one manager into another.]
@@ -469,16 +601,11 @@ Abc_Obj_t * Abc_NodeStrash( Abc_Ntk_t * pNtkNew, Abc_Obj_t * pNodeOld, int fReco
 {
     Hop_Man_t * pMan;
     Hop_Obj_t * pRoot;
-    Abc_Obj_t * pFanin;
-    int i;
     assert( Abc_ObjIsNode(pNodeOld) );
     assert( Abc_NtkHasAig(pNodeOld->pNtk) && !Abc_NtkIsStrash(pNodeOld->pNtk) );
     // get the local AIG manager and the local root node
     pMan = (Hop_Man_t *)pNodeOld->pNtk->pManFunc;
     pRoot = (Hop_Obj_t *)pNodeOld->pData;
-    // check the constant case
-    if ( Abc_NodeIsConst(pNodeOld) || Hop_Regular(pRoot) == Hop_ManConst1(pMan) )
-        return Abc_ObjNotCond( Abc_AigConst1(pNtkNew), Hop_IsComplement(pRoot) );
     // perform special case-strashing using the record of AIG subgraphs
 /*
     if ( fRecord && Abc_NtkRecIsRunning() && Abc_ObjFaninNum(pNodeOld) > 2 && Abc_ObjFaninNum(pNodeOld) <= Abc_NtkRecVarNum() )
@@ -495,6 +622,27 @@ Abc_Obj_t * Abc_NodeStrash( Abc_Ntk_t * pNtkNew, Abc_Obj_t * pNodeOld, int fReco
             return pNodeOld->pCopy;
     }
 */
+    return Abc_NodeStrashHop( pNtkNew, pNodeOld, pMan, pRoot );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Strashes one logic node using its local AIG.]
+
+  Description [The local AIG (pRoot) belongs to the manager pMan.]
+               
+  SideEffects []
+ 
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Obj_t * Abc_NodeStrashHop( Abc_Ntk_t * pNtkNew, Abc_Obj_t * pNodeOld, Hop_Man_t * pMan, Hop_Obj_t * pRoot )
+{
+    Abc_Obj_t * pFanin;
+    int i;
+    // check the constant case
+    if ( Abc_NodeIsConst(pNodeOld) || Hop_Regular(pRoot) == Hop_ManConst1(pMan) )
+        return Abc_ObjNotCond( Abc_AigConst1(pNtkNew), Hop_IsComplement(pRoot) );
     // set elementary variables
     Abc_ObjForEachFanin( pNodeOld, pFanin, i )
         Hop_IthVar(pMan, i)->pData = pFanin->pCopy;
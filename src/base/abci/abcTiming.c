@@ -1431,6 +1431,72 @@ void Abc_NtkUpdate( Abc_Obj_t * pObj, Abc_Obj_t * pObjNew, Vec_Vec_t * vLevels )
     Abc_NtkUpdateReverseLevel( pObjNew, vLevels );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Compares the levels with those recomputed from scratch.]
+
+  Description [Returns the number of nodes whose level is different from 
+  the recomputed one, or whose reverse level is smaller than the recomputed
+  one. Larger reverse levels are allowed because the incremental update does 
+  not decrease them for the fanins of the removed nodes.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkCheckLevels( Abc_Ntk_t * pNtk )
+{
+    Vec_Ptr_t * vNodes;
+    Vec_Int_t * vLevels;
+    Abc_Obj_t * pObj, * pNext;
+    int i, k, Level, Counter = 0, CounterR = 0;
+    assert( Abc_NtkIsStrash(pNtk) );
+    // recompute direct levels in topological order
+    vLevels = Vec_IntStart( Abc_NtkObjNumMax(pNtk) );
+    Abc_NtkForEachCi( pNtk, pObj, i )
+        Vec_IntWriteEntry( vLevels, pObj->Id, pObj->Level );
+    vNodes = Abc_NtkDfs( pNtk, 0 );
+    Vec_PtrForEachEntry( Abc_Obj_t *, vNodes, pObj, i )
+    {
+        Level = 0;
+        Abc_ObjForEachFanin( pObj, pNext, k )
+            Level = Abc_MaxInt( Level, Vec_IntEntry(vLevels, pNext->Id) );
+        Vec_IntWriteEntry( vLevels, pObj->Id, Level + 1 );
+        if ( (int)pObj->Level != Level + 1 )
+        {
+            printf( "Level of node %6d should be %4d instead of %4d.\n", pObj->Id, Level + 1, pObj->Level );
+            Counter++;
+        }
+    }
+    Vec_PtrFree( vNodes );
+    // recompute reverse levels in reverse topological order
+    if ( pNtk->vLevelsR )
+    {
+        Vec_IntFill( vLevels, Abc_NtkObjNumMax(pNtk), 0 );
+        vNodes = Abc_NtkDfsReverse( pNtk );
+        Vec_PtrForEachEntry( Abc_Obj_t *, vNodes, pObj, i )
+        {
+            Level = 0;
+            Abc_ObjForEachFanout( pObj, pNext, k )
+                Level = Abc_MaxInt( Level, Vec_IntEntry(vLevels, pNext->Id) );
+            Vec_IntWriteEntry( vLevels, pObj->Id, Level + 1 );
+            if ( Abc_ObjReverseLevel(pObj) < Level + 1 )
+            {
+                printf( "Reverse level of node %6d should be %4d instead of %4d.\n", pObj->Id, Level + 1, Abc_ObjReverseLevel(pObj) );
+                CounterR++;
+            }
+        }
+        Vec_PtrFree( vNodes );
+    }
+    Vec_IntFree( vLevels );
+    if ( Counter )
+        printf( "Levels of %d nodes are incorrect.\n", Counter );
+    if ( CounterR )
+        printf( "Reverse levels of %d nodes are incorrect.\n", CounterR );
+    return Counter + CounterR;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
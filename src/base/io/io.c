@@ -505,6 +505,8 @@ int IoCommandReadBlif( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fReadAsAig;
     int fCheck;
     int fUseNewParser;
+    int fUseLogic;
+    int fUnsupported;
     int fSaveNames;
     int c;
     extern Abc_Ntk_t * Io_ReadBlifAsAig( char * pFileName, int fCheck );
@@ -512,15 +514,19 @@ int IoCommandReadBlif( Abc_Frame_t * pAbc, int argc, char ** argv )
     fCheck = 1;
     fReadAsAig = 0;
     fUseNewParser = 1;
+    fUseLogic = 0;
     fSaveNames = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "nmach" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "nsmach" ) ) != EOF )
     {
         switch ( c )
         {
             case 'n':
                 fUseNewParser ^= 1;
                 break;
+            case 's':
+                fUseLogic ^= 1;
+                break;
             case 'm':
                 fSaveNames ^= 1;
                 break;
@@ -541,11 +547,18 @@ int IoCommandReadBlif( Abc_Frame_t * pAbc, int argc, char ** argv )
     // get the input file name
     pFileName = argv[globalUtilOptind];
     // read the file using the corresponding file reader
-    if ( fReadAsAig )
+    pNtk = NULL;
+    if ( fUseLogic && !fReadAsAig && !fSaveNames && Io_ReadBlifIsFlat( pFileName ) )
+    {
+        pNtk = Io_ReadBlifLogic( pFileName, fCheck, &fUnsupported );
+        if ( pNtk == NULL && !fUnsupported )
+            return 1;
+    }
+    if ( pNtk == NULL && fReadAsAig )
         pNtk = Io_ReadBlifAsAig( pFileName, fCheck );
-    else if ( fUseNewParser )
+    else if ( pNtk == NULL && fUseNewParser )
         pNtk = Io_Read( pFileName, IO_FILE_BLIF, fCheck, 0 );
-    else
+    else if ( pNtk == NULL )
     {
         Abc_Ntk_t * pTemp;
         pNtk = Io_ReadBlif( pFileName, fCheck );
@@ -567,10 +580,12 @@ int IoCommandReadBlif( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: read_blif [-nmach] <file>\n" );
+    fprintf( pAbc->Err, "usage: read_blif [-nsmach] <file>\n" );
     fprintf( pAbc->Err, "\t         reads the network in binary BLIF format\n" );
     fprintf( pAbc->Err, "\t         (if this command does not work, try \"read\")\n" );
     fprintf( pAbc->Err, "\t-n     : toggle using old BLIF parser without hierarchy support [default = %s]\n", !fUseNewParser? "yes":"no" );
+    fprintf( pAbc->Err, "\t-s     : toggle reading flat files in one pass without the netlist [default = %s]\n", fUseLogic? "yes":"no" );
+    fprintf( pAbc->Err, "\t         (the default parser does this for files of %d MB and more)\n", IO_BLIF_STREAM_SIZE >> 20 );
     fprintf( pAbc->Err, "\t-m     : toggle saving original circuit names into a file [default = %s]\n", fSaveNames? "yes":"no" );
     fprintf( pAbc->Err, "\t-a     : toggle creating AIG while reading the file [default = %s]\n", fReadAsAig? "yes":"no" );
     fprintf( pAbc->Err, "\t-c     : toggle network check after reading [default = %s]\n", fCheck? "yes":"no" );
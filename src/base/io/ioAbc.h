@@ -34,6 +34,8 @@
 ///                         PARAMETERS                               ///
 ////////////////////////////////////////////////////////////////////////
 
+// BLIF files of this size and larger are read without the intermediate netlist
+#define IO_BLIF_STREAM_SIZE   (1<<27)
 
 
 ABC_NAMESPACE_HEADER_START
@@ -85,6 +87,8 @@ extern Abc_Ntk_t *        Io_ReadBaf( char * pFileName, int fCheck );
 extern Abc_Ntk_t *        Io_ReadBblif( char * pFileName, int fCheck );
 /*=== abcReadBlif.c ===========================================================*/
 extern Abc_Ntk_t *        Io_ReadBlif( char * pFileName, int fCheck );
+extern Abc_Ntk_t *        Io_ReadBlifLogic( char * pFileName, int fCheck, int * pfUnsupported );
+extern int                Io_ReadBlifIsFlat( char * pFileName );
 /*=== abcReadBlifMv.c =========================================================*/
 extern Abc_Ntk_t *        Io_ReadBlifMv( char * pFileName, int fBlifMv, int fCheck );
 /*=== abcReadBench.c ==========================================================*/
@@ -141,6 +145,7 @@ extern void               Io_WriteVerilog( Abc_Ntk_t * pNtk, char * FileName, in
 /*=== abcUtil.c ===============================================================*/
 extern Io_FileType_t      Io_ReadFileType( char * pFileName );
 extern Io_FileType_t      Io_ReadLibType( char * pFileName );
+extern int                Io_ReadBlifUseLogic( char * pFileName );
 extern Abc_Ntk_t *        Io_ReadNetlist( char * pFileName, Io_FileType_t FileType, int fCheck );
 extern Abc_Ntk_t *        Io_Read( char * pFileName, Io_FileType_t FileType, int fCheck, int fBarBufs );
 extern void               Io_Write( Abc_Ntk_t * pNtk, char * pFileName, Io_FileType_t FileType );
@@ -63,6 +63,12 @@ struct Io_ReadBlif_t_
     int                  fHaveDefOutReq; // provided in the file
     int                  fHaveDefInDri;  // provided in the file
     int                  fHaveDefOutLoad;// provided in the file
+    // direct construction of the logic network
+    st__table *          tNets;        // maps the net names into the net IDs
+    Vec_Ptr_t *          vNetNames;    // the name of each net (owned until the net is driven)
+    Vec_Int_t *          vDrivers;     // the driver of each net (-1 if not driven yet)
+    Vec_Int_t *          vFanins;      // the fanin nets of the nodes (Id, nFanins, Net1, Net2, ...)
+    int                  fUnsupported; // the file needs the netlist reader
     // the error message
     FILE *               Output;       // the output stream
     char                 sError[1000]; // the error string generated during parsing
@@ -81,6 +87,8 @@ static int Io_ReadBlifNetworkInputs( Io_ReadBlif_t * p, Vec_Ptr_t * vTokens );
 static int Io_ReadBlifNetworkOutputs( Io_ReadBlif_t * p, Vec_Ptr_t * vTokens );
 static int Io_ReadBlifNetworkLatch( Io_ReadBlif_t * p, Vec_Ptr_t * vTokens );
 static int Io_ReadBlifNetworkNames( Io_ReadBlif_t * p, Vec_Ptr_t ** pvTokens );
+static int Io_ReadBlifNetworkCubes( Io_ReadBlif_t * p, int nFanins, Vec_Ptr_t ** pvTokens );
+static int Io_ReadBlifNetworkLatchInit( Io_ReadBlif_t * p, Vec_Ptr_t * vTokens, Abc_Obj_t * pLatch );
 static int Io_ReadBlifNetworkGate( Io_ReadBlif_t * p, Vec_Ptr_t * vTokens );
 static int Io_ReadBlifNetworkSubcircuit( Io_ReadBlif_t * p, Vec_Ptr_t * vTokens );
 static int Io_ReadBlifNetworkInputArrival( Io_ReadBlif_t * p, Vec_Ptr_t * vTokens );
@@ -94,6 +102,7 @@ static int Io_ReadBlifNetworkDefaultOutputLoad( Io_ReadBlif_t * p, Vec_Ptr_t * v
 static int Io_ReadBlifNetworkAndGateDelay( Io_ReadBlif_t * p, Vec_Ptr_t * vTokens );
 static int Io_ReadBlifNetworkConnectBoxes( Io_ReadBlif_t * p, Abc_Ntk_t * pNtkMaster );
 static int Io_ReadBlifCreateTiming( Io_ReadBlif_t * p, Abc_Ntk_t * pNtkMaster );
+static Abc_Ntk_t * Io_ReadBlifLogicNetwork( Io_ReadBlif_t * p );
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -141,6 +150,416 @@ Abc_Ntk_t * Io_ReadBlif( char * pFileName, int fCheck )
     return pNtk;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Reads the flat BLIF file directly into the logic network.]
+
+  Description [Tokenizes the file through the bounded buffer of the file
+  reader and creates the objects of the logic network in the same pass,
+  without the intermediate netlist and the netlist-to-logic conversion.
+  The net names are kept in a separate name manager until the fanins are
+  connected. Supports .inputs, .outputs, .latch and .names of a single
+  model. Returns NULL and sets *pfUnsupported if the file has other
+  directives, in which case it should be read by the netlist readers.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Ntk_t * Io_ReadBlifLogic( char * pFileName, int fCheck, int * pfUnsupported )
+{
+    Io_ReadBlif_t * p;
+    Abc_Ntk_t * pNtk;
+    *pfUnsupported = 0;
+
+    // start the file
+    p = Io_ReadBlifFile( pFileName );
+    if ( p == NULL )
+        return NULL;
+
+    // read the network
+    pNtk = Io_ReadBlifLogicNetwork( p );
+    *pfUnsupported = p->fUnsupported;
+    Io_ReadBlifFree( p );
+    if ( pNtk == NULL )
+        return NULL;
+
+    // make sure that everything is okay with the network structure
+    if ( fCheck && !Abc_NtkCheckRead( pNtk ) )
+    {
+        printf( "Io_ReadBlifLogic: The network check has failed.\n" );
+        Abc_NtkDelete( pNtk );
+        return NULL;
+    }
+    return pNtk;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the BLIF file can be read in one pass.]
+
+  Description [Scans the lines of the file without tokenizing them and
+  checks that the directives are those supported by Io_ReadBlifLogic()
+  and that there is only one model. Stops at the first unsupported
+  directive, which in hierarchical files usually comes early. This way
+  the reader does not start building the network only to discard it.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Io_ReadBlifIsFlat( char * pFileName )
+{
+    static char * pSupported[] = { ".model", ".inputs", ".outputs", ".names", ".latch", ".end", NULL };
+    char * pBuffer, * pCur;
+    int k, nSize, nModels = 0, fLineStart = 1, RetValue = 1;
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return 0;
+    pBuffer = ABC_ALLOC( char, 1 << 16 );
+    while ( RetValue && fgets( pBuffer, 1 << 16, pFile ) != NULL )
+    {
+        nSize = strlen( pBuffer );
+        if ( fLineStart )
+        {
+            for ( pCur = pBuffer; *pCur == ' ' || *pCur == '\t'; pCur++ );
+            if ( *pCur == '.' )
+            {
+                for ( k = 0; pSupported[k]; k++ )
+                {
+                    int nLength = strlen( pSupported[k] );
+                    if ( !strncmp( pCur, pSupported[k], nLength ) && (pCur[nLength] == 0 || isspace( (int)pCur[nLength] )) )
+                        break;
+                }
+                if ( pSupported[k] == NULL || (k == 0 && ++nModels > 1) )
+                    RetValue = 0;
+            }
+        }
+        // the next line starts a directive unless this one is continued
+        if ( nSize > 0 && pBuffer[nSize-1] == '\n' )
+            nSize--;
+        if ( nSize > 0 && pBuffer[nSize-1] == '\r' )
+            nSize--;
+        fLineStart = pBuffer[nSize] != 0 && !(nSize > 0 && pBuffer[nSize-1] == '\\');
+    }
+    ABC_FREE( pBuffer );
+    fclose( pFile );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the ID of the net with the given name.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_ReadBlifLogicNet( Io_ReadBlif_t * p, char * pName )
+{
+    char * pCopy;
+    int iNet;
+    if ( st__lookup_int( p->tNets, pName, &iNet ) )
+        return iNet;
+    iNet = Vec_IntSize( p->vDrivers );
+    pCopy = Extra_UtilStrsav( pName );
+    st__insert( p->tNets, pCopy, (char *)(ABC_PTRINT_T)iNet );
+    Vec_PtrPush( p->vNetNames, pCopy );
+    Vec_IntPush( p->vDrivers, -1 );
+    return iNet;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the driver of the net.]
+
+  Description [Replaces the copy of the net name by the name of the
+  driver, which is stored in the name manager of the network.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Io_ReadBlifLogicSetDriver( Io_ReadBlif_t * p, int iNet, Abc_Obj_t * pObj )
+{
+    char * pCopy = (char *)Vec_PtrEntry( p->vNetNames, iNet );
+    char * pName = Abc_ObjName( pObj );
+    assert( Vec_IntEntry(p->vDrivers, iNet) == -1 );
+    st__delete( p->tNets, (const char **)&pCopy, NULL );
+    st__insert( p->tNets, pName, (char *)(ABC_PTRINT_T)iNet );
+    Vec_PtrWriteEntry( p->vNetNames, iNet, pName );
+    Vec_IntWriteEntry( p->vDrivers, iNet, Abc_ObjId(pObj) );
+    ABC_FREE( pCopy );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Makes the object the driver of the net with the given name.]
+
+  Description [The object gets the name of the net, as in the logic
+  network derived from the netlist. From then on, the net table refers
+  to the name of the object, so that each name is stored once.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_ReadBlifLogicDrive( Io_ReadBlif_t * p, char * pName, Abc_Obj_t * pObj )
+{
+    int iNet = Io_ReadBlifLogicNet( p, pName );
+    if ( Vec_IntEntry(p->vDrivers, iNet) >= 0 )
+    {
+        p->LineCur = Extra_FileReaderGetLineNumber(p->pReader, 0);
+        sprintf( p->sError, "Net \"%s\" has more than one driver.", pName );
+        Io_ReadBlifPrintErrorMessage( p );
+        return 1;
+    }
+    Abc_ObjAssignName( pObj, pName, NULL );
+    Io_ReadBlifLogicSetDriver( p, iNet, pObj );
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Creates the latch with its terminals.]
+
+  Description [The input net of the latch is stored in the BI terminal
+  and connected at the end.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_ReadBlifLogicLatch( Io_ReadBlif_t * p, Vec_Ptr_t * vTokens )
+{
+    Abc_Ntk_t * pNtk = p->pNtkCur;
+    Abc_Obj_t * pLatch, * pTerm;
+    if ( vTokens->nSize < 3 )
+    {
+        p->LineCur = Extra_FileReaderGetLineNumber(p->pReader, 0);
+        sprintf( p->sError, "The .latch line does not have enough tokens." );
+        Io_ReadBlifPrintErrorMessage( p );
+        return 1;
+    }
+    pLatch = Abc_NtkCreateLatch( pNtk );
+    pTerm  = Abc_NtkCreateBi( pNtk );
+    pTerm->iTemp = Io_ReadBlifLogicNet( p, (char *)vTokens->pArray[1] );
+    Abc_ObjAddFanin( pLatch, pTerm );
+    pTerm  = Abc_NtkCreateBo( pNtk );
+    Abc_ObjAddFanin( pTerm, pLatch );
+    Abc_ObjAssignName( pLatch, (char *)vTokens->pArray[2], "L" );
+    if ( Io_ReadBlifLogicDrive( p, (char *)vTokens->pArray[2], pTerm ) )
+        return 1;
+    return Io_ReadBlifNetworkLatchInit( p, vTokens, pLatch );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Creates the node given by the .names line.]
+
+  Description [The fanin nets are recorded and connected at the end, so
+  that the nodes may refer to the nets defined later in the file.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_ReadBlifLogicNames( Io_ReadBlif_t * p, Vec_Ptr_t ** pvTokens )
+{
+    Vec_Ptr_t * vTokens = *pvTokens;
+    Abc_Ntk_t * pNtk = p->pNtkCur;
+    Abc_Obj_t * pNode;
+    int i, nFanins;
+    if ( vTokens->nSize < 2 )
+    {
+        p->LineCur = Extra_FileReaderGetLineNumber(p->pReader, 0);
+        sprintf( p->sError, "The .names line has less than two tokens." );
+        Io_ReadBlifPrintErrorMessage( p );
+        return 1;
+    }
+    // create the node and remember its fanin nets
+    nFanins = vTokens->nSize - 2;
+    pNode = Abc_NtkCreateNode( pNtk );
+    Vec_IntPush( p->vFanins, Abc_ObjId(pNode) );
+    Vec_IntPush( p->vFanins, nFanins );
+    for ( i = 1; i <= nFanins; i++ )
+        Vec_IntPush( p->vFanins, Io_ReadBlifLogicNet(p, (char *)vTokens->pArray[i]) );
+    if ( Io_ReadBlifLogicDrive( p, (char *)vTokens->pArray[nFanins+1], pNode ) )
+        return 1;
+    // derive the functionality of the node (this overwrites the tokens)
+    if ( Io_ReadBlifNetworkCubes( p, nFanins, pvTokens ) )
+        return 1;
+    Abc_ObjSetData( pNode, Abc_SopRegister((Mem_Flex_t *)pNtk->pManFunc, p->vCubes->pArray) );
+    if ( nFanins != Abc_SopGetVarNum((char *)Abc_ObjData(pNode)) )
+    {
+        p->LineCur = Extra_FileReaderGetLineNumber(p->pReader, 0);
+        sprintf( p->sError, "The number of fanins (%d) of node %s is different from SOP size (%d).",
+            nFanins, Abc_ObjName(pNode), Abc_SopGetVarNum((char *)Abc_ObjData(pNode)) );
+        Io_ReadBlifPrintErrorMessage( p );
+        return 1;
+    }
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Connects the fanins after the file is read.]
+
+  Description [Adds constant-0 drivers to the nets without drivers,
+  connects the nodes and then the COs in the same order as the
+  netlist-to-logic conversion does.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Io_ReadBlifLogicFinalize( Io_ReadBlif_t * p )
+{
+    Abc_Ntk_t * pNtk = p->pNtkCur;
+    Abc_Obj_t * pObj;
+    int i, k, iNet, Driver, nFanins, nUndriven = 0;
+    // add the constant-0 drivers to the non-driven nets
+    Vec_IntForEachEntry( p->vDrivers, Driver, iNet )
+        nUndriven += (Driver == -1);
+    if ( nUndriven > 0 )
+        printf( "Warning: Constant-0 drivers added to %d non-driven nets in network \"%s\":\n", nUndriven, pNtk->pName );
+    k = 0;
+    Vec_IntForEachEntry( p->vDrivers, Driver, iNet )
+    {
+        if ( Driver >= 0 )
+            continue;
+        pObj = Abc_NtkCreateNodeConst0( pNtk );
+        Abc_ObjAssignName( pObj, (char *)Vec_PtrEntry(p->vNetNames, iNet), NULL );
+        Io_ReadBlifLogicSetDriver( p, iNet, pObj );
+        if ( k < 4 )
+            printf( "%s%s", (k? ", ": ""), Abc_ObjName(pObj) );
+        else if ( k == 4 )
+            printf( " ..." );
+        k++;
+    }
+    if ( nUndriven > 0 )
+        printf( "\n" );
+    // connect the nodes
+    for ( i = 0; i < Vec_IntSize(p->vFanins); i += nFanins + 2 )
+    {
+        pObj    = Abc_NtkObj( pNtk, Vec_IntEntry(p->vFanins, i) );
+        nFanins = Vec_IntEntry( p->vFanins, i+1 );
+        for ( k = 0; k < nFanins; k++ )
+            Abc_ObjAddFanin( pObj, Abc_NtkObj(pNtk, Vec_IntEntry(p->vDrivers, Vec_IntEntry(p->vFanins, i+2+k))) );
+    }
+    // name the latch inputs (after all names are known, so that the names are unique)
+    Abc_NtkForEachLatchInput( pNtk, pObj, i )
+        Abc_ObjAssignName( pObj, Abc_ObjName(pObj), NULL );
+    // connect the COs
+    Abc_NtkOrderCisCos( pNtk );
+    Abc_NtkForEachCo( pNtk, pObj, i )
+        Abc_ObjAddFanin( pObj, Abc_NtkObj(pNtk, Vec_IntEntry(p->vDrivers, pObj->iTemp)) );
+    // fix the problem with CO pointing directly to CIs
+    Abc_NtkLogicMakeSimpleCos( pNtk, 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the network in one pass.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Ntk_t * Io_ReadBlifLogicNetwork( Io_ReadBlif_t * p )
+{
+    Abc_Ntk_t * pNtk;
+    Abc_Obj_t * pObj;
+    Vec_Ptr_t * vTokens;
+    char * pDirective, * pToken, * pPivot;
+    int i, fTokensReady = 0, fStatus = 0;
+
+    // read the name of the network
+    vTokens = Io_ReadBlifGetTokens(p);
+    if ( vTokens == NULL || strcmp( (char *)vTokens->pArray[0], ".model" ) )
+    {
+        p->LineCur = 0;
+        sprintf( p->sError, "Wrong input file format." );
+        Io_ReadBlifPrintErrorMessage( p );
+        return NULL;
+    }
+    if ( Vec_PtrSize(vTokens) != 2 )
+    {
+        p->LineCur = Extra_FileReaderGetLineNumber(p->pReader, 0);
+        sprintf( p->sError, "The .model line does not have exactly two entries." );
+        Io_ReadBlifPrintErrorMessage( p );
+        return NULL;
+    }
+    p->pNtkCur = pNtk = Abc_NtkAlloc( ABC_NTK_LOGIC, ABC_FUNC_SOP, 1 );
+    for ( pPivot = pToken = (char *)Vec_PtrEntry(vTokens, 1); *pToken; pToken++ )
+        if ( *pToken == '/' || *pToken == '\\' )
+            pPivot = pToken+1;
+    pNtk->pName = Extra_UtilStrsav( pPivot );
+    pNtk->pSpec = Extra_UtilStrsav( p->pFileName );
+
+    // start the net table
+    p->tNets     = st__init_table( strcmp, st__strhash );
+    p->vNetNames = Vec_PtrAlloc( 1000 );
+    p->vDrivers  = Vec_IntAlloc( 1000 );
+    p->vFanins   = Vec_IntAlloc( 1000 );
+
+    // read the lines
+    while ( fTokensReady || (vTokens = Io_ReadBlifGetTokens(p)) )
+    {
+        fTokensReady = 0;
+        pDirective = (char *)vTokens->pArray[0];
+        if ( !strcmp( pDirective, ".names" ) )
+            { fStatus = Io_ReadBlifLogicNames( p, &vTokens ); fTokensReady = 1; }
+        else if ( !strcmp( pDirective, ".latch" ) )
+            fStatus = Io_ReadBlifLogicLatch( p, vTokens );
+        else if ( !strcmp( pDirective, ".inputs" ) )
+        {
+            for ( i = 1; !fStatus && i < vTokens->nSize; i++ )
+                fStatus = Io_ReadBlifLogicDrive( p, (char *)vTokens->pArray[i], Abc_NtkCreatePi(pNtk) );
+        }
+        else if ( !strcmp( pDirective, ".outputs" ) )
+        {
+            for ( i = 1; i < vTokens->nSize; i++ )
+            {
+                pObj = Abc_NtkCreatePo( pNtk );
+                pObj->iTemp = Io_ReadBlifLogicNet( p, (char *)vTokens->pArray[i] );
+                Abc_ObjAssignName( pObj, (char *)vTokens->pArray[i], NULL );
+            }
+        }
+        else if ( !strcmp( pDirective, ".end" ) )
+        {
+            // other models or the EXDC network need the netlist reader
+            if ( (vTokens = Io_ReadBlifGetTokens(p)) )
+                p->fUnsupported = fStatus = 1;
+            break;
+        }
+        else
+            p->fUnsupported = fStatus = 1;
+        if ( fStatus || vTokens == NULL )
+            break;
+    }
+    if ( fStatus )
+    {
+        Abc_NtkDelete( pNtk );
+        return NULL;
+    }
+    Io_ReadBlifLogicFinalize( p );
+    return pNtk;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Iteratively reads several networks in the hierarchical design.]
@@ -394,10 +813,9 @@ int Io_ReadBlifNetworkOutputs( Io_ReadBlif_t * p, Vec_Ptr_t * vTokens )
 
 ***********************************************************************/
 int Io_ReadBlifNetworkLatch( Io_ReadBlif_t * p, Vec_Ptr_t * vTokens )
-{ 
+{
     Abc_Ntk_t * pNtk = p->pNtkCur;
     Abc_Obj_t * pLatch;
-    int ResetValue;
     if ( vTokens->nSize < 3 )
     {
         p->LineCur = Extra_FileReaderGetLineNumber(p->pReader, 0);
@@ -408,6 +826,23 @@ int Io_ReadBlifNetworkLatch( Io_ReadBlif_t * p, Vec_Ptr_t * vTokens )
     // create the latch
     pLatch = Io_ReadCreateLatch( pNtk, (char *)vTokens->pArray[1], (char *)vTokens->pArray[2] );
     // get the latch reset value
+    return Io_ReadBlifNetworkLatchInit( p, vTokens, pLatch );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sets the reset value of the latch.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Io_ReadBlifNetworkLatchInit( Io_ReadBlif_t * p, Vec_Ptr_t * vTokens, Abc_Obj_t * pLatch )
+{
+    int ResetValue;
     if ( vTokens->nSize == 3 )
         Abc_LatchSetInitDc( pLatch );
     else
@@ -446,8 +881,8 @@ int Io_ReadBlifNetworkNames( Io_ReadBlif_t * p, Vec_Ptr_t ** pvTokens )
     Vec_Ptr_t * vTokens = *pvTokens;
     Abc_Ntk_t * pNtk = p->pNtkCur;
     Abc_Obj_t * pNode;
-    char * pToken, Char, ** ppNames;
-    int nFanins, nNames;
+    char ** ppNames;
+    int nNames;
 
     // create a new node and add it to the network
     if ( vTokens->nSize < 2 )
@@ -464,8 +899,42 @@ int Io_ReadBlifNetworkNames( Io_ReadBlif_t * p, Vec_Ptr_t ** pvTokens )
     pNode   = Io_ReadCreateNode( pNtk, ppNames[nNames], ppNames, nNames );
 
     // derive the functionality of the node
+    if ( Io_ReadBlifNetworkCubes( p, nNames, pvTokens ) )
+        return 1;
+
+    // set the pointer to the functionality of the node
+    Abc_ObjSetData( pNode, Abc_SopRegister((Mem_Flex_t *)pNtk->pManFunc, p->vCubes->pArray) );
+
+    // check the size
+    if ( Abc_ObjFaninNum(pNode) != Abc_SopGetVarNum((char *)Abc_ObjData(pNode)) )
+    {
+        p->LineCur = Extra_FileReaderGetLineNumber(p->pReader, 0);
+        sprintf( p->sError, "The number of fanins (%d) of node %s is different from SOP size (%d).",
+            Abc_ObjFaninNum(pNode), Abc_ObjName(Abc_ObjFanout(pNode,0)), Abc_SopGetVarNum((char *)Abc_ObjData(pNode)) );
+        Io_ReadBlifPrintErrorMessage( p );
+        return 1;
+    }
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the cubes following the .names line.]
+
+  Description [Collects the SOP of the node in p->vCubes. Returns the
+  tokens of the first line after the cubes in pvTokens.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Io_ReadBlifNetworkCubes( Io_ReadBlif_t * p, int nFanins, Vec_Ptr_t ** pvTokens )
+{
+    Vec_Ptr_t * vTokens;
+    char * pToken, Char;
+
     p->vCubes->nSize = 0;
-    nFanins = vTokens->nSize - 2;
     if ( nFanins == 0 )
     {
         while ( (vTokens = Io_ReadBlifGetTokens(p)) )
@@ -505,7 +974,7 @@ int Io_ReadBlifNetworkNames( Io_ReadBlif_t * p, Vec_Ptr_t ** pvTokens )
             }
             // create the cube
             Vec_StrPrintStr( p->vCubes, (char *)vTokens->pArray[0] );
-            // check the char 
+            // check the char
             Char = ((char *)vTokens->pArray[1])[0];
             if ( Char != '0' && Char != '1' && Char != 'x' && Char != 'n' )
             {
@@ -529,19 +998,6 @@ int Io_ReadBlifNetworkNames( Io_ReadBlif_t * p, Vec_Ptr_t ** pvTokens )
     }
     Vec_StrPush( p->vCubes, 0 );
 
-    // set the pointer to the functionality of the node
-    Abc_ObjSetData( pNode, Abc_SopRegister((Mem_Flex_t *)pNtk->pManFunc, p->vCubes->pArray) );
-
-    // check the size
-    if ( Abc_ObjFaninNum(pNode) != Abc_SopGetVarNum((char *)Abc_ObjData(pNode)) )
-    {
-        p->LineCur = Extra_FileReaderGetLineNumber(p->pReader, 0);
-        sprintf( p->sError, "The number of fanins (%d) of node %s is different from SOP size (%d).", 
-            Abc_ObjFaninNum(pNode), Abc_ObjName(Abc_ObjFanout(pNode,0)), Abc_SopGetVarNum((char *)Abc_ObjData(pNode)) );
-        Io_ReadBlifPrintErrorMessage( p );
-        return 1;
-    }
-
     // return the last array of tokens
     *pvTokens = vTokens;
     return 0;
@@ -1419,6 +1875,19 @@ void Io_ReadBlifFree( Io_ReadBlif_t * p )
     Vec_IntFree( p->vOutReqs );
     Vec_IntFree( p->vInDrives );
     Vec_IntFree( p->vOutLoads );
+    if ( p->tNets )
+    {
+        char * pName;
+        int i;
+        // free the names of the nets without drivers
+        Vec_PtrForEachEntry( char *, p->vNetNames, pName, i )
+            if ( Vec_IntEntry(p->vDrivers, i) == -1 )
+                ABC_FREE( pName );
+        st__free_table( p->tNets );
+        Vec_PtrFree( p->vNetNames );
+    }
+    Vec_IntFreeP( &p->vDrivers );
+    Vec_IntFreeP( &p->vFanins );
     ABC_FREE( p );
 }
 
@@ -85,6 +85,41 @@ Io_FileType_t Io_ReadFileType( char * pFileName )
     return IO_FILE_UNKNOWN;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the BLIF file should be read in one pass.]
+
+  Description [Large uncompressed flat files are read directly into the
+  logic network, which avoids keeping the netlist and its copy at the same
+  time. Files with the constructs not supported by the one-pass reader
+  are detected before reading.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Io_ReadBlifUseLogic( char * pFileName )
+{
+    FILE * pFile;
+    ABC_INT64_T nFileSize;
+    int nNameSize = strlen(pFileName);
+    if ( (nNameSize > 3 && !strcmp(pFileName+nNameSize-3, ".gz")) || (nNameSize > 4 && !strcmp(pFileName+nNameSize-4, ".bz2")) )
+        return 0;
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return 0;
+#ifdef _WIN32
+    _fseeki64( pFile, 0, SEEK_END );
+    nFileSize = _ftelli64( pFile );
+#else
+    fseeko( pFile, 0, SEEK_END );
+    nFileSize = ftello( pFile );
+#endif
+    fclose( pFile );
+    return nFileSize >= IO_BLIF_STREAM_SIZE && Io_ReadBlifIsFlat( pFileName );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Read the network from a file.]
@@ -242,6 +277,14 @@ Abc_Ntk_t * Io_Read( char * pFileName, Io_FileType_t FileType, int fCheck, int f
 {
     Abc_Ntk_t * pNtk, * pTemp;
     Vec_Ptr_t * vLtl;
+    int fUnsupported;
+    // read large flat BLIF files directly into the logic network
+    if ( FileType == IO_FILE_BLIF && !fBarBufs && Io_ReadBlifUseLogic(pFileName) )
+    {
+        pNtk = Io_ReadBlifLogic( pFileName, fCheck, &fUnsupported );
+        if ( pNtk != NULL || !fUnsupported )
+            return pNtk;
+    }
     // get the netlist
     pNtk = Io_ReadNetlist( pFileName, FileType, fCheck );
     if ( pNtk == NULL )
@@ -66,7 +66,7 @@ void *      Abc_FrameReadManDd()                             { if ( s_GlobalFram
 void *      Abc_FrameReadManDec()                            { if ( s_GlobalFrame->pManDec == NULL ) s_GlobalFrame->pManDec = Dec_ManStart();                                        return s_GlobalFrame->pManDec; } 
 void *      Abc_FrameReadManDsd()                            { return s_GlobalFrame->pManDsd;      } 
 void *      Abc_FrameReadManDsd2()                           { return s_GlobalFrame->pManDsd2;     }
-char *      Abc_FrameReadFlag( char * pFlag )                { return Cmd_FlagReadByName( s_GlobalFrame, pFlag );   }
+char *      Abc_FrameReadFlag( char * pFlag )                { return s_GlobalFrame ? Cmd_FlagReadByName( s_GlobalFrame, pFlag ) : NULL; }
 Vec_Ptr_t * Abc_FrameReadSignalNames()                       { return s_GlobalFrame->vSignalNames; }
 char *      Abc_FrameReadSpecName()                          { return s_GlobalFrame->pSpecName;    }
 
@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "bbr.h"
+#include "bdd/extrab/extraBdd.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -516,10 +517,6 @@ int Aig_ManVerifyUsingBdds_int( Aig_Man_t * p, Saig_ParBbr_t * pPars )
     for ( i = 0; i < Saig_ManPoNum(p); i++ )
         Cudd_RecursiveDeref( dd, pbOutputs[i] );
     ABC_FREE( pbOutputs );
-//    if ( RetValue == -1 )
-        Cudd_Quit( dd );
-//    else
-//        Bbr_StopManager( dd );
 
     // report the runtime
     if ( !pPars->fSilent )
@@ -527,6 +524,12 @@ int Aig_ManVerifyUsingBdds_int( Aig_Man_t * p, Saig_ParBbr_t * pPars )
     ABC_PRT( "Time", Abc_Clock() - clk );
     fflush( stdout );
     }
+    if ( pPars->fVerbose )
+        Extra_PrintManagerProfile( dd, "Reach" );
+//    if ( RetValue == -1 )
+        Cudd_Quit( dd );
+//    else
+//        Bbr_StopManager( dd );
     return RetValue;
 }
 
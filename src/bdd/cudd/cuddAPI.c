@@ -3041,6 +3041,9 @@ Cudd_PrintInfo(
     retval = fprintf(fp,"Number of cache deletions: %.0f\n",
                      dd->cachedeletions);
     if (retval == EOF) return(0);
+    retval = fprintf(fp,"Number of cache resizings: %d\n",
+                     dd->cacheResizes);
+    if (retval == EOF) return(0);
     retval = cuddCacheProfile(dd,fp);
     if (retval == 0) return(0);
     retval = fprintf(fp,"Soft limit for cache size: %u\n",
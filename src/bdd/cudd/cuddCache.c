@@ -18,6 +18,7 @@
                 <li> cuddConstantLookup()
                 <li> cuddCacheProfile()
                 <li> cuddCacheResize()
+                <li> cuddCacheAdapt()
                 <li> cuddCacheFlush()
                 <li> cuddComputeFloorLog2()
                 </ul>
@@ -191,6 +192,8 @@ cuddInitCache(
     unique->cachecollisions = 0;
     unique->cacheinserts = 0;
     unique->cacheLastInserts = 0;
+    unique->cacheLastCollisions = 0;
+    unique->cacheResizes = 0;
     unique->cachedeletions = 0;
 
     /* Initialize the cache */
@@ -258,6 +261,10 @@ cuddCacheInsert(
 #endif
     entry->hash = hash;
 
+    /* Grow the cache if it is thrashing. */
+    if (table->cacheinserts >= table->cacheLastInserts + 2.0 * (double) table->cacheSlots)
+        (void) cuddCacheAdapt(table);
+
 } /* end of cuddCacheInsert */
 
 
@@ -304,6 +311,10 @@ cuddCacheInsert2(
 #endif
     entry->hash = hash;
 
+    /* Grow the cache if it is thrashing. */
+    if (table->cacheinserts >= table->cacheLastInserts + 2.0 * (double) table->cacheSlots)
+        (void) cuddCacheAdapt(table);
+
 } /* end of cuddCacheInsert2 */
 
 
@@ -349,6 +360,10 @@ cuddCacheInsert1(
 #endif
     entry->hash = hash;
 
+    /* Grow the cache if it is thrashing. */
+    if (table->cacheinserts >= table->cacheLastInserts + 2.0 * (double) table->cacheSlots)
+        (void) cuddCacheAdapt(table);
+
 } /* end of cuddCacheInsert1 */
 
 
@@ -952,11 +967,10 @@ cuddCacheResize(
                    table->cacheHits / (table->cacheHits + table->cacheMisses));
 #endif
 
-    saveHandler = MMoutOfMemory;
-    MMoutOfMemory = Cudd_OutOfMem;
+    cuddOutOfMemSave(saveHandler);
 //    table->acache = cache = ABC_ALLOC(DdCache,slots+1);
     table->acache = cache = ABC_ALLOC(DdCache,slots+2);
-    MMoutOfMemory = saveHandler;
+    cuddOutOfMemRestore(saveHandler);
     /* If we fail to allocate the new table we just give up. */
     if (cache == NULL) {
 #ifdef DD_VERBOSE
@@ -1028,10 +1042,52 @@ cuddCacheResize(
     table->totCachehits += table->cacheHits;
     table->cacheHits = 0;
     table->cacheLastInserts = table->cacheinserts - (double) moved;
+    table->cacheLastCollisions = table->cachecollisions;
+    table->cacheResizes++;
 
 } /* end of cuddCacheResize */
 
 
+/**Function********************************************************************
+
+  Synopsis    [Grows the cache when it is thrashing.]
+
+  Description [The lookup functions grow the cache when the hit ratio
+  is high. A cache that is too small for the working set has a low hit
+  ratio, because the entries are overwritten before they are reused, and
+  is never resized by that rule. The insertion functions call this
+  function after the number of insertions since the last check exceeds
+  twice the number of slots. It doubles the cache if most of these
+  insertions replaced valid entries; otherwise, it starts the next
+  period of counting. The size remains bounded by the slack computed
+  from the unique table and the memory limit. Returns 1 if the cache
+  was resized; 0 otherwise.]
+
+  SideEffects [None]
+
+  SeeAlso     [cuddCacheResize]
+
+******************************************************************************/
+int
+cuddCacheAdapt(
+  DdManager * table)
+{
+    double inserts, collisions;
+
+    inserts = table->cacheinserts - table->cacheLastInserts;
+    collisions = table->cachecollisions - table->cacheLastCollisions;
+    if (table->cacheSlack < 0 || inserts < 2.0 * (double) table->cacheSlots ||
+        collisions * 100.0 < inserts * DD_MAX_COLLISIONS) {
+        table->cacheLastInserts = table->cacheinserts;
+        table->cacheLastCollisions = table->cachecollisions;
+        return(0);
+    }
+    cuddCacheResize(table);
+    return(1);
+
+} /* end of cuddCacheAdapt */
+
+
 /**Function********************************************************************
 
   Synopsis    [Flushes the cache.]
@@ -1057,6 +1113,7 @@ cuddCacheFlush(
         cache[i].data = NULL;
     }
     table->cacheLastInserts = table->cacheinserts;
+    table->cacheLastCollisions = table->cachecollisions;
 
     return;
 
@@ -150,10 +150,9 @@ Cudd_Init(
     result = cuddInitCache(unique,cacheSize,maxCacheSize);
     if (result == 0) return(NULL);
 
-    saveHandler = MMoutOfMemory;
-    MMoutOfMemory = Cudd_OutOfMem;
+    cuddOutOfMemSave(saveHandler);
     unique->stash = ABC_ALLOC(char,(maxMemory / DD_STASH_FRACTION) + 4);
-    MMoutOfMemory = saveHandler;
+    cuddOutOfMemRestore(saveHandler);
     if (unique->stash == NULL) {
         (void) fprintf(unique->err,"Unable to set aside memory\n");
     }
@@ -135,6 +135,8 @@ ABC_NAMESPACE_HEADER_START
 #define DD_GC_FRAC_MIN          0.2
 #define DD_MIN_HIT              30      /* resize cache when hit ratio
                                            above this percentage (default) */
+#define DD_MAX_COLLISIONS       75      /* resize cache when collision ratio
+                                           above this percentage */
 #define DD_MAX_LOOSE_FRACTION   5 /* 1 / (max fraction of memory used for
                                      unique table in fast growth mode) */
 #define DD_MAX_CACHE_FRACTION   3 /* 1 / (max fraction of memory used for
@@ -456,7 +458,9 @@ struct DdManager {      /* specialized DD symbol table */
     double totCacheMisses;      /* total number of cache misses */
     double cachecollisions;     /* number of cache collisions */
     double cacheinserts;        /* number of cache insertions */
-    double cacheLastInserts;    /* insertions at the last cache resizing */
+    double cacheLastInserts;    /* insertions at the last thrashing check */
+    double cacheLastCollisions; /* collisions at the last thrashing check */
+    int cacheResizes;           /* number of cache resizings */
     double cachedeletions;      /* number of deletions during garbage coll. */
 #ifdef DD_STATS
     double nodesFreed;          /* number of nodes returned to the free list */
@@ -1038,6 +1042,37 @@ dd->nextSample += 250000;}
 #endif
 
 
+/**Macro***********************************************************************
+
+  Synopsis    [Installs Cudd_OutOfMem as the out-of-memory handler.]
+
+  Description [Saves the current handler in save and installs Cudd_OutOfMem
+  for a discretionary allocation. The handler is global while the managers
+  may be used by different threads, so the handler stays locked until it is
+  restored by cuddOutOfMemRestore.]
+
+  SideEffects [none]
+
+  SeeAlso     [cuddOutOfMemRestore]
+
+******************************************************************************/
+#define cuddOutOfMemSave(save) (cuddOutOfMemLock(), (save) = MMoutOfMemory, MMoutOfMemory = Cudd_OutOfMem)
+
+
+/**Macro***********************************************************************
+
+  Synopsis    [Restores the out-of-memory handler.]
+
+  Description []
+
+  SideEffects [none]
+
+  SeeAlso     [cuddOutOfMemSave]
+
+******************************************************************************/
+#define cuddOutOfMemRestore(save) (MMoutOfMemory = (save), cuddOutOfMemUnlock())
+
+
 /**AutomaticStart*************************************************************/
 
 /*---------------------------------------------------------------------------*/
@@ -1081,6 +1116,7 @@ extern DdNode *        cuddCacheLookup1Zdd( DdManager * table, DdNode * (*)(DdMa
 extern DdNode *        cuddConstantLookup( DdManager * table, ptruint op, DdNode * f, DdNode * g, DdNode * h );
 extern int             cuddCacheProfile( DdManager * table, FILE * fp );
 extern void            cuddCacheResize( DdManager * table );
+extern int             cuddCacheAdapt( DdManager * table );
 extern void            cuddCacheFlush( DdManager * table );
 extern int             cuddComputeFloorLog2( unsigned int value );
 extern int             cuddHeapProfile( DdManager * dd );
@@ -1184,6 +1220,9 @@ extern enum st__retval  cuddStCountfree( char * key, char * value, char * arg );
 extern int             cuddCollectNodes( DdNode * f, st__table * visited );
 #endif
 extern DdNodePtr *     cuddNodeArray( DdNode * f, int * n );
+extern void            cuddOutOfMemLock( void );
+extern void            cuddOutOfMemUnlock( void );
+extern void            cuddOutOfMemCall( long size );
 extern int             cuddWindowReorder( DdManager * table, int low, int high, Cudd_ReorderingType submethod );
 extern DdNode *        cuddZddProduct( DdManager * dd, DdNode * f, DdNode * g );
 extern DdNode *        cuddZddUnateProduct( DdManager * dd, DdNode * f, DdNode * g );
@@ -1120,11 +1120,10 @@ cuddLocalCacheResize(
                    cache->hits, cache->lookUps, cache->hits / cache->lookUps);
 #endif
 
-    saveHandler = MMoutOfMemory;
-    MMoutOfMemory = Cudd_OutOfMem;
+    cuddOutOfMemSave(saveHandler);
     cache->item = item =
         (DdLocalCacheItem *) ABC_ALLOC(char, slots * cache->itemsize);
-    MMoutOfMemory = saveHandler;
+    cuddOutOfMemRestore(saveHandler);
     /* If we fail to allocate the new table we just give up. */
     if (item == NULL) {
 #ifdef DD_VERBOSE
@@ -1299,14 +1298,13 @@ cuddHashTableResize(
 
     /* Compute the new size of the table. */
     numBuckets = oldNumBuckets << 1;
-    saveHandler = MMoutOfMemory;
-    MMoutOfMemory = Cudd_OutOfMem;
+    cuddOutOfMemSave(saveHandler);
 #ifdef __osf__
 #pragma pointer_size save
 #pragma pointer_size short
 #endif
     buckets = ABC_ALLOC(DdHashItem *, numBuckets);
-    MMoutOfMemory = saveHandler;
+    cuddOutOfMemRestore(saveHandler);
     if (buckets == NULL) {
         hash->maxsize <<= 1;
         return(1);
@@ -1404,10 +1402,9 @@ cuddHashTableAlloc(
     DdHashItem **mem, *thisOne, *next, *item;
 
     if (hash->nextFree == NULL) {
-        saveHandler = MMoutOfMemory;
-        MMoutOfMemory = Cudd_OutOfMem;
+        cuddOutOfMemSave(saveHandler);
         mem = (DdHashItem **) ABC_ALLOC(char,(DD_MEM_CHUNK+1) * itemsize);
-        MMoutOfMemory = saveHandler;
+        cuddOutOfMemRestore(saveHandler);
 #ifdef __osf__
 #pragma pointer_size restore
 #endif
@@ -1434,7 +1431,7 @@ cuddHashTableAlloc(
 #endif
             }
             if (mem == NULL) {
-                (*MMoutOfMemory)((long)((DD_MEM_CHUNK + 1) * itemsize));
+                cuddOutOfMemCall((long)((DD_MEM_CHUNK + 1) * itemsize));
                 hash->manager->errorCode = CUDD_MEMORY_OUT;
                 return(NULL);
             }
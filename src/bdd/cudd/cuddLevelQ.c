@@ -529,14 +529,13 @@ hashResize(
 
     /* Compute the new size of the subtable. */
     numBuckets = oldNumBuckets << 1;
-    saveHandler = MMoutOfMemory;
-    MMoutOfMemory = Cudd_OutOfMem;
+    cuddOutOfMemSave(saveHandler);
 #ifdef __osf__
 #pragma pointer_size save
 #pragma pointer_size short
 #endif
     buckets = queue->buckets = ABC_ALLOC(DdQueueItem *, numBuckets);
-    MMoutOfMemory = saveHandler;
+    cuddOutOfMemRestore(saveHandler);
     if (buckets == NULL) {
         queue->maxsize <<= 1;
         return(1);
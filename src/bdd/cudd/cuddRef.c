@@ -340,11 +340,11 @@ Cudd_DelayedDerefBdd(
     if (table->nextDead == table->deathRowDepth) {
         if (table->deathRowDepth < table->looseUpTo / 2) {
             extern void (*MMoutOfMemory)(long);
-            void (*saveHandler)(long) = MMoutOfMemory;
+            void (*saveHandler)(long);
             DdNodePtr *newRow;
-            MMoutOfMemory = Cudd_OutOfMem;
+            cuddOutOfMemSave(saveHandler);
             newRow = ABC_REALLOC(DdNodePtr,table->deathRow,2*table->deathRowDepth);
-            MMoutOfMemory = saveHandler;
+            cuddOutOfMemRestore(saveHandler);
             if (newRow == NULL) {
                 table->nextDead = 0;
             } else {
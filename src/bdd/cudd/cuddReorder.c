@@ -414,11 +414,10 @@ cuddDynamicAllocNode(
 
     if (table->nextFree == NULL) {        /* free list is empty */
         /* Try to allocate a new block. */
-        saveHandler = MMoutOfMemory;
-        MMoutOfMemory = Cudd_OutOfMem;
+        cuddOutOfMemSave(saveHandler);
 //        mem = (DdNodePtr *) ABC_ALLOC(DdNode, DD_MEM_CHUNK + 1);
         mem = (DdNodePtr *) ABC_ALLOC(DdNode, DD_MEM_CHUNK + 2);
-        MMoutOfMemory = saveHandler;
+        cuddOutOfMemRestore(saveHandler);
         if (mem == NULL && table->stash != NULL) {
             ABC_FREE(table->stash);
             table->stash = NULL;
@@ -436,7 +435,7 @@ cuddDynamicAllocNode(
             ** whatever it specifies for a failed malloc.  If this
             ** handler returns, then set error code, print
             ** warning, and return. */
-            (*MMoutOfMemory)(sizeof(DdNode)*(DD_MEM_CHUNK + 1));
+            cuddOutOfMemCall(sizeof(DdNode)*(DD_MEM_CHUNK + 1));
             table->errorCode = CUDD_MEMORY_OUT;
 #ifdef DD_VERBOSE
             (void) fprintf(table->err,
@@ -899,10 +898,9 @@ cuddSwapInPlace(
                 newxslots >>= 1;
             }
             /* Try to allocate new table. Be ready to back off. */
-            saveHandler = MMoutOfMemory;
-            MMoutOfMemory = Cudd_OutOfMem;
+            cuddOutOfMemSave(saveHandler);
             newxlist = ABC_ALLOC(DdNodePtr, newxslots);
-            MMoutOfMemory = saveHandler;
+            cuddOutOfMemRestore(saveHandler);
             if (newxlist == NULL) {
                 (void) fprintf(table->err, "Unable to resize subtable %d for lack of memory\n", i);
                 newxlist = xlist;
@@ -258,11 +258,10 @@ cuddAllocNode(
                 return(NULL);
             }
             /* Try to allocate a new block. */
-            saveHandler = MMoutOfMemory;
-            MMoutOfMemory = Cudd_OutOfMem;
+            cuddOutOfMemSave(saveHandler);
 //            mem = (DdNodePtr *) ABC_ALLOC(DdNode,DD_MEM_CHUNK + 1);
             mem = (DdNodePtr *) ABC_ALLOC(DdNode,DD_MEM_CHUNK + 2);
-            MMoutOfMemory = saveHandler;
+            cuddOutOfMemRestore(saveHandler);
             if (mem == NULL) {
                 /* No more memory: Try collecting garbage. If this succeeds,
                 ** we end up with mem still NULL, but unique->nextFree !=
@@ -285,7 +284,7 @@ cuddAllocNode(
                         ** whatever it specifies for a failed malloc.
                         ** If this handler returns, then set error code,
                         ** print warning, and return. */
-                        (*MMoutOfMemory)(sizeof(DdNode)*(DD_MEM_CHUNK + 1));
+                        cuddOutOfMemCall(sizeof(DdNode)*(DD_MEM_CHUNK + 1));
                         unique->errorCode = CUDD_MEMORY_OUT;
 #ifdef DD_VERBOSE
                         (void) fprintf(unique->err,
@@ -1570,10 +1569,9 @@ cuddRehash(
         slots = oldslots << 1;
         shift = oldshift - 1;
 
-        saveHandler = MMoutOfMemory;
-        MMoutOfMemory = Cudd_OutOfMem;
+        cuddOutOfMemSave(saveHandler);
         nodelist = ABC_ALLOC(DdNodePtr, slots);
-        MMoutOfMemory = saveHandler;
+        cuddOutOfMemRestore(saveHandler);
         if (nodelist == NULL) {
             (void) fprintf(unique->err,
                            "Unable to resize subtable %d for lack of memory\n",
@@ -1637,10 +1635,9 @@ cuddRehash(
         */
         slots = oldslots << 1;
         shift = oldshift - 1;
-        saveHandler = MMoutOfMemory;
-        MMoutOfMemory = Cudd_OutOfMem;
+        cuddOutOfMemSave(saveHandler);
         nodelist = ABC_ALLOC(DdNodePtr, slots);
-        MMoutOfMemory = saveHandler;
+        cuddOutOfMemRestore(saveHandler);
         if (nodelist == NULL) {
             (void) fprintf(unique->err,
                            "Unable to resize constant subtable for lack of memory\n");
@@ -1715,10 +1712,9 @@ cuddShrinkSubtable(
     oldnodelist = unique->subtables[i].nodelist;
     oldslots = unique->subtables[i].slots;
     slots = oldslots >> 1;
-    saveHandler = MMoutOfMemory;
-    MMoutOfMemory = Cudd_OutOfMem;
+    cuddOutOfMemSave(saveHandler);
     nodelist = ABC_ALLOC(DdNodePtr, slots);
-    MMoutOfMemory = saveHandler;
+    cuddOutOfMemRestore(saveHandler);
     if (nodelist == NULL) {
         return;
     }
@@ -2458,10 +2454,9 @@ ddRehashZdd(
         shift--;
     } while (slots * DD_MAX_SUBTABLE_DENSITY < unique->subtableZ[i].keys);
 
-    saveHandler = MMoutOfMemory;
-    MMoutOfMemory = Cudd_OutOfMem;
+    cuddOutOfMemSave(saveHandler);
     nodelist = ABC_ALLOC(DdNodePtr, slots);
-    MMoutOfMemory = saveHandler;
+    cuddOutOfMemRestore(saveHandler);
     if (nodelist == NULL) {
         (void) fprintf(unique->err,
                        "Unable to resize ZDD subtable %d for lack of memory.\n",
@@ -108,6 +108,16 @@
 #include "misc/util/util_hack.h"
 #include "cuddInt.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -2991,6 +3001,82 @@ cuddNodeArray(
 } /* cuddNodeArray */
 
 
+#ifdef ABC_USE_PTHREADS
+static pthread_mutex_t cuddOutOfMemMutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+/**Function********************************************************************
+
+  Synopsis    [Locks the out-of-memory handler.]
+
+  Description [The handler MMoutOfMemory is a global variable, which is
+  temporarily replaced by Cudd_OutOfMem when allocating memory. The lock
+  keeps the threads working with different managers from saving each
+  other's temporary handler. Only an allocation is done while the lock
+  is held.]
+
+  SideEffects [None]
+
+  SeeAlso     [cuddOutOfMemUnlock cuddOutOfMemSave]
+
+******************************************************************************/
+void
+cuddOutOfMemLock(void)
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock(&cuddOutOfMemMutex);
+#endif
+
+} /* cuddOutOfMemLock */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Unlocks the out-of-memory handler.]
+
+  Description []
+
+  SideEffects [None]
+
+  SeeAlso     [cuddOutOfMemLock]
+
+******************************************************************************/
+void
+cuddOutOfMemUnlock(void)
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock(&cuddOutOfMemMutex);
+#endif
+
+} /* cuddOutOfMemUnlock */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Calls the out-of-memory handler.]
+
+  Description [Reads the current handler under the lock and calls it.]
+
+  SideEffects [None]
+
+  SeeAlso     [cuddOutOfMemLock]
+
+******************************************************************************/
+void
+cuddOutOfMemCall(
+  long size /* size of the allocation that failed */)
+{
+    extern DD_OOMFP MMoutOfMemory;
+    DD_OOMFP handler;
+
+    cuddOutOfMemLock();
+    handler = MMoutOfMemory;
+    cuddOutOfMemUnlock();
+    (*handler)(size);
+
+} /* cuddOutOfMemCall */
+
+
 /*---------------------------------------------------------------------------*/
 /* Definition of static functions                                            */
 /*---------------------------------------------------------------------------*/
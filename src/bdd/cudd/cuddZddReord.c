@@ -1466,10 +1466,9 @@ zddReorderPostprocess(
             oldslots <= table->initSlots) continue;
         oldnodelist = table->subtableZ[i].nodelist;
         slots = oldslots >> 1;
-        saveHandler = MMoutOfMemory;
-        MMoutOfMemory = Cudd_OutOfMem;
+        cuddOutOfMemSave(saveHandler);
         nodelist = ABC_ALLOC(DdNodePtr, slots);
-        MMoutOfMemory = saveHandler;
+        cuddOutOfMemRestore(saveHandler);
         if (nodelist == NULL) {
             return(1);
         }
@@ -169,6 +169,7 @@ extern DdNode *     Extra_bddRemapUp( DdManager * dd, DdNode * bF );
 extern DdNode *     Extra_bddMove( DdManager * dd, DdNode * bF, int nVars );
 extern DdNode *     extraBddMove( DdManager * dd, DdNode * bF, DdNode * bFlag );
 extern void         Extra_StopManager( DdManager * dd );
+extern void         Extra_PrintManagerProfile( DdManager * dd, char * pTitle );
 extern void         Extra_bddPrint( DdManager * dd, DdNode * F );
 extern void         Extra_bddPrintSupport( DdManager * dd, DdNode * F );
 extern void         extraDecomposeCover( DdManager* dd, DdNode*  zC, DdNode** zC0, DdNode** zC1, DdNode** zC2 );
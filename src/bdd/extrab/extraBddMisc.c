@@ -232,6 +232,33 @@ void Extra_StopManager( DdManager * dd )
     Cudd_Quit( dd );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Prints the resource profile of the manager.]
+
+  Description [Reports the peak number of live nodes, the final size and
+  the hit ratio of the computed table, and the time spent in reordering
+  and garbage collection.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Extra_PrintManagerProfile( DdManager * dd, char * pTitle )
+{
+    double nLookUps = Cudd_ReadCacheLookUps( dd );
+    Abc_Print( 1, "%s BDD profile: ", pTitle ? pTitle : "" );
+    Abc_Print( 1, "Vars = %d. ", Cudd_ReadSize(dd) );
+    Abc_Print( 1, "Peak = %d. ", Cudd_ReadPeakLiveNodeCount(dd) );
+    Abc_Print( 1, "Live = %d. ", Cudd_ReadKeys(dd) - Cudd_ReadDead(dd) );
+    Abc_Print( 1, "Cache = %u (%d resizes). ", Cudd_ReadCacheSlots(dd), dd->cacheResizes );
+    Abc_Print( 1, "Hits = %.2f %%. ", nLookUps > 0 ? 100.0 * Cudd_ReadCacheHits(dd) / nLookUps : 0.0 );
+    Abc_Print( 1, "GC = %d (%.2f sec). ", Cudd_ReadGarbageCollections(dd), 1.0 * Cudd_ReadGarbageCollectionTime(dd) / CLOCKS_PER_SEC );
+    Abc_Print( 1, "Reo = %d (%.2f sec). ", Cudd_ReadReorderings(dd), 1.0 * Cudd_ReadReorderingTime(dd) / CLOCKS_PER_SEC );
+    Abc_Print( 1, "Mem = %.2f MB\n", 1.0 * Cudd_ReadMemoryInUse(dd) / (1 << 20) );
+}
+
 /**Function********************************************************************
 
   Synopsis    [Outputs the BDD in a readable format.]
@@ -50,6 +50,8 @@ struct Gia_ParLlb_t_
     int         nVolumeMax;    // the largest volume
     int         nVolumeMin;    // the smallest volume
     int         nPartValue;    // partitioning value
+    int         nProcs;        // the number of threads for image computation
+    int         fSplitParts;   // divide partitions rather than states among threads
     int         fBackward;     // enable backward reachability
     int         fReorder;      // enable dynamic variable reordering
     int         fIndConstr;    // extract inductive constraints
@@ -145,7 +145,7 @@ Abc_Cex_t * Llb_CoreDeriveCex( Llb_Img_t * p )
             continue;
         // compute the next states
         bImage = Llb_ImgComputeImage( p->pAig, p->vDdMans, p->dd, bState, 
-            vQuant0, vQuant1, p->vDriRefs, p->pPars->TimeTarget, 1, 0, 0 );
+            vQuant0, vQuant1, p->vDriRefs, p->pPars->TimeTarget, 1, 0, 1, 0, 0 );
         assert( bImage != NULL );
         Cudd_Ref( bImage );
         Cudd_RecursiveDeref( p->dd, bState );
@@ -335,7 +335,7 @@ int Llb_CoreReachability_int( Llb_Img_t * p, Vec_Ptr_t * vQuant0, Vec_Ptr_t * vQ
         // compute the next states
         bNext = Llb_ImgComputeImage( p->pAig, p->vDdMans, p->dd, bCurrent, 
             vQuant0, vQuant1, p->vDriRefs, p->pPars->TimeTarget, 
-            p->pPars->fBackward, p->pPars->fReorder, p->pPars->fVeryVerbose );
+            p->pPars->fBackward, p->pPars->fReorder, p->pPars->nProcs, p->pPars->fSplitParts, p->pPars->fVeryVerbose );
         if ( bNext == NULL )
         {
             if ( !p->pPars->fSilent )
@@ -667,6 +667,8 @@ void Llb_CoreStop( Llb_Img_t * p )
     Vec_PtrForEachEntry( DdNode *, p->vRings, bTemp, i )
         Cudd_RecursiveDeref( p->ddR, bTemp );
     Vec_PtrFree( p->vRings );
+    if ( p->pPars->fVerbose )
+        Extra_PrintManagerProfile( p->dd, "Image" );
     Extra_StopManager( p->dd );
     Extra_StopManager( p->ddG );
     Extra_StopManager( p->ddR );
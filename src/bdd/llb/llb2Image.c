@@ -350,6 +350,84 @@ void Llb_ImgQuantifyReset( Vec_Ptr_t * vDdMans )
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Callbacks of the multi-threaded image computation.]
+
+  Description [The thread's manager receives the partitions and the cubes
+  of the variables quantified after each of them.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Llb_ImgPar_t_ Llb_ImgPar_t;
+struct Llb_ImgPar_t_
+{
+    Aig_Man_t *     pAig;           // the AIG manager
+    Vec_Ptr_t *     vDdMans;        // the partition managers
+    Vec_Ptr_t *     vQuant1;        // the variables to quantify
+    Vec_Ptr_t *     vGroups;        // the partitions in the thread's manager
+    Vec_Ptr_t *     vCubes;         // the cubes in the thread's manager
+};
+void Llb_ImgParStop( DdManager * ddW, void * pState )
+{
+    Llb_ImgPar_t * p = (Llb_ImgPar_t *)pState;
+    DdNode * bFunc;
+    int i;
+    Vec_PtrForEachEntry( DdNode *, p->vGroups, bFunc, i )
+        Cudd_RecursiveDeref( ddW, bFunc );
+    Vec_PtrForEachEntry( DdNode *, p->vCubes, bFunc, i )
+        Cudd_RecursiveDeref( ddW, bFunc );
+    Vec_PtrFree( p->vGroups );
+    Vec_PtrFree( p->vCubes );
+    ABC_FREE( p );
+}
+void * Llb_ImgParStart( DdManager * ddW, void * pUser )
+{
+    Llb_ImgPar_t * pUsr = (Llb_ImgPar_t *)pUser;
+    Llb_ImgPar_t * p = ABC_CALLOC( Llb_ImgPar_t, 1 );
+    DdManager * ddPart;
+    DdNode * bGroup, * bCube;
+    int i;
+    p->vGroups = Vec_PtrAlloc( Vec_PtrSize(pUsr->vDdMans) );
+    p->vCubes  = Vec_PtrAlloc( Vec_PtrSize(pUsr->vDdMans) );
+    Vec_PtrForEachEntry( DdManager *, pUsr->vDdMans, ddPart, i )
+    {
+        bGroup = Cudd_bddTransfer( ddPart, ddW, ddPart->bFunc );
+        if ( bGroup == NULL )
+        {
+            Llb_ImgParStop( ddW, p );
+            return NULL;
+        }
+        Cudd_Ref( bGroup );
+        Vec_PtrPush( p->vGroups, bGroup );
+        bCube = Llb_ImgComputeCube( pUsr->pAig, (Vec_Int_t *)Vec_PtrEntry(pUsr->vQuant1, i+1), ddW );  Cudd_Ref( bCube );
+        Vec_PtrPush( p->vCubes, bCube );
+    }
+    return p;
+}
+DdNode * Llb_ImgParImage( DdManager * ddW, void * pState, DdNode * bPiece )
+{
+    Llb_ImgPar_t * p = (Llb_ImgPar_t *)pState;
+    DdNode * bImage, * bGroup, * bTemp;
+    int i;
+    bImage = bPiece;  Cudd_Ref( bImage );
+    Vec_PtrForEachEntry( DdNode *, p->vGroups, bGroup, i )
+    {
+        bImage = Cudd_bddAndAbstract( ddW, bTemp = bImage, bGroup, (DdNode *)Vec_PtrEntry(p->vCubes, i) );
+        if ( bImage == NULL )
+        {
+            Cudd_RecursiveDeref( ddW, bTemp );
+            return NULL;
+        }
+        Cudd_Ref( bImage );
+        Cudd_RecursiveDeref( ddW, bTemp );
+    }
+    Cudd_Deref( bImage );
+    return bImage;
+}
 /**Function*************************************************************
 
   Synopsis    [Computes image of the initial set of states.]
@@ -363,7 +441,7 @@ void Llb_ImgQuantifyReset( Vec_Ptr_t * vDdMans )
 ***********************************************************************/
 DdNode * Llb_ImgComputeImage( Aig_Man_t * pAig, Vec_Ptr_t * vDdMans, DdManager * dd, DdNode * bInit, 
     Vec_Ptr_t * vQuant0, Vec_Ptr_t * vQuant1, Vec_Int_t * vDriRefs, 
-    abctime TimeTarget, int fBackward, int fReorder, int fVerbose )
+    abctime TimeTarget, int fBackward, int fReorder, int nProcs, int fSplitParts, int fVerbose )
 {
 //    int fCheckSupport = 0;
     DdManager * ddPart;
@@ -396,6 +474,38 @@ DdNode * Llb_ImgComputeImage( Aig_Man_t * pAig, Vec_Ptr_t * vDdMans, DdManager *
         Cudd_RecursiveDeref( dd, bCube );
     }
     // perform image computation
+    if ( nProcs > 1 && fSplitParts )
+    {
+        Vec_Ptr_t * vParts = Vec_PtrAlloc( Vec_PtrSize(vDdMans) );
+        Vec_Int_t * vVars2Q = Vec_IntStart( Cudd_ReadSize(dd) );
+        Vec_Int_t * vVars;
+        Aig_Obj_t * pObj;
+        int k;
+        Vec_PtrForEachEntry( DdManager *, vDdMans, ddPart, i )
+        {
+            Vec_PtrPush( vParts, ddPart->bFunc );
+            vVars = (Vec_Int_t *)Vec_PtrEntry( vQuant1, i+1 );
+            Aig_ManForEachObjVec( vVars, pAig, pObj, k )
+                Vec_IntWriteEntry( vVars2Q, Aig_ObjId(pObj), 1 );
+        }
+        bImage = Llb_ParImageParts( dd, vDdMans, vParts, bTemp = bImage, vVars2Q, nProcs, fVerbose );
+        Cudd_RecursiveDeref( dd, bTemp );
+        Vec_PtrFree( vParts );
+        Vec_IntFree( vVars2Q );
+        if ( bImage == NULL )
+            return NULL;
+        Cudd_Ref( bImage );
+    }
+    else if ( nProcs > 1 )
+    {
+        Llb_ImgPar_t Par = { pAig, vDdMans, vQuant1, NULL, NULL };
+        bImage = Llb_ParImage( dd, bTemp = bImage, nProcs, Llb_ImgParStart, Llb_ImgParImage, Llb_ImgParStop, &Par, fVerbose );
+        Cudd_RecursiveDeref( dd, bTemp );
+        if ( bImage == NULL )
+            return NULL;
+        Cudd_Ref( bImage );
+    }
+    else
     Vec_PtrForEachEntry( DdManager *, vDdMans, ddPart, i )
     {
         clk = Abc_Clock();
@@ -792,6 +792,80 @@ DdNode * Llb_Nonlin4Image( DdManager * dd, Vec_Ptr_t * vParts, DdNode * bCurrent
     return bFunc;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Computes the image using several threads.]
+
+  Description [Each thread gets a copy of the partitions and computes
+  the images of the pieces of the current states. Alternatively, the
+  partitions are divided among the threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Llb_Nonlin4Par_t_ Llb_Nonlin4Par_t;
+struct Llb_Nonlin4Par_t_
+{
+    DdManager *   dd;        // the manager of the partitions
+    Vec_Ptr_t *   vParts;    // partitions
+    Vec_Int_t *   vVars2Q;   // variables to quantify
+};
+void Llb_Nonlin4ParStop( DdManager * ddW, void * pState )
+{
+    Llb_Nonlin4Par_t * p = (Llb_Nonlin4Par_t *)pState;
+    DdNode * bFunc;
+    int i;
+    Vec_PtrForEachEntry( DdNode *, p->vParts, bFunc, i )
+        Cudd_RecursiveDeref( ddW, bFunc );
+    Vec_PtrFree( p->vParts );
+    ABC_FREE( p );
+}
+void * Llb_Nonlin4ParStart( DdManager * ddW, void * pUser )
+{
+    Llb_Nonlin4Par_t * pUsr = (Llb_Nonlin4Par_t *)pUser;
+    Llb_Nonlin4Par_t * p = ABC_CALLOC( Llb_Nonlin4Par_t, 1 );
+    DdNode * bFunc, * bPart;
+    int i;
+    p->dd      = ddW;
+    p->vParts  = Vec_PtrAlloc( Vec_PtrSize(pUsr->vParts) );
+    p->vVars2Q = pUsr->vVars2Q;
+    Vec_PtrForEachEntry( DdNode *, pUsr->vParts, bFunc, i )
+    {
+        bPart = Cudd_bddTransfer( pUsr->dd, ddW, bFunc );
+        if ( bPart == NULL )
+        {
+            Llb_Nonlin4ParStop( ddW, p );
+            return NULL;
+        }
+        Cudd_Ref( bPart );
+        Vec_PtrPush( p->vParts, bPart );
+    }
+    return p;
+}
+DdNode * Llb_Nonlin4ParImage( DdManager * ddW, void * pState, DdNode * bPiece )
+{
+    Llb_Nonlin4Par_t * p = (Llb_Nonlin4Par_t *)pState;
+    return Llb_Nonlin4Image( ddW, p->vParts, bPiece, p->vVars2Q );
+}
+DdNode * Llb_Nonlin4ImagePar( DdManager * dd, Vec_Ptr_t * vParts, DdNode * bCurrent, Vec_Int_t * vVars2Q, int nProcs, int fSplitParts, int fVerbose )
+{
+    Llb_Nonlin4Par_t Par = { dd, vParts, vVars2Q };
+    Vec_Ptr_t * vDdMans;
+    DdNode * bImage;
+    int i;
+    if ( !fSplitParts )
+        return Llb_ParImage( dd, bCurrent, nProcs, Llb_Nonlin4ParStart, Llb_Nonlin4ParImage, Llb_Nonlin4ParStop, &Par, fVerbose );
+    // all partitions belong to the main manager
+    vDdMans = Vec_PtrAlloc( Vec_PtrSize(vParts) );
+    for ( i = 0; i < Vec_PtrSize(vParts); i++ )
+        Vec_PtrPush( vDdMans, dd );
+    bImage = Llb_ParImageParts( dd, vDdMans, vParts, bCurrent, vVars2Q, nProcs, fVerbose );
+    Vec_PtrFree( vDdMans );
+    return bImage;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -770,7 +770,10 @@ int Llb_Nonlin4Reachability( Llb_Mnx_t * p )
 
         // compute the next states
         clkTemp = Abc_Clock();
-        p->bNext = Llb_Nonlin4Image( p->dd, p->vRoots, p->bCurrent, p->vVars2Q );
+        if ( p->pPars->nProcs > 1 )
+            p->bNext = Llb_Nonlin4ImagePar( p->dd, p->vRoots, p->bCurrent, p->vVars2Q, p->pPars->nProcs, p->pPars->fSplitParts, p->pPars->fVeryVerbose );
+        else
+            p->bNext = Llb_Nonlin4Image( p->dd, p->vRoots, p->bCurrent, p->vVars2Q );
         if ( p->bNext == NULL )
         {
             if ( !p->pPars->fSilent )
@@ -1000,6 +1003,7 @@ void Llb_MnxStop( Llb_Mnx_t * p )
         ABC_PRTP( "Other    ", p->timeOther, p->timeTotal );
         ABC_PRTP( "TOTAL    ", p->timeTotal, p->timeTotal );
         ABC_PRTP( "  reo    ", p->timeReo,   p->timeTotal );
+        Extra_PrintManagerProfile( p->dd, "Image" );
     }
     // remove BDDs
     if ( p->bBad )
@@ -48,6 +48,11 @@ typedef struct Llb_Man_t_ Llb_Man_t;
 typedef struct Llb_Mtr_t_ Llb_Mtr_t;
 typedef struct Llb_Grp_t_ Llb_Grp_t;
 
+// callbacks of the multi-threaded image computation
+typedef void *    (*Llb_ParStartFunc_t)( DdManager * ddW, void * pUser );
+typedef DdNode *  (*Llb_ParImageFunc_t)( DdManager * ddW, void * pState, DdNode * bPiece );
+typedef void      (*Llb_ParStopFunc_t) ( DdManager * ddW, void * pState );
+
 struct Llb_Man_t_
 {
     Gia_ParLlb_t *  pPars;          // parameters
@@ -137,6 +142,9 @@ extern Llb_Mtr_t *     Llb_MtrCreate( Llb_Man_t * p );
 extern void            Llb_MtrFree( Llb_Mtr_t * p );
 extern void            Llb_MtrPrint( Llb_Mtr_t * p, int fOrder );
 extern void            Llb_MtrPrintMatrixStats( Llb_Mtr_t * p ); 
+/*=== llbPar.c =======================================================*/
+extern DdNode *        Llb_ParImage( DdManager * dd, DdNode * bCurrent, int nProcs, Llb_ParStartFunc_t pStart, Llb_ParImageFunc_t pImage, Llb_ParStopFunc_t pStop, void * pUser, int fVerbose );
+extern DdNode *        Llb_ParImageParts( DdManager * dd, Vec_Ptr_t * vDdMans, Vec_Ptr_t * vParts, DdNode * bCurrent, Vec_Int_t * vVars2Q, int nProcs, int fVerbose );
 /*=== llbPart.c ======================================================*/
 extern Llb_Grp_t *     Llb_ManGroupAlloc( Llb_Man_t * pMan );
 extern void            Llb_ManGroupStop( Llb_Grp_t * p );
@@ -172,7 +180,7 @@ extern void            Llb_ImgQuantifyFirst( Aig_Man_t * pAig, Vec_Ptr_t * vDdMa
 extern void            Llb_ImgQuantifyReset( Vec_Ptr_t * vDdMans );
 extern DdNode *        Llb_ImgComputeImage( Aig_Man_t * pAig, Vec_Ptr_t * vDdMans, DdManager * dd, DdNode * bInit, 
                            Vec_Ptr_t * vQuant0, Vec_Ptr_t * vQuant1, Vec_Int_t * vDriRefs, 
-                           abctime TimeTarget, int fBackward, int fReorder, int fVerbose );
+                           abctime TimeTarget, int fBackward, int fReorder, int nProcs, int fSplitParts, int fVerbose );
 
 extern DdManager *     Llb_NonlinImageStart( Aig_Man_t * pAig, Vec_Ptr_t * vLeaves, Vec_Ptr_t * vRoots, int * pVars2Q, int * pOrder, int fFirst, abctime TimeTarget );
 extern DdNode *        Llb_NonlinImageCompute( DdNode * bCurrent, int fReorder, int fDrop, int fVerbose, int * pOrder );
@@ -192,6 +200,7 @@ extern Abc_Cex_t *     Llb4_Nonlin4TransformCex( Aig_Man_t * pAig, Vec_Ptr_t * v
 /*=== llb4Image.c =======================================================*/
 extern DdNode *        Llb_Nonlin4Image( DdManager * dd, Vec_Ptr_t * vParts, DdNode * bCurrent, Vec_Int_t * vVars2Q );
 extern Vec_Ptr_t *     Llb_Nonlin4Group( DdManager * dd, Vec_Ptr_t * vParts, Vec_Int_t * vVars2Q, int nSizeMax );
+extern DdNode *        Llb_Nonlin4ImagePar( DdManager * dd, Vec_Ptr_t * vParts, DdNode * bCurrent, Vec_Int_t * vVars2Q, int nProcs, int fSplitParts, int fVerbose );
 /*=== llb4Map.c =========================================================*/
 //extern Vec_Int_t *     Llb_AigMap( Aig_Man_t * pAig, int nLutSize, int nLutMin );
 /*=== llb4Nonlin.c ======================================================*/
@@ -0,0 +1,660 @@
+/**CFile****************************************************************
+
+  FileName    [llbPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [BDD based reachability.]
+
+  Synopsis    [Multi-threaded image computation.]
+
+  Author      [LSV-PA contributors]
+  
+  Affiliation []
+
+  Date        [Ver. 1.0.]
+
+  Revision    [$Id: llbPar.c $]
+
+***********************************************************************/
+
+#include "llbInt.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+/*
+    The BDD package is not thread-safe, and each thread works only with
+    its own manager. The managers share the global out-of-memory handler,
+    which CUDD replaces around discretionary allocations (resizing the
+    caches and the unique tables), and these replacements are serialized
+    by a lock in the package (cuddOutOfMemSave/cuddOutOfMemRestore).
+    The set of current states is split into disjoint pieces by cofactoring
+    w.r.t. its top variables. Each thread owns a manager with the same
+    variable order, into which it transfers the partitions of the
+    transition relation, and computes the images of the pieces taken
+    from the shared queue. The union of the images of each thread is
+    transferred back into the main manager. Only the main thread creates
+    managers and changes the variable order (reordering uses global
+    data), and the main manager is only read while the threads run.
+*/
+
+#define LLB_PAR_THR_MAX 100
+
+typedef struct Llb_ParTh_t_ Llb_ParTh_t;
+struct Llb_ParTh_t_
+{
+    // shared data
+    DdManager *          dd;        // the main manager
+    Vec_Ptr_t *          vPieces;   // pieces of the current states in the main manager
+    int *                pNext;     // the next piece to be processed
+    void *               pMutex;    // protects the next piece
+    Llb_ParStartFunc_t   pStart;    // transfers the relation into the thread's manager
+    Llb_ParImageFunc_t   pImage;    // computes the image of one piece
+    Llb_ParStopFunc_t    pStop;     // releases the relation
+    void *               pUser;     // user's data
+    // thread data
+    DdManager *          ddW;       // the manager of this thread
+    DdNode *             bImage;    // the union of images in the thread's manager
+    int                  nPieces;   // the number of processed pieces
+    int                  fFailed;   // timeout or resource limit
+};
+
+/*
+    In the second mode, the partitions of the transition relation are
+    divided into contiguous groups, one task per group. The thread
+    transfers the partitions of the group and the current states, and
+    computes the partial image by quantifying the variables that do not
+    appear in the current states or in other groups. The partial images
+    are transferred back and the remaining variables are quantified in
+    the main manager.
+*/
+
+typedef struct Llb_ParPt_t_ Llb_ParPt_t;
+struct Llb_ParPt_t_
+{
+    // shared data
+    DdManager *          dd;        // the main manager
+    Vec_Ptr_t *          vDdMans;   // the managers of partitions
+    Vec_Ptr_t *          vParts;    // the partitions
+    Vec_Int_t *          vGroups;   // the first partition of each group followed by the number of partitions
+    Vec_Ptr_t *          vLocals;   // the local variables of each group
+    DdNode *             bCurrent;  // the current states in the main manager
+    DdNode **            pResults;  // the partial images in the thread's managers
+    DdManager **         pOwners;   // the managers of the partial images
+    int *                pNext;     // the next group to be processed
+    void *               pMutex;    // protects the next group
+    // thread data
+    DdManager *          ddW;       // the manager of this thread
+    int                  nGroups;   // the number of processed groups
+    int                  fFailed;   // timeout or resource limit
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Splits the set into disjoint pieces.]
+
+  Description [Cofactors w.r.t. the top variable nDepth times and
+  skips the empty pieces.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Llb_ParSplit_rec( DdManager * dd, DdNode * bFunc, DdNode * bCube, int nDepth, Vec_Ptr_t * vPieces )
+{
+    DdNode * bVar, * bCof, * bTemp;
+    if ( bFunc == Cudd_ReadLogicZero(dd) )
+        return;
+    if ( nDepth == 0 || Cudd_IsConstant(bFunc) )
+    {
+        bTemp = Cudd_bddAnd( dd, bFunc, bCube );  Cudd_Ref( bTemp );
+        Vec_PtrPush( vPieces, bTemp );
+        return;
+    }
+    bVar  = Cudd_bddIthVar( dd, Cudd_Regular(bFunc)->index );
+    bCof  = Cudd_NotCond( Cudd_T(bFunc), Cudd_IsComplement(bFunc) );
+    bTemp = Cudd_bddAnd( dd, bCube, bVar );            Cudd_Ref( bTemp );
+    Llb_ParSplit_rec( dd, bCof, bTemp, nDepth - 1, vPieces );
+    Cudd_RecursiveDeref( dd, bTemp );
+    bCof  = Cudd_NotCond( Cudd_E(bFunc), Cudd_IsComplement(bFunc) );
+    bTemp = Cudd_bddAnd( dd, bCube, Cudd_Not(bVar) );  Cudd_Ref( bTemp );
+    Llb_ParSplit_rec( dd, bCof, bTemp, nDepth - 1, vPieces );
+    Cudd_RecursiveDeref( dd, bTemp );
+}
+Vec_Ptr_t * Llb_ParSplit( DdManager * dd, DdNode * bFunc, int nPieces )
+{
+    Vec_Ptr_t * vPieces = Vec_PtrAlloc( nPieces );
+    abctime TimeStop = dd->TimeStop; dd->TimeStop = 0;
+    Llb_ParSplit_rec( dd, bFunc, Cudd_ReadOne(dd), Abc_Base2Log(nPieces + 1) - 1, vPieces );
+    dd->TimeStop = TimeStop;
+    return vPieces;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the manager of a thread.]
+
+  Description [Uses the variable order of the main manager.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+DdManager * Llb_ParManStart( DdManager * dd )
+{
+    DdManager * ddW;
+    ddW = Cudd_Init( Cudd_ReadSize(dd), 0, CUDD_UNIQUE_SLOTS, CUDD_CACHE_SLOTS, 0 );
+    Cudd_ShuffleHeap( ddW, dd->invperm );
+    ddW->TimeStop = dd->TimeStop;
+    return ddW;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes images of the pieces in one thread.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Llb_ParNextPiece( Llb_ParTh_t * p )
+{
+    int iPiece;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( (pthread_mutex_t *)p->pMutex );
+#endif
+    iPiece = (*p->pNext)++;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( (pthread_mutex_t *)p->pMutex );
+#endif
+    return iPiece;
+}
+void * Llb_ParWorkerThread( void * pArg )
+{
+    Llb_ParTh_t * p = (Llb_ParTh_t *)pArg;
+    DdNode * bPiece, * bImage, * bTemp;
+    void * pState;
+    int iPiece;
+    p->bImage = Cudd_ReadLogicZero( p->ddW );  Cudd_Ref( p->bImage );
+    pState = p->pStart( p->ddW, p->pUser );
+    if ( pState == NULL )
+        p->fFailed = 1;
+    while ( !p->fFailed && (iPiece = Llb_ParNextPiece(p)) < Vec_PtrSize(p->vPieces) )
+    {
+        bPiece = Cudd_bddTransfer( p->dd, p->ddW, (DdNode *)Vec_PtrEntry(p->vPieces, iPiece) );
+        if ( bPiece == NULL )
+        {
+            p->fFailed = 1;
+            break;
+        }
+        Cudd_Ref( bPiece );
+        bImage = p->pImage( p->ddW, pState, bPiece );
+        Cudd_RecursiveDeref( p->ddW, bPiece );
+        if ( bImage == NULL )
+        {
+            p->fFailed = 1;
+            break;
+        }
+        Cudd_Ref( bImage );
+        p->bImage = Cudd_bddOr( p->ddW, bTemp = p->bImage, bImage );
+        if ( p->bImage == NULL )
+        {
+            p->bImage = bTemp;
+            Cudd_RecursiveDeref( p->ddW, bImage );
+            p->fFailed = 1;
+            break;
+        }
+        Cudd_Ref( p->bImage );
+        Cudd_RecursiveDeref( p->ddW, bTemp );
+        Cudd_RecursiveDeref( p->ddW, bImage );
+        p->nPieces++;
+    }
+    if ( pState )
+        p->pStop( p->ddW, pState );
+#ifdef ABC_USE_PTHREADS
+    pthread_exit( NULL );
+#endif
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes image of the current states using several threads.]
+
+  Description [The callbacks transfer the transition relation into the
+  thread's manager, compute the image of one piece, and release the
+  relation. Returns the non-referenced image in the main manager, or
+  NULL if the computation did not finish.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+DdNode * Llb_ParImage( DdManager * dd, DdNode * bCurrent, int nProcs,
+    Llb_ParStartFunc_t pStart, Llb_ParImageFunc_t pImage, Llb_ParStopFunc_t pStop, void * pUser, int fVerbose )
+{
+    Llb_ParTh_t ThData[LLB_PAR_THR_MAX];
+    Vec_Ptr_t * vPieces;
+    DdNode * bImage, * bPart, * bTemp, * bFunc;
+    int i, nThreads, iNext = 0, fFailed = 0;
+    abctime clk = Abc_Clock();
+#ifdef ABC_USE_PTHREADS
+    pthread_t WorkerThread[LLB_PAR_THR_MAX];
+    pthread_mutex_t Mutex;
+    int status;
+    pthread_mutex_init( &Mutex, NULL );
+#endif
+    // split the states into twice as many pieces as threads to balance the load
+    nProcs  = Abc_MinInt( Abc_MaxInt(nProcs, 1), LLB_PAR_THR_MAX );
+    vPieces = Llb_ParSplit( dd, bCurrent, 2 * nProcs );
+    nThreads = Abc_MinInt( nProcs, Vec_PtrSize(vPieces) );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        memset( ThData + i, 0, sizeof(Llb_ParTh_t) );
+        ThData[i].dd      = dd;
+        ThData[i].vPieces = vPieces;
+        ThData[i].pNext   = &iNext;
+#ifdef ABC_USE_PTHREADS
+        ThData[i].pMutex  = (void *)&Mutex;
+#endif
+        ThData[i].pStart  = pStart;
+        ThData[i].pImage  = pImage;
+        ThData[i].pStop   = pStop;
+        ThData[i].pUser   = pUser;
+        ThData[i].ddW     = Llb_ParManStart( dd );
+    }
+#ifdef ABC_USE_PTHREADS
+    for ( i = 0; i < nThreads; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Llb_ParWorkerThread, (void *)(ThData + i) );
+        assert( status == 0 );
+    }
+    for ( i = 0; i < nThreads; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );
+        assert( status == 0 );
+    }
+    pthread_mutex_destroy( &Mutex );
+#else
+    for ( i = 0; i < nThreads; i++ )
+        Llb_ParWorkerThread( (void *)(ThData + i) );
+#endif
+    Vec_PtrForEachEntry( DdNode *, vPieces, bFunc, i )
+        Cudd_RecursiveDeref( dd, bFunc );
+    if ( fVerbose )
+    {
+        printf( "Image with %d threads: Pieces = %d (", nThreads, Vec_PtrSize(vPieces) );
+        for ( i = 0; i < nThreads; i++ )
+            printf( "%s%d", i ? " " : "", ThData[i].nPieces );
+        printf( ").  " );
+    }
+    Vec_PtrFree( vPieces );
+    // collect the images in the main manager
+    bImage = Cudd_ReadLogicZero( dd );  Cudd_Ref( bImage );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        fFailed |= ThData[i].fFailed;
+        bPart = fFailed ? NULL : Cudd_bddTransfer( ThData[i].ddW, dd, ThData[i].bImage );
+        if ( bPart != NULL )
+        {
+            Cudd_Ref( bPart );
+            bTemp = Cudd_bddOr( dd, bImage, bPart );
+            if ( bTemp != NULL )
+            {
+                Cudd_Ref( bTemp );
+                Cudd_RecursiveDeref( dd, bImage );
+                bImage = bTemp;
+            }
+            else
+                fFailed = 1;
+            Cudd_RecursiveDeref( dd, bPart );
+        }
+        else
+            fFailed = 1;
+        Cudd_RecursiveDeref( ThData[i].ddW, ThData[i].bImage );
+        Extra_StopManager( ThData[i].ddW );
+    }
+    if ( fVerbose )
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    if ( fFailed )
+    {
+        Cudd_RecursiveDeref( dd, bImage );
+        return NULL;
+    }
+    Cudd_Deref( bImage );
+    return bImage;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes partial images of the groups in one thread.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Llb_ParPtNextGroup( Llb_ParPt_t * p )
+{
+    int iGroup;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( (pthread_mutex_t *)p->pMutex );
+#endif
+    iGroup = (*p->pNext)++;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( (pthread_mutex_t *)p->pMutex );
+#endif
+    return iGroup;
+}
+DdNode * Llb_ParPtGroupImage( Llb_ParPt_t * p, int iGroup )
+{
+    Vec_Ptr_t * vPartsW;
+    DdNode * bCurrent = NULL, * bPart, * bImage = NULL;
+    int i, iStart = Vec_IntEntry( p->vGroups, 2*iGroup ), nParts = Vec_IntEntry( p->vGroups, 2*iGroup+1 );
+    vPartsW = Vec_PtrAlloc( nParts );
+    for ( i = iStart; i < iStart + nParts; i++ )
+    {
+        bPart = Cudd_bddTransfer( (DdManager *)Vec_PtrEntry(p->vDdMans, i), p->ddW, (DdNode *)Vec_PtrEntry(p->vParts, i) );
+        if ( bPart == NULL )
+            goto finish;
+        Cudd_Ref( bPart );
+        // constant partitions are not accepted by the scheduler
+        if ( bPart == Cudd_ReadLogicZero(p->ddW) )
+        {
+            bImage = bPart;
+            goto finish;
+        }
+        if ( bPart == Cudd_ReadOne(p->ddW) )
+        {
+            Cudd_RecursiveDeref( p->ddW, bPart );
+            continue;
+        }
+        Vec_PtrPush( vPartsW, bPart );
+    }
+    if ( !Cudd_IsConstant(p->bCurrent) )
+    {
+        bCurrent = Cudd_bddTransfer( p->dd, p->ddW, p->bCurrent );
+        if ( bCurrent == NULL )
+            goto finish;
+        Cudd_Ref( bCurrent );
+    }
+    bImage = Llb_Nonlin4Image( p->ddW, vPartsW, bCurrent, (Vec_Int_t *)Vec_PtrEntry(p->vLocals, iGroup) );
+    if ( bImage )
+        Cudd_Ref( bImage );
+    if ( bCurrent )
+        Cudd_RecursiveDeref( p->ddW, bCurrent );
+finish:
+    Vec_PtrForEachEntry( DdNode *, vPartsW, bPart, i )
+        Cudd_RecursiveDeref( p->ddW, bPart );
+    Vec_PtrFree( vPartsW );
+    return bImage;
+}
+void * Llb_ParPtWorkerThread( void * pArg )
+{
+    Llb_ParPt_t * p = (Llb_ParPt_t *)pArg;
+    int iGroup;
+    while ( !p->fFailed && (iGroup = Llb_ParPtNextGroup(p)) < Vec_PtrSize(p->vLocals) )
+    {
+        p->pResults[iGroup] = Llb_ParPtGroupImage( p, iGroup );
+        p->pOwners[iGroup]  = p->ddW;
+        if ( p->pResults[iGroup] == NULL )
+            p->fFailed = 1;
+        else
+            p->nGroups++;
+    }
+#ifdef ABC_USE_PTHREADS
+    pthread_exit( NULL );
+#endif
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Divides the partitions into contiguous groups.]
+
+  Description [Balances the total BDD size of the groups. Returns the
+  first partition and the number of partitions of each group.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Llb_ParPtGroups( Vec_Ptr_t * vDdMans, Vec_Ptr_t * vParts, int nGroups )
+{
+    Vec_Int_t * vGroups = Vec_IntAlloc( 2 * nGroups );
+    DdNode * bPart;
+    int i, nNodes = 0, nTotal = 0, iStart = 0, nLeft;
+    Vec_PtrForEachEntry( DdNode *, vParts, bPart, i )
+        nTotal += Cudd_DagSize( bPart );
+    Vec_PtrForEachEntry( DdNode *, vParts, bPart, i )
+    {
+        nNodes += Cudd_DagSize( bPart );
+        nLeft   = nGroups - 1 - Vec_IntSize(vGroups)/2; // groups to be opened after this one
+        // close the group if it has its share of nodes or if the remaining partitions are needed by other groups
+        if ( i < Vec_PtrSize(vParts) - 1 && (nLeft == 0 || ((double)nNodes * nGroups < (double)nTotal * (Vec_IntSize(vGroups)/2 + 1) && Vec_PtrSize(vParts) - 1 - i > nLeft)) )
+            continue;
+        Vec_IntPushTwo( vGroups, iStart, i + 1 - iStart );
+        iStart = i + 1;
+    }
+    return vGroups;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the local variables of each group.]
+
+  Description [A variable is local if it is quantified, does not appear
+  in the current states, and appears only in the partitions of one group.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * Llb_ParPtLocals( DdManager * dd, Vec_Ptr_t * vDdMans, Vec_Ptr_t * vParts, Vec_Int_t * vGroups, DdNode * bCurrent, Vec_Int_t * vVars2Q )
+{
+    Vec_Ptr_t * vLocals;
+    Vec_Int_t * vLocal;
+    DdManager * ddPart;
+    int * pOwner, * pSupp;
+    int i, k, v, g, nVars = Cudd_ReadSize(dd);
+    Vec_PtrForEachEntry( DdManager *, vDdMans, ddPart, i )
+        nVars = Abc_MaxInt( nVars, Abc_MaxInt(ddPart->size, ddPart->sizeZ) );
+    pOwner = ABC_FALLOC( int, nVars );
+    pSupp  = ABC_ALLOC( int, nVars );
+    for ( g = 0; g < Vec_IntSize(vGroups)/2; g++ )
+    for ( k = 0, i = Vec_IntEntry(vGroups, 2*g); k < Vec_IntEntry(vGroups, 2*g+1); k++, i++ )
+    {
+        ddPart = (DdManager *)Vec_PtrEntry( vDdMans, i );
+        Extra_SupportArray( ddPart, (DdNode *)Vec_PtrEntry(vParts, i), pSupp );
+        for ( v = 0; v < Abc_MaxInt(ddPart->size, ddPart->sizeZ); v++ )
+            if ( pSupp[v] )
+                pOwner[v] = (pOwner[v] == -1 || pOwner[v] == g) ? g : -2;
+    }
+    Extra_SupportArray( dd, bCurrent, pSupp );
+    for ( v = 0; v < Abc_MaxInt(dd->size, dd->sizeZ); v++ )
+        if ( pSupp[v] )
+            pOwner[v] = -2;
+    vLocals = Vec_PtrAlloc( Vec_IntSize(vGroups)/2 );
+    for ( g = 0; g < Vec_IntSize(vGroups)/2; g++ )
+    {
+        vLocal = Vec_IntStart( Abc_MaxInt(nVars, Vec_IntSize(vVars2Q)) );
+        for ( v = 0; v < Vec_IntSize(vVars2Q); v++ )
+            if ( Vec_IntEntry(vVars2Q, v) && v < nVars && pOwner[v] == g )
+                Vec_IntWriteEntry( vLocal, v, 1 );
+        Vec_PtrPush( vLocals, vLocal );
+    }
+    ABC_FREE( pOwner );
+    ABC_FREE( pSupp );
+    return vLocals;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes image by dividing the partitions among threads.]
+
+  Description [The i-th partition belongs to the i-th manager in vDdMans.
+  Variable v is quantified if entry v of vVars2Q is set. Returns the
+  non-referenced image in the main manager, or NULL if the computation
+  did not finish.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+DdNode * Llb_ParImageParts( DdManager * dd, Vec_Ptr_t * vDdMans, Vec_Ptr_t * vParts, DdNode * bCurrent, Vec_Int_t * vVars2Q, int nProcs, int fVerbose )
+{
+    Llb_ParPt_t ThData[LLB_PAR_THR_MAX];
+    Vec_Int_t * vGroups;
+    Vec_Ptr_t * vLocals, * vPartials;
+    DdManager * pOwners[LLB_PAR_THR_MAX];
+    DdNode * pResults[LLB_PAR_THR_MAX];
+    DdNode * bImage, * bPart;
+    int i, k, nGroups, nThreads, iNext = 0, fFailed = 0, fZero = 0;
+    abctime clk = Abc_Clock();
+#ifdef ABC_USE_PTHREADS
+    pthread_t WorkerThread[LLB_PAR_THR_MAX];
+    pthread_mutex_t Mutex;
+    int status;
+#endif
+    assert( Vec_PtrSize(vDdMans) == Vec_PtrSize(vParts) );
+    assert( Vec_PtrSize(vParts) > 0 );
+    if ( bCurrent == Cudd_ReadLogicZero(dd) )
+        return bCurrent;
+    // use twice as many groups as threads to balance the load
+    nProcs   = Abc_MinInt( Abc_MaxInt(nProcs, 1), LLB_PAR_THR_MAX / 2 );
+    nGroups  = Abc_MinInt( 2 * nProcs, Vec_PtrSize(vParts) );
+    nThreads = Abc_MinInt( nProcs, nGroups );
+    vGroups  = Llb_ParPtGroups( vDdMans, vParts, nGroups );
+    nGroups  = Vec_IntSize(vGroups) / 2;
+    vLocals  = Llb_ParPtLocals( dd, vDdMans, vParts, vGroups, bCurrent, vVars2Q );
+    memset( pResults, 0, sizeof(DdNode *) * nGroups );
+    memset( pOwners, 0, sizeof(DdManager *) * nGroups );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &Mutex, NULL );
+#endif
+    for ( i = 0; i < nThreads; i++ )
+    {
+        memset( ThData + i, 0, sizeof(Llb_ParPt_t) );
+        ThData[i].dd       = dd;
+        ThData[i].vDdMans  = vDdMans;
+        ThData[i].vParts   = vParts;
+        ThData[i].vGroups  = vGroups;
+        ThData[i].vLocals  = vLocals;
+        ThData[i].bCurrent = bCurrent;
+        ThData[i].pResults = pResults;
+        ThData[i].pOwners  = pOwners;
+        ThData[i].pNext    = &iNext;
+#ifdef ABC_USE_PTHREADS
+        ThData[i].pMutex   = (void *)&Mutex;
+#endif
+        ThData[i].ddW      = Llb_ParManStart( dd );
+    }
+#ifdef ABC_USE_PTHREADS
+    for ( i = 0; i < nThreads; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Llb_ParPtWorkerThread, (void *)(ThData + i) );
+        assert( status == 0 );
+    }
+    for ( i = 0; i < nThreads; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );
+        assert( status == 0 );
+    }
+    pthread_mutex_destroy( &Mutex );
+#else
+    for ( i = 0; i < nThreads; i++ )
+        Llb_ParPtWorkerThread( (void *)(ThData + i) );
+#endif
+    if ( fVerbose )
+    {
+        printf( "Image with %d threads: Groups = %d (", nThreads, nGroups );
+        for ( i = 0; i < nGroups; i++ )
+            printf( "%s%d", i ? " " : "", Vec_IntEntry(vGroups, 2*i+1) );
+        printf( ")  Done = (" );
+        for ( i = 0; i < nThreads; i++ )
+            printf( "%s%d", i ? " " : "", ThData[i].nGroups );
+        printf( ").  " );
+    }
+    // transfer the partial images into the main manager
+    vPartials = Vec_PtrAlloc( nGroups );
+    for ( i = 0; i < nThreads; i++ )
+        fFailed |= ThData[i].fFailed;
+    for ( k = 0; k < nGroups; k++ )
+    {
+        if ( pResults[k] == NULL )
+            continue;
+        if ( !fFailed && !fZero )
+        {
+            bPart = Cudd_bddTransfer( pOwners[k], dd, pResults[k] );
+            if ( bPart == NULL )
+                fFailed = 1;
+            else if ( bPart == Cudd_ReadLogicZero(dd) )
+                fZero = 1;
+            else if ( bPart != Cudd_ReadOne(dd) )
+            {
+                Cudd_Ref( bPart );
+                Vec_PtrPush( vPartials, bPart );
+            }
+        }
+        Cudd_RecursiveDeref( pOwners[k], pResults[k] );
+    }
+    for ( i = 0; i < nThreads; i++ )
+        Extra_StopManager( ThData[i].ddW );
+    Vec_VecFree( (Vec_Vec_t *)vLocals );
+    Vec_IntFree( vGroups );
+    // quantify the remaining variables
+    if ( fFailed )
+        bImage = NULL;
+    else if ( fZero )
+        bImage = Cudd_ReadLogicZero( dd );
+    else
+        bImage = Llb_Nonlin4Image( dd, vPartials, NULL, vVars2Q );
+    if ( bImage )
+        Cudd_Ref( bImage );
+    Vec_PtrForEachEntry( DdNode *, vPartials, bPart, i )
+        Cudd_RecursiveDeref( dd, bPart );
+    Vec_PtrFree( vPartials );
+    if ( fVerbose )
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    if ( bImage )
+        Cudd_Deref( bImage );
+    return bImage;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -108,8 +108,10 @@ struct Dec_Man_t_
 /*=== decAbc.c ========================================================*/
 /*=== decFactor.c ========================================================*/
 extern Dec_Graph_t *  Dec_Factor( char * pSop );
+extern Dec_Graph_t *  Dec_FactorMan( Dec_Man_t * pManDec, char * pSop );
 /*=== decMan.c ========================================================*/
 extern Dec_Man_t *    Dec_ManStart();
+extern Dec_Man_t *    Dec_ManStartFactor();
 extern void           Dec_ManStop( Dec_Man_t * p );
 /*=== decPrint.c ========================================================*/
 extern void           Dec_GraphPrint( FILE * pFile, Dec_Graph_t * pGraph, char * pNamesIn[], char * pNameOut );
@@ -292,21 +292,21 @@ Hop_Obj_t * Dec_GraphToNetworkAig( Hop_Man_t * pMan, Dec_Graph_t * pGraph )
 
   Synopsis    [Strashes one logic node using its SOP.]
 
-  Description []
+  Description [Factoring uses the given manager.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Hop_Obj_t * Dec_GraphFactorSop( Hop_Man_t * pMan, char * pSop )
+Hop_Obj_t * Dec_GraphFactorSop( Hop_Man_t * pMan, Dec_Man_t * pManDec, char * pSop )
 {
     Hop_Obj_t * pFunc;
     Dec_Graph_t * pFForm;
     Dec_Node_t * pNode;
     int i;
     // perform factoring
-    pFForm = Dec_Factor( pSop );
+    pFForm = Dec_FactorMan( pManDec, pSop );
     // collect the fanins
     Dec_GraphForEachLeaf( pFForm, pNode, i )
         pNode->pFunc = Hop_IthVar( pMan, i );
@@ -32,13 +32,13 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
-static Dec_Edge_t       Dec_Factor_rec( Dec_Graph_t * pFForm, Mvc_Cover_t * pCover );
-static Dec_Edge_t       Dec_FactorLF_rec( Dec_Graph_t * pFForm, Mvc_Cover_t * pCover, Mvc_Cover_t * pSimple );
-static Dec_Edge_t       Dec_FactorTrivial( Dec_Graph_t * pFForm, Mvc_Cover_t * pCover );
+static Dec_Edge_t       Dec_Factor_rec( Dec_Man_t * pManDec, Dec_Graph_t * pFForm, Mvc_Cover_t * pCover );
+static Dec_Edge_t       Dec_FactorLF_rec( Dec_Man_t * pManDec, Dec_Graph_t * pFForm, Mvc_Cover_t * pCover, Mvc_Cover_t * pSimple );
+static Dec_Edge_t       Dec_FactorTrivial( Dec_Man_t * pManDec, Dec_Graph_t * pFForm, Mvc_Cover_t * pCover );
 static Dec_Edge_t       Dec_FactorTrivialCube( Dec_Graph_t * pFForm, Mvc_Cover_t * pCover, Mvc_Cube_t * pCube, Vec_Int_t * vEdgeLits );
 static Dec_Edge_t       Dec_FactorTrivialTree_rec( Dec_Graph_t * pFForm, Dec_Edge_t * peNodes, int nNodes, int fNodeOr );
 static int              Dec_FactorVerify( char * pSop, Dec_Graph_t * pFForm );
-static Mvc_Cover_t *    Dec_ConvertSopToMvc( char * pSop );
+static Mvc_Cover_t *    Dec_ConvertSopToMvc( Dec_Man_t * pManDec, char * pSop );
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -56,6 +56,24 @@ static Mvc_Cover_t *    Dec_ConvertSopToMvc( char * pSop );
 
 ***********************************************************************/
 Dec_Graph_t * Dec_Factor( char * pSop )
+{
+    return Dec_FactorMan( (Dec_Man_t *)Abc_FrameReadManDec(), pSop );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Factors the cover using the given manager.]
+
+  Description [The manager provides the MVC memory and the temporary
+  storage, so the procedure can be called concurrently with different
+  managers.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Dec_Graph_t * Dec_FactorMan( Dec_Man_t * pManDec, char * pSop )
 {
     Mvc_Cover_t * pCover;
     Dec_Graph_t * pFForm;
@@ -66,7 +84,7 @@ Dec_Graph_t * Dec_Factor( char * pSop )
         return Dec_GraphCreateConst1();
 
     // derive the cover from the SOP representation
-    pCover = Dec_ConvertSopToMvc( pSop );
+    pCover = Dec_ConvertSopToMvc( pManDec, pSop );
 
     // make sure the cover is CCS free (should be done before CST)
     Mvc_CoverContain( pCover );
@@ -80,7 +98,7 @@ Dec_Graph_t * Dec_Factor( char * pSop )
     // start the factored form
     pFForm = Dec_GraphCreate( Abc_SopGetVarNum(pSop) );
     // factor the cover
-    eRoot = Dec_Factor_rec( pFForm, pCover );
+    eRoot = Dec_Factor_rec( pManDec, pFForm, pCover );
     // finalize the factored form
     Dec_GraphSetRoot( pFForm, eRoot );
     // complement the factored form if SOP is complemented
@@ -105,7 +123,7 @@ Dec_Graph_t * Dec_Factor( char * pSop )
   SeeAlso     []
 
 ***********************************************************************/
-Dec_Edge_t Dec_Factor_rec( Dec_Graph_t * pFForm, Mvc_Cover_t * pCover )
+Dec_Edge_t Dec_Factor_rec( Dec_Man_t * pManDec, Dec_Graph_t * pFForm, Mvc_Cover_t * pCover )
 {
     Mvc_Cover_t * pDiv, * pQuo, * pRem, * pCom;
     Dec_Edge_t eNodeDiv, eNodeQuo, eNodeRem;
@@ -117,7 +135,7 @@ Dec_Edge_t Dec_Factor_rec( Dec_Graph_t * pFForm, Mvc_Cover_t * pCover )
     // get the divisor
     pDiv = Mvc_CoverDivisor( pCover );
     if ( pDiv == NULL )
-        return Dec_FactorTrivial( pFForm, pCover );
+        return Dec_FactorTrivial( pManDec, pFForm, pCover );
 
     // divide the cover by the divisor
     Mvc_CoverDivideInternal( pCover, pDiv, &pQuo, &pRem );
@@ -129,7 +147,7 @@ Dec_Edge_t Dec_Factor_rec( Dec_Graph_t * pFForm, Mvc_Cover_t * pCover )
     // check the trivial case
     if ( Mvc_CoverReadCubeNum(pQuo) == 1 )
     {
-        eNode = Dec_FactorLF_rec( pFForm, pCover, pQuo );
+        eNode = Dec_FactorLF_rec( pManDec, pFForm, pCover, pQuo );
         Mvc_CoverFree( pQuo );
         return eNode;
     }
@@ -143,8 +161,8 @@ Dec_Edge_t Dec_Factor_rec( Dec_Graph_t * pFForm, Mvc_Cover_t * pCover )
     // check the trivial case
     if ( Mvc_CoverIsCubeFree( pDiv ) )
     {
-        eNodeDiv = Dec_Factor_rec( pFForm, pDiv );
-        eNodeQuo = Dec_Factor_rec( pFForm, pQuo );
+        eNodeDiv = Dec_Factor_rec( pManDec, pFForm, pDiv );
+        eNodeQuo = Dec_Factor_rec( pManDec, pFForm, pQuo );
         Mvc_CoverFree( pDiv );
         Mvc_CoverFree( pQuo );
         eNodeAnd = Dec_GraphAddNodeAnd( pFForm, eNodeDiv, eNodeQuo );
@@ -155,7 +173,7 @@ Dec_Edge_t Dec_Factor_rec( Dec_Graph_t * pFForm, Mvc_Cover_t * pCover )
         }
         else
         {
-            eNodeRem = Dec_Factor_rec( pFForm, pRem );
+            eNodeRem = Dec_Factor_rec( pManDec, pFForm, pRem );
             Mvc_CoverFree( pRem );
             return Dec_GraphAddNodeOr( pFForm, eNodeAnd, eNodeRem );
         }
@@ -168,7 +186,7 @@ Dec_Edge_t Dec_Factor_rec( Dec_Graph_t * pFForm, Mvc_Cover_t * pCover )
     Mvc_CoverFree( pRem );
 
     // solve the simple problem
-    eNode = Dec_FactorLF_rec( pFForm, pCover, pCom );
+    eNode = Dec_FactorLF_rec( pManDec, pFForm, pCover, pCom );
     Mvc_CoverFree( pCom );
     return eNode;
 }
@@ -185,9 +203,8 @@ Dec_Edge_t Dec_Factor_rec( Dec_Graph_t * pFForm, Mvc_Cover_t * pCover )
   SeeAlso     []
 
 ***********************************************************************/
-Dec_Edge_t Dec_FactorLF_rec( Dec_Graph_t * pFForm, Mvc_Cover_t * pCover, Mvc_Cover_t * pSimple )
+Dec_Edge_t Dec_FactorLF_rec( Dec_Man_t * pManDec, Dec_Graph_t * pFForm, Mvc_Cover_t * pCover, Mvc_Cover_t * pSimple )
 {
-    Dec_Man_t * pManDec = (Dec_Man_t *)Abc_FrameReadManDec();
     Vec_Int_t * vEdgeLits  = pManDec->vLits;
     Mvc_Cover_t * pDiv, * pQuo, * pRem;
     Dec_Edge_t eNodeDiv, eNodeQuo, eNodeRem;
@@ -201,7 +218,7 @@ Dec_Edge_t Dec_FactorLF_rec( Dec_Graph_t * pFForm, Mvc_Cover_t * pCover, Mvc_Cov
     eNodeDiv = Dec_FactorTrivialCube( pFForm, pDiv, Mvc_CoverReadCubeHead(pDiv), vEdgeLits );
     Mvc_CoverFree( pDiv );
     // factor the quotient and remainder
-    eNodeQuo = Dec_Factor_rec( pFForm, pQuo );
+    eNodeQuo = Dec_Factor_rec( pManDec, pFForm, pQuo );
     Mvc_CoverFree( pQuo );
     eNodeAnd = Dec_GraphAddNodeAnd( pFForm, eNodeDiv, eNodeQuo );
     if ( Mvc_CoverReadCubeNum(pRem) == 0 )
@@ -211,7 +228,7 @@ Dec_Edge_t Dec_FactorLF_rec( Dec_Graph_t * pFForm, Mvc_Cover_t * pCover, Mvc_Cov
     }
     else
     {
-        eNodeRem = Dec_Factor_rec( pFForm, pRem );
+        eNodeRem = Dec_Factor_rec( pManDec, pFForm, pRem );
         Mvc_CoverFree( pRem );
         return Dec_GraphAddNodeOr( pFForm,  eNodeAnd, eNodeRem );
     }
@@ -230,9 +247,8 @@ Dec_Edge_t Dec_FactorLF_rec( Dec_Graph_t * pFForm, Mvc_Cover_t * pCover, Mvc_Cov
   SeeAlso     []
 
 ***********************************************************************/
-Dec_Edge_t Dec_FactorTrivial( Dec_Graph_t * pFForm, Mvc_Cover_t * pCover )
+Dec_Edge_t Dec_FactorTrivial( Dec_Man_t * pManDec, Dec_Graph_t * pFForm, Mvc_Cover_t * pCover )
 {
-    Dec_Man_t * pManDec = (Dec_Man_t *)Abc_FrameReadManDec();
     Vec_Int_t * vEdgeCubes = pManDec->vCubes;
     Vec_Int_t * vEdgeLits  = pManDec->vLits;
     Dec_Edge_t eNode;
@@ -323,9 +339,8 @@ Dec_Edge_t Dec_FactorTrivialTree_rec( Dec_Graph_t * pFForm, Dec_Edge_t * peNodes
   SeeAlso     []
 
 ***********************************************************************/
-Mvc_Cover_t * Dec_ConvertSopToMvc( char * pSop )
+Mvc_Cover_t * Dec_ConvertSopToMvc( Dec_Man_t * pManDec, char * pSop )
 {
-    Dec_Man_t * pManDec = (Dec_Man_t *)Abc_FrameReadManDec();
     Mvc_Manager_t * pMem = (Mvc_Manager_t *)pManDec->pMvcMem;
     Mvc_Cover_t * pMvc;
     Mvc_Cube_t * pMvcCube;
@@ -56,6 +56,28 @@ Dec_Man_t * Dec_ManStart()
     return p;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Starts the manager used only for factoring.]
+
+  Description [Skips the precomputation of 4-variable NPN classes. Such
+  managers are used by the threads that factor SOPs concurrently.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Dec_Man_t * Dec_ManStartFactor()
+{
+    Dec_Man_t * p;
+    p = ABC_CALLOC( Dec_Man_t, 1 );
+    p->pMvcMem = Mvc_ManagerStart();
+    p->vCubes = Vec_IntAlloc( 8 );
+    p->vLits = Vec_IntAlloc( 8 );
+    return p;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Stops the MVC maanager used in the factoring package.]
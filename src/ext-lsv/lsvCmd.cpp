@@ -5,6 +5,7 @@
 #include <set>
 #include <algorithm>
 #include "sat/cnf/cnf.h"
+#include "sat/bmc/bmc.h"
 extern "C"
 {
   Aig_Man_t *Abc_NtkToDar(Abc_Ntk_t *pNtk, int fExors, int fRegisters);
@@ -193,7 +194,7 @@ int Lsv_CommandPrintCuts(Abc_Frame_t *pAbc, int argc, char **argv)
     Abc_Print(-1, "Empty network.\n");
     return 1;
   }
-  Lsv_NtkPrintCuts(pNtk, atoi(argv[1]));
+  Lsv_NtkPrintCuts(pNtk, atoi(argv[globalUtilOptind]));
 
   return 0;
 
@@ -204,7 +205,21 @@ usage:
   return 1;
 }
 
-void Lsv_NtkSDC(Abc_Ntk_t *pNtk, int n)
+int Lsv_NtkIsAndNode(Abc_Ntk_t *pNtk, int n)
+{
+  return n >= 0 && n < Abc_NtkObjNumMax(pNtk) && Abc_NtkObj(pNtk, n) && Abc_AigNodeIsAnd(Abc_NtkObj(pNtk, n));
+}
+
+Bmc_Sat_t *Lsv_SatStart(Cnf_Dat_t *pCnf, int SolverType)
+{
+  Bmc_Sat_t *pSat = Bmc_SatStart(SolverType);
+  Bmc_SatSetVarNum(pSat, pCnf->nVars);
+  for (int i = 0; i < pCnf->nClauses; i++)
+    Bmc_SatAddClause(pSat, pCnf->pClauses[i], pCnf->pClauses[i + 1] - pCnf->pClauses[i]);
+  return pSat;
+}
+
+void Lsv_NtkSDC(Abc_Ntk_t *pNtk, int n, int SolverType)
 {
   // Initialization
   Abc_Obj_t *pObj = Abc_NtkObj(pNtk, n);
@@ -224,8 +239,7 @@ void Lsv_NtkSDC(Abc_Ntk_t *pNtk, int n)
   Cnf_Dat_t *pCnf = Cnf_Derive(pAig, 3);
 
   // Create sat solver
-  sat_solver *pSatSolver = sat_solver_new();
-  Cnf_DataWriteIntoSolverInt(pSatSolver, pCnf, 1, 0);
+  Bmc_Sat_t *pSat = Lsv_SatStart(pCnf, SolverType);
 
   // Solver initialization
   int varFanin0 = pCnf->pVarNums[Aig_ManCo(pAig, 1)->Id];
@@ -238,13 +252,13 @@ void Lsv_NtkSDC(Abc_Ntk_t *pNtk, int n)
     for (int v1 = 0; v1 <= 1; v1++)
     {
       // Create assignments
-      lit assumptions[2] = {
+      int assumptions[2] = {
           Abc_Var2Lit(varFanin0, v0),
           Abc_Var2Lit(varFanin1, v1),
       };
 
       // Solve
-      int satisfiable = sat_solver_solve(pSatSolver, assumptions, assumptions + 2, 0, 0, 0, 0);
+      int satisfiable = Bmc_SatSolve(pSat, assumptions, 2);
       if (satisfiable == l_False)
       {
         printf("%d%d ", (v0 == edge_Fanin0), (v1 == edge_Fanin1));
@@ -257,7 +271,7 @@ void Lsv_NtkSDC(Abc_Ntk_t *pNtk, int n)
   printf("\n");
 
   // Free memory
-  sat_solver_delete(pSatSolver);
+  Bmc_SatStop(pSat);
   Cnf_DataFree(pCnf);
   Vec_PtrFree(vCone);
 }
@@ -265,12 +279,23 @@ void Lsv_NtkSDC(Abc_Ntk_t *pNtk, int n)
 int Lsv_CommandSDC(Abc_Frame_t *pAbc, int argc, char **argv)
 {
   Abc_Ntk_t *pNtk = Abc_FrameReadNtk(pAbc);
-  int c;
+  int c, n, SolverType = BMC_SAT_BSAT;
   Extra_UtilGetoptReset();
-  while ((c = Extra_UtilGetopt(argc, argv, "h")) != EOF)
+  while ((c = Extra_UtilGetopt(argc, argv, "Sh")) != EOF)
   {
     switch (c)
     {
+    case 'S':
+      if (globalUtilOptind >= argc)
+      {
+        Abc_Print(-1, "Command line switch \"-S\" should be followed by an integer.\n");
+        goto usage;
+      }
+      SolverType = atoi(argv[globalUtilOptind]);
+      globalUtilOptind++;
+      if (SolverType < BMC_SAT_BSAT || SolverType > BMC_SAT_PORTFOLIO)
+        goto usage;
+      break;
     case 'h':
       goto usage;
     default:
@@ -287,18 +312,30 @@ int Lsv_CommandSDC(Abc_Frame_t *pAbc, int argc, char **argv)
     Abc_Print(-1, "Empty network.\n");
     return 1;
   }
-  Lsv_NtkSDC(pNtk, atoi(argv[1]));
+  if (!Abc_NtkIsStrash(pNtk))
+  {
+    Abc_Print(-1, "This command can only be applied to an AIG (run \"strash\").\n");
+    return 1;
+  }
+  n = atoi(argv[globalUtilOptind]);
+  if (!Lsv_NtkIsAndNode(pNtk, n))
+  {
+    Abc_Print(-1, "Object %d is not an AND node of the AIG.\n", n);
+    return 1;
+  }
+  Lsv_NtkSDC(pNtk, n, SolverType);
 
   return 0;
 
 usage:
-  Abc_Print(-2, "usage: lsv_sdc [-h] <n>\n");
+  Abc_Print(-2, "usage: lsv_sdc [-S num] [-h] <n>\n");
   Abc_Print(-2, "\t        list all the minterms of the satisfiability don't cares\n");
-  Abc_Print(-2, "\t-h    : print the command usage\n");
+  Abc_Print(-2, "\t-S num : SAT solver (0=bsat, 1=satoko, 2=glucose2, 3=portfolio) [default = %d]\n", SolverType);
+  Abc_Print(-2, "\t-h     : print the command usage\n");
   return 1;
 }
 
-std::set<std::pair<int, int>> Lsv_SetSDC(Abc_Ntk_t *pNtk, int n)
+std::set<std::pair<int, int>> Lsv_SetSDC(Abc_Ntk_t *pNtk, int n, int SolverType)
 {
   Abc_Obj_t *pObj = Abc_NtkObj(pNtk, n);
   Abc_Obj_t *pFanin0 = Abc_ObjFanin0(pObj);
@@ -313,8 +350,7 @@ std::set<std::pair<int, int>> Lsv_SetSDC(Abc_Ntk_t *pNtk, int n)
   Aig_Man_t *pAig = Abc_NtkToDar(pConeNtk, 0, 0);
   Cnf_Dat_t *pCnf = Cnf_Derive(pAig, 3);
 
-  sat_solver *pSatSolver = sat_solver_new();
-  Cnf_DataWriteIntoSolverInt(pSatSolver, pCnf, 1, 0);
+  Bmc_Sat_t *pSat = Lsv_SatStart(pCnf, SolverType);
 
   int varFanin0 = pCnf->pVarNums[Aig_ManCo(pAig, 1)->Id];
   int varFanin1 = pCnf->pVarNums[Aig_ManCo(pAig, 2)->Id];
@@ -324,12 +360,12 @@ std::set<std::pair<int, int>> Lsv_SetSDC(Abc_Ntk_t *pNtk, int n)
   {
     for (int v1 = 0; v1 <= 1; v1++)
     {
-      lit assumptions[2] = {
+      int assumptions[2] = {
           Abc_Var2Lit(varFanin0, v0),
           Abc_Var2Lit(varFanin1, v1),
       };
 
-      int satisfiable = sat_solver_solve(pSatSolver, assumptions, assumptions + 2, 0, 0, 0, 0);
+      int satisfiable = Bmc_SatSolve(pSat, assumptions, 2);
       if (satisfiable == l_False)
       {
         sdc_set.insert({(v0 == edge_Fanin0), (v1 == edge_Fanin1)});
@@ -342,34 +378,38 @@ std::set<std::pair<int, int>> Lsv_SetSDC(Abc_Ntk_t *pNtk, int n)
   //   printf("no sdc");
   // printf("\n");
 
-  sat_solver_delete(pSatSolver);
+  Bmc_SatStop(pSat);
   Cnf_DataFree(pCnf);
   Vec_PtrFree(vCone);
   return sdc_set;
 }
 
-void Lsv_NtkODC(Abc_Ntk_t *pNtk, int n)
+void Lsv_NtkODC(Abc_Ntk_t *pNtk, int n, int SolverType)
 {
   // Initialization
-  Abc_Ntk_t *pNtk1 = Abc_NtkDup(pNtk), *pNtk2 = Abc_NtkDup(pNtk);
-  Abc_Obj_t *pObj1 = Abc_NtkObj(pNtk1, n), *pObj2 = Abc_NtkObj(pNtk2, n);
+  Abc_Ntk_t *pNtk1 = Abc_NtkDup(pNtk);
+  Abc_Obj_t *pObj1 = Abc_NtkObj(pNtk1, n), *pObj2 = Abc_NtkObj(pNtk, n);
   int edge_Fanin0 = Abc_ObjFaninC0(pObj1), edge_Fanin1 = Abc_ObjFaninC1(pObj1);
 
-  // Negate the fanouts of node n
+  // Negate the fanouts of node n in place (undone after deriving the miter)
   Abc_Obj_t *iFanout;
   int i;
+  Abc_NtkUndoStart(pNtk);
   Abc_ObjForEachFanout(pObj2, iFanout, i)
   {
     if (Abc_ObjIsPo(iFanout)) // Fanout is PO: no odc
     {
       printf("no odc\n");
+      Abc_NtkUndoRollback(pNtk);
+      Abc_NtkDelete(pNtk1);
       return;
     }
     Abc_ObjXorFaninC(iFanout, Abc_ObjFanoutEdgeNum(pObj2, iFanout));
   }
 
   // Create the miter
-  Abc_Ntk_t *pMiter = Abc_NtkMiter(pNtk1, pNtk2, 1, 0, 0, 0);
+  Abc_Ntk_t *pMiter = Abc_NtkMiter(pNtk1, pNtk, 1, 0, 0, 0);
+  Abc_NtkUndoRollback(pNtk);
   Abc_NtkAppend(pNtk1, pMiter, 1);
 
   // Create the miter using cone
@@ -391,19 +431,18 @@ void Lsv_NtkODC(Abc_Ntk_t *pNtk, int n)
   // Aig_ManDumpBlif(pAig, "debug.blif", NULL, NULL);
 
   // Create sat solver
-  sat_solver *pSatSolver = sat_solver_new();
-  Cnf_DataWriteIntoSolverInt(pSatSolver, pCnf, 1, 0);
+  Bmc_Sat_t *pSat = Lsv_SatStart(pCnf, SolverType);
 
   // Set PO = 1
   int varPo = pCnf->pVarNums[Aig_ManCo(pAig, 0)->Id];
-  lit litPo = Abc_Var2Lit(varPo, 0);
-  sat_solver_addclause(pSatSolver, &litPo, &litPo + 1);
+  int litPo = Abc_Var2Lit(varPo, 0);
+  Bmc_SatAddClause(pSat, &litPo, 1);
 
   // Solver initialization
 
   int varFanin0 = pCnf->pVarNums[Aig_ManCo(pAig, 1)->Id];
   int varFanin1 = pCnf->pVarNums[Aig_ManCo(pAig, 2)->Id];
-  int satisfiable = sat_solver_solve(pSatSolver, NULL, NULL, 0, 0, 0, 0);
+  int satisfiable = Bmc_SatSolve(pSat, NULL, 0);
   std::set<std::pair<int, int>> dc_set = {
       {0, 0},
       {0, 1},
@@ -414,25 +453,25 @@ void Lsv_NtkODC(Abc_Ntk_t *pNtk, int n)
   while (satisfiable == 1)
   {
     // Create clause
-    lit Lits[2];
-    Lits[0] = Abc_Var2Lit(varFanin0, sat_solver_var_value(pSatSolver, varFanin0));
-    Lits[1] = Abc_Var2Lit(varFanin1, sat_solver_var_value(pSatSolver, varFanin1));
+    int Lits[2];
+    Lits[0] = Abc_Var2Lit(varFanin0, Bmc_SatVarValue(pSat, varFanin0));
+    Lits[1] = Abc_Var2Lit(varFanin1, Bmc_SatVarValue(pSat, varFanin1));
 
     // Remove care pattern
-    auto care = dc_set.find({(sat_solver_var_value(pSatSolver, varFanin0) != edge_Fanin0), (sat_solver_var_value(pSatSolver, varFanin1) != edge_Fanin1)});
+    auto care = dc_set.find({(Bmc_SatVarValue(pSat, varFanin0) != edge_Fanin0), (Bmc_SatVarValue(pSat, varFanin1) != edge_Fanin1)});
     if (care != dc_set.end())
       dc_set.erase(care);
 
     // Add clauses
-    if (!sat_solver_addclause(pSatSolver, Lits, Lits + 2))
+    if (!Bmc_SatAddClause(pSat, Lits, 2))
       break;
 
     // Solve
-    satisfiable = sat_solver_solve(pSatSolver, NULL, NULL, 0, 0, 0, 0);
+    satisfiable = Bmc_SatSolve(pSat, NULL, 0);
   }
 
   // Create odc set
-  std::set<std::pair<int, int>> sdc_set = Lsv_SetSDC(pNtk, n);
+  std::set<std::pair<int, int>> sdc_set = Lsv_SetSDC(pNtk, n, SolverType);
   std::set<std::pair<int, int>> odc_set;
 
   std::set_difference(dc_set.begin(), dc_set.end(),
@@ -449,20 +488,35 @@ void Lsv_NtkODC(Abc_Ntk_t *pNtk, int n)
   printf("\n");
 
   // Free memory
-  sat_solver_delete(pSatSolver);
+  Bmc_SatStop(pSat);
   Cnf_DataFree(pCnf);
+  Aig_ManStop(pAig);
+  Abc_NtkDelete(pConeMiter);
+  Abc_NtkDelete(pMiter);
+  Abc_NtkDelete(pNtk1);
   Vec_PtrFree(vCone);
 }
 
 int Lsv_CommandODC(Abc_Frame_t *pAbc, int argc, char **argv)
 {
   Abc_Ntk_t *pNtk = Abc_FrameReadNtk(pAbc);
-  int c;
+  int c, n, SolverType = BMC_SAT_BSAT;
   Extra_UtilGetoptReset();
-  while ((c = Extra_UtilGetopt(argc, argv, "h")) != EOF)
+  while ((c = Extra_UtilGetopt(argc, argv, "Sh")) != EOF)
   {
     switch (c)
     {
+    case 'S':
+      if (globalUtilOptind >= argc)
+      {
+        Abc_Print(-1, "Command line switch \"-S\" should be followed by an integer.\n");
+        goto usage;
+      }
+      SolverType = atoi(argv[globalUtilOptind]);
+      globalUtilOptind++;
+      if (SolverType < BMC_SAT_BSAT || SolverType > BMC_SAT_PORTFOLIO)
+        goto usage;
+      break;
     case 'h':
       goto usage;
     default:
@@ -479,13 +533,25 @@ int Lsv_CommandODC(Abc_Frame_t *pAbc, int argc, char **argv)
     Abc_Print(-1, "Empty network.\n");
     return 1;
   }
-  Lsv_NtkODC(pNtk, atoi(argv[1]));
+  if (!Abc_NtkIsStrash(pNtk))
+  {
+    Abc_Print(-1, "This command can only be applied to an AIG (run \"strash\").\n");
+    return 1;
+  }
+  n = atoi(argv[globalUtilOptind]);
+  if (!Lsv_NtkIsAndNode(pNtk, n))
+  {
+    Abc_Print(-1, "Object %d is not an AND node of the AIG.\n", n);
+    return 1;
+  }
+  Lsv_NtkODC(pNtk, n, SolverType);
 
   return 0;
 
 usage:
-  Abc_Print(-2, "usage: lsv_odc [-h] <n>\n");
+  Abc_Print(-2, "usage: lsv_odc [-S num] [-h] <n>\n");
   Abc_Print(-2, "\t        list all the minterms of the observability don't cares\n");
-  Abc_Print(-2, "\t-h    : print the command usage\n");
+  Abc_Print(-2, "\t-S num : SAT solver (0=bsat, 1=satoko, 2=glucose2, 3=portfolio) [default = %d]\n", SolverType);
+  Abc_Print(-2, "\t-h     : print the command usage\n");
   return 1;
 }
\ No newline at end of file
@@ -149,6 +149,8 @@ struct If_Par_t_
     int                fHashMapping;  // perform AIG hashing after mapping
     int                fUserLutDec;   // perform Boolean decomposition during mapping
     int                fUserLut2D;    // perform Boolean decomposition during mapping
+    int                nCacheLimit;   // the memory limit of the cut-function cache in MB (0 = no cache)
+    int                fCacheKeep;    // keeps the cut-function cache for the next mapping call
     int                fVerbose;      // the verbosity flag
     int                fVerboseTrace; // the verbosity flag
     char *             pLutStruct;    // LUT structure
@@ -277,6 +279,13 @@ struct If_Man_t_
     int                nBestCutSmall[2];
     int                nCountNonDec[2];
     Vec_Int_t *        vCutData;      // cut data storage
+    Vec_Int_t *        vCacheTable;   // hash table of cut functions (fanin functions, leaf positions, function, remaining leaves)
+    int                pCacheKey[3];  // the key of the last lookup
+    int                nCacheEntries; // the number of cached cut functions
+    int                fCacheFull;    // the cache reached its memory limit
+    int                fCacheReused;  // the cache was inherited from the previous call
+    word               nCutCacheHits;
+    word               nCutCacheMisses;
     int                pArrTimeProfile[IF_MAX_FUNC_LUTSIZE];
     Vec_Ptr_t *        vVisited;
     void *             pUserMan;
@@ -514,6 +523,12 @@ static inline float      If_CutLutDelay( If_LibLut_t * p, int Size, int iPin )
 ///                    FUNCTION DECLARATIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/*=== ifCache.c ==========================================================*/
+extern void            If_ManCacheStart( If_Man_t * p );
+extern void            If_ManCacheStop( If_Man_t * p );
+extern int             If_ManCacheLookup( If_Man_t * p, If_Cut_t * pCut, If_Cut_t * pCut0, If_Cut_t * pCut1, int fCompl0, int fCompl1, int * pfChange );
+extern void            If_ManCacheInsert( If_Man_t * p, If_Cut_t * pCut, int nLeavesOld, int * pLeavesOld );
+extern void            If_ManCacheQuit();
 /*=== ifCore.c ===========================================================*/
 extern void            If_ManSetDefaultPars( If_Par_t * pPars );
 extern int             If_ManPerformMapping( If_Man_t * p );
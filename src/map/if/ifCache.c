@@ -27,6 +27,20 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// cut-function cache kept after the mapping call for the next call
+typedef struct If_CacheKeep_t_ If_CacheKeep_t;
+struct If_CacheKeep_t_
+{
+    int                nLutSize;      // the LUT size
+    int                fCutMin;       // cut minimization
+    int                nEntries;      // the number of cached cut functions
+    Vec_Int_t *        vTable;        // hash table of cached cut functions
+    Vec_Mem_t *        vTtMem[IF_MAX_FUNC_LUTSIZE+1];   // truth tables referred to by the cache
+    Vec_Wec_t *        vTtIsops[IF_MAX_FUNC_LUTSIZE+1]; // ISOPs of the truth tables
+};
+
+static If_CacheKeep_t * s_pIfCacheKeep = NULL;
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -91,6 +105,287 @@ void If_ManCacheAnalize( If_Man_t * p )
     Vec_IntFree( vRes );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Hash table of the cut-function cache.]
+
+  Description [The function of the merged cut is determined by the
+  functions of the two fanin cuts (with complements applied) and by the
+  positions of their leaves among the leaves of the merged cut. The node
+  and the leaf IDs are not part of the key: a node is not a unique function
+  of its leaves when one leaf depends on the others. Each slot holds the
+  two fanin literals, the two position masks, the literal of the result in
+  p->vTtMem, and the mask of the leaves remaining after cut minimization.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define IF_CACHE_SLOT 5
+
+static inline unsigned If_ManCacheHash( int * pKey )
+{
+    unsigned uHash = (unsigned)pKey[0] * 4177 + (unsigned)pKey[1] * 7873 + (unsigned)pKey[2] * 1699;
+    return uHash ^ (uHash >> 15);
+}
+static inline int * If_ManCacheFind( Vec_Int_t * vTable, int * pKey )
+{
+    int * pSlot, Mask = Vec_IntSize(vTable) / IF_CACHE_SLOT - 1;
+    int i = If_ManCacheHash(pKey) & Mask;
+    for ( pSlot = Vec_IntEntryP(vTable, IF_CACHE_SLOT * i); pSlot[0] >= 0; pSlot = Vec_IntEntryP(vTable, IF_CACHE_SLOT * i) )
+    {
+        if ( pSlot[0] == pKey[0] && pSlot[1] == pKey[1] && pSlot[2] == pKey[2] )
+            break;
+        i = (i + 1) & Mask;
+    }
+    return pSlot;
+}
+static void If_ManCacheResize( If_Man_t * p )
+{
+    Vec_Int_t * vTable = Vec_IntStartFull( 2 * Vec_IntSize(p->vCacheTable) );
+    int * pSlot, i;
+    for ( i = 0; i < Vec_IntSize(p->vCacheTable); i += IF_CACHE_SLOT )
+    {
+        pSlot = Vec_IntEntryP( p->vCacheTable, i );
+        if ( pSlot[0] >= 0 )
+            memcpy( If_ManCacheFind(vTable, pSlot), pSlot, sizeof(int) * IF_CACHE_SLOT );
+    }
+    Vec_IntFree( p->vCacheTable );
+    p->vCacheTable = vTable;
+}
+static inline double If_ManCacheMemory( If_Man_t * p, int nTableCopies )
+{
+    double Mem = 4.0 * nTableCopies * Vec_IntSize(p->vCacheTable);
+    int v, nVarMax = Abc_MaxInt(6, p->pPars->nLutSize);
+    // the truth tables are kept together with the table
+    for ( v = 6; v <= nVarMax; v++ )
+    {
+        if ( p->vTtMem[v] )
+            Mem += Vec_MemMemory( p->vTtMem[v] ) + 4.0 * Vec_IntCap( p->vTtMem[v]->vTable ) + 4.0 * Vec_IntCap( p->vTtMem[v]->vNexts );
+        Mem += Vec_WecMemory( p->vTtIsops[v] );
+    }
+    return Mem / (1<<20);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the cut-function cache.]
+
+  Description [Takes over the cache of the previous mapping call if it
+  was kept for the same LUT size. In this case, the truth tables of the
+  manager are replaced by those referred to by the cache.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ManCacheStart( If_Man_t * p )
+{
+    If_CacheKeep_t * pKeep = s_pIfCacheKeep;
+    int v, nVarMax = Abc_MaxInt(6, p->pPars->nLutSize);
+    if ( p->pPars->nCacheLimit <= 0 || !p->pPars->fTruth || p->pPars->fUseTtPerm || p->pPars->fLiftLeaves || p->vCacheTable )
+        return;
+    if ( pKeep && pKeep->nLutSize == p->pPars->nLutSize && pKeep->fCutMin == p->pPars->fCutMin && 
+         (pKeep->vTtIsops[6] != NULL) == (p->vTtIsops[6] != NULL) )
+    {
+        for ( v = 6; v <= nVarMax; v++ )
+        {
+            Vec_MemHashFree( p->vTtMem[v] );
+            Vec_MemFree( p->vTtMem[v] );
+            p->vTtMem[v] = pKeep->vTtMem[v];
+            if ( p->vTtIsops[v] == NULL )
+                continue;
+            Vec_WecFree( p->vTtIsops[v] );
+            p->vTtIsops[v] = pKeep->vTtIsops[v];
+        }
+        for ( v = 0; v < 6; v++ )
+        {
+            p->vTtMem[v]   = p->vTtMem[6];
+            p->vTtIsops[v] = p->vTtIsops[6];
+        }
+        p->vCacheTable   = pKeep->vTable;
+        p->nCacheEntries = pKeep->nEntries;
+        p->fCacheReused  = 1;
+        ABC_FREE( s_pIfCacheKeep );
+        return;
+    }
+    If_ManCacheQuit();
+    p->vCacheTable = Vec_IntStartFull( IF_CACHE_SLOT * (1 << 12) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the cut-function cache.]
+
+  Description [Reports the hit rate. If requested, moves the cache and
+  the truth tables it refers to into the static storage for the next
+  mapping call, unless together they exceed the memory limit.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ManCacheStop( If_Man_t * p )
+{
+    If_CacheKeep_t * pKeep;
+    int v, nVarMax = Abc_MaxInt(6, p->pPars->nLutSize);
+    if ( p->vCacheTable == NULL )
+        return;
+    if ( p->pPars->fVerbose )
+    {
+        word nLookups = p->nCutCacheHits + p->nCutCacheMisses;
+        Abc_Print( 1, "Cut-function cache: Entries = %d. Lookups = %.0f. Hits = %.0f (%.2f %%). Memory = %.2f MB.%s%s\n", 
+            p->nCacheEntries, (double)nLookups, (double)p->nCutCacheHits, 100.0 * p->nCutCacheHits / Abc_MaxDouble(1.0, (double)nLookups), 
+            If_ManCacheMemory(p, 1), p->fCacheReused ? " Reused." : "", p->fCacheFull ? " Full." : "" );
+    }
+    if ( !p->pPars->fCacheKeep || If_ManCacheMemory(p, 1) > (double)p->pPars->nCacheLimit )
+    {
+        Vec_IntFreeP( &p->vCacheTable );
+        return;
+    }
+    If_ManCacheQuit();
+    pKeep = ABC_CALLOC( If_CacheKeep_t, 1 );
+    pKeep->nLutSize = p->pPars->nLutSize;
+    pKeep->fCutMin  = p->pPars->fCutMin;
+    pKeep->nEntries = p->nCacheEntries;
+    pKeep->vTable   = p->vCacheTable;
+    for ( v = 6; v <= nVarMax; v++ )
+    {
+        pKeep->vTtMem[v]   = p->vTtMem[v];
+        pKeep->vTtIsops[v] = p->vTtIsops[v];
+    }
+    for ( v = 0; v <= nVarMax; v++ )
+        p->vTtMem[v] = NULL, p->vTtIsops[v] = NULL;
+    p->vCacheTable = NULL;
+    s_pIfCacheKeep = pKeep;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Frees the cut-function cache kept for the next call.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ManCacheQuit()
+{
+    If_CacheKeep_t * pKeep = s_pIfCacheKeep;
+    int v;
+    if ( pKeep == NULL )
+        return;
+    for ( v = 6; v <= IF_MAX_FUNC_LUTSIZE; v++ )
+    {
+        if ( pKeep->vTtMem[v] )
+        {
+            Vec_MemHashFree( pKeep->vTtMem[v] );
+            Vec_MemFree( pKeep->vTtMem[v] );
+        }
+        Vec_WecFreeP( &pKeep->vTtIsops[v] );
+    }
+    Vec_IntFreeP( &pKeep->vTable );
+    ABC_FREE( s_pIfCacheKeep );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Looks up the function of the merged cut.]
+
+  Description [If found, sets the function of the cut and removes the
+  leaves dropped by cut minimization. Otherwise, remembers the key for 
+  If_ManCacheInsert().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManCacheLookup( If_Man_t * p, If_Cut_t * pCut, If_Cut_t * pCut0, If_Cut_t * pCut1, int fCompl0, int fCompl1, int * pfChange )
+{
+    int * pKey = p->pCacheKey, * pSlot;
+    int i, k0, k1, nLeaves = pCut->nLeaves;
+    unsigned uMask0 = 0, uMask1 = 0, uMask;
+    for ( i = k0 = k1 = 0; i < nLeaves; i++ )
+    {
+        if ( k0 < (int)pCut0->nLeaves && pCut0->pLeaves[k0] == pCut->pLeaves[i] )
+            uMask0 |= (1 << i), k0++;
+        if ( k1 < (int)pCut1->nLeaves && pCut1->pLeaves[k1] == pCut->pLeaves[i] )
+            uMask1 |= (1 << i), k1++;
+    }
+    assert( k0 == (int)pCut0->nLeaves && k1 == (int)pCut1->nLeaves );
+    pKey[0] = Abc_LitNotCond( pCut0->iCutFunc, fCompl0 ^ pCut0->fCompl );
+    pKey[1] = Abc_LitNotCond( pCut1->iCutFunc, fCompl1 ^ pCut1->fCompl );
+    pKey[2] = (int)(uMask0 | (uMask1 << 16));
+    pSlot = If_ManCacheFind( p->vCacheTable, pKey );
+    if ( pSlot[0] < 0 )
+    {
+        p->nCutCacheMisses++;
+        return 0;
+    }
+    p->nCutCacheHits++;
+    pCut->iCutFunc = pSlot[3];
+    uMask = (unsigned)pSlot[4];
+    for ( i = k0 = 0; i < nLeaves; i++ )
+        if ( (uMask >> i) & 1 )
+            pCut->pLeaves[k0++] = pCut->pLeaves[i];
+    *pfChange = (k0 < nLeaves);
+    if ( *pfChange )
+    {
+        pCut->nLeaves = k0;
+        pCut->uSign   = If_ObjCutSignCompute( pCut );
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the function of the cut after a failed lookup.]
+
+  Description [The leaves of the cut are the leaves of the merged cut,
+  possibly reduced by cut minimization. Stops adding entries when the 
+  table and the truth tables would exceed the memory limit.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ManCacheInsert( If_Man_t * p, If_Cut_t * pCut, int nLeavesOld, int * pLeavesOld )
+{
+    int * pKey = p->pCacheKey, * pSlot;
+    int i, k, nSlots = Vec_IntSize(p->vCacheTable) / IF_CACHE_SLOT;
+    unsigned uMask = 0;
+    if ( p->fCacheFull )
+        return;
+    if ( 2 * (p->nCacheEntries + 1) > nSlots )
+    {
+        if ( If_ManCacheMemory(p, 2) > (double)p->pPars->nCacheLimit )
+        {
+            p->fCacheFull = 1;
+            return;
+        }
+        If_ManCacheResize( p );
+    }
+    for ( i = k = 0; i < nLeavesOld; i++ )
+        if ( k < (int)pCut->nLeaves && pLeavesOld[i] == pCut->pLeaves[k] )
+            uMask |= (1 << i), k++;
+    assert( k == (int)pCut->nLeaves );
+    pSlot = If_ManCacheFind( p->vCacheTable, pKey );
+    assert( pSlot[0] < 0 );
+    pSlot[0] = pKey[0];
+    pSlot[1] = pKey[1];
+    pSlot[2] = pKey[2];
+    pSlot[3] = pCut->iCutFunc;
+    pSlot[4] = (int)uMask;
+    p->nCacheEntries++;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
@@ -64,6 +64,8 @@ void If_ManSetDefaultPars( If_Par_t * pPars )
     pPars->fBidec      =  0;
     pPars->fUserLutDec =  0;
     pPars->fUserLut2D  =  0;
+    pPars->nCacheLimit =  0;
+    pPars->fCacheKeep  =  1;
     pPars->fVerbose    =  0;
 }
 
@@ -88,6 +90,8 @@ int If_ManPerformMapping( If_Man_t * p )
     If_ManSetupSetAll( p, If_ManCrossCut(p) );
     // derive reverse top order
     p->vObjsRev = If_ManReverseOrder( p );
+    // start the cut-function cache
+    If_ManCacheStart( p );
     return If_ManPerformMappingComb( p );
 }
 
@@ -1613,7 +1613,7 @@ int If_DsdManOperation( If_DsdMan_t * p, int Type, int * pLits, int nLits, unsig
     {
         char pCanonPerm[DAU_MAX_VAR];
         int i, uCanonPhase, pFirsts[DAU_MAX_VAR];
-        uCanonPhase = Abc_TtCanonicize( pTruth, nLits, pCanonPerm );
+        uCanonPhase = Abc_TtCanonicizeCache( pTruth, nLits, pCanonPerm );
         fCompl = ((uCanonPhase >> nLits) & 1);
         nSSize = If_DsdManComputeFirstArray( p, pLits, nLits, pFirsts );
         for ( j = i = 0; i < nLits; i++ )
@@ -232,6 +232,7 @@ void If_ManStop( If_Man_t * p )
             Abc_PrintTime( 1, "DSD misses", p->timeCache[2] );
             Abc_PrintTime( 1, "TOTAL     ", p->timeCache[0] + p->timeCache[1] + p->timeCache[2] );
             Abc_PrintTime( 1, "Canon     ", p->timeCache[3] );
+            Abc_TtCachePrintStats();
         }
     }
     if ( p->pPars->fVerbose && p->nCutsUselessAll )
@@ -243,6 +244,7 @@ void If_ManStop( If_Man_t * p )
     }
 //    if ( p->pPars->fVerbose && p->nCuts5 )
 //        Abc_Print( 1, "Statistics about 5-cuts: Total = %d  Non-decomposable = %d (%.2f %%)\n", p->nCuts5, p->nCuts5-p->nCuts5a, 100.0*(p->nCuts5-p->nCuts5a)/p->nCuts5 );
+    If_ManCacheStop( p );
     if ( p->pIfDsdMan )
         p->pIfDsdMan = NULL;
     if ( p->pPars->fUseDsd && (p->nCountNonDec[0] || p->nCountNonDec[1]) )
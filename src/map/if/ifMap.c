@@ -292,8 +292,15 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
                 clk = Abc_Clock();
             if ( p->pPars->fUseTtPerm )
                 fChange = If_CutComputeTruthPerm( p, pCut, pCut0R, pCut1R, fFunc0R, fFunc1R );
-            else
+            else if ( p->vCacheTable == NULL )
+                fChange = If_CutComputeTruth( p, pCut, pCut0, pCut1, pObj->fCompl0, pObj->fCompl1 );
+            else if ( !If_ManCacheLookup( p, pCut, pCut0, pCut1, pObj->fCompl0, pObj->fCompl1, &fChange ) )
+            {
+                int pLeavesOld[IF_MAX_FUNC_LUTSIZE], nLeavesOld = pCut->nLeaves;
+                memcpy( pLeavesOld, pCut->pLeaves, sizeof(int) * nLeavesOld );
                 fChange = If_CutComputeTruth( p, pCut, pCut0, pCut1, pObj->fCompl0, pObj->fCompl1 );
+                If_ManCacheInsert( p, pCut, nLeavesOld, pLeavesOld );
+            }
             if ( p->pPars->fVerbose )
                 p->timeCache[4] += Abc_Clock() - clk;
             if ( !p->pPars->fSkipCutFilter && fChange && If_CutFilter( pCutSet, pCut, fSave0 ) )
@@ -227,7 +227,7 @@ if ( fVerbose )
     // compute canonical form
 if ( p->pPars->fVerbose )
 clk = Abc_Clock();
-    p->uCanonPhase = Abc_TtCanonicize( pTruth, pCut->nLeaves, p->pCanonPerm );
+    p->uCanonPhase = Abc_TtCanonicizeCache( pTruth, pCut->nLeaves, p->pCanonPerm );
 if ( p->pPars->fVerbose )
 p->timeCache[3] += Abc_Clock() - clk;
     for ( v = 0; v < (int)pCut->nLeaves; v++ )
@@ -468,17 +468,26 @@ void Abc_SclBufSize( Bus_Man_t * p, float Gain )
     }
     // compute departure time of the PI
     if ( i < 0 ) // finished buffering
-    Abc_NtkForEachCi( p->pNtk, pObj, i )
     {
-        float DeptCur = Abc_NtkComputeNodeDeparture(pObj, p->pPars->Slew);
+        int nCis = Abc_NtkCiNum(p->pNtk);
+        SC_Pair * pLoads = ABC_ALLOC( SC_Pair, nCis );
+        SC_Pair * pArrs  = ABC_ALLOC( SC_Pair, nCis );
+        SC_Pair * pSlews = ABC_ALLOC( SC_Pair, nCis );
+        Abc_NtkForEachCi( p->pNtk, pObj, i )
+            pLoads[i].rise = pLoads[i].fall = Bus_SclObjLoad( pObj );
+        // the input driver delays of all PIs are computed in one batch
         if ( p->pPiDrive )
+            Scl_LibHandleInputDriverBatch( p->pPiDrive, pLoads, pArrs, pSlews, nCis );
+        Abc_NtkForEachCi( p->pNtk, pObj, i )
         {
-            float Load = Bus_SclObjLoad( pObj );
-            SC_Pair ArrOut, SlewOut, LoadIn = { Load, Load }; 
-            Scl_LibHandleInputDriver( p->pPiDrive, &LoadIn, &ArrOut, &SlewOut );
-            DeptCur += 0.5 * ArrOut.fall +  0.5 * ArrOut.rise;
-        }       
-        DeptMax = Abc_MaxFloat( DeptMax, DeptCur );
+            float DeptCur = Abc_NtkComputeNodeDeparture(pObj, p->pPars->Slew);
+            if ( p->pPiDrive )
+                DeptCur += 0.5 * pArrs[i].fall +  0.5 * pArrs[i].rise;
+            DeptMax = Abc_MaxFloat( DeptMax, DeptCur );
+        }
+        ABC_FREE( pLoads );
+        ABC_FREE( pArrs );
+        ABC_FREE( pSlews );
     }
     if ( p->pPars->fVerbose )
     {
@@ -260,9 +260,11 @@ void Abc_SclDnsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
     }
 
     // prepare the manager; collect init stats
-    p = Abc_SclManStart( pLib, pNtk, pPars->fUseWireLoads, pPars->fUseDept, pPars->DelayUser, pPars->BuffTreeEst );
+    p = Abc_SclManStart( pLib, pNtk, pPars->fUseWireLoads, pPars->fUseDept, pPars->DelayUser, pPars->BuffTreeEst, 1 );
     p->pFuncFanin = (float (*)(void *, Abc_Obj_t *, Abc_Obj_t *, int, int))pFuncFanin;
     p->timeTotal  = Abc_Clock();
+    if ( pPars->IncEps > 0 )
+        p->IncEps = pPars->IncEps;
     assert( p->vGatesBest == NULL );
     p->vGatesBest = Vec_IntDup( p->pNtk->vGates );
 
@@ -297,9 +299,7 @@ void Abc_SclDnsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
 
             clk = Abc_Clock();
             if ( Vec_IntSize(p->vChanged) )
-                Abc_SclTimeIncUpdate( p );
-            else
-                Abc_SclTimeNtkRecompute( p, &p->SumArea, &p->MaxDelay, pPars->fUseDept, pPars->DelayUser );
+                Abc_SclTimeIncUpdate( p, pPars->fUseDept );
             p->timeTime += Abc_Clock() - clk;
 
             p->MaxDelay = Abc_SclReadMaxDelay( p );
@@ -92,6 +92,7 @@ struct SC_SizePars_
     int        TimeOut;
     int        BuffTreeEst;      // ratio for buffer tree estimation
     int        BypassFreq;       // frequency to try bypassing
+    float      IncEps;           // the smallest timing change propagated by incremental update
     int        fUseDept;
     int        fDumpStats;
     int        fUseWireLoads;
@@ -172,6 +173,8 @@ struct SC_Timing_
     SC_Surface     pCellFall;
     SC_Surface     pRiseTrans;     // -- Used to compute output slew
     SC_Surface     pFallTrans;
+    char *         pLazy;          // -- encoded tables in the mapped .scl file (decoded on first use)
+    float          LazyScale[2];   // -- time/load scaling to apply after decoding
 };
 
 struct SC_Timings_ 
@@ -237,6 +240,8 @@ struct SC_Lib_
     Vec_Ptr_t      vCellClasses;   // NamedSet<SC_Cell>
     int *          pBins;          // hashing gateName -> gateId
     int            nBins;
+    void *         pMapped;        // the mapped .scl file holding the undecoded tables
+    size_t         nMapped;
 };
 
 ////////////////////////////////////////////////////////////////////////
@@ -468,6 +473,7 @@ static inline void Abc_SclLibFree( SC_Lib * p )
     ABC_FREE( p->default_wire_load );
     ABC_FREE( p->default_wire_load_sel );
     ABC_FREE( p->pBins );
+    Abc_FileUnmap( p->pMapped, p->nMapped );
     ABC_FREE( p );
 }
 
@@ -658,8 +664,10 @@ static inline void Scl_LibPinRequiredI( SC_Timing * pTime, SC_PairI * pReqIn, SC
 ***********************************************************************/
 static inline SC_Timing * Scl_CellPinTime( SC_Cell * pCell, int iPin )
 {
+    extern void Abc_SclTimingDecode( SC_Timing * p );
     SC_Pin * pPin;
     SC_Timings * pRTime;
+    SC_Timing * pTime;
     assert( iPin >= 0 && iPin < pCell->n_inputs );
     pPin = SC_CellPin( pCell, pCell->n_inputs );
     assert( Vec_PtrSize(&pPin->vRTimings) == pCell->n_inputs );
@@ -667,7 +675,10 @@ static inline SC_Timing * Scl_CellPinTime( SC_Cell * pCell, int iPin )
     if ( Vec_PtrSize(&pRTime->vTimings) == 0 )
         return NULL;
     assert( Vec_PtrSize(&pRTime->vTimings) == 1 );
-    return (SC_Timing *)Vec_PtrEntry( &pRTime->vTimings, 0 );
+    pTime = (SC_Timing *)Vec_PtrEntry( &pRTime->vTimings, 0 );
+    if ( pTime->pLazy )
+        Abc_SclTimingDecode( pTime );
+    return pTime;
 }
 static inline float Scl_LibPinArrivalEstimate( SC_Cell * pCell, int iPin, float Slew, float Load )
 {
@@ -746,6 +757,8 @@ extern SC_Lib *      Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVe
 extern SC_Lib *      Abc_SclReadFromGenlib( void * pLib );
 extern SC_Lib *      Abc_SclReadFromStr( Vec_Str_t * vOut );
 extern SC_Lib *      Abc_SclReadFromFile( char * pFileName );
+extern void          Abc_SclTimingDecode( SC_Timing * p );
+extern void          Abc_SclLibDecode( SC_Lib * p );
 extern void          Abc_SclWriteScl( char * pFileName, SC_Lib * p );
 extern void          Abc_SclWriteLiberty( char * pFileName, SC_Lib * p );
 extern SC_Lib *      Abc_SclMergeLibraries( SC_Lib * pLib1, SC_Lib * pLib2, int fUsePrefix );
@@ -759,6 +772,9 @@ extern void          Abc_SclLinkCells( SC_Lib * p );
 extern void          Abc_SclPrintCells( SC_Lib * p, float Slew, float Gain, int fInvOnly, int fShort );
 extern void          Abc_SclConvertLeakageIntoArea( SC_Lib * p, float A, float B );
 extern void          Abc_SclLibNormalize( SC_Lib * p );
+extern void          Scl_LibLookupBatch( SC_Surface * p, float * pSlews, float * pLoads, float * pRes, int nPairs );
+extern void          Scl_LibHandleInputDriverBatch( SC_Cell * pCell, SC_Pair * pLoads, SC_Pair * pArrs, SC_Pair * pSlews, int nPairs );
+extern void          Abc_SclLibLookupBench( SC_Lib * p, int nPairs );
 extern SC_Cell *     Abc_SclFindInvertor( SC_Lib * p, int fFindBuff );
 extern SC_Cell *     Abc_SclFindSmallestGate( SC_Cell * p, float CinMin );
 extern SC_WireLoad * Abc_SclFindWireLoadModel( SC_Lib * p, float Area );
@@ -231,7 +231,24 @@ static void Abc_SclReadSurface( Vec_Str_t * vOut, int * pPos, SC_Surface * p )
     for ( i = 0; i < 6; i++ ) 
         p->approx[2][i] = Vec_StrGetF( vOut, pPos );
 }
-static int Abc_SclReadLibrary( Vec_Str_t * vOut, int * pPos, SC_Lib * p )
+static int Abc_SclSkipSurface( Vec_Str_t * vOut, int * pPos )
+{
+    ABC_INT64_T nBytes;
+    int nIndex0, nIndex1;
+    if ( *pPos >= Vec_StrSize(vOut) )
+        return 0;
+    nIndex0 = Vec_StrGetI( vOut, pPos );
+    if ( nIndex0 < 0 || 4 * (ABC_INT64_T)nIndex0 >= Vec_StrSize(vOut) - *pPos )
+        return 0;
+    *pPos  += 4 * nIndex0;
+    nIndex1 = Vec_StrGetI( vOut, pPos );
+    nBytes  = 4 * ((ABC_INT64_T)nIndex1 + (ABC_INT64_T)nIndex0 * nIndex1 + 3 + 4 + 6);
+    if ( nIndex1 < 0 || nBytes > Vec_StrSize(vOut) - *pPos )
+        return 0;
+    *pPos  += (int)nBytes;
+    return 1;
+}
+static int Abc_SclReadLibrary( Vec_Str_t * vOut, int * pPos, SC_Lib * p, int fLazy )
 {
     int i, j, k, n;
     int version = Vec_StrGetI( vOut, pPos );
@@ -388,6 +405,19 @@ static int Abc_SclReadLibrary( Vec_Str_t * vOut, int * pPos, SC_Lib * p )
                     Vec_PtrPush( &pRTime->vTimings, pTime );
 
                     pTime->tsense = (SC_TSense)Vec_StrGetI(vOut, pPos);
+                    if ( fLazy )
+                    {
+                        // remember where the tables are and skip them
+                        pTime->pLazy = Vec_StrEntryP( vOut, *pPos );
+                        pTime->LazyScale[0] = pTime->LazyScale[1] = 1;
+                        for ( n = 0; n < 4; n++ )
+                            if ( !Abc_SclSkipSurface( vOut, pPos ) )
+                            {
+                                Abc_Print( -1, "The timing tables of cell \"%s\" do not fit into the SCL file.\n", pCell->pName );
+                                return 0;
+                            }
+                        continue;
+                    }
                     Abc_SclReadSurface( vOut, pPos, &pTime->pCellRise );
                     Abc_SclReadSurface( vOut, pPos, &pTime->pCellFall );
                     Abc_SclReadSurface( vOut, pPos, &pTime->pRiseTrans );
@@ -406,7 +436,7 @@ SC_Lib * Abc_SclReadFromStr( Vec_Str_t * vOut )
     int Pos = 0;
     // read the library
     p = Abc_SclLibAlloc();
-    if ( !Abc_SclReadLibrary( vOut, &Pos, p ) )
+    if ( !Abc_SclReadLibrary( vOut, &Pos, p, 0 ) )
         return NULL;
     assert( Pos == Vec_StrSize(vOut) );
     // hash gates by name
@@ -417,36 +447,93 @@ SC_Lib * Abc_SclReadFromStr( Vec_Str_t * vOut )
 SC_Lib * Abc_SclReadFromFile( char * pFileName )
 {
     SC_Lib * p;
-    FILE * pFile;
-    Vec_Str_t * vOut;
-    int nFileSize;
-    pFile = fopen( pFileName, "rb" );
-    if ( pFile == NULL )
+    Vec_Str_t vOut;
+    size_t nFileSize;
+    int Pos = 0;
+    void * pData = Abc_FileMap( pFileName, &nFileSize );
+    if ( pData == NULL )
     {
         printf( "Cannot open file \"%s\" for reading.\n", pFileName );
         return NULL;
     }
-    // get the file size, in bytes
-    fseek( pFile, 0, SEEK_END );  
-    nFileSize = ftell( pFile );  
-    rewind( pFile ); 
-    // load the contents
-    vOut = Vec_StrAlloc( nFileSize );
-    vOut->nSize = vOut->nCap;
-    assert( nFileSize == Vec_StrSize(vOut) );
-    nFileSize = fread( Vec_StrArray(vOut), 1, Vec_StrSize(vOut), pFile );
-    assert( nFileSize == Vec_StrSize(vOut) );
-    fclose( pFile );
-    // read the library
-    p = Abc_SclReadFromStr( vOut );
-    if ( p != NULL )
-        p->pFileName = Abc_UtilStrsav( pFileName );
-    if ( p != NULL )
-        Abc_SclLibNormalize( p );
-    Vec_StrFree( vOut );
+    if ( nFileSize > (size_t)0x7FFFFFFF )
+    {
+        printf( "The file \"%s\" is too large.\n", pFileName );
+        Abc_FileUnmap( pData, nFileSize );
+        return NULL;
+    }
+    // read the library without the timing tables, which stay in the mapped file
+    vOut.nCap = vOut.nSize = (int)nFileSize;
+    vOut.pArray = (char *)pData;
+    p = Abc_SclLibAlloc();
+    p->pMapped = pData;
+    p->nMapped = nFileSize;
+    if ( !Abc_SclReadLibrary( &vOut, &Pos, p, 1 ) )
+    {
+        Abc_SclLibFree( p );
+        return NULL;
+    }
+    assert( Pos == Vec_StrSize(&vOut) );
+    // hash gates by name
+    Abc_SclHashCells( p );
+    Abc_SclLinkCells( p );
+    p->pFileName = Abc_UtilStrsav( pFileName );
+    Abc_SclLibNormalize( p );
     return p;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Decodes the timing tables kept in the mapped file.]
+
+  Description [The tables of a library read by Abc_SclReadFromFile() are
+  decoded on first use by Scl_CellPinTime(). Decoding is not thread-safe,
+  so the library should be decoded by Abc_SclLibDecode() before it is
+  shared by several threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclTimingDecode( SC_Timing * p )
+{
+    extern void Abc_SclLibNormalizeSurface( SC_Surface * p, float Time, float Load );
+    Vec_Str_t vOut;
+    int Pos = 0;
+    if ( p->pLazy == NULL )
+        return;
+    // the tables were checked to fit into the file when skipped
+    vOut.nCap = vOut.nSize = ABC_INFINITY;
+    vOut.pArray = p->pLazy;
+    Abc_SclReadSurface( &vOut, &Pos, &p->pCellRise );
+    Abc_SclReadSurface( &vOut, &Pos, &p->pCellFall );
+    Abc_SclReadSurface( &vOut, &Pos, &p->pRiseTrans );
+    Abc_SclReadSurface( &vOut, &Pos, &p->pFallTrans );
+    p->pLazy = NULL;
+    if ( p->LazyScale[0] == 1 && p->LazyScale[1] == 1 )
+        return;
+    Abc_SclLibNormalizeSurface( &p->pCellRise,  p->LazyScale[0], p->LazyScale[1] );
+    Abc_SclLibNormalizeSurface( &p->pCellFall,  p->LazyScale[0], p->LazyScale[1] );
+    Abc_SclLibNormalizeSurface( &p->pRiseTrans, p->LazyScale[0], p->LazyScale[1] );
+    Abc_SclLibNormalizeSurface( &p->pFallTrans, p->LazyScale[0], p->LazyScale[1] );
+}
+void Abc_SclLibDecode( SC_Lib * p )
+{
+    SC_Cell * pCell;
+    SC_Pin * pPin;
+    SC_Timings * pRTime;
+    SC_Timing * pTime;
+    int i, k, m, n;
+    if ( p->pMapped == NULL )
+        return;
+    SC_LibForEachCell( p, pCell, i )
+    SC_CellForEachPinOut( pCell, pPin, k )
+    SC_PinForEachRTiming( pPin, pRTime, m )
+    Vec_PtrForEachEntry( SC_Timing *, &pRTime->vTimings, pTime, n )
+        Abc_SclTimingDecode( pTime );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Writing library into file.]
@@ -547,6 +634,7 @@ static void Abc_SclWriteLibraryCellsOnly( Vec_Str_t * vOut, SC_Lib * p, int fAdd
                 if ( Vec_PtrSize(&pRTime->vTimings) == 1 )
                 {
                     SC_Timing * pTime = (SC_Timing *)Vec_PtrEntry( &pRTime->vTimings, 0 );
+                    Abc_SclTimingDecode( pTime );
                         // -- NOTE! We don't need to save 'related_pin' string because we have sorted 
                         // the elements on input pins.
                     Vec_StrPutI( vOut, (int)pTime->tsense);
@@ -806,6 +894,7 @@ static void Abc_SclWriteLibraryText( FILE * s, SC_Lib * p )
                 if ( Vec_PtrSize(&pRTime->vTimings) == 1 )
                 {
                     SC_Timing * pTime = (SC_Timing *)Vec_PtrEntry( &pRTime->vTimings, 0 );
+                    Abc_SclTimingDecode( pTime );
                     fprintf( s, "      timing() {\n" );
                     fprintf( s, "        related_pin : \"%s\"\n", pRTime->pName );
                     if ( pTime->tsense == sc_ts_Pos )
@@ -776,6 +776,12 @@ void Abc_SclLibNormalize( SC_Lib * p )
         SC_PinForEachRTiming( pPin, pTimings, m )
         Vec_PtrForEachEntry( SC_Timing *, &pTimings->vTimings, pTiming, n )
         {
+            if ( pTiming->pLazy ) // scaled when decoded
+            {
+                pTiming->LazyScale[0] *= Time;
+                pTiming->LazyScale[1] *= Load;
+                continue;
+            }
             Abc_SclLibNormalizeSurface( &pTiming->pCellRise, Time, Load );
             Abc_SclLibNormalizeSurface( &pTiming->pCellFall, Time, Load );
             Abc_SclLibNormalizeSurface( &pTiming->pRiseTrans, Time, Load );
@@ -1071,6 +1077,221 @@ void Abc_SclInstallGenlib( void * pScl, float SlewInit, float Gain, int nGatesMi
 //        printf( "Derived unit-delay GENLIB library \"%s\" with %d gates.\n", p->pName, nGateCount );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Batched lookup table delay computation.]
+
+  Description [Evaluates nPairs points (pSlews[i], pLoads[i]) against the
+  same table and writes the values into pRes. The points are processed in
+  chunks of SC_LOOKUP_BATCH. The sample points are located by counting the
+  indexes not exceeding the value, and the interpolation is done over the
+  chunk arrays without branches, so that both loops can be vectorized by
+  the compiler. The values are the same as those of Scl_LibLookup().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define SC_LOOKUP_BATCH 64
+
+void Scl_LibLookupBatch( SC_Surface * p, float * pSlews, float * pLoads, float * pRes, int nPairs )
+{
+    float Slew[SC_LOOKUP_BATCH], Load[SC_LOOKUP_BATCH], Res[SC_LOOKUP_BATCH];
+    float S0[SC_LOOKUP_BATCH], S1[SC_LOOKUP_BATCH], L0[SC_LOOKUP_BATCH], L1[SC_LOOKUP_BATCH];
+    float D00[SC_LOOKUP_BATCH], D01[SC_LOOKUP_BATCH], D10[SC_LOOKUP_BATCH], D11[SC_LOOKUP_BATCH];
+    int s[SC_LOOKUP_BATCH], l[SC_LOOKUP_BATCH];
+    float * pIndex0 = Vec_FltArray(&p->vIndex0);
+    float * pIndex1 = Vec_FltArray(&p->vIndex1);
+    int nIndex0 = Vec_FltSize(&p->vIndex0);
+    int nIndex1 = Vec_FltSize(&p->vIndex1);
+    int b, i, j, n, nLanes;
+
+    // handle constant table
+    if ( nIndex0 == 1 && nIndex1 == 1 )
+    {
+        Vec_Flt_t * vTemp = (Vec_Flt_t *)Vec_PtrEntry(&p->vData, 0);
+        assert( Vec_PtrSize(&p->vData) == 1 );
+        assert( Vec_FltSize(vTemp) == 1 );
+        for ( i = 0; i < nPairs; i++ )
+            pRes[i] = Vec_FltEntry(vTemp, 0);
+        return;
+    }
+
+    for ( b = 0; b < nPairs; b += SC_LOOKUP_BATCH )
+    {
+        // the last chunk is padded to a multiple of 8 with copies of the first point
+        n = Abc_MinInt( SC_LOOKUP_BATCH, nPairs - b );
+        nLanes = (n + 7) & ~7;
+        for ( i = 0; i < nLanes; i++ )
+        {
+            Slew[i] = pSlews[b + (i < n ? i : 0)];
+            Load[i] = pLoads[b + (i < n ? i : 0)];
+            s[i] = l[i] = 0;
+        }
+
+        // find closest sample points in surface (the same as the linear search in Scl_LibLookup)
+        for ( j = 1; j < nIndex0-1; j++ )
+            for ( i = 0; i < nLanes; i++ )
+                s[i] += !(pIndex0[j] > Slew[i]);
+        for ( j = 1; j < nIndex1-1; j++ )
+            for ( i = 0; i < nLanes; i++ )
+                l[i] += !(pIndex1[j] > Load[i]);
+
+        // collect the sample points and the table values around them
+        for ( i = 0; i < nLanes; i++ )
+        {
+            float * pDataS  = Vec_FltArray( (Vec_Flt_t *)Vec_PtrEntry(&p->vData, s[i]) );
+            float * pDataS1 = Vec_FltArray( (Vec_Flt_t *)Vec_PtrEntry(&p->vData, s[i]+1) );
+            S0[i]  = pIndex0[s[i]];
+            S1[i]  = pIndex0[s[i]+1];
+            L0[i]  = pIndex1[l[i]];
+            L1[i]  = pIndex1[l[i]+1];
+            D00[i] = pDataS [l[i]];
+            D01[i] = pDataS [l[i]+1];
+            D10[i] = pDataS1[l[i]];
+            D11[i] = pDataS1[l[i]+1];
+        }
+
+        // interpolate (or extrapolate) function values from sample points
+        for ( i = 0; i < nLanes; i++ )
+        {
+            float sfrac = (Slew[i] - S0[i]) / (S1[i] - S0[i]);
+            float lfrac = (Load[i] - L0[i]) / (L1[i] - L0[i]);
+            float p0 = D00[i] + lfrac * (D01[i] - D00[i]);
+            float p1 = D10[i] + lfrac * (D11[i] - D10[i]);
+            Res[i] = p0 + sfrac * (p1 - p0);
+        }
+        memcpy( pRes + b, Res, sizeof(float) * n );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Batched computation of the input driver delays.]
+
+  Description [Performs Scl_LibHandleInputDriver() for nPairs loads 
+  driven by the same cell.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Scl_LibHandleInputDriverBatch( SC_Cell * pCell, SC_Pair * pLoads, SC_Pair * pArrs, SC_Pair * pSlews, int nPairs )
+{
+    SC_Timing * pTime = Scl_CellPinTime( pCell, 0 );
+    SC_Pair LoadIn   = { 0.0, 0.0 }; // zero input load
+    SC_Pair ArrIn    = { 0.0, 0.0 }; // zero input time
+    SC_Pair SlewIn   = { 0.0, 0.0 }; // zero input slew
+    SC_Pair ArrOut0  = { 0.0, 0.0 }; // output time under zero load
+    SC_Pair SlewOut  = { 0.0, 0.0 }; // output slew under zero load 
+    float * pSlew = ABC_CALLOC( float, nPairs );
+    float * pLoad = ABC_ALLOC( float, nPairs );
+    float * pRes  = ABC_ALLOC( float, 4 * nPairs );
+    int i, fDefined = pTime->tsense == sc_ts_Pos || pTime->tsense == sc_ts_Neg || pTime->tsense == sc_ts_Non;
+    assert( pCell->n_inputs == 1 );
+    Scl_LibPinArrival( pTime, &ArrIn, &SlewIn, &LoadIn, &ArrOut0, &SlewOut );
+    // the input slew is zero, so the unateness of the arc does not matter
+    for ( i = 0; i < nPairs; i++ )
+        pLoad[i] = pLoads[i].rise;
+    Scl_LibLookupBatch( &pTime->pCellRise,  pSlew, pLoad, pRes,            nPairs );
+    Scl_LibLookupBatch( &pTime->pRiseTrans, pSlew, pLoad, pRes +   nPairs, nPairs );
+    for ( i = 0; i < nPairs; i++ )
+        pLoad[i] = pLoads[i].fall;
+    Scl_LibLookupBatch( &pTime->pCellFall,  pSlew, pLoad, pRes + 2*nPairs, nPairs );
+    Scl_LibLookupBatch( &pTime->pFallTrans, pSlew, pLoad, pRes + 3*nPairs, nPairs );
+    for ( i = 0; i < nPairs; i++ )
+    {
+        pArrs[i].rise  = (fDefined ? Abc_MaxFloat(0, pRes[i]) : 0) - ArrOut0.rise;
+        pSlews[i].rise =  fDefined ? Abc_MaxFloat(0, pRes[nPairs + i]) : 0;
+        pArrs[i].fall  = (fDefined ? Abc_MaxFloat(0, pRes[2*nPairs + i]) : 0) - ArrOut0.fall;
+        pSlews[i].fall =  fDefined ? Abc_MaxFloat(0, pRes[3*nPairs + i]) : 0;
+    }
+    ABC_FREE( pSlew );
+    ABC_FREE( pLoad );
+    ABC_FREE( pRes );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Compares the speed of scalar and batched table lookups.]
+
+  Description [For each timing arc of the library, evaluates nPairs random
+  points inside the ranges of its tables (extended by 20%), first with 
+  Scl_LibLookup() and then with Scl_LibLookupBatch(), and reports arcs per
+  second. Evaluating one arc includes the lookups of its rise/fall delay 
+  and transition tables.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclLibLookupBench( SC_Lib * p, int nPairs )
+{
+    Vec_Ptr_t * vArcs = Vec_PtrAlloc( 1000 );
+    SC_Timing * pTime;
+    SC_Cell * pCell;
+    float * pSlews = ABC_ALLOC( float, nPairs );
+    float * pLoads = ABC_ALLOC( float, nPairs );
+    float * pRes0  = ABC_ALLOC( float, nPairs );
+    float * pRes1  = ABC_ALLOC( float, nPairs );
+    abctime clk, clkScalar = 0, clkBatch = 0;
+    int i, k, f, nRounds, nMisses = 0;
+    double nArcs;
+    SC_LibForEachCell( p, pCell, i )
+        if ( pCell->n_outputs == 1 )
+            for ( k = 0; k < pCell->n_inputs; k++ )
+                if ( (pTime = Scl_CellPinTime(pCell, k)) )
+                    Vec_PtrPush( vArcs, pTime );
+    if ( Vec_PtrSize(vArcs) == 0 )
+    {
+        printf( "The library has no timing arcs.\n" );
+        Vec_PtrFree( vArcs );
+        ABC_FREE( pSlews ); ABC_FREE( pLoads ); ABC_FREE( pRes0 ); ABC_FREE( pRes1 );
+        return;
+    }
+    // repeat to get about 10M arc evaluations in each mode
+    nRounds = Abc_MaxInt( 1, 10000000 / (Vec_PtrSize(vArcs) * nPairs) );
+    Abc_Random( 1 );
+    for ( f = 0; f < nRounds; f++ )
+    Vec_PtrForEachEntry( SC_Timing *, vArcs, pTime, i )
+    {
+        SC_Surface * pSurfs[4] = { &pTime->pCellRise, &pTime->pCellFall, &pTime->pRiseTrans, &pTime->pFallTrans };
+        float SlewMax = Vec_FltEntryLast(&pTime->pCellRise.vIndex0);
+        float LoadMax = Vec_FltEntryLast(&pTime->pCellRise.vIndex1);
+        for ( k = 0; k < nPairs; k++ )
+        {
+            pSlews[k] = 1.2 * SlewMax * (Abc_Random(0) & 0xFFFF) / 0xFFFF;
+            pLoads[k] = 1.2 * LoadMax * (Abc_Random(0) & 0xFFFF) / 0xFFFF;
+        }
+        for ( k = 0; k < 4; k++ )
+        {
+            int j;
+            clk = Abc_Clock();
+            for ( j = 0; j < nPairs; j++ )
+                pRes0[j] = Scl_LibLookup( pSurfs[k], pSlews[j], pLoads[j] );
+            clkScalar += Abc_Clock() - clk;
+            clk = Abc_Clock();
+            Scl_LibLookupBatch( pSurfs[k], pSlews, pLoads, pRes1, nPairs );
+            clkBatch += Abc_Clock() - clk;
+            nMisses += memcmp( pRes0, pRes1, sizeof(float) * nPairs ) != 0;
+        }
+    }
+    nArcs = (double)nRounds * Vec_PtrSize(vArcs) * nPairs;
+    printf( "Evaluated %d timing arcs at %d points %d times.  Mismatches = %d.\n", Vec_PtrSize(vArcs), nPairs, nRounds, nMisses );
+    printf( "Scalar  = %8.2f M arcs/sec   ", 1.0e-6 * nArcs / Abc_MaxDouble(1.0e-6, 1.0*clkScalar/CLOCKS_PER_SEC) );
+    ABC_PRT( "Time", clkScalar );
+    printf( "Batched = %8.2f M arcs/sec   ", 1.0e-6 * nArcs / Abc_MaxDouble(1.0e-6, 1.0*clkBatch/CLOCKS_PER_SEC) );
+    ABC_PRT( "Time", clkBatch );
+    Vec_PtrFree( vArcs );
+    ABC_FREE( pSlews );
+    ABC_FREE( pLoads );
+    ABC_FREE( pRes0 );
+    ABC_FREE( pRes1 );
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
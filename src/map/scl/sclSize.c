@@ -27,6 +27,16 @@
 #include <windows.h>
 #endif
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -259,6 +269,327 @@ void Abc_SclTimeNtkPrint( SC_Man * p, int fShowAll, int fPrintPath )
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Batched timing computation for the network.]
+
+  Description [Computes arrival times and slews of the internal nodes 
+  level by level. On each level, the nodes are grouped by their gates, 
+  so that the timing arcs of one gate pin are evaluated for all nodes of
+  the group with one call to Scl_LibLookupBatch(). The CIs are timed in 
+  one batch if the input driver is given.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define SC_TIME_BATCH     256  // the largest group timed at once
+#define SC_TIME_BATCH_MIN   8  // the smallest group timed in a batch
+#define SC_TIME_BATCH_WIDTH 64  // the smallest average number of nodes on a level
+
+static inline void Abc_SclTimeGroupEdge( SC_Surface * pSurf, int nNodes, float * pSlews, float * pLoads, int * pObjs, SC_Pair * pOuts, int fRiseOut, int * pFans, SC_Pair * pIns, int fRiseIn )
+{
+    float Res[SC_TIME_BATCH];
+    int i;
+    Scl_LibLookupBatch( pSurf, pSlews, pLoads, Res, nNodes );
+    if ( pIns == NULL ) // slew
+    {
+        for ( i = 0; i < nNodes; i++ )
+            if ( fRiseOut )
+                pOuts[pObjs[i]].rise = Abc_MaxFloat( pOuts[pObjs[i]].rise, Res[i] );
+            else
+                pOuts[pObjs[i]].fall = Abc_MaxFloat( pOuts[pObjs[i]].fall, Res[i] );
+        return;
+    }
+    for ( i = 0; i < nNodes; i++ )
+        if ( fRiseOut )
+            pOuts[pObjs[i]].rise = Abc_MaxFloat( pOuts[pObjs[i]].rise, (fRiseIn ? pIns[pFans[i]].rise : pIns[pFans[i]].fall) + Res[i] );
+        else
+            pOuts[pObjs[i]].fall = Abc_MaxFloat( pOuts[pObjs[i]].fall, (fRiseIn ? pIns[pFans[i]].rise : pIns[pFans[i]].fall) + Res[i] );
+}
+static void Abc_SclTimeGroup( SC_Man * p, SC_Cell * pCell, int * pObjs, int nNodes, int * pFanStart, int * pFanins )
+{
+    float SlewR[SC_TIME_BATCH], SlewF[SC_TIME_BATCH], LoadR[SC_TIME_BATCH], LoadF[SC_TIME_BATCH];
+    int Fans[SC_TIME_BATCH];
+    SC_Timing * pTime;
+    int i, k;
+    assert( nNodes <= SC_TIME_BATCH );
+    if ( nNodes < SC_TIME_BATCH_MIN )
+    {
+        for ( i = 0; i < nNodes; i++ )
+        for ( k = 0; k < pCell->n_inputs; k++ )
+        {
+            int iFanin = pFanins[pFanStart[pObjs[i]] + k];
+            Scl_LibPinArrival( Scl_CellPinTime(pCell, k), p->pTimes + iFanin, p->pSlews + iFanin, p->pLoads + pObjs[i], p->pTimes + pObjs[i], p->pSlews + pObjs[i] );
+        }
+        return;
+    }
+    for ( i = 0; i < nNodes; i++ )
+    {
+        LoadR[i] = p->pLoads[pObjs[i]].rise;
+        LoadF[i] = p->pLoads[pObjs[i]].fall;
+    }
+    for ( k = 0; k < pCell->n_inputs; k++ )
+    {
+        pTime = Scl_CellPinTime( pCell, k );
+        for ( i = 0; i < nNodes; i++ )
+        {
+            Fans[i]  = pFanins[pFanStart[pObjs[i]] + k];
+            SlewR[i] = p->pSlews[Fans[i]].rise;
+            SlewF[i] = p->pSlews[Fans[i]].fall;
+        }
+        if ( pTime->tsense == sc_ts_Pos || pTime->tsense == sc_ts_Non )
+        {
+            Abc_SclTimeGroupEdge( &pTime->pCellRise,  nNodes, SlewR, LoadR, pObjs, p->pTimes, 1, Fans, p->pTimes, 1 );
+            Abc_SclTimeGroupEdge( &pTime->pCellFall,  nNodes, SlewF, LoadF, pObjs, p->pTimes, 0, Fans, p->pTimes, 0 );
+            Abc_SclTimeGroupEdge( &pTime->pRiseTrans, nNodes, SlewR, LoadR, pObjs, p->pSlews, 1, NULL, NULL,     0 );
+            Abc_SclTimeGroupEdge( &pTime->pFallTrans, nNodes, SlewF, LoadF, pObjs, p->pSlews, 0, NULL, NULL,     0 );
+        }
+        if ( pTime->tsense == sc_ts_Neg || pTime->tsense == sc_ts_Non )
+        {
+            Abc_SclTimeGroupEdge( &pTime->pCellRise,  nNodes, SlewF, LoadR, pObjs, p->pTimes, 1, Fans, p->pTimes, 0 );
+            Abc_SclTimeGroupEdge( &pTime->pCellFall,  nNodes, SlewR, LoadF, pObjs, p->pTimes, 0, Fans, p->pTimes, 1 );
+            Abc_SclTimeGroupEdge( &pTime->pRiseTrans, nNodes, SlewF, LoadR, pObjs, p->pSlews, 1, NULL, NULL,     0 );
+            Abc_SclTimeGroupEdge( &pTime->pFallTrans, nNodes, SlewR, LoadF, pObjs, p->pSlews, 0, NULL, NULL,     0 );
+        }
+    }
+}
+void Abc_SclTimeCiBatch( SC_Man * p )
+{
+    int i, nCis = Abc_NtkCiNum(p->pNtk);
+    SC_Pair * pLoads = ABC_ALLOC( SC_Pair, nCis );
+    SC_Pair * pArrs  = ABC_ALLOC( SC_Pair, nCis );
+    SC_Pair * pSlews = ABC_ALLOC( SC_Pair, nCis );
+    Abc_Obj_t * pObj;
+    assert( p->pPiDrive != NULL );
+    Abc_NtkForEachCi( p->pNtk, pObj, i )
+        pLoads[i] = *Abc_SclObjLoad( p, pObj );
+    Scl_LibHandleInputDriverBatch( p->pPiDrive, pLoads, pArrs, pSlews, nCis );
+    Abc_NtkForEachCi( p->pNtk, pObj, i )
+    {
+        *Abc_SclObjTime( p, pObj ) = pArrs[i];
+        *Abc_SclObjSlew( p, pObj ) = pSlews[i];
+    }
+    ABC_FREE( pLoads );
+    ABC_FREE( pArrs );
+    ABC_FREE( pSlews );
+}
+static void Abc_SclDeptNodePull( SC_Man * p, int iObj )
+{
+    Abc_Obj_t * pObj = Abc_NtkObj( p->pNtk, iObj );
+    Abc_Obj_t * pFanout, * pFanin;
+    int i, k;
+    SC_PairClean( Abc_SclObjDept(p, pObj) );
+    Abc_ObjForEachFanout( pObj, pFanout, i )
+    {
+        if ( Abc_ObjIsCo(pFanout) || Abc_ObjIsLatch(pFanout) )
+            continue;
+        Abc_ObjForEachFanin( pFanout, pFanin, k )
+            if ( pFanin == pObj )
+                Scl_LibPinDeparture( Scl_CellPinTime(Abc_SclObjCell(pFanout), k), Abc_SclObjDept(p, pObj), Abc_SclObjSlew(p, pObj), Abc_SclObjLoad(p, pFanout), Abc_SclObjDept(p, pFanout) );
+    }
+}
+static void Abc_SclTimeItem( SC_Man * p, Vec_Int_t * vOrder, Vec_Int_t * vItems, int iItem, int * pFanStart, int * pFanins, int fDept )
+{
+    int iCell  = Vec_IntEntry( vItems, 3*iItem+0 );
+    int iStart = Vec_IntEntry( vItems, 3*iItem+1 );
+    int nNodes = Vec_IntEntry( vItems, 3*iItem+2 );
+    int i;
+    if ( fDept )
+        for ( i = 0; i < nNodes; i++ )
+            Abc_SclDeptNodePull( p, Vec_IntEntry(vOrder, iStart + i) );
+    else
+        Abc_SclTimeGroup( p, SC_LibCell(p->pLib, iCell), Vec_IntEntryP(vOrder, iStart), nNodes, pFanStart, pFanins );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Times one level of the network using several threads.]
+
+  Description [The items of the level (groups of nodes with the same gate,
+  or chunks of nodes when departure times are computed) are taken by the
+  threads one at a time from a shared index. Each node only reads timing 
+  data of the nodes on lower (higher for departure times) levels and
+  writes its own timing data, so the result does not depend on the order,
+  in which the items are processed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define SC_PROC_MAX       64  // the max number of threads
+#define SC_PAR_MIN      1024  // the smallest level processed by several threads
+
+#ifdef ABC_USE_PTHREADS
+typedef struct SC_ThData_t_ SC_ThData_t;
+struct SC_ThData_t_
+{
+    SC_Man *          p;              // timing manager
+    Vec_Int_t *       vOrder;         // nodes of the current level
+    Vec_Int_t *       vItems;         // (gate, first node, node count) for each item
+    int *             pFanStart;      // the first fanin of each node in pFanins
+    int *             pFanins;        // the fanins of all nodes
+    int *             piNext;         // the next item to process
+    pthread_mutex_t * pMutex;         // protects the next item
+    int               fDept;          // computes departure times
+};
+void * Abc_SclTimeWorkerThread( void * pArg )
+{
+    SC_ThData_t * pThData = (SC_ThData_t *)pArg;
+    int iItem;
+    while ( 1 )
+    {
+        pthread_mutex_lock( pThData->pMutex );
+        iItem = (*pThData->piNext)++;
+        pthread_mutex_unlock( pThData->pMutex );
+        if ( 3*iItem >= Vec_IntSize(pThData->vItems) )
+            break;
+        Abc_SclTimeItem( pThData->p, pThData->vOrder, pThData->vItems, iItem, pThData->pFanStart, pThData->pFanins, pThData->fDept );
+    }
+    return NULL;
+}
+#endif
+void Abc_SclTimeLevel( SC_Man * p, Vec_Int_t * vOrder, Vec_Int_t * vItems, int * pFanStart, int * pFanins, int fDept )
+{
+    int i;
+#ifdef ABC_USE_PTHREADS
+    if ( p->nThreads > 1 && Vec_IntSize(vOrder) >= SC_PAR_MIN )
+    {
+        pthread_t WorkerThread[SC_PROC_MAX];
+        SC_ThData_t ThData[SC_PROC_MAX];
+        pthread_mutex_t Mutex;
+        int nProcs = Abc_MinInt( p->nThreads, SC_PROC_MAX );
+        int iNext = 0, status;
+        pthread_mutex_init( &Mutex, NULL );
+        for ( i = 0; i < nProcs; i++ )
+        {
+            ThData[i].p         = p;
+            ThData[i].vOrder    = vOrder;
+            ThData[i].vItems    = vItems;
+            ThData[i].pFanStart = pFanStart;
+            ThData[i].pFanins   = pFanins;
+            ThData[i].piNext    = &iNext;
+            ThData[i].pMutex    = &Mutex;
+            ThData[i].fDept     = fDept;
+            status = pthread_create( WorkerThread + i, NULL, Abc_SclTimeWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+        }
+        for ( i = 0; i < nProcs; i++ )
+        {
+            status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+        }
+        pthread_mutex_destroy( &Mutex );
+        return;
+    }
+#endif
+    for ( i = 0; 3*i < Vec_IntSize(vItems); i++ )
+        Abc_SclTimeItem( p, vOrder, vItems, i, pFanStart, pFanins, fDept );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Batched and level-parallel timing computation.]
+
+  Description [Computes arrival times and slews of the internal nodes 
+  level by level. On each level, the nodes are grouped by their gates, 
+  so that the timing arcs of one gate pin are evaluated for all nodes of
+  the group with one call to Scl_LibLookupBatch(). Small groups are timed
+  node by node. If fDept is set, also computes departure times level by 
+  level in the reverse order, with each node collecting them from its 
+  fanouts. If p->nThreads > 1, large levels are divided among threads.
+  The result is the same as that of the serial computation in the 
+  topological order. Returns 0 without timing the nodes if the network 
+  has too few nodes per level for batching to pay off.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_SclTimeNtkBatch( SC_Man * p, int fDept )
+{
+    Vec_Int_t * vLevel    = Vec_IntStart( Abc_NtkObjNumMax(p->pNtk) );
+    Vec_Int_t * vFanStart = Vec_IntStart( Abc_NtkObjNumMax(p->pNtk) );
+    Vec_Int_t * vFanins   = Vec_IntAlloc( 2 * Abc_NtkObjNumMax(p->pNtk) );
+    Vec_Wec_t * vLevels   = Vec_WecAlloc( 100 );
+    Vec_Wec_t * vCells    = Vec_WecStart( SC_LibCellNum(p->pLib) );
+    Vec_Int_t * vUsed     = Vec_IntAlloc( 100 );
+    Vec_Int_t * vOrder    = Vec_IntAlloc( 1000 );
+    Vec_Int_t * vItems    = Vec_IntAlloc( 1000 );
+    Vec_Int_t * vNodes, * vGroup;
+    Abc_Obj_t * pObj, * pFanin;
+    int i, k, j, iObj, iCell, Level, RetValue = 0;
+    // levelize the nodes and copy their fanins into one array, which is 
+    // done in the topological order, while the rest only uses the arrays
+    Abc_NtkForEachNode1( p->pNtk, pObj, i )
+    {
+        Level = 0;
+        Vec_IntWriteEntry( vFanStart, i, Vec_IntSize(vFanins) );
+        Abc_ObjForEachFanin( pObj, pFanin, k )
+        {
+            Level = Abc_MaxInt( Level, Vec_IntEntry(vLevel, Abc_ObjId(pFanin)) );
+            Vec_IntPush( vFanins, Abc_ObjId(pFanin) );
+        }
+        Vec_IntWriteEntry( vLevel, i, Level + 1 );
+        Vec_WecPushTwo( vLevels, Level, i, Abc_SclObjCellId(pObj) );
+    }
+    // narrow networks have too few nodes with the same gate on each level
+    if ( Abc_NtkNodeNum(p->pNtk) < SC_TIME_BATCH_WIDTH * Vec_WecSize(vLevels) )
+        goto finish;
+    // compute arrival times of each level with the nodes grouped by gates
+    Vec_WecForEachLevel( vLevels, vNodes, i )
+    {
+        Vec_IntForEachEntryDouble( vNodes, iObj, iCell, k )
+        {
+            if ( Vec_IntSize(Vec_WecEntry(vCells, iCell)) == 0 )
+                Vec_IntPush( vUsed, iCell );
+            Vec_WecPush( vCells, iCell, iObj );
+        }
+        Vec_IntClear( vOrder );
+        Vec_IntClear( vItems );
+        Vec_IntForEachEntry( vUsed, iCell, k )
+        {
+            vGroup = Vec_WecEntry( vCells, iCell );
+            for ( j = 0; j < Vec_IntSize(vGroup); j += SC_TIME_BATCH )
+                Vec_IntPushThree( vItems, iCell, Vec_IntSize(vOrder) + j, Abc_MinInt(SC_TIME_BATCH, Vec_IntSize(vGroup) - j) );
+            Vec_IntAppend( vOrder, vGroup );
+            Vec_IntClear( vGroup );
+        }
+        Vec_IntClear( vUsed );
+        Abc_SclTimeLevel( p, vOrder, vItems, Vec_IntArray(vFanStart), Vec_IntArray(vFanins), 0 );
+    }
+    // compute departure times of each level in the reverse order
+    if ( fDept )
+    {
+        Vec_WecForEachLevelReverse( vLevels, vNodes, i )
+        {
+            Vec_IntClear( vOrder );
+            Vec_IntClear( vItems );
+            Vec_IntForEachEntryDouble( vNodes, iObj, iCell, k )
+                Vec_IntPush( vOrder, iObj );
+            for ( j = 0; j < Vec_IntSize(vOrder); j += SC_TIME_BATCH )
+                Vec_IntPushThree( vItems, -1, j, Abc_MinInt(SC_TIME_BATCH, Vec_IntSize(vOrder) - j) );
+            Abc_SclTimeLevel( p, vOrder, vItems, NULL, NULL, 1 );
+        }
+        // the remaining objects (CIs and constant nodes) can be fanins too
+        Abc_NtkForEachObj( p->pNtk, pObj, i )
+            if ( Abc_ObjIsCi(pObj) || (Abc_ObjIsNode(pObj) && Abc_ObjFaninNum(pObj) == 0) )
+                Abc_SclDeptNodePull( p, i );
+    }
+    RetValue = 1;
+finish:
+    Vec_IntFree( vLevel );
+    Vec_IntFree( vFanStart );
+    Vec_IntFree( vFanins );
+    Vec_WecFree( vLevels );
+    Vec_WecFree( vCells );
+    Vec_IntFree( vUsed );
+    Vec_IntFree( vOrder );
+    Vec_IntFree( vItems );
+    return RetValue;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Timing computation for pin/gate/cone/network.]
@@ -416,14 +747,18 @@ void Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fRe
 {
     Abc_Obj_t * pObj;
     float D;
-    int i;
+    int i, fBatch, fDeptPar = fReverse && p->nThreads > 1;
     Abc_SclComputeLoad( p );
     Abc_SclManCleanTime( p );
     p->nEstNodes = 0;
-    Abc_NtkForEachCi( p->pNtk, pObj, i )
-        Abc_SclTimeNode( p, pObj, 0 );
-    Abc_NtkForEachNode1( p->pNtk, pObj, i )
-        Abc_SclTimeNode( p, pObj, 0 );
+    if ( p->pPiDrive != NULL )
+        Abc_SclTimeCiBatch( p );
+    fBatch = p->pFuncFanin == NULL && p->EstLoadMax == 0 && Abc_SclTimeNtkBatch( p, fDeptPar );
+    if ( !fBatch )
+    {
+        Abc_NtkForEachNode1( p->pNtk, pObj, i )
+            Abc_SclTimeNode( p, pObj, 0 );
+    }
     Abc_NtkForEachCo( p->pNtk, pObj, i )
         Abc_SclTimeNode( p, pObj, 0 );
     D = Abc_SclReadMaxDelay( p );
@@ -433,7 +768,7 @@ void Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fRe
         *pArea = Abc_SclGetTotalArea(p->pNtk);
     if ( pDelay )
         *pDelay = D;
-    if ( fReverse )
+    if ( fReverse && !(fBatch && fDeptPar) )
     {
         p->nEstNodes = 0;
         Abc_NtkForEachNodeReverse1( p->pNtk, pObj, i )
@@ -445,7 +780,11 @@ void Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fRe
 
   Synopsis    [Incremental timing update.]
 
-  Description []
+  Description [Starts from the nodes in p->vChanged, whose gates or loads
+  were changed, and re-times them in the order of levels. The fanouts of a
+  node are visited only if its arrival time or slew changed by more than
+  p->IncEps. If fDept is set, departure times are updated backward in the
+  same way. Returns the number of re-timed nodes.]
                
   SideEffects []
 
@@ -498,7 +837,7 @@ static inline void Abc_SclTimeIncUpdateArrival( SC_Man * p )
     SC_Pair ArrOut, SlewOut;
     SC_Pair * pArrOut, *pSlewOut;
     Abc_Obj_t * pObj;
-    float E = (float)0.1;
+    float E = p->IncEps;
     int i, k;
     Vec_WecForEachLevel( p->vLevels, vLevel, i )
     {
@@ -528,7 +867,7 @@ static inline void Abc_SclTimeIncUpdateDeparture( SC_Man * p )
     Vec_Int_t * vLevel;
     SC_Pair DepOut, * pDepOut;
     Abc_Obj_t * pObj;
-    float E = (float)0.1;
+    float E = p->IncEps;
     int i, k;
     Vec_WecForEachLevelReverse( p->vLevels, vLevel, i )
     {
@@ -552,7 +891,7 @@ void Abc_SclTimeIncCheckLevel( Abc_Ntk_t * pNtk )
         if ( (int)pObj->Level != Abc_ObjLevelNew(pObj) )
             printf( "Level of node %d is out of date!\n", i );
 }
-int Abc_SclTimeIncUpdate( SC_Man * p )
+int Abc_SclTimeIncUpdate( SC_Man * p, int fDept )
 {
     Abc_Obj_t * pObj;
     int i, RetValue;
@@ -568,7 +907,8 @@ int Abc_SclTimeIncUpdate( SC_Man * p )
     }
     Vec_IntClear( p->vChanged );
     Abc_SclTimeIncUpdateArrival( p );
-    Abc_SclTimeIncUpdateDeparture( p );
+    if ( fDept )
+        Abc_SclTimeIncUpdateDeparture( p );
     Abc_SclTimeIncUpdateClean( p );
     RetValue = p->nIncUpdates;
     p->nIncUpdates = 0;
@@ -645,9 +985,13 @@ void Abc_SclManReadSlewAndLoad( SC_Man * p, Abc_Ntk_t * pNtk )
   SeeAlso     []
 
 ***********************************************************************/
-SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio )
+SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio, int nThreads )
 {
     SC_Man * p = Abc_SclManAlloc( pLib, pNtk );
+    p->nThreads = nThreads;
+    // the timing tables are decoded on first use, which is not thread-safe
+    if ( nThreads > 1 )
+        Abc_SclLibDecode( pLib );
     if ( nTreeCRatio )
     {
         p->EstLoadMax = 0.01 * nTreeCRatio;  // max ratio of Cout/Cave when the estimation is used
@@ -683,10 +1027,10 @@ SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, in
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_SclTimePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats )
+void Abc_SclTimePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats, int nThreads )
 {
     SC_Man * p;
-    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, nTreeCRatio );
+    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, nTreeCRatio, nThreads );
     Abc_SclTimeNtkPrint( p, fShowAll, fPrintPath );
     if ( fDumpStats )
         Abc_SclDumpStats( p, "stats.txt", 0 );
@@ -704,12 +1048,12 @@ void Abc_SclTimePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, in
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats )
+void Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats, int nThreads )
 {
     Abc_Ntk_t * pNtkNew = pNtk;
     if ( pNtk->nBarBufs2 > 0 )
         pNtkNew = Abc_NtkDupDfsNoBarBufs( pNtk );
-    Abc_SclTimePerformInt( pLib, pNtkNew, nTreeCRatio, fUseWireLoads, fShowAll, fPrintPath, fDumpStats );
+    Abc_SclTimePerformInt( pLib, pNtkNew, nTreeCRatio, fUseWireLoads, fShowAll, fPrintPath, fDumpStats, nThreads );
     if ( pNtk->nBarBufs2 > 0 )
         Abc_NtkDelete( pNtkNew );
 }
@@ -914,7 +1258,7 @@ void Abc_SclPrintBuffers( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fVerbose )
     int fUseWireLoads = 0;
     SC_Man * p;
     assert( Abc_NtkIsMappedLogic(pNtk) );
-    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, 10000 ); 
+    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, 10000, 1 ); 
     Abc_SclPrintBufferTrees( p, pNtk ); 
 //    Abc_SclPrintFaninPairs( p, pNtk );
     Abc_SclManFree( p );
@@ -890,9 +890,11 @@ void Abc_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
     if ( pPars->Window == 1 )
         pPars->Window += (Abc_NtkNodeNum(pNtk) > 40000);
     // prepare the manager; collect init stats
-    p = Abc_SclManStart( pLib, pNtk, pPars->fUseWireLoads, pPars->fUseDept, 0, pPars->BuffTreeEst );
+    p = Abc_SclManStart( pLib, pNtk, pPars->fUseWireLoads, pPars->fUseDept, 0, pPars->BuffTreeEst, 1 );
     p->pFuncFanin = (float (*)(void *, Abc_Obj_t *, Abc_Obj_t *, int, int))pFuncFanin;    
     p->timeTotal  = Abc_Clock();
+    if ( pPars->IncEps > 0 )
+        p->IncEps = pPars->IncEps;
     assert( p->vGatesBest == NULL );
     p->vGatesBest = Vec_IntDup( p->pNtk->vGates );
     p->BestDelay  = p->MaxDelay0;
@@ -934,20 +936,10 @@ void Abc_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
 
         // update timing information
         clk = Abc_Clock();
-        if ( pPars->fUseDept )
-        {
-            if ( Vec_IntSize(p->vChanged) && !(pPars->BypassFreq && i && (i % pPars->BypassFreq) == 0) )
-                nConeSize = Abc_SclTimeIncUpdate( p );
-            else
-                Abc_SclTimeNtkRecompute( p, NULL, NULL, pPars->fUseDept, 0 );
-        }
+        if ( Vec_IntSize(p->vChanged) )
+            nConeSize = Abc_SclTimeIncUpdate( p, pPars->fUseDept );
         else
-        {
-            Vec_Int_t * vTFO = Abc_SclFindTFO( p->pNtk, vPathNodes );
-            Abc_SclTimeCone( p, vTFO );
-            nConeSize = Vec_IntSize( vTFO );
-            Vec_IntFree( vTFO );
-        }
+            Abc_SclTimeNtkRecompute( p, NULL, NULL, pPars->fUseDept, 0 );
         p->timeTime += Abc_Clock() - clk;
 //        Abc_SclUpsizePrintDiffs( p, pLib, pNtk );
 
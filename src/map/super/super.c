@@ -64,6 +64,7 @@ void Super_Init( Abc_Frame_t * pAbc )
 ***********************************************************************/
 void Super_End( Abc_Frame_t * pAbc )
 {
+    Super_PrecomputeQuit();
 }
 
 
@@ -157,7 +158,7 @@ int Super_CommandSupergates( Abc_Frame_t * pAbc, int argc, char **argv )
     float AreaLimit;
     int fSkipInvs;
     int fWriteOldFormat; 
-    int nVarsMax, nLevels, nGatesMax, TimeLimit;
+    int nVarsMax, nLevels, nGatesMax, TimeLimit, nProcs;
     int fVerbose;
     int c;
 
@@ -171,13 +172,14 @@ int Super_CommandSupergates( Abc_Frame_t * pAbc, int argc, char **argv )
     AreaLimit  = 0;
     nGatesMax  = 0;
     TimeLimit  = 0;
+    nProcs     = 1;
     fSkipInvs  = 1;
     fVerbose   = 0;
     fWriteOldFormat = 0;
     ExcludeFile = 0;
 
     Extra_UtilGetoptReset();
-    while ( (c = Extra_UtilGetopt(argc, argv, "ILNTDAEsovh")) != EOF ) 
+    while ( (c = Extra_UtilGetopt(argc, argv, "ILNTPDAEsovh")) != EOF ) 
     {
         switch (c) 
         {
@@ -205,6 +207,12 @@ int Super_CommandSupergates( Abc_Frame_t * pAbc, int argc, char **argv )
                 if ( TimeLimit < 0 ) 
                     goto usage;
                 break;
+            case 'P':
+                nProcs = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if ( nProcs < 1 ) 
+                    goto usage;
+                break;
             case 'D':
                 DelayLimit = (float)atof(argv[globalUtilOptind]);
                 globalUtilOptind++;
@@ -276,19 +284,22 @@ int Super_CommandSupergates( Abc_Frame_t * pAbc, int argc, char **argv )
 
     // compute the gates
     FileName = Extra_FileNameGenericAppend(Mio_LibraryReadName(pLib), ".super");
-    Super_Precompute( pLib, nVarsMax, nLevels, nGatesMax, DelayLimit, AreaLimit, TimeLimit, fSkipInvs, fVerbose, FileName );
+    Super_Precompute( pLib, nVarsMax, nLevels, nGatesMax, DelayLimit, AreaLimit, TimeLimit, fSkipInvs, nProcs, fVerbose, FileName );
 
     // delete the library
     Mio_LibraryDelete( pLib );
     return 0;
 
 usage:
-    fprintf( pErr, "usage: super [-ILNT num] [-DA float] [-E file] [-sovh] <genlib_file>\n");
+    fprintf( pErr, "usage: super [-ILNTP num] [-DA float] [-E file] [-sovh] <genlib_file>\n");
     fprintf( pErr, "\t         precomputes the supergates for the given genlib library\n" );  
+    fprintf( pErr, "\t         (the libraries are cached in memory and, if \"set cachedir <dir>\"\n" );  
+    fprintf( pErr, "\t         gives a directory, on disk)\n" );  
     fprintf( pErr, "\t-I num   : the max number of supergate inputs [default = %d]\n", nVarsMax );
     fprintf( pErr, "\t-L num   : the max number of levels of gates [default = %d]\n", nLevels );
     fprintf( pErr, "\t-N num   : the limit on the number of considered supergates [default = %d]\n", nGatesMax );
     fprintf( pErr, "\t-T num   : the approximate runtime limit in seconds [default = %d]\n", TimeLimit );
+    fprintf( pErr, "\t-P num   : the number of threads (levels after the first one) [default = %d]\n", nProcs );
     fprintf( pErr, "\t-D float : the max delay of the supergates [default = %.2f]\n", DelayLimit );
     fprintf( pErr, "\t-A float : the max area of the supergates [default = %.2f]\n", AreaLimit );
     fprintf( pErr, "\t-E file  : file contains list of genlib gates to exclude\n" );
@@ -19,6 +19,16 @@
 #include <math.h>
 #include "superInt.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -31,6 +41,11 @@ ABC_NAMESPACE_IMPL_START
 #define SUPER_FULL         (~((unsigned)0))
 #define SUPER_NO_VAR         (-9999.0)
 #define SUPER_EPSILON        (0.001)
+#define SUPER_PROC_MAX       64          // the max number of threads
+#define SUPER_PAR_RECS       (1 << 19)   // the max number of candidates buffered at a time
+#define SUPER_CACHE_MAX      16          // the number of libraries cached in one session
+#define SUPER_CACHE_MAGIC    0x53555052  // the kind of the cache entries
+#define SUPER_CACHE_VERSION  2           // changes when the generation procedure changes
 
 // data structure for supergate precomputation
 typedef struct Super_ManStruct_t_     Super_Man_t;   // manager
@@ -48,6 +63,7 @@ struct Super_ManStruct_t_
     float               tAreaMax;     // the max area of the supergates in the library
     int                 fSkipInv;     // the flag says about skipping inverters
     int                 fWriteOldFormat; // in addition, writes the file in the old format
+    int                 nProcs;       // the number of threads
     int                 fVerbose;
 
     // supergates
@@ -75,6 +91,7 @@ struct Super_ManStruct_t_
     int                 TimeSec;      // the time passed (in seconds)
     abctime             TimeStop;     // the time to stop computation (in miliseconds)
     abctime             TimePrint;    // the time to print message
+    int                 fTimeOut;     // the runtime limit was reached
 };
 
 struct Super_GateStruct_t_
@@ -106,12 +123,17 @@ static void           Super_ManStop( Super_Man_t * pMan );
 static void           Super_AddGateToTable( Super_Man_t * pMan, Super_Gate_t * pGate );
 static void           Super_First( Super_Man_t * pMan, int nVarsMax );
 static Super_Man_t *  Super_Compute( Super_Man_t * pMan, Mio_Gate_t ** ppGates, int nGates, int nGatesMax, int fSkipInv );
+static Super_Man_t *  Super_ComputePar( Super_Man_t * pMan, Mio_Gate_t ** ppGates, int nGates, int nGatesMax, int fSkipInv );
 static Super_Gate_t * Super_CreateGateNew( Super_Man_t * pMan, Mio_Gate_t * pRoot, Super_Gate_t ** pSupers, int nSupers, unsigned uTruth[], float Area, float tPinDelaysRes[], float tDelayMax, int nPins );
 static int            Super_CompareGates( Super_Man_t * pMan, unsigned uTruth[], float Area, float tPinDelaysRes[], int nPins );
 static int            Super_DelayCompare( Super_Gate_t ** ppG1, Super_Gate_t ** ppG2 );
 static int            Super_AreaCompare( Super_Gate_t ** ppG1, Super_Gate_t ** ppG2 );
 static void           Super_TranferGatesToArray( Super_Man_t * pMan );
 static int            Super_CheckTimeout( ProgressBar * pPro, Super_Man_t * pMan );
+
+static word           Super_LibraryHash( Super_Man_t * pMan, Mio_Gate_t ** ppGates, int nGates, int nVarsMax, int nLevels );
+static Vec_Str_t *    Super_CacheLookup( word Hash );
+static void           Super_CacheInsert( word Hash, Vec_Str_t * vStr );
  
 static Vec_Str_t *    Super_Write( Super_Man_t * pMan );
 static int            Super_WriteCompare( Super_Gate_t ** ppG1, Super_Gate_t ** ppG2 );
@@ -137,7 +159,7 @@ static Vec_Str_t *    Super_WriteLibraryTreeStr( Super_Man_t * pMan );
   SeeAlso     []
 
 ***********************************************************************/
-void Super_Precompute( Mio_Library_t * pLibGen, int nVarsMax, int nLevels, int nGatesMax, float tDelayMax, float tAreaMax, int TimeLimit, int fSkipInv, int fVerbose, char * pFileName )
+void Super_Precompute( Mio_Library_t * pLibGen, int nVarsMax, int nLevels, int nGatesMax, float tDelayMax, float tAreaMax, int TimeLimit, int fSkipInv, int nProcs, int fVerbose, char * pFileName )
 {
     Vec_Str_t * vStr;
     FILE * pFile = fopen( pFileName, "wb" );
@@ -146,7 +168,7 @@ void Super_Precompute( Mio_Library_t * pLibGen, int nVarsMax, int nLevels, int n
         printf( "Cannot open output file \"%s\".\n", pFileName );
         return;
     }
-    vStr = Super_PrecomputeStr( pLibGen, nVarsMax, nLevels, nGatesMax, tDelayMax, tAreaMax, TimeLimit, fSkipInv, fVerbose );
+    vStr = Super_PrecomputeStr( pLibGen, nVarsMax, nLevels, nGatesMax, tDelayMax, tAreaMax, TimeLimit, fSkipInv, nProcs, fVerbose );
     if ( vStr ) 
     {
         fwrite( Vec_StrArray(vStr), 1, Vec_StrSize(vStr), pFile );
@@ -165,20 +187,24 @@ void Super_Precompute( Mio_Library_t * pLibGen, int nVarsMax, int nLevels, int n
 
   Synopsis    [Precomputes the library of supergates.]
 
-  Description []
+  Description [The supergates depend only on the root gates and the 
+  parameters, so the result is looked up in the supergate library cache
+  by the content hash of both, and the computed library is saved there.
+  The libraries computed when the runtime limit is reached are not saved.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Vec_Str_t * Super_PrecomputeStr( Mio_Library_t * pLibGen, int nVarsMax, int nLevels, int nGatesMax, float tDelayMax, float tAreaMax, int TimeLimit, int fSkipInv, int fVerbose )
+Vec_Str_t * Super_PrecomputeStr( Mio_Library_t * pLibGen, int nVarsMax, int nLevels, int nGatesMax, float tDelayMax, float tAreaMax, int TimeLimit, int fSkipInv, int nProcs, int fVerbose )
 {
     Vec_Str_t * vStr;
     Super_Man_t * pMan;
     Mio_Gate_t ** ppGates;
     int nGates, Level;
     abctime clk, clockStart;
+    word Hash;
 
     assert( nVarsMax < 7 );
     if ( nGatesMax && nGatesMax < nVarsMax )
@@ -205,6 +231,7 @@ Vec_Str_t * Super_PrecomputeStr( Mio_Library_t * pLibGen, int nVarsMax, int nLev
     pMan->tAreaMax  = tAreaMax;
     pMan->TimeLimit = TimeLimit; // in seconds
     pMan->TimeStop  = TimeLimit ? TimeLimit * CLOCKS_PER_SEC + Abc_Clock() : 0; // in CPU ticks
+    pMan->nProcs    = Abc_MinInt( Abc_MaxInt(nProcs, 1), SUPER_PROC_MAX );
     pMan->fVerbose  = fVerbose;
 
     if ( nGates == 0 )
@@ -220,6 +247,18 @@ Vec_Str_t * Super_PrecomputeStr( Mio_Library_t * pLibGen, int nVarsMax, int nLev
         return NULL;
     }
 
+    // check the cache
+    Hash = Super_LibraryHash( pMan, ppGates, nGates, nVarsMax, nLevels );
+    vStr = Super_CacheLookup( Hash );
+    if ( vStr != NULL )
+    {
+        if ( fVerbose )
+            printf( "Loaded the supergate library for \"%s\" from the cache (%d bytes).\n", pMan->pName, Vec_StrSize(vStr) );
+        Super_ManStop( pMan );
+        ABC_FREE( ppGates );
+        return vStr;
+    }
+
     // get the starting supergates
     Super_First( pMan, nVarsMax );
 
@@ -227,8 +266,8 @@ Vec_Str_t * Super_PrecomputeStr( Mio_Library_t * pLibGen, int nVarsMax, int nLev
     clockStart = Abc_Clock();
 if ( fVerbose )
 {
-    printf( "Computing supergates with %d inputs, %d levels, and %d max gates.\n", 
-        pMan->nVarsMax, nLevels, nGatesMax );
+    printf( "Computing supergates with %d inputs, %d levels, and %d max gates using %d thread%s.\n", 
+        pMan->nVarsMax, nLevels, nGatesMax, pMan->nProcs, pMan->nProcs > 1 ? "s" : "" );
     printf( "Limits: max delay =  %.2f, max area =  %.2f, time limit = %d sec.\n", 
         pMan->tDelayMax, pMan->tAreaMax, pMan->TimeLimit );
 }
@@ -236,9 +275,16 @@ if ( fVerbose )
     for ( Level = 1; Level <= nLevels; Level++ )
     {
         if ( pMan->TimeStop && Abc_Clock() > pMan->TimeStop )
+        {
+            pMan->fTimeOut = 1;
             break;
+        }
 clk = Abc_Clock();
-        Super_Compute( pMan, ppGates, nGates, nGatesMax, fSkipInv );
+        // the first level is small and is not pruned, so it is always computed serially
+        if ( pMan->nProcs > 1 && pMan->nLevels >= 1 )
+            Super_ComputePar( pMan, ppGates, nGates, nGatesMax, fSkipInv );
+        else
+            Super_Compute( pMan, ppGates, nGates, nGatesMax, fSkipInv );
         pMan->nLevels = Level;
 if ( fVerbose )
 {
@@ -257,6 +303,8 @@ fflush( stdout );
 }
     // write them into a file
     vStr = Super_Write( pMan );
+    if ( vStr != NULL && !pMan->fTimeOut )
+        Super_CacheInsert( Hash, vStr );
 
     // stop the manager
     Super_ManStop( pMan );
@@ -265,6 +313,131 @@ fflush( stdout );
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Computes the content hash of the root gates and parameters.]
+
+  Description [The hash covers everything the supergates depend on: the 
+  library name, the gate names, functions, areas, pin delays, and the 
+  parameters of the computation.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline word Super_HashString( word Hash, char * pStr )
+{
+    int k;
+    for ( k = 0; pStr && pStr[k]; k++ )
+        Hash = Abc_CacheHashWord( Hash, (word)(unsigned char)pStr[k] );
+    return Abc_CacheHashWord( Hash, 0 );
+}
+static inline word Super_HashDouble( word Hash, double Value )
+{
+    word w;
+    memcpy( &w, &Value, sizeof(word) );
+    return Abc_CacheHashWord( Hash, w );
+}
+word Super_LibraryHash( Super_Man_t * pMan, Mio_Gate_t ** ppGates, int nGates, int nVarsMax, int nLevels )
+{
+    Mio_Pin_t * pPin;
+    word Hash = Abc_CacheHashWord( SUPER_CACHE_VERSION, nVarsMax );
+    int i;
+    Hash = Abc_CacheHashWord( Hash, nLevels );
+    Hash = Abc_CacheHashWord( Hash, pMan->nGatesMax );
+    Hash = Abc_CacheHashWord( Hash, (word)(unsigned)Abc_Float2Int(pMan->tDelayMax) );
+    Hash = Abc_CacheHashWord( Hash, (word)(unsigned)Abc_Float2Int(pMan->tAreaMax) );
+    Hash = Abc_CacheHashWord( Hash, pMan->TimeLimit );
+    Hash = Abc_CacheHashWord( Hash, pMan->fSkipInv );
+    Hash = Super_HashString( Hash, pMan->pName );
+    Hash = Abc_CacheHashWord( Hash, nGates );
+    for ( i = 0; i < nGates; i++ )
+    {
+        Hash = Super_HashString( Hash, Mio_GateReadName(ppGates[i]) );
+        Hash = Abc_CacheHashWord( Hash, Mio_GateReadPinNum(ppGates[i]) );
+        Hash = Abc_CacheHashWord( Hash, Mio_GateReadTruth(ppGates[i]) );
+        Hash = Super_HashDouble( Hash, Mio_GateReadArea(ppGates[i]) );
+        Hash = Super_HashDouble( Hash, Mio_GateReadDelayMax(ppGates[i]) );
+        Mio_GateForEachPin( ppGates[i], pPin )
+            Hash = Super_HashDouble( Hash, Mio_PinReadDelayBlockMax(pPin) );
+    }
+    return Hash;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Cache of supergate libraries.]
+
+  Description [The libraries computed in this session are kept in memory,
+  so that switching back to a library does not recompute the supergates.
+  If the cache directory is set (see Abc_CacheMap()), the libraries are 
+  also saved there, one entry per library, and are reused across runs.
+  The entry is found by the content hash of the gates and parameters, and
+  its payload is the text of the supergate library.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Vec_Wrd_t * s_vSuperCacheKeys = NULL;   // the hashes of the cached libraries
+static Vec_Ptr_t * s_vSuperCacheLibs = NULL;   // the cached libraries
+
+static void Super_CacheKeep( word Hash, Vec_Str_t * vStr )
+{
+    if ( s_vSuperCacheKeys == NULL )
+    {
+        s_vSuperCacheKeys = Vec_WrdAlloc( SUPER_CACHE_MAX );
+        s_vSuperCacheLibs = Vec_PtrAlloc( SUPER_CACHE_MAX );
+    }
+    if ( Vec_WrdSize(s_vSuperCacheKeys) == SUPER_CACHE_MAX )
+    {
+        Vec_StrFree( (Vec_Str_t *)Vec_PtrEntry(s_vSuperCacheLibs, 0) );
+        Vec_PtrDrop( s_vSuperCacheLibs, 0 );
+        Vec_WrdDrop( s_vSuperCacheKeys, 0 );
+    }
+    Vec_WrdPush( s_vSuperCacheKeys, Hash );
+    Vec_PtrPush( s_vSuperCacheLibs, Vec_StrDup(vStr) );
+}
+Vec_Str_t * Super_CacheLookup( word Hash )
+{
+    Vec_Str_t * vStr;
+    char * pData;
+    size_t nSize;
+    int i;
+    if ( s_vSuperCacheKeys && (i = Vec_WrdFind(s_vSuperCacheKeys, Hash)) >= 0 )
+        return Vec_StrDup( (Vec_Str_t *)Vec_PtrEntry(s_vSuperCacheLibs, i) );
+    pData = (char *)Abc_CacheMap( (char *)"sup", SUPER_CACHE_MAGIC, SUPER_CACHE_VERSION, Hash, &nSize );
+    if ( pData == NULL )
+        return NULL;
+    if ( nSize == 0 || nSize > (size_t)ABC_INFINITY )
+    {
+        Abc_CacheUnmap( pData, nSize );
+        return NULL;
+    }
+    vStr = Vec_StrAllocArrayCopy( pData, (int)nSize );
+    Abc_CacheUnmap( pData, nSize );
+    Super_CacheKeep( Hash, vStr );
+    return vStr;
+}
+void Super_CacheInsert( word Hash, Vec_Str_t * vStr )
+{
+    Super_CacheKeep( Hash, vStr );
+    Abc_CacheWrite( (char *)"sup", SUPER_CACHE_MAGIC, SUPER_CACHE_VERSION, Hash, Vec_StrArray(vStr), (size_t)Vec_StrSize(vStr) );
+}
+void Super_PrecomputeQuit()
+{
+    Vec_Str_t * vStr;
+    int i;
+    if ( s_vSuperCacheKeys == NULL )
+        return;
+    Vec_PtrForEachEntry( Vec_Str_t *, s_vSuperCacheLibs, vStr, i )
+        Vec_StrFree( vStr );
+    Vec_PtrFreeP( &s_vSuperCacheLibs );
+    Vec_WrdFreeP( &s_vSuperCacheKeys );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Derives the starting supergates.]
@@ -726,6 +899,367 @@ done:
     return pMan;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Precomputes one level of supergates using several threads.]
+
+  Description [Starting from the second level, the root gates have at most
+  three pins (see pruning in Super_Compute). The enumeration is split into 
+  items, which fix all fanins of the root gate except the last one. The 
+  threads compute the truth tables and the pin delays of the candidates of 
+  a batch of items, while the main thread enumerates the items and then 
+  checks the candidates against the unique table in the same order as 
+  Super_Compute, so that the resulting supergates are the same.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+
+typedef struct Super_Rec_t_ Super_Rec_t;
+struct Super_Rec_t_
+{
+    int                 iTry;         // the number of tries of the item up to this candidate
+    unsigned            uTruth[2];    // the truth table of the candidate
+    float               Area;         // the area of the candidate
+    float               tDelayMax;    // the maximum delay
+    float               ptDelays[6];  // the pin-to-pin delays for all inputs
+    Super_Gate_t *      pFanins[3];   // the fanins of the root gate
+};
+
+typedef struct Super_Item_t_ Super_Item_t;
+struct Super_Item_t_
+{
+    int                 k;            // the root gate
+    int                 i0;           // the first fanin (if the root gate has two or three pins)
+    int                 i1;           // the second fanin (if the root gate has three pins)
+    int                 nTried;       // the number of tries
+    int                 fTimeOut;     // the runtime limit was reached
+    int                 nRecs;        // the number of candidates
+    int                 nRecsAlloc;   // the number of candidates allocated
+    Super_Rec_t *       pRecs;        // the candidates
+};
+
+typedef struct Super_Par_t_ Super_Par_t;
+struct Super_Par_t_
+{
+    Super_Man_t *       pMan;         // the manager
+    Mio_Gate_t **       ppGates;      // the root gates
+    int                 nGates;       // the number of root gates
+    int                 fSkipInv;     // the flag says about skipping inverters
+    Super_Gate_t ***    pppLimits;    // the fanin gates considered for each root gate
+    int *               pnLimits;     // the number of fanin gates considered for each root gate
+    int                 k, i0, i1;    // the last enumerated item
+    int                 fRootDone;    // the items of the current root gate are enumerated
+    Super_Item_t *      pItems;       // the items of the current batch
+    int                 nItems;       // the number of items of the current batch
+    int                 nItemsAlloc;  // the number of items allocated
+};
+
+typedef struct Super_ThData_t_ Super_ThData_t;
+struct Super_ThData_t_
+{
+    Super_Par_t *       p;            // the enumeration data
+    int *               piNext;       // the next item to process
+    pthread_mutex_t *   pMutex;       // protects the next item
+};
+
+static void Super_ParStartRoot( Super_Par_t * p, int k )
+{
+    Super_Man_t * pMan = p->pMan;
+    Super_Gate_t ** ppGatesLimit = ABC_ALLOC( Super_Gate_t *, pMan->nGates );
+    float tDelayMio = (float)Mio_GateReadDelayMax(p->ppGates[k]);
+    int s, t;
+    // select the subset of gates to be considered with this root gate (as in Super_Compute)
+    for ( s = 0, t = 0; s < pMan->nGates; s++ )
+    {
+        if ( ((int)pMan->pGates[s]->nFanins) >= 3 )
+            continue;
+        ppGatesLimit[t] = pMan->pGates[s];
+        if ( ppGatesLimit[t++]->tDelayMax + tDelayMio > pMan->tDelayMax && pMan->tDelayMax > 0.0 )
+            break;
+    }
+    if ( pMan->fVerbose )
+        printf ("Trying %d choices for %d inputs\r", t, Mio_GateReadPinNum(p->ppGates[k]) );
+    if ( t > 10000 )
+        printf( "Sorting array of %d supergates...\r", t );
+    qsort( (void *)ppGatesLimit, (size_t)t, sizeof(Super_Gate_t *), 
+            (int (*)(const void *, const void *)) Super_AreaCompare );
+    if ( t > 10000 )
+        printf( "                                       \r" );
+    p->pppLimits[k] = ppGatesLimit;
+    p->pnLimits[k]  = t;
+}
+static int Super_ParNextItem( Super_Par_t * p, Super_Item_t * pItem )
+{
+    Super_Man_t * pMan = p->pMan;
+    Super_Gate_t ** ppGatesLimit;
+    float AreaMio, Area0, Area1;
+    int nGatesLimit, nFanins;
+    while ( 1 )
+    {
+        if ( p->fRootDone )
+        {
+            if ( ++p->k == p->nGates )
+                return 0;
+            if ( Mio_GateReadPinNum(p->ppGates[p->k]) >= 4 )
+                continue;
+            Super_ParStartRoot( p, p->k );
+            p->i0 = p->i1 = -1;
+            p->fRootDone = 0;
+        }
+        ppGatesLimit = p->pppLimits[p->k];
+        nGatesLimit  = p->pnLimits[p->k];
+        AreaMio      = (float)Mio_GateReadArea(p->ppGates[p->k]);
+        nFanins      = Mio_GateReadPinNum(p->ppGates[p->k]);
+        if ( nFanins == 1 )
+        {
+            p->fRootDone = 1;
+            break;
+        }
+        if ( nFanins == 3 && p->i0 >= 0 )
+        {
+            // move to the next second fanin
+            Area0 = AreaMio + ppGatesLimit[p->i0]->Area;
+            for ( p->i1++; p->i1 < nGatesLimit && p->i1 == p->i0; p->i1++ );
+            if ( p->i1 < nGatesLimit )
+            {
+                Area1 = Area0 + ppGatesLimit[p->i1]->Area;
+                if ( !(pMan->tAreaMax > 0.0 && Area1 > pMan->tAreaMax) )
+                    break;
+            }
+        }
+        // move to the next first fanin
+        p->i1 = -1;
+        if ( ++p->i0 == nGatesLimit )
+        {
+            p->fRootDone = 1;
+            continue;
+        }
+        Area0 = AreaMio + ppGatesLimit[p->i0]->Area;
+        if ( pMan->tAreaMax > 0.0 && Area0 > pMan->tAreaMax )
+        {
+            p->fRootDone = 1;
+            continue;
+        }
+        if ( nFanins == 2 )
+            break;
+    }
+    pItem->k  = p->k;
+    pItem->i0 = p->i0;
+    pItem->i1 = p->i1;
+    return 1;
+}
+static void Super_ParComputeItem( Super_Par_t * p, Super_Item_t * pItem )
+{
+    Super_Man_t * pMan = p->pMan;
+    Mio_Gate_t * pRoot = p->ppGates[pItem->k];
+    Super_Gate_t ** ppGatesLimit = p->pppLimits[pItem->k];
+    Super_Gate_t * pSupers[3] = { NULL }, * pGate;
+    Super_Rec_t * pRec;
+    float tPinDelaysRes[6], * ptPinDelays[3], tPinDelayMax, Area, AreaFixed;
+    unsigned uTruth[2], uTruths[3][2];
+    int nGatesLimit = p->pnLimits[pItem->k];
+    int nFanins = Mio_GateReadPinNum(pRoot);
+    int i, n, nFixed = nFanins - 1;
+    pItem->nTried = pItem->nRecs = pItem->fTimeOut = 0;
+    // the fixed fanins are added to the area in the same order as in Super_Compute
+    AreaFixed = (float)Mio_GateReadArea(pRoot);
+    if ( nFixed > 0 )
+        pSupers[0] = ppGatesLimit[pItem->i0];
+    if ( nFixed > 1 )
+        pSupers[1] = ppGatesLimit[pItem->i1];
+    for ( n = 0; n < nFixed; n++ )
+    {
+        AreaFixed = AreaFixed + pSupers[n]->Area;
+        uTruths[n][0] = pSupers[n]->uTruth[0];  uTruths[n][1] = pSupers[n]->uTruth[1];  ptPinDelays[n] = pSupers[n]->ptDelays;
+    }
+    // enumerate the last fanin
+    Super_ManForEachGate( ppGatesLimit, nGatesLimit, i, pGate )
+    {
+        if ( (nFixed > 0 && i == pItem->i0) || (nFixed > 1 && i == pItem->i1) )
+            continue;
+        if ( pMan->TimeStop && Abc_Clock() > pMan->TimeStop )
+        {
+            pItem->fTimeOut = 1;
+            break;
+        }
+        pItem->nTried++;
+        if ( nFanins == 1 && p->fSkipInv && pGate->tDelayMax == 0 )
+            continue;
+        Area = AreaFixed + pGate->Area;
+        if ( pMan->tAreaMax > 0.0 && Area > pMan->tAreaMax )
+            break;
+        pSupers[nFixed] = pGate;  uTruths[nFixed][0] = pGate->uTruth[0];  uTruths[nFixed][1] = pGate->uTruth[1];  ptPinDelays[nFixed] = pGate->ptDelays;
+        Mio_DeriveGateDelays( pRoot, ptPinDelays, nFanins, pMan->nVarsMax, SUPER_NO_VAR, tPinDelaysRes, &tPinDelayMax );
+        Mio_DeriveTruthTable( pRoot, uTruths, nFanins, pMan->nVarsMax, uTruth );
+        // skip constant functions, which are rejected by Super_CompareGates
+        if ( pMan->nVarsMax < 6 ? (uTruth[0] == 0 || ~uTruth[0] == 0) : ((uTruth[0] == 0 && uTruth[1] == 0) || (~uTruth[0] == 0 && ~uTruth[1] == 0)) )
+            continue;
+        // save the candidate
+        if ( pItem->nRecs == pItem->nRecsAlloc )
+        {
+            pItem->nRecsAlloc = Abc_MaxInt( 2 * pItem->nRecsAlloc, 256 );
+            pItem->pRecs = ABC_REALLOC( Super_Rec_t, pItem->pRecs, pItem->nRecsAlloc );
+        }
+        pRec = pItem->pRecs + pItem->nRecs++;
+        pRec->iTry      = pItem->nTried;
+        pRec->uTruth[0] = uTruth[0];
+        pRec->uTruth[1] = uTruth[1];
+        pRec->Area      = Area;
+        pRec->tDelayMax = tPinDelayMax;
+        memcpy( pRec->ptDelays, tPinDelaysRes, sizeof(float) * pMan->nVarsMax );
+        memcpy( pRec->pFanins, pSupers, sizeof(Super_Gate_t *) * nFanins );
+    }
+}
+void * Super_ParWorkerThread( void * pArg )
+{
+    Super_ThData_t * pThData = (Super_ThData_t *)pArg;
+    int iItem;
+    while ( 1 )
+    {
+        pthread_mutex_lock( pThData->pMutex );
+        iItem = (*pThData->piNext)++;
+        pthread_mutex_unlock( pThData->pMutex );
+        if ( iItem >= pThData->p->nItems )
+            break;
+        Super_ParComputeItem( pThData->p, pThData->p->pItems + iItem );
+    }
+    return NULL;
+}
+Super_Man_t * Super_ComputePar( Super_Man_t * pMan, Mio_Gate_t ** ppGates, int nGates, int nGatesMax, int fSkipInv )
+{
+    pthread_t WorkerThread[SUPER_PROC_MAX];
+    Super_ThData_t ThData[SUPER_PROC_MAX];
+    pthread_mutex_t Mutex;
+    Super_Par_t Par, * p = &Par;
+    Super_Gate_t * pGateNew;
+    Super_Item_t * pItem;
+    Super_Rec_t * pRec;
+    ProgressBar * pProgress;
+    int i, k, r, iNext, status, nRecsMax, fDone = 0;
+
+    // put the gates from the unique table into the array and sort them by delay (as in Super_Compute)
+    Super_TranferGatesToArray( pMan );
+    if ( pMan->nGates > 10000 )
+    {
+        printf( "Sorting array of %d supergates...\r", pMan->nGates );
+        fflush( stdout );
+    }
+    qsort( (void *)pMan->pGates, (size_t)pMan->nGates, sizeof(Super_Gate_t *), 
+            (int (*)(const void *, const void *)) Super_DelayCompare );
+    if ( pMan->nGates > 10000 )
+    {
+        printf( "                                       \r" );
+    }
+
+    memset( p, 0, sizeof(Super_Par_t) );
+    p->pMan      = pMan;
+    p->ppGates   = ppGates;
+    p->nGates    = nGates;
+    p->fSkipInv  = fSkipInv;
+    p->pppLimits = ABC_CALLOC( Super_Gate_t **, nGates );
+    p->pnLimits  = ABC_CALLOC( int, nGates );
+    p->k         = -1;
+    p->fRootDone = 1;
+    pthread_mutex_init( &Mutex, NULL );
+    for ( i = 0; i < pMan->nProcs; i++ )
+    {
+        ThData[i].p      = p;
+        ThData[i].piNext = &iNext;
+        ThData[i].pMutex = &Mutex;
+    }
+
+    pProgress = Extra_ProgressBarStart( stdout, pMan->TimeLimit );
+    pMan->TimePrint = Abc_Clock() + CLOCKS_PER_SEC;
+    while ( !fDone )
+    {
+        // collect the items, whose candidates fit into the buffer
+        for ( p->nItems = nRecsMax = 0; nRecsMax < SUPER_PAR_RECS; p->nItems++ )
+        {
+            if ( p->nItems == p->nItemsAlloc )
+            {
+                p->nItemsAlloc = Abc_MaxInt( 2 * p->nItemsAlloc, 1024 );
+                p->pItems = ABC_REALLOC( Super_Item_t, p->pItems, p->nItemsAlloc );
+                memset( p->pItems + p->nItems, 0, sizeof(Super_Item_t) * (p->nItemsAlloc - p->nItems) );
+            }
+            if ( !Super_ParNextItem( p, p->pItems + p->nItems ) )
+            {
+                fDone = 1;
+                break;
+            }
+            nRecsMax += p->pnLimits[p->k];
+        }
+        // compute the candidates
+        iNext = 0;
+        for ( i = 0; i < pMan->nProcs; i++ )
+        {
+            status = pthread_create( WorkerThread + i, NULL, Super_ParWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+        }
+        for ( i = 0; i < pMan->nProcs; i++ )
+        {
+            status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+        }
+        // check the candidates in the order of enumeration
+        for ( i = 0; i < p->nItems; i++ )
+        {
+            pItem = p->pItems + i;
+            for ( r = 0; r < pItem->nRecs; r++ )
+            {
+                pRec = pItem->pRecs + r;
+                if ( !Super_CompareGates( pMan, pRec->uTruth, pRec->Area, pRec->ptDelays, pMan->nVarsMax ) )
+                    continue;
+                pGateNew = Super_CreateGateNew( pMan, ppGates[pItem->k], pRec->pFanins, Mio_GateReadPinNum(ppGates[pItem->k]), 
+                    pRec->uTruth, pRec->Area, pRec->ptDelays, pRec->tDelayMax, pMan->nVarsMax );
+                Super_AddGateToTable( pMan, pGateNew );
+                if ( nGatesMax && pMan->nClasses > nGatesMax )
+                {
+                    pMan->nTried += pRec->iTry;
+                    goto done;
+                }
+            }
+            pMan->nTried += pItem->nTried;
+            if ( pItem->fTimeOut )
+            {
+                printf ("Timeout!\n");
+                pMan->fTimeOut = 1;
+                goto done;
+            }
+        }
+        // update the progress bar
+        if ( Abc_Clock() > pMan->TimePrint )
+        {
+            Extra_ProgressBarUpdate( pProgress, ++pMan->TimeSec, NULL );
+            pMan->TimePrint = Abc_Clock() + CLOCKS_PER_SEC;
+        }
+        // free the fanin gates of the root gates, whose items are processed
+        for ( k = 0; k < p->k; k++ )
+            ABC_FREE( p->pppLimits[k] );
+    }
+done:
+    Extra_ProgressBarStop( pProgress );
+    pthread_mutex_destroy( &Mutex );
+    for ( i = 0; i < p->nItemsAlloc; i++ )
+        ABC_FREE( p->pItems[i].pRecs );
+    ABC_FREE( p->pItems );
+    for ( k = 0; k < nGates; k++ )
+        ABC_FREE( p->pppLimits[k] );
+    ABC_FREE( p->pppLimits );
+    ABC_FREE( p->pnLimits );
+    return pMan;
+}
+
+#else
+
+Super_Man_t * Super_ComputePar( Super_Man_t * pMan, Mio_Gate_t ** ppGates, int nGates, int nGatesMax, int fSkipInv )
+{
+    return Super_Compute( pMan, ppGates, nGates, nGatesMax, fSkipInv );
+}
+
+#endif
+
 /**Function*************************************************************
 
   Synopsis    [Transfers gates from table into the array.]
@@ -748,6 +1282,7 @@ int Super_CheckTimeout( ProgressBar * pPro, Super_Man_t * pMan )
     if ( pMan->TimeStop && TimeNow > pMan->TimeStop )
     {
         printf ("Timeout!\n");
+        pMan->fTimeOut = 1;
         return 1;
     }
     pMan->nTried++;
@@ -880,11 +1415,12 @@ int Super_CompareGates( Super_Man_t * pMan, unsigned uTruth[], float Area, float
             pPrev = pGate;
         else if ( fNewIsBetter ) // gate is worse; remove the gate
         {
+            // the gate is not recycled because it may be a fanin of 
+            // the gates computed earlier or of the gates tried later
             if ( pPrev == NULL )
                 *ppList = pGate->pNext;
             else
                 pPrev->pNext = pGate->pNext;
-            Extra_MmFixedEntryRecycle( pMan->pMem, (char *)pGate );
             pMan->nRemoved++;
         }
         else if ( fGateIsBetter ) // new is worse, already dominated no need to see others
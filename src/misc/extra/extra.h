@@ -137,8 +137,8 @@ extern Extra_FileReader_t * Extra_FileReaderAlloc( char * pFileName,
     char * pCharsComment, char * pCharsStop, char * pCharsClean );
 extern void         Extra_FileReaderFree( Extra_FileReader_t * p );
 extern char *       Extra_FileReaderGetFileName( Extra_FileReader_t * p );
-extern int          Extra_FileReaderGetFileSize( Extra_FileReader_t * p );
-extern int          Extra_FileReaderGetCurPosition( Extra_FileReader_t * p );
+extern ABC_INT64_T  Extra_FileReaderGetFileSize( Extra_FileReader_t * p );
+extern ABC_INT64_T  Extra_FileReaderGetCurPosition( Extra_FileReader_t * p );
 extern void *       Extra_FileReaderGetTokens( Extra_FileReader_t * p );
 extern int          Extra_FileReaderGetLineNumber( Extra_FileReader_t * p, int iToken );
 
@@ -239,12 +239,12 @@ extern void        Sdm_ManReadCnfCosts( Sdm_Man_t * p, int * pCosts, int nCosts
 
 typedef struct ProgressBarStruct ProgressBar;
 
-extern ProgressBar * Extra_ProgressBarStart( FILE * pFile, int nItemsTotal );
+extern ProgressBar * Extra_ProgressBarStart( FILE * pFile, ABC_INT64_T nItemsTotal );
 extern void        Extra_ProgressBarStop( ProgressBar * p );
-extern void        Extra_ProgressBarUpdate_int( ProgressBar * p, int nItemsCur, char * pString );
+extern void        Extra_ProgressBarUpdate_int( ProgressBar * p, ABC_INT64_T nItemsCur, char * pString );
 
-static inline void Extra_ProgressBarUpdate( ProgressBar * p, int nItemsCur, char * pString ) 
-{  if ( p && nItemsCur < *((int*)p) ) return; Extra_ProgressBarUpdate_int(p, nItemsCur, pString); }
+static inline void Extra_ProgressBarUpdate( ProgressBar * p, ABC_INT64_T nItemsCur, char * pString ) 
+{  if ( p && nItemsCur < *((ABC_INT64_T*)p) ) return; Extra_ProgressBarUpdate_int(p, nItemsCur, pString); }
 
 /*=== extraUtilTruth.c ================================================================*/
 
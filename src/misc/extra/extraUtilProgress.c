@@ -31,8 +31,8 @@ ABC_NAMESPACE_IMPL_START
 
 struct ProgressBarStruct
 {
-    int              nItemsNext;   // the number of items for the next update of the progress bar
-    int              nItemsTotal;  // the total number of items
+    ABC_INT64_T      nItemsNext;   // the number of items for the next update of the progress bar (should be first)
+    ABC_INT64_T      nItemsTotal;  // the total number of items
     int              posTotal;     // the total number of positions
     int              posCur;       // the current position
     FILE *           pFile;        // the output stream 
@@ -59,7 +59,7 @@ static void Extra_ProgressBarClean( ProgressBar * p );
   SeeAlso     []
 
 ***********************************************************************/
-ProgressBar * Extra_ProgressBarStart( FILE * pFile, int nItemsTotal )
+ProgressBar * Extra_ProgressBarStart( FILE * pFile, ABC_INT64_T nItemsTotal )
 {
     ProgressBar * p;
     if ( !Abc_FrameShowProgress(Abc_FrameGetGlobalFrame()) ) return NULL;
@@ -69,7 +69,7 @@ ProgressBar * Extra_ProgressBarStart( FILE * pFile, int nItemsTotal )
     p->nItemsTotal = nItemsTotal;
     p->posTotal    = 78;
     p->posCur      = 1;
-    p->nItemsNext  = (int)((7.0+p->posCur)*p->nItemsTotal/p->posTotal);
+    p->nItemsNext  = (ABC_INT64_T)((7.0+p->posCur)*p->nItemsTotal/p->posTotal);
     Extra_ProgressBarShow( p, NULL );
     return p;
 }
@@ -85,7 +85,7 @@ ProgressBar * Extra_ProgressBarStart( FILE * pFile, int nItemsTotal )
   SeeAlso     []
 
 ***********************************************************************/
-void Extra_ProgressBarUpdate_int( ProgressBar * p, int nItemsCur, char * pString )
+void Extra_ProgressBarUpdate_int( ProgressBar * p, ABC_INT64_T nItemsCur, char * pString )
 {
     if ( p == NULL ) return;
     if ( nItemsCur < p->nItemsNext )
@@ -93,12 +93,12 @@ void Extra_ProgressBarUpdate_int( ProgressBar * p, int nItemsCur, char * pString
     if ( nItemsCur >= p->nItemsTotal )
     {
         p->posCur = 78;
-        p->nItemsNext = 0x7FFFFFFF;
+        p->nItemsNext = (ABC_INT64_T)ABC_CONST(0x7FFFFFFFFFFFFFFF);
     }
     else
     {
         p->posCur += 7;
-        p->nItemsNext = (int)((7.0+p->posCur)*p->nItemsTotal/p->posTotal);
+        p->nItemsNext = (ABC_INT64_T)((7.0+p->posCur)*p->nItemsTotal/p->posTotal);
     }
     Extra_ProgressBarShow( p, pString );
 }
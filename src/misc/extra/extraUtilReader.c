@@ -42,8 +42,8 @@ struct Extra_FileReader_t_
     // the input file
     char *           pFileName;     // the input file name
     FILE *           pFile;         // the input file pointer
-    int              nFileSize;     // the total number of bytes in the file
-    int              nFileRead;     // the number of bytes currently read from file
+    ABC_INT64_T      nFileSize;     // the total number of bytes in the file
+    ABC_INT64_T      nFileRead;     // the number of bytes currently read from file
     // info about processing different types of input chars
     char             pCharMap[256]; // the character map
     // temporary storage for data 
@@ -124,7 +124,7 @@ Extra_FileReader_t * Extra_FileReaderAlloc( char * pFileName,
     p->nBufferSize = EXTRA_BUFFER_SIZE;
     p->pBufferCur  = p->pBuffer;
     // determine how many chars to read
-    nCharsToRead = EXTRA_MINIMUM(p->nFileSize, EXTRA_BUFFER_SIZE);
+    nCharsToRead = (int)EXTRA_MINIMUM(p->nFileSize, EXTRA_BUFFER_SIZE);
     // load the first part into the buffer
     RetValue = fread( p->pBuffer, nCharsToRead, 1, p->pFile );
     p->nFileRead = nCharsToRead;
@@ -186,7 +186,7 @@ char * Extra_FileReaderGetFileName( Extra_FileReader_t * p )
   SeeAlso     []
 
 ***********************************************************************/
-int Extra_FileReaderGetFileSize( Extra_FileReader_t * p )
+ABC_INT64_T Extra_FileReaderGetFileSize( Extra_FileReader_t * p )
 {
     return p->nFileSize;
 }
@@ -202,7 +202,7 @@ int Extra_FileReaderGetFileSize( Extra_FileReader_t * p )
   SeeAlso     []
 
 ***********************************************************************/
-int Extra_FileReaderGetCurPosition( Extra_FileReader_t * p )
+ABC_INT64_T Extra_FileReaderGetCurPosition( Extra_FileReader_t * p )
 {
     return p->nFileRead - (p->pBufferEnd - p->pBufferCur);
 }
@@ -375,7 +375,7 @@ void Extra_FileReaderReload( Extra_FileReader_t * p )
     memmove( p->pBuffer, p->pBufferCur, (size_t)nCharsUsed );
     p->pBufferCur = p->pBuffer;
     // determine how many chars we will read
-    nCharsToRead = EXTRA_MINIMUM( p->nBufferSize - nCharsUsed, p->nFileSize - p->nFileRead );
+    nCharsToRead = (int)EXTRA_MINIMUM( p->nBufferSize - nCharsUsed, p->nFileSize - p->nFileRead );
     // read the chars
     RetValue = fread( p->pBuffer + nCharsUsed, nCharsToRead, 1, p->pFile );
     p->nFileRead += nCharsToRead;
@@ -55,6 +55,8 @@ void Tim_ManCreateBox( Tim_Man_t * p, int firstIn, int nIns, int firstOut, int n
     pBox->nInputs  = nIns;
     pBox->nOutputs = nOuts;
     pBox->fBlack = fBlack;
+    pBox->fArrDirty = 1;
+    pBox->fReqDirty = 1;
     for ( i = 0; i < nIns; i++ )
     {
         assert( firstIn+i < p->nCos );
@@ -244,6 +246,91 @@ float * Tim_ManBoxDelayTable( Tim_Man_t * p, int iBox )
     return pTable;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns the sparse copy of the delay table of the box.]
+
+  Description [The delay tables are copied into one contiguous array,
+  which is built on demand and rebuilt when tables are added. Each table
+  starts with the number of inputs and the number of outputs, followed,
+  for each output, by the number of finite delays and the (input, delay)
+  pairs. Delays are stored as floats cast to integers. The copy is
+  smaller than the tables when many arcs are missing, and up to twice
+  larger when none are. Boxes without delay tables return NULL.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Tim_ManDelayTablesSparse( Tim_Man_t * p )
+{
+    float * pTable;
+    int i, k, j, nIns, nOuts, iCount;
+    Vec_IntFreeP( &p->vTableData );
+    Vec_IntFreeP( &p->vTableStarts );
+    p->vTableData   = Vec_IntAlloc( 1000 );
+    p->vTableStarts = Vec_IntStartFull( Vec_PtrSize(p->vDelayTables) );
+    Tim_ManForEachTable( p, pTable, i )
+    {
+        if ( pTable == NULL )
+            continue;
+        nIns  = (int)pTable[1];
+        nOuts = (int)pTable[2];
+        Vec_IntWriteEntry( p->vTableStarts, i, Vec_IntSize(p->vTableData) );
+        Vec_IntPush( p->vTableData, nIns );
+        Vec_IntPush( p->vTableData, nOuts );
+        for ( k = 0; k < nOuts; k++ )
+        {
+            iCount = Vec_IntSize(p->vTableData);
+            Vec_IntPush( p->vTableData, 0 );
+            for ( j = 0; j < nIns; j++ )
+                if ( pTable[3 + k * nIns + j] != -ABC_INFINITY )
+                {
+                    Vec_IntPush( p->vTableData, j );
+                    Vec_IntPush( p->vTableData, Abc_Float2Int(pTable[3 + k * nIns + j]) );
+                    Vec_IntAddToEntry( p->vTableData, iCount, 1 );
+                }
+        }
+    }
+}
+int * Tim_ManBoxDelayTableSparse( Tim_Man_t * p, Tim_Box_t * pBox )
+{
+    int * pData;
+    if ( pBox->iDelayTable < 0 || p->vDelayTables == NULL )
+        return NULL;
+    if ( p->vTableStarts == NULL || Vec_IntSize(p->vTableStarts) != Vec_PtrSize(p->vDelayTables) )
+        Tim_ManDelayTablesSparse( p );
+    if ( Vec_IntEntry(p->vTableStarts, pBox->iDelayTable) < 0 )
+        return NULL;
+    pData = Vec_IntEntryP( p->vTableData, Vec_IntEntry(p->vTableStarts, pBox->iDelayTable) );
+    assert( pData[0] == pBox->nInputs );
+    assert( pData[1] == pBox->nOutputs );
+    return pData;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Invalidates the sparse tables and the cached box timing.]
+
+  Description [Should be called when the delay tables are replaced.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Tim_ManDelayTablesInvalidate( Tim_Man_t * p )
+{
+    Tim_Box_t * pBox;
+    int i;
+    Vec_IntFreeP( &p->vTableData );
+    Vec_IntFreeP( &p->vTableStarts );
+    if ( p->vBoxes )
+    Tim_ManForEachBox( p, pBox, i )
+        pBox->fArrDirty = pBox->fReqDirty = 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Return 1 if the box is black.]
@@ -60,6 +60,9 @@ struct Tim_Man_t_
     int              nCos;           // the number of POs
     Tim_Obj_t *      pCis;           // timing info for the PIs
     Tim_Obj_t *      pCos;           // timing info for the POs
+    Vec_Int_t *      vTableData;     // sparse copy of the delay tables
+    Vec_Int_t *      vTableStarts;   // offset of each delay table in vTableData
+    int              nBoxUpdates;    // the number of times the box timing was computed
 };
 
 // timing box
@@ -72,6 +75,8 @@ struct Tim_Box_t_
     int              iDelayTable;    // index of the delay table
     int              iCopy;          // copy of this box
     int              fBlack;         // this is black box
+    int              fArrDirty;      // arrival times of box inputs have changed
+    int              fReqDirty;      // required times of box outputs have changed
     int              Inouts[0];      // the int numbers of PIs and POs
 };
 
@@ -133,7 +138,9 @@ static inline Tim_Obj_t * Tim_ManBoxOutput( Tim_Man_t * p, Tim_Box_t * pBox, int
 ///                    FUNCTION DECLARATIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
-/*=== time.c ===========================================================*/
+/*=== timBox.c ========================================================*/
+extern int *             Tim_ManBoxDelayTableSparse( Tim_Man_t * p, Tim_Box_t * pBox );
+extern void              Tim_ManDelayTablesInvalidate( Tim_Man_t * p );
 
 
 ABC_NAMESPACE_HEADER_END
@@ -378,6 +378,8 @@ Vec_Int_t * Tim_ManAlignTwo( Tim_Man_t * pSpec, Tim_Man_t * pImpl )
 void Tim_ManStop( Tim_Man_t * p )
 {
     Vec_PtrFreeFree( p->vDelayTables );
+    Vec_IntFreeP( &p->vTableData );
+    Vec_IntFreeP( &p->vTableStarts );
     Vec_PtrFreeP( &p->vBoxes );
     Mem_FlexStop( p->pMemObj, 0 );
     ABC_FREE( p->pCis );
@@ -448,6 +450,7 @@ void Tim_ManCreate( Tim_Man_t * p, void * pLib, Vec_Flt_t * vInArrs, Vec_Flt_t *
         // save table
         Vec_PtrWriteEntry( p->vDelayTables, pBox->iDelayTable, pTable );
     }
+    Tim_ManDelayTablesInvalidate( p );
     // create arrival times
     if ( vInArrs )
     {
@@ -764,6 +767,7 @@ void Tim_ManSetDelayTables( Tim_Man_t * p, Vec_Ptr_t * vDelayTables )
 {
     assert( p->vDelayTables == NULL );
     p->vDelayTables = vDelayTables;
+    Tim_ManDelayTablesInvalidate( p );
 }
 
 /**Function*************************************************************
@@ -26,6 +26,10 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// marking the boxes whose timing should be recomputed
+static inline void Tim_ManObjSetBoxArrDirty( Tim_Man_t * p, Tim_Obj_t * pObj ) { if ( pObj->iObj2Box >= 0 ) Tim_ManBox(p, pObj->iObj2Box)->fArrDirty = 1; }
+static inline void Tim_ManObjSetBoxReqDirty( Tim_Man_t * p, Tim_Obj_t * pObj ) { if ( pObj->iObj2Box >= 0 ) Tim_ManBox(p, pObj->iObj2Box)->fReqDirty = 1; }
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -45,6 +49,7 @@ void Tim_ManInitPiArrival( Tim_Man_t * p, int iPi, float Delay )
 {
     assert( iPi < p->nCis );
     p->pCis[iPi].timeArr = Delay;
+    Tim_ManObjSetBoxArrDirty( p, p->pCis + iPi );
 }
 
 /**Function*************************************************************
@@ -62,6 +67,7 @@ void Tim_ManInitPoRequired( Tim_Man_t * p, int iPo, float Delay )
 {
     assert( iPo < p->nCos );
     p->pCos[iPo].timeReq = Delay;
+    Tim_ManObjSetBoxReqDirty( p, p->pCos + iPo );
 }
 
 /**Function*************************************************************
@@ -117,6 +123,8 @@ void Tim_ManSetCoArrival( Tim_Man_t * p, int iCo, float Delay )
 {
     assert( iCo < p->nCos );
     assert( !p->fUseTravId || p->pCos[iCo].TravId != p->nTravIds );
+    if ( p->pCos[iCo].timeArr != Delay )
+        Tim_ManObjSetBoxArrDirty( p, p->pCos + iCo );
     p->pCos[iCo].timeArr = Delay;
     p->pCos[iCo].TravId = p->nTravIds;
 }
@@ -136,6 +144,8 @@ void Tim_ManSetCiRequired( Tim_Man_t * p, int iCi, float Delay )
 {
     assert( iCi < p->nCis );
     assert( !p->fUseTravId || p->pCis[iCi].TravId != p->nTravIds );
+    if ( p->pCis[iCi].timeReq != Delay )
+        Tim_ManObjSetBoxReqDirty( p, p->pCis + iCi );
     p->pCis[iCi].timeReq = Delay;
     p->pCis[iCi].TravId = p->nTravIds;
 }
@@ -157,14 +167,16 @@ void Tim_ManSetCoRequired( Tim_Man_t * p, int iCo, float Delay )
     assert( !p->fUseTravId || !p->nTravIds || p->pCos[iCo].TravId != p->nTravIds );
     p->pCos[iCo].timeReq = Delay;
     p->pCos[iCo].TravId = p->nTravIds;
+    Tim_ManObjSetBoxReqDirty( p, p->pCos + iCo );
 }
 
 
 /**Function*************************************************************
 
-  Synopsis    [Returns CO arrival time.]
+  Synopsis    [Returns CI arrival time.]
 
-  Description []
+  Description [The box outputs are recomputed only if the arrival times
+  of the box inputs have changed since the last computation.]
                
   SideEffects []
 
@@ -175,8 +187,8 @@ float Tim_ManGetCiArrival( Tim_Man_t * p, int iCi )
 {
     Tim_Box_t * pBox;
     Tim_Obj_t * pObjThis, * pObj, * pObjRes;
-    float * pTable, * pDelays, DelayBest;
-    int i, k;
+    float DelayBest;
+    int * pData, i, k, nEntries;
     // consider the already processed PI
     pObjThis = Tim_ManCi( p, iCi );
     if ( p->fUseTravId && pObjThis->TravId == p->nTravIds )
@@ -193,15 +205,28 @@ float Tim_ManGetCiArrival( Tim_Man_t * p, int iCi )
     Tim_ManBoxForEachInput( p, pBox, pObj, i )
         if ( pObj->TravId != p->nTravIds )
             printf( "Tim_ManGetCiArrival(): Input arrival times of the box are not up to date!\n" );
+    // the box outputs (PIs) are up to date if the box inputs did not change
+    if ( !pBox->fArrDirty )
+    {
+        Tim_ManBoxForEachOutput( p, pBox, pObjRes, i )
+            pObjRes->TravId = p->nTravIds;
+        return pObjThis->timeArr;
+    }
+    pBox->fArrDirty = 0;
+    p->nBoxUpdates++;
     // compute the arrival times for each output of the box (PIs)
-    pTable = Tim_ManBoxDelayTable( p, pBox->iBox );
+    pData = Tim_ManBoxDelayTableSparse( p, pBox );
+    assert( pData != NULL );
+    pData += 2;
     Tim_ManBoxForEachOutput( p, pBox, pObjRes, i )
     {
-        pDelays = pTable + 3 + i * pBox->nInputs;
         DelayBest = -TIM_ETERNITY;
-        Tim_ManBoxForEachInput( p, pBox, pObj, k )
-            if ( pDelays[k] != -ABC_INFINITY )
-                DelayBest = Abc_MaxInt( DelayBest, pObj->timeArr + pDelays[k] );
+        nEntries = *pData++;
+        for ( k = 0; k < nEntries; k++, pData += 2 )
+        {
+            pObj = Tim_ManBoxInput( p, pBox, pData[0] );
+            DelayBest = Abc_MaxInt( DelayBest, pObj->timeArr + Abc_Int2Float(pData[1]) );
+        }
         pObjRes->timeArr = DelayBest;
         pObjRes->TravId = p->nTravIds;
     }
@@ -212,7 +237,8 @@ float Tim_ManGetCiArrival( Tim_Man_t * p, int iCi )
 
   Synopsis    [Returns CO required time.]
 
-  Description []
+  Description [The box inputs are recomputed only if the required times
+  of the box outputs have changed since the last computation.]
                
   SideEffects []
 
@@ -223,8 +249,7 @@ float Tim_ManGetCoRequired( Tim_Man_t * p, int iCo )
 {
     Tim_Box_t * pBox;
     Tim_Obj_t * pObjThis, * pObj, * pObjRes;
-    float * pTable, * pDelays, DelayBest;
-    int i, k;
+    int * pData, i, k, nEntries;
     // consider the already processed PO
     pObjThis = Tim_ManCo( p, iCo );
     if ( p->fUseTravId && pObjThis->TravId == p->nTravIds )
@@ -241,19 +266,33 @@ float Tim_ManGetCoRequired( Tim_Man_t * p, int iCo )
     Tim_ManBoxForEachOutput( p, pBox, pObj, i )
         if ( pObj->TravId != p->nTravIds )
             printf( "Tim_ManGetCoRequired(): Output required times of output %d the box %d are not up to date!\n", i, pBox->iBox );
+    // the box inputs (POs) are up to date if the box outputs did not change
+    if ( !pBox->fReqDirty )
+    {
+        Tim_ManBoxForEachInput( p, pBox, pObjRes, i )
+            pObjRes->TravId = p->nTravIds;
+        return pObjThis->timeReq;
+    }
+    pBox->fReqDirty = 0;
+    p->nBoxUpdates++;
     // compute the required times for each input of the box (POs)
-    pTable = Tim_ManBoxDelayTable( p, pBox->iBox );
+    // by going through the delays of each output of the box (PIs)
+    pData = Tim_ManBoxDelayTableSparse( p, pBox );
+    assert( pData != NULL );
+    pData += 2;
     Tim_ManBoxForEachInput( p, pBox, pObjRes, i )
     {
-        DelayBest = TIM_ETERNITY;
-        Tim_ManBoxForEachOutput( p, pBox, pObj, k )
+        pObjRes->timeReq = TIM_ETERNITY;
+        pObjRes->TravId = p->nTravIds;
+    }
+    Tim_ManBoxForEachOutput( p, pBox, pObj, i )
+    {
+        nEntries = *pData++;
+        for ( k = 0; k < nEntries; k++, pData += 2 )
         {
-            pDelays = pTable + 3 + k * pBox->nInputs;
-            if ( pDelays[k] != -ABC_INFINITY )
-                DelayBest = Abc_MinFloat( DelayBest, pObj->timeReq - pDelays[i] );
+            pObjRes = Tim_ManBoxInput( p, pBox, pData[0] );
+            pObjRes->timeReq = Abc_MinFloat( pObjRes->timeReq, pObj->timeReq - Abc_Int2Float(pData[1]) );
         }
-        pObjRes->timeReq = DelayBest;
-        pObjRes->TravId = p->nTravIds;
     }
     return pObjThis->timeReq;
 }
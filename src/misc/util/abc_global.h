@@ -391,6 +391,23 @@ extern int Gia_ManToBridgeAbsNetlist( FILE * pFile, void * p, int pkg_type );
 extern char * vnsprintf(const char* format, va_list args);
 extern char * nsprintf(const char* format, ...);
 
+// read-only file mapping
+extern void * Abc_FileMap( char * pFileName, size_t * pnSize );
+extern void   Abc_FileUnmap( void * pData, size_t nSize );
+
+// on-disk cache of derived data
+extern void * Abc_CacheMap( char * pExt, int Kind, int Version, word Key, size_t * pnSize );
+extern void   Abc_CacheUnmap( void * pData, size_t nSize );
+extern int    Abc_CacheWrite( char * pExt, int Kind, int Version, word Key, void * pData, size_t nSize );
+extern unsigned Abc_CacheHashData( void * pData, size_t nSize );
+static inline word Abc_CacheHashWord( word Hash, word w )
+{
+    Hash = (Hash ^ w) * ABC_CONST(0xBF58476D1CE4E5B9);
+    Hash ^= Hash >> 33;
+    Hash *= ABC_CONST(0x94D049BB133111EB);
+    return Hash ^ (Hash >> 31);
+}
+
 static inline void Abc_Print( int level, const char * format, ... )
 {
     extern ABC_DLL int Abc_FrameIsBridgeMode();
@@ -86,7 +86,7 @@ Abc_Cex_t * Abc_CexMakeTriv( int nRegs, int nTruePis, int nTruePos, int iFrameOu
 {
     Abc_Cex_t * pCex;
     int iPo, iFrame;
-    assert( nRegs > 0 );
+    assert( nRegs >= 0 );
     iPo    = iFrameOut % nTruePos;
     iFrame = iFrameOut / nTruePos;
     // allocate the counter example
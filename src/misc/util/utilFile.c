@@ -48,6 +48,7 @@
 #include <io.h>
 #else
 #include <unistd.h>
+#include <sys/mman.h>
 #endif
 
 #include "abc_global.h"
@@ -240,6 +241,171 @@ char* nsprintf(const char* format, ...)
     return ret;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Maps the file into memory for reading.]
+
+  Description [Returns the read-only contents of the file and its size,
+  or NULL if the file cannot be opened or is empty. On platforms without
+  mmap(), the contents are read into an allocated buffer instead. The
+  result should be released by Abc_FileUnmap().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Abc_FileMap( char * pFileName, size_t * pnSize )
+{
+#if defined(_MSC_VER) || defined(__MINGW32__)
+    int nFileSize = 0;
+    void * pData = Abc_FileReadContents( pFileName, &nFileSize );
+    if ( pData && nFileSize == 0 )
+        ABC_FREE( pData );
+    *pnSize = pData ? (size_t)nFileSize : 0;
+    return pData;
+#else
+    struct stat Stat;
+    void * pData;
+    int fd = open( pFileName, O_RDONLY );
+    *pnSize = 0;
+    if ( fd < 0 )
+        return NULL;
+    if ( fstat( fd, &Stat ) != 0 || Stat.st_size <= 0 )
+    {
+        close( fd );
+        return NULL;
+    }
+    pData = mmap( NULL, (size_t)Stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    if ( pData == MAP_FAILED )
+        return NULL;
+    *pnSize = (size_t)Stat.st_size;
+    return pData;
+#endif
+}
+void Abc_FileUnmap( void * pData, size_t nSize )
+{
+    if ( pData == NULL )
+        return;
+#if defined(_MSC_VER) || defined(__MINGW32__)
+    ABC_FREE( pData );
+#else
+    munmap( pData, nSize );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [On-disk cache of derived data.]
+
+  Description [The cache is enabled by "set cachedir <dir>", where <dir>
+  is an existing directory. Each entry is one file named by the 64-bit key
+  and the extension given by the client. The file starts with a 32-byte
+  header (the signature, the kind and the version of the data given by
+  the client, the hash of the payload, the key, and the size of the
+  payload), so that the payload is aligned when the file is mapped.
+  The file is written under a temporary name and renamed, so that
+  concurrent runs never see an incomplete file. An entry whose payload
+  does not match the hash (for example, because the file was damaged
+  or partly overwritten) is not returned. The key only locates the
+  entry: the clients store enough data in the payload to check that
+  it matches their input.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define ABC_CACHE_MAGIC   0x43434241   // "ABCC"
+#define ABC_CACHE_HEADER  32           // the number of bytes in the file header
+
+static char * Abc_CacheFileName( char * pExt, word Key )
+{
+    extern ABC_DLL char * Abc_FrameReadFlag( char * pFlag );
+    char * pDir = Abc_FrameReadFlag( (char *)"cachedir" ), * pFileName;
+    if ( pDir == NULL || pDir[0] == 0 )
+        return NULL;
+    pFileName = ABC_ALLOC( char, strlen(pDir) + strlen(pExt) + 64 );
+    sprintf( pFileName, "%s/%016llx.%s", pDir, (unsigned long long)Key, pExt );
+    return pFileName;
+}
+unsigned Abc_CacheHashData( void * pData, size_t nSize )
+{
+    unsigned char * pBytes = (unsigned char *)pData;
+    word Hash = (word)nSize, w;
+    size_t i;
+    for ( i = 0; i + 8 <= nSize; i += 8 )
+    {
+        memcpy( &w, pBytes + i, 8 );
+        Hash = Abc_CacheHashWord( Hash, w );
+    }
+    for ( w = 0; i < nSize; i++ )
+        w = (w << 8) | pBytes[i];
+    return (unsigned)(Abc_CacheHashWord( Hash, w ) >> 32);
+}
+void * Abc_CacheMap( char * pExt, int Kind, int Version, word Key, size_t * pnSize )
+{
+    char * pFileName = Abc_CacheFileName( pExt, Key );
+    int * pData;
+    size_t nSize;
+    *pnSize = 0;
+    if ( pFileName == NULL )
+        return NULL;
+    pData = (int *)Abc_FileMap( pFileName, &nSize );
+    ABC_FREE( pFileName );
+    if ( pData == NULL )
+        return NULL;
+    if ( nSize < ABC_CACHE_HEADER || pData[0] != ABC_CACHE_MAGIC || pData[1] != Kind || pData[2] != Version ||
+         ((word *)pData)[2] != Key || ((word *)pData)[3] != (word)(nSize - ABC_CACHE_HEADER) ||
+         (unsigned)pData[3] != Abc_CacheHashData((char *)pData + ABC_CACHE_HEADER, nSize - ABC_CACHE_HEADER) )
+    {
+        Abc_FileUnmap( pData, nSize );
+        return NULL;
+    }
+    *pnSize = nSize - ABC_CACHE_HEADER;
+    return (char *)pData + ABC_CACHE_HEADER;
+}
+void Abc_CacheUnmap( void * pData, size_t nSize )
+{
+    if ( pData )
+        Abc_FileUnmap( (char *)pData - ABC_CACHE_HEADER, nSize + ABC_CACHE_HEADER );
+}
+int Abc_CacheWrite( char * pExt, int Kind, int Version, word Key, void * pData, size_t nSize )
+{
+    char * pFileName = Abc_CacheFileName( pExt, Key ), * pTempName;
+    word Header[4];
+    FILE * pFile;
+    int RetValue;
+    if ( pFileName == NULL )
+        return 0;
+    ((int *)Header)[0] = ABC_CACHE_MAGIC;
+    ((int *)Header)[1] = Kind;
+    ((int *)Header)[2] = Version;
+    ((int *)Header)[3] = (int)Abc_CacheHashData( pData, nSize );
+    Header[2] = Key;
+    Header[3] = (word)nSize;
+    pTempName = ABC_ALLOC( char, strlen(pFileName) + 64 );
+#if defined(_MSC_VER) || defined(__MINGW32__)
+    sprintf( pTempName, "%s.%d.%llx.tmp", pFileName, _getpid(), (unsigned long long)((ABC_PTRUINT_T)pData ^ (ABC_PTRUINT_T)Abc_Clock()) );
+#else
+    sprintf( pTempName, "%s.%d.%llx.tmp", pFileName, (int)getpid(), (unsigned long long)((ABC_PTRUINT_T)pData ^ (ABC_PTRUINT_T)Abc_Clock()) );
+#endif
+    pFile = fopen( pTempName, "wb" );
+    RetValue = pFile != NULL;
+    if ( pFile )
+    {
+        RetValue &= fwrite( Header, 1, ABC_CACHE_HEADER, pFile ) == ABC_CACHE_HEADER;
+        RetValue &= fwrite( pData, 1, nSize, pFile ) == nSize;
+        RetValue &= fclose( pFile ) == 0;
+        if ( !RetValue || rename( pTempName, pFileName ) )
+            remove( pTempName ), RetValue = 0;
+    }
+    ABC_FREE( pTempName );
+    ABC_FREE( pFileName );
+    return RetValue;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
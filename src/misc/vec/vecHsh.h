@@ -169,11 +169,11 @@ static inline int Hsh_Int1ManHash( int Data, int nTableSize )
 }
 static inline int * Hsh_Int1ManLookupInt( Hsh_Int1Man_t * p, int Data )
 {
-    int Item, * pPlace = Vec_IntEntryP( p->vTable, Hsh_Int1ManHash(Data, Vec_IntSize(p->vTable)) );
-    for ( Item = *pPlace; Item >= 0; Item = Vec_IntEntry(p->vNext, Item) )
-        if ( Vec_IntEntry(p->vData, Item) == (int)Data )
+    int * pPlace = Vec_IntEntryP( p->vTable, Hsh_Int1ManHash(Data, Vec_IntSize(p->vTable)) );
+    for ( ; *pPlace >= 0; pPlace = Vec_IntEntryP(p->vNext, *pPlace) )
+        if ( Vec_IntEntry(p->vData, *pPlace) == (int)Data )
             return pPlace;
-    assert( Item == -1 );
+    assert( *pPlace == -1 );
     return pPlace;
 }
 static inline int Hsh_Int1ManLookup( Hsh_Int1Man_t * p, int Data )
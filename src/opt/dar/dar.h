@@ -52,6 +52,7 @@ struct Dar_RwrPar_t_
     int              fUseZeros;      // performs zero-cost replacement
     int              fPower;         // enables power-aware rewriting
     int              fRecycle;       // enables cut recycling
+    int              fCheckLevels;   // verifies incremental levels after each move
     int              fVerbose;       // enables verbose output
     int              fVeryVerbose;   // enables very verbose output
 };
@@ -59,6 +59,7 @@ void Dar_ManDefaultRwrParams( Dar_RwrPar_t * pPars )
     pPars->fUseZeros    =  0;
     pPars->fPower       =  0;
     pPars->fRecycle     =  1;
+    pPars->fCheckLevels =  0;
     pPars->fVerbose     =  0;
     pPars->fVeryVerbose =  0;
 }
@@ -85,7 +86,7 @@ int Dar_ManRewrite( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
     Aig_Obj_t * pObj, * pObjNew;
     int i, k, nNodesOld, nNodeBefore, nNodeAfter, Required;
     abctime clk = 0, clkStart;
-    int Counter = 0;
+    int Counter = 0, nLevelChecks = 0, nLevelErrors = 0;
     int nMffcSize;//, nMffcGains[MAX_VAL+1][MAX_VAL+1] = {{0}};
     if ( pPars->fUseZeros )
         pPars->nMinSaved = 0;
@@ -164,6 +165,8 @@ p->timeCuts += Abc_Clock() - clk;
             Dar_ObjSetCuts( pObj, NULL );
             // replace the node
             Aig_ObjReplace( pAig, pObj, pObjNew, p->pPars->fUpdateLevel );
+            if ( p->pPars->fCheckLevels && p->pPars->fUpdateLevel )
+                nLevelChecks++, nLevelErrors += Aig_ManVerifyLevel( pAig ) + Aig_ManVerifyReverseLevel( pAig );
             continue;
         }
 
@@ -196,6 +199,8 @@ p->timeCuts += Abc_Clock() - clk;
         assert( (int)Aig_Regular(pObjNew)->Level <= Required );
         // replace the node
         Aig_ObjReplace( pAig, pObj, pObjNew, p->pPars->fUpdateLevel );
+        if ( p->pPars->fCheckLevels && p->pPars->fUpdateLevel )
+            nLevelChecks++, nLevelErrors += Aig_ManVerifyLevel( pAig ) + Aig_ManVerifyReverseLevel( pAig );
         // compare the gains
         nNodeAfter = Aig_ManNodeNum( pAig );
         assert( p->GainBest <= nNodeBefore - nNodeAfter );
@@ -227,6 +232,8 @@ p->timeOther = p->timeTotal - p->timeCuts - p->timeEval;
 //    Aig_ManVerifyLevel( pAig );
     if ( p->pPars->fFanout )
         Aig_ManFanoutStop( pAig );
+    if ( p->pPars->fCheckLevels && p->pPars->fUpdateLevel )
+        printf( "Level check: Verified %d replacements. Found %d incorrect levels.\n", nLevelChecks, nLevelErrors );
     if ( p->pPars->fUpdateLevel )
     {
 //        Aig_ManVerifyReverseLevel( pAig );
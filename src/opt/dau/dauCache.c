@@ -0,0 +1,462 @@
+/**CFile****************************************************************
+
+  FileName    [dauCache.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [DAG-aware unmapping.]
+
+  Synopsis    [Process-wide cache of semi-canonical forms.]
+
+  Author      [LSV-PA contributors]
+  
+  Affiliation []
+
+  Date        [Ver. 1.0.]
+
+  Revision    [$Id: dauCache.c $]
+
+***********************************************************************/
+
+#include "dauInt.h"
+#include "misc/util/utilTruth.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#ifdef __cplusplus
+#include <atomic>
+using namespace std;
+#else
+#include <stdatomic.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+/*
+    The cache remembers the result of Abc_TtCanonicize() for functions
+    of 6 to 12 variables. There is one direct-mapped table for each number
+    of variables, which is allocated on the first lookup of that size and
+    never grows beyond DAU_CACHE_MEMORY bytes. An entry is composed of the
+    info word (valid bit, canonical phase, and canonical permutation with
+    4 bits per variable), the original truth table, and the canonical truth
+    table. Entries are protected by striped locks, so the cache can be used
+    by several threads. The statistics are kept for each stripe and updated
+    under its lock.
+
+    The cache is loaded on first use and saved on exit if the cache
+    directory is set by "set cachedir <dir>" (see Abc_CacheMap()). The key
+    of the entry is fixed. The payload is an array of 64-bit words with
+    the tables: the number of variables, the number of entries, followed
+    by the entries.
+*/
+
+#define DAU_CACHE_MAGIC    0x4E504E43  // "NPNC"
+#define DAU_CACHE_VERSION  2
+#define DAU_CACHE_VAR_MIN  6
+#define DAU_CACHE_VAR_MAX  12
+#define DAU_CACHE_MEMORY   (1 << 24)
+#define DAU_CACHE_LOCKS    64
+
+#define DAU_CACHE_VALID    ((word)1 << 63)
+
+typedef struct Dau_Cache_t_ Dau_Cache_t;
+struct Dau_Cache_t_
+{
+    int              nVars;          // the number of variables
+    int              nWords;         // the number of words in the truth table
+    int              nEntryWords;    // the number of words in the entry
+    int              nBins;          // the number of entries (power of 2)
+    word *           pData;          // the entries
+    word             nHits[DAU_CACHE_LOCKS];    // statistics of each stripe
+    word             nMisses[DAU_CACHE_LOCKS];
+    word             nInserts[DAU_CACHE_LOCKS];
+};
+
+static int           s_fDauCacheLoaded = 0;
+
+#ifdef ABC_USE_PTHREADS
+// the tables are published after they are filled
+static atomic_uintptr_t s_pDauCaches[DAU_CACHE_VAR_MAX+1];
+static inline Dau_Cache_t * Dau_CacheTable( int nVars )                 { return (Dau_Cache_t *)atomic_load_explicit( &s_pDauCaches[nVars], memory_order_acquire );   }
+static inline void          Dau_CacheSetTable( int nVars, Dau_Cache_t * p ) { atomic_store_explicit( &s_pDauCaches[nVars], (ABC_PTRUINT_T)p, memory_order_release ); }
+static pthread_once_t  s_DauCacheOnce = PTHREAD_ONCE_INIT;
+static pthread_mutex_t s_DauCacheStartLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t s_DauCacheLocks[DAU_CACHE_LOCKS];
+static inline void Dau_CacheLock( int iBin )   { pthread_mutex_lock( s_DauCacheLocks + (iBin & (DAU_CACHE_LOCKS-1)) );   }
+static inline void Dau_CacheUnlock( int iBin ) { pthread_mutex_unlock( s_DauCacheLocks + (iBin & (DAU_CACHE_LOCKS-1)) ); }
+#else
+static Dau_Cache_t * s_pDauCaches[DAU_CACHE_VAR_MAX+1] = { NULL };
+static inline Dau_Cache_t * Dau_CacheTable( int nVars )                 { return s_pDauCaches[nVars]; }
+static inline void          Dau_CacheSetTable( int nVars, Dau_Cache_t * p ) { s_pDauCaches[nVars] = p;    }
+static inline void Dau_CacheLock( int iBin )   {}
+static inline void Dau_CacheUnlock( int iBin ) {}
+#endif
+
+static inline word * Dau_CacheEntry( Dau_Cache_t * p, int iBin ) { return p->pData + (size_t)iBin * p->nEntryWords; }
+static inline int    Dau_CacheStripe( int iBin )                 { return iBin & (DAU_CACHE_LOCKS-1);                   }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Packs and unpacks the canonical transform.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline word Dau_CacheInfoPack( int nVars, unsigned uPhase, char * pPerm )
+{
+    word Info = DAU_CACHE_VALID | (word)uPhase;
+    int i;
+    assert( uPhase < (1u << (DAU_CACHE_VAR_MAX+1)) );
+    for ( i = 0; i < nVars; i++ )
+        Info |= (word)(pPerm[i] & 15) << (DAU_CACHE_VAR_MAX + 1 + 4 * i);
+    return Info;
+}
+static inline unsigned Dau_CacheInfoUnpack( int nVars, word Info, char * pPerm )
+{
+    int i;
+    for ( i = 0; i < nVars; i++ )
+        pPerm[i] = (char)((Info >> (DAU_CACHE_VAR_MAX + 1 + 4 * i)) & 15);
+    return (unsigned)(Info & ((1 << (DAU_CACHE_VAR_MAX+1)) - 1));
+}
+// returns 1 if the phase and the permutation are well-formed
+static inline int Dau_CacheInfoCheck( int nVars, word Info )
+{
+    char pPerm[DAU_CACHE_VAR_MAX];
+    unsigned uPhase = Dau_CacheInfoUnpack( nVars, Info, pPerm ), uSeen = 0;
+    int i;
+    if ( uPhase >= (1u << (nVars+1)) )
+        return 0;
+    for ( i = 0; i < nVars; i++ )
+    {
+        if ( pPerm[i] >= nVars || ((uSeen >> pPerm[i]) & 1) )
+            return 0;
+        uSeen |= 1u << pPerm[i];
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Hashes the truth table.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Dau_CacheHash( Dau_Cache_t * p, word * pTruth )
+{
+    word Hash = ABC_CONST(0xCBF29CE484222325);
+    int i;
+    for ( i = 0; i < p->nWords; i++ )
+        Hash = Abc_CacheHashWord( Hash, pTruth[i] );
+    return (int)(Hash & (word)(p->nBins - 1));
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Allocates the table for the given number of variables.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Dau_Cache_t * Dau_CacheAlloc( int nVars )
+{
+    Dau_Cache_t * p = ABC_CALLOC( Dau_Cache_t, 1 );
+    p->nVars       = nVars;
+    p->nWords      = Abc_TtWordNum( nVars );
+    p->nEntryWords = 1 + 2 * p->nWords;
+    p->nBins       = 1 << Abc_Base2Log( DAU_CACHE_MEMORY / (int)sizeof(word) / p->nEntryWords + 1 );
+    if ( (size_t)p->nBins * p->nEntryWords * sizeof(word) > DAU_CACHE_MEMORY )
+        p->nBins >>= 1;
+    p->pData       = ABC_CALLOC( word, (size_t)p->nBins * p->nEntryWords );
+    return p;
+}
+static void Dau_CacheFree( Dau_Cache_t * p )
+{
+    ABC_FREE( p->pData );
+    ABC_FREE( p );
+}
+static word Dau_CacheSum( word * pCounts )
+{
+    word Sum = 0;
+    int i;
+    for ( i = 0; i < DAU_CACHE_LOCKS; i++ )
+        Sum += pCounts[i];
+    return Sum;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Inserts the canonical transform into the table.]
+
+  Description [Assumes that the bin is locked by the caller.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Dau_CacheInsert( Dau_Cache_t * p, int iBin, word * pKey, word Info, word * pCanon )
+{
+    word * pEntry = Dau_CacheEntry( p, iBin );
+    pEntry[0] = Info;
+    Abc_TtCopy( pEntry + 1, pKey, p->nWords, 0 );
+    Abc_TtCopy( pEntry + 1 + p->nWords, pCanon, p->nWords, 0 );
+    p->nInserts[Dau_CacheStripe(iBin)]++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the cache from the cache directory.]
+
+  Description [Publishes the tables found in the entry. Stops at the
+  first table that is malformed, and skips the entries whose transform
+  is malformed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static word Dau_CacheKey()
+{
+    return Abc_CacheHashWord( Abc_CacheHashWord(DAU_CACHE_MAGIC, DAU_CACHE_VAR_MIN), DAU_CACHE_VAR_MAX );
+}
+static void Dau_CacheLoad()
+{
+    Dau_Cache_t * p;
+    size_t nSize, iWord = 0, nWords;
+    word * pData = (word *)Abc_CacheMap( (char *)"npn", DAU_CACHE_MAGIC, DAU_CACHE_VERSION, Dau_CacheKey(), &nSize );
+    word * pEntry;
+    int i, nVars, nEntries;
+    if ( pData == NULL )
+        return;
+    nWords = nSize / sizeof(word);
+    while ( iWord + 2 <= nWords )
+    {
+        nVars    = (int)pData[iWord];
+        nEntries = (int)pData[iWord+1];
+        if ( pData[iWord] < DAU_CACHE_VAR_MIN || pData[iWord] > DAU_CACHE_VAR_MAX || Dau_CacheTable(nVars) || pData[iWord+1] > (word)(nWords - iWord - 2) / (1 + 2 * Abc_TtWordNum(nVars)) )
+            break;
+        iWord += 2;
+        p = Dau_CacheAlloc( nVars );
+        for ( i = 0; i < nEntries; i++, iWord += p->nEntryWords )
+        {
+            pEntry = pData + iWord;
+            if ( (pEntry[0] & DAU_CACHE_VALID) && Dau_CacheInfoCheck(nVars, pEntry[0]) )
+                Dau_CacheInsert( p, Dau_CacheHash(p, pEntry + 1), pEntry + 1, pEntry[0], pEntry + 1 + p->nWords );
+        }
+        memset( p->nInserts, 0, sizeof(p->nInserts) );
+        Dau_CacheSetTable( nVars, p );
+    }
+    Abc_CacheUnmap( pData, nSize );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Saves the cache into the cache directory.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Dau_CacheSave()
+{
+    Vec_Wrd_t * vData = Vec_WrdAlloc( 1000 );
+    Dau_Cache_t * p;
+    word * pEntry;
+    int v, i, k, nEntries;
+    for ( v = DAU_CACHE_VAR_MIN; v <= DAU_CACHE_VAR_MAX; v++ )
+    {
+        if ( (p = Dau_CacheTable(v)) == NULL )
+            continue;
+        for ( nEntries = i = 0; i < p->nBins; i++ )
+            nEntries += (Dau_CacheEntry(p, i)[0] & DAU_CACHE_VALID) != 0;
+        Vec_WrdPush( vData, (word)v );
+        Vec_WrdPush( vData, (word)nEntries );
+        for ( i = 0; i < p->nBins; i++ )
+            if ( (pEntry = Dau_CacheEntry(p, i))[0] & DAU_CACHE_VALID )
+                for ( k = 0; k < p->nEntryWords; k++ )
+                    Vec_WrdPush( vData, pEntry[k] );
+    }
+    Abc_CacheWrite( (char *)"npn", DAU_CACHE_MAGIC, DAU_CACHE_VERSION, Dau_CacheKey(), Vec_WrdArray(vData), sizeof(word) * Vec_WrdSize(vData) );
+    Vec_WrdFree( vData );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the table for the given number of variables.]
+
+  Description [The first call loads the cache. The table is allocated
+  when it is first needed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+static void Dau_CacheStartLocks()
+{
+    int i;
+    for ( i = 0; i < DAU_CACHE_LOCKS; i++ )
+        pthread_mutex_init( s_DauCacheLocks + i, NULL );
+}
+#endif
+static Dau_Cache_t * Dau_CacheStart( int nVars )
+{
+    Dau_Cache_t * p = Dau_CacheTable( nVars );
+    if ( p )
+        return p;
+#ifdef ABC_USE_PTHREADS
+    pthread_once( &s_DauCacheOnce, Dau_CacheStartLocks );
+    pthread_mutex_lock( &s_DauCacheStartLock );
+#endif
+    if ( !s_fDauCacheLoaded )
+        Dau_CacheLoad(), s_fDauCacheLoaded = 1;
+    if ( (p = Dau_CacheTable(nVars)) == NULL )
+        Dau_CacheSetTable( nVars, p = Dau_CacheAlloc(nVars) );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &s_DauCacheStartLock );
+#endif
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes semi-canonical form using the cache.]
+
+  Description [Has the same interface and the same result as
+  Abc_TtCanonicize(). Functions with the number of variables outside
+  of the cached range are canonicized directly.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+unsigned Abc_TtCanonicizeCache( word * pTruth, int nVars, char * pCanonPerm )
+{
+    word pKey[1 << (DAU_CACHE_VAR_MAX-6)], * pEntry;
+    Dau_Cache_t * p;
+    unsigned uCanonPhase;
+    int iBin;
+    if ( nVars < DAU_CACHE_VAR_MIN || nVars > DAU_CACHE_VAR_MAX )
+        return Abc_TtCanonicize( pTruth, nVars, pCanonPerm );
+    p = Dau_CacheStart( nVars );
+    iBin = Dau_CacheHash( p, pTruth );
+    Dau_CacheLock( iBin );
+    pEntry = Dau_CacheEntry( p, iBin );
+    if ( (pEntry[0] & DAU_CACHE_VALID) && Abc_TtEqual(pEntry + 1, pTruth, p->nWords) )
+    {
+        uCanonPhase = Dau_CacheInfoUnpack( nVars, pEntry[0], pCanonPerm );
+        Abc_TtCopy( pTruth, pEntry + 1 + p->nWords, p->nWords, 0 );
+        p->nHits[Dau_CacheStripe(iBin)]++;
+        Dau_CacheUnlock( iBin );
+        return uCanonPhase;
+    }
+    p->nMisses[Dau_CacheStripe(iBin)]++;
+    Dau_CacheUnlock( iBin );
+    // canonicize outside of the lock
+    Abc_TtCopy( pKey, pTruth, p->nWords, 0 );
+    uCanonPhase = Abc_TtCanonicize( pTruth, nVars, pCanonPerm );
+    Dau_CacheLock( iBin );
+    Dau_CacheInsert( p, iBin, pKey, Dau_CacheInfoPack(nVars, uCanonPhase, pCanonPerm), pTruth );
+    Dau_CacheUnlock( iBin );
+    return uCanonPhase;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints statistics of the cache.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_TtCachePrintStats()
+{
+    Dau_Cache_t * p;
+    word nHits, nLookups;
+    int v;
+    for ( v = DAU_CACHE_VAR_MIN; v <= DAU_CACHE_VAR_MAX; v++ )
+    {
+        if ( (p = Dau_CacheTable(v)) == NULL )
+            continue;
+        nHits    = Dau_CacheSum( p->nHits );
+        nLookups = nHits + Dau_CacheSum( p->nMisses );
+        if ( nLookups == 0 )
+            continue;
+        printf( "NPN cache %2d vars: Entries = %8d.  Lookups = %10.0f.  Hits = %6.2f %%.  Memory = %6.2f MB\n",
+            v, p->nBins, (double)nLookups, 100.0 * nHits / nLookups,
+            1.0 * p->nBins * p->nEntryWords * sizeof(word) / (1<<20) );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Saves and deallocates the cache.]
+
+  Description [Called when the program terminates. The cache is started
+  again if it is used afterwards.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_TtCacheQuit()
+{
+    int v, nInserts = 0;
+    for ( v = DAU_CACHE_VAR_MIN; v <= DAU_CACHE_VAR_MAX; v++ )
+        if ( Dau_CacheTable(v) )
+            nInserts += Dau_CacheSum( Dau_CacheTable(v)->nInserts ) > 0;
+    if ( nInserts )
+        Dau_CacheSave();
+    for ( v = DAU_CACHE_VAR_MIN; v <= DAU_CACHE_VAR_MAX; v++ )
+        if ( Dau_CacheTable(v) )
+            Dau_CacheFree( Dau_CacheTable(v) ), Dau_CacheSetTable( v, NULL );
+    s_fDauCacheLoaded = 0;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -26,26 +26,18 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
-#define PDR_ZER 1
-#define PDR_ONE 2
-#define PDR_UND 3
+#define PDR_ZER SAIG_TER_ZER
+#define PDR_ONE SAIG_TER_ONE
+#define PDR_UND SAIG_TER_UND
 
 static inline int Pdr_ManSimInfoNot( int Value )
 {
-    if ( Value == PDR_ZER )
-        return PDR_ONE;
-    if ( Value == PDR_ONE )
-        return PDR_ZER;
-    return PDR_UND;
+    return Saig_TerNot( Value );
 }
 
 static inline int Pdr_ManSimInfoAnd( int Value0, int Value1 )
 {
-    if ( Value0 == PDR_ZER || Value1 == PDR_ZER )
-        return PDR_ZER;
-    if ( Value0 == PDR_ONE && Value1 == PDR_ONE )
-        return PDR_ONE;
-    return PDR_UND;
+    return Saig_TerAnd( Value0, Value1 );
 }
 
 static inline int Pdr_ManSimInfoGet( Aig_Man_t * p, Aig_Obj_t * pObj )
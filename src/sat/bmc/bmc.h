@@ -115,7 +115,9 @@ struct Saig_ParBmc_t_
     int         fSkipRand;      // skip random decisions
     int         fNoRestarts;    // disables periodic restarts
     int         fUseSatoko;     // enables using Satoko
+    int         fUseInproc;     // enables inprocessing in Satoko
     int         fUseGlucose;    // enables using Glucose 3.0
+    int         nProcs;         // the number of threads for clustered outputs
     int         nLearnedStart;  // starting learned clause limit
     int         nLearnedDelta;  // delta of learned clause limit
     int         nLearnedPerce;  // ratio of learned clause limit
@@ -130,6 +132,8 @@ struct Saig_ParBmc_t_
     int(*pFuncOnFail)(int,Abc_Cex_t*); // called for a failed output in MO mode
     int         RunId;          // BMC id in this run 
     int(*pFuncStop)(int);       // callback to terminate
+    int *       pStop;          // external flag to terminate
+    int *       pStopFrame;     // external bound on the frames explored (if not NULL)
 };
 
  
@@ -206,6 +210,15 @@ struct Bmc_ParFf_t_
     int        fVerbose;
 };
 
+// unified interface to incremental SAT solvers (bmcSolver.c)
+typedef struct Bmc_Sat_t_ Bmc_Sat_t;
+typedef enum { 
+    BMC_SAT_BSAT = 0,        // 0: MiniSat-based solver (src/sat/bsat)
+    BMC_SAT_SATOKO,          // 1: Satoko (src/sat/satoko)
+    BMC_SAT_GLUCOSE2,        // 2: Glucose (src/sat/glucose2)
+    BMC_SAT_PORTFOLIO        // 3: concurrent racing of the above
+} Bmc_SatType_t;
+
 ////////////////////////////////////////////////////////////////////////
 ///                      MACRO DEFINITIONS                           ///
 ////////////////////////////////////////////////////////////////////////
@@ -223,6 +236,8 @@ extern int               Saig_BmcPerform( Aig_Man_t * pAig, int nStart, int nFra
 /*=== bmcBmc3.c ==========================================================*/
 extern void              Saig_ParBmcSetDefaultParams( Saig_ParBmc_t * p );
 extern int               Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars );
+/*=== bmcBmc3Par.c ==========================================================*/
+extern int               Saig_ManBmcScalablePar( Aig_Man_t * pAig, Saig_ParBmc_t * pPars );
 /*=== bmcBmcAnd.c ==========================================================*/
 extern int               Gia_ManBmcPerform( Gia_Man_t * p, Bmc_AndPar_t * pPars );
 /*=== bmcCexCare.c ==========================================================*/
@@ -245,6 +260,24 @@ extern int               Bmc_CexVerifyAnyPo( Gia_Man_t * p, Abc_Cex_t * pCex, Ab
 /*=== bmcICheck.c ==========================================================*/
 extern void              Bmc_PerformICheck( Gia_Man_t * p, int nFramesMax, int nTimeOut, int fEmpty, int fVerbose );
 extern Vec_Int_t *       Bmc_PerformISearch( Gia_Man_t * p, int nFramesMax, int nTimeOut, int fReverse, int fBackTopo, int fDump, int fVerbose );
+/*=== bmcSolver.c ==========================================================*/
+extern Bmc_Sat_t *       Bmc_SatStart( int Type );
+extern Bmc_Sat_t *       Bmc_SatStartPortfolio( int nSolvers );
+extern void              Bmc_SatStop( Bmc_Sat_t * p );
+extern char *            Bmc_SatTypeName( int Type );
+extern int               Bmc_SatType( Bmc_Sat_t * p );
+extern void              Bmc_SatSetVarNum( Bmc_Sat_t * p, int nVars );
+extern int               Bmc_SatAddVar( Bmc_Sat_t * p );
+extern int               Bmc_SatVarNum( Bmc_Sat_t * p );
+extern int               Bmc_SatAddClause( Bmc_Sat_t * p, int * pLits, int nLits );
+extern void              Bmc_SatSetConflictLimit( Bmc_Sat_t * p, int nConfLimit );
+extern void              Bmc_SatSetStop( Bmc_Sat_t * p, int * pStop );
+extern int               Bmc_SatSolve( Bmc_Sat_t * p, int * pLits, int nLits );
+extern int               Bmc_SatVarValue( Bmc_Sat_t * p, int iVar );
+extern int               Bmc_SatFinal( Bmc_Sat_t * p, int ** ppLits );
+extern int               Bmc_SatConflictNum( Bmc_Sat_t * p );
+extern int               Bmc_SatWinner( Bmc_Sat_t * p );
+extern void              Bmc_SatPrintStats( Bmc_Sat_t * p );
 /*=== bmcUnroll.c ==========================================================*/
 extern Unr_Man_t *       Unr_ManUnrollStart( Gia_Man_t * pGia, int fVerbose );
 extern Gia_Man_t *       Unr_ManUnrollFrame( Unr_Man_t * p, int f );
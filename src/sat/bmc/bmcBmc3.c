@@ -46,6 +46,7 @@ struct Gia_ManBmc_t_
 //    Vec_Vec_t *       vSects;      // sections
     Vec_Int_t *       vId2Num;     // number of each node 
     Vec_Ptr_t *       vTerInfo;    // ternary information
+    Saig_Ter_t *      pTer;        // ternary states of the flops
     Vec_Ptr_t *       vId2Var;     // SAT vars for each object
     Vec_Wec_t *       vVisited;    // visited nodes
     abctime *         pTime4Outs;  // timeout per output
@@ -84,27 +85,14 @@ void Gia_ManReportProgress( FILE * pFile, int prop_no, int depth )
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
-#define SAIG_TER_NON 0
-#define SAIG_TER_ZER 1
-#define SAIG_TER_ONE 2
-#define SAIG_TER_UND 3
-
 static inline int Saig_ManBmcSimInfoNot( int Value )
 {
-    if ( Value == SAIG_TER_ZER )
-        return SAIG_TER_ONE;
-    if ( Value == SAIG_TER_ONE )
-        return SAIG_TER_ZER;
-    return SAIG_TER_UND;
+    return Saig_TerNot( Value );
 }
 
 static inline int Saig_ManBmcSimInfoAnd( int Value0, int Value1 )
 {
-    if ( Value0 == SAIG_TER_ZER || Value1 == SAIG_TER_ZER )
-        return SAIG_TER_ZER;
-    if ( Value0 == SAIG_TER_ONE && Value1 == SAIG_TER_ONE )
-        return SAIG_TER_ONE;
-    return SAIG_TER_UND;
+    return Saig_TerAnd( Value0, Value1 );
 }
 
 static inline int Saig_ManBmcSimInfoGet( unsigned * pInfo, Aig_Obj_t * pObj )
@@ -201,36 +189,7 @@ unsigned * Saig_ManBmcTerSimOne( Aig_Man_t * p, unsigned * pPrev )
 
 /**Function*************************************************************
 
-  Synopsis    [Collects internal nodes and PIs in the DFS order.]
-
-  Description []
-               
-  SideEffects []
-
-  SeeAlso     []
-
-***********************************************************************/
-Vec_Ptr_t * Saig_ManBmcTerSim( Aig_Man_t * p )
-{
-    Vec_Ptr_t * vInfos;
-    unsigned * pInfo = NULL;
-    int i, TerPrev = ABC_INFINITY, TerCur, CountIncrease = 0;
-    vInfos = Vec_PtrAlloc( 100 );
-    for ( i = 0; i < 1000 && CountIncrease < 5 && TerPrev > 0; i++ )
-    {
-        TerCur = Saig_ManBmcTerSimCount01( p, pInfo );
-        if ( TerCur >= TerPrev )
-            CountIncrease++;
-        TerPrev = TerCur;
-        pInfo = Saig_ManBmcTerSimOne( p, pInfo );
-        Vec_PtrPush( vInfos, pInfo );
-    }
-    return vInfos;
-}
-
-/**Function*************************************************************
-
-  Synopsis    []
+  Synopsis    [Prints the number of binary flops in each ternary state.]
 
   Description []
                
@@ -241,14 +200,13 @@ Vec_Ptr_t * Saig_ManBmcTerSim( Aig_Man_t * p )
 ***********************************************************************/
 void Saig_ManBmcTerSimTest( Aig_Man_t * p )
 {
-    Vec_Ptr_t * vInfos;
-    unsigned * pInfo;
-    int i;
-    vInfos = Saig_ManBmcTerSim( p );
-    Vec_PtrForEachEntry( unsigned *, vInfos, pInfo, i )
-        Abc_Print( 1, "%d=%d ", i, Saig_ManBmcTerSimCount01(p, pInfo) );
+    Saig_Ter_t * pTer = Saig_TerStart( p );
+    int i, nStates = Saig_TerSimulate( pTer, 1000 );
+    for ( i = 0; i < nStates; i++ )
+        Abc_Print( 1, "%d=%d ", i, Saig_TerStateCountBinary(pTer, Saig_TerState(pTer, i)) );
     Abc_Print( 1, "\n" );
-    Vec_PtrFreeFree( vInfos );
+    Saig_TerPrintStats( pTer );
+    Saig_TerStop( pTer );
 }
 
 
@@ -727,7 +685,7 @@ Gia_ManBmc_t * Saig_Bmc3ManStart( Aig_Man_t * pAig, int nTimeOutOne, int nConfLi
     p = ABC_CALLOC( Gia_ManBmc_t, 1 );
     p->pAig = pAig;
     // create mapping
-    p->vMapping = Cnf_DeriveMappingArray( pAig );
+    p->vMapping = Cnf_DeriveMappingArrayCache( pAig );
     p->vMapRefs = Saig_ManBmcComputeMappingRefs( pAig, p->vMapping );
     // create sections
 //    p->vSects = Saig_ManBmcSections( pAig );
@@ -744,6 +702,7 @@ Gia_ManBmc_t * Saig_Bmc3ManStart( Aig_Man_t * pAig, int nTimeOutOne, int nConfLi
         Vec_IntWriteEntry( p->vId2Num,  Aig_ObjId(pObj), p->nObjNums++ );
     p->vId2Var  = Vec_PtrAlloc( 100 );
     p->vTerInfo = Vec_PtrAlloc( 100 );
+    p->pTer = Saig_TerStart( pAig );
     p->vVisited = Vec_WecAlloc( 100 );
     // create solver
     p->nSatVars = 1;
@@ -827,6 +786,7 @@ void Saig_Bmc3ManStop( Gia_ManBmc_t * p )
     Vec_IntFree( p->vId2Num );
     Vec_VecFree( (Vec_Vec_t *)p->vId2Var );
     Vec_PtrFreeFree( p->vTerInfo );
+    Saig_TerStop( p->pTer );
     if ( p->pSat )  sat_solver_delete( p->pSat );
     if ( p->pSat2 ) satoko_destroy( p->pSat2 );
     if ( p->pSat3 ) bmcg_sat_solver_stop( p->pSat3 );
@@ -1138,6 +1098,7 @@ int Saig_ManBmcCreateCnf_rec( Gia_ManBmc_t * p, Aig_Obj_t * pObj, int iFrame )
 ***********************************************************************/
 void Saig_ManBmcCreateCnf_iter( Gia_ManBmc_t * p, Aig_Obj_t * pObj, int iFrame, Vec_Int_t * vVisit )
 {
+    extern int Saig_ManBmcRunTerSim_rec( Gia_ManBmc_t * p, Aig_Obj_t * pObj, int iFrame );
     if ( Saig_ManBmcLiteral( p, pObj, iFrame ) != ~0 )
         return; 
     if ( Aig_ObjIsTravIdCurrent(p->pAig, pObj) )
@@ -1151,6 +1112,8 @@ void Saig_ManBmcCreateCnf_iter( Gia_ManBmc_t * p, Aig_Obj_t * pObj, int iFrame,
     }
     if ( Aig_ObjIsCo(pObj) )
     {
+        // evaluate the cone in this frame to find the constant nodes
+        Saig_ManBmcRunTerSim_rec( p, pObj, iFrame );
         Saig_ManBmcCreateCnf_iter( p, Aig_ObjFanin0(pObj), iFrame, vVisit );
         return;
     }
@@ -1217,11 +1180,6 @@ int Saig_ManBmcRunTerSim_rec( Gia_ManBmc_t * p, Aig_Obj_t * pObj, int iFrame )
         if ( Aig_ObjFaninC0(pObj) )
             Value = Saig_ManBmcSimInfoNot( Value );
     }
-    else if ( Saig_ObjIsLo(p->pAig, pObj) )
-    {
-        assert( iFrame > 0 );
-        Value = Saig_ManBmcRunTerSim_rec( p, Saig_ObjLoToLi(p->pAig, pObj), iFrame - 1 );
-    }
     else if ( Aig_ObjIsNode(pObj) )
     {
         Val0 = Saig_ManBmcRunTerSim_rec( p, Aig_ObjFanin0(pObj), iFrame  );
@@ -1344,6 +1302,7 @@ void Saig_ParBmcSetDefaultParams( Saig_ParBmc_t * p )
     p->nPisAbstract   =     0;    // the number of PIs to abstract
     p->fSolveAll      =     0;    // stops on the first SAT instance
     p->fDropSatOuts   =     0;    // replace sat outputs by constant 0
+    p->nProcs         =     1;    // the number of threads for clustered outputs
     p->nLearnedStart  = 10000;    // starting learned clause limit
     p->nLearnedDelta  =  2000;    // delta of learned clause limit
     p->nLearnedPerce  =    80;    // ratio of learned clause limit
@@ -1465,6 +1424,7 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
     Abc_Cex_t * pCexNew, * pCexNew0;
     FILE * pLogFile = NULL;
     unsigned * pInfo;
+    word * pState;
     int RetValue = -1, fFirst = 1, nJumpFrame = 0, fUnfinished = 0;
     int nOutDigits = Abc_Base10Log( Saig_ManPoNum(pAig) );
     int i, f, k, Lit, status;
@@ -1491,6 +1451,7 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
         p->pSat->fNoRestarts  = p->pPars->fNoRestarts;
         p->pSat->RunId        = p->pPars->RunId;
         p->pSat->pFuncStop    = p->pPars->pFuncStop;
+        p->pSat->pStop        = p->pPars->pStop;
     }
     else if ( p->pSat3 )
     {
@@ -1501,6 +1462,8 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
     {
         satoko_set_runid(p->pSat2, p->pPars->RunId);
         satoko_set_stop_func(p->pSat2, p->pPars->pFuncStop);
+        satoko_set_stop(p->pSat2, p->pPars->pStop);
+        satoko_options(p->pSat2)->inprocess = (char)p->pPars->fUseInproc;
     }
     if ( pPars->fSolveAll && p->vCexes == NULL )
         p->vCexes = Vec_PtrStart( Saig_ManPoNum(pAig) );
@@ -1531,7 +1494,8 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
         // stop BMC after exploring all reachable states
         if ( !pPars->nFramesJump && Aig_ManRegNum(pAig) < 30 && f == (1 << Aig_ManRegNum(pAig)) )
         {
-            Abc_Print( 1, "Stopping BMC because all 2^%d reachable states are visited.\n", Aig_ManRegNum(pAig) );
+            if ( !pPars->fSilent )
+                Abc_Print( 1, "Stopping BMC because all 2^%d reachable states are visited.\n", Aig_ManRegNum(pAig) );
             if ( p->pPars->fUseBridge )
                 Saig_ManForEachPo( pAig, pObj, i )
                     if ( !(p->vCexes && Vec_PtrEntry(p->vCexes, i)) && !(p->pTime4Outs && p->pTime4Outs[i] == 0) ) // not SAT and not timed out
@@ -1542,7 +1506,8 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
         // stop BMC if all targets are solved
         if ( pPars->fSolveAll && pPars->nFailOuts + pPars->nDropOuts >= Saig_ManPoNum(pAig) )
         {
-            Abc_Print( 1, "Stopping BMC because all targets are disproved or timed out.\n" );
+            if ( !pPars->fSilent )
+                Abc_Print( 1, "Stopping BMC because all targets are disproved or timed out.\n" );
             RetValue = pPars->nFailOuts ? 0 : 1;
             goto finish;
         }
@@ -1567,13 +1532,14 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
         Saig_ManBmcSimInfoSet( pInfo, Aig_ManConst1(pAig), SAIG_TER_ONE );
         Saig_ManForEachPi( pAig, pObj, i )
             Saig_ManBmcSimInfoSet( pInfo, pObj, SAIG_TER_UND );
-        if ( f == 0 )
+        // the flop values come from the precomputed ternary states
+        pState = Saig_TerState( p->pTer, f );
+        Saig_ManForEachLo( p->pAig, pObj, i )
         {
-            Saig_ManForEachLo( p->pAig, pObj, i )
-            {
-                Saig_ManBmcSetLiteral( p, pObj, 0, 0 );
-                Saig_ManBmcSimInfoSet( pInfo, pObj, SAIG_TER_ZER );
-            }
+            int Value = Saig_TerStateValue( pState, Abc_Bit6WordNum(Saig_ManRegNum(pAig)), i );
+            Saig_ManBmcSimInfoSet( pInfo, pObj, Value );
+            if ( Value != SAIG_TER_UND )
+                Saig_ManBmcSetLiteral( p, pObj, f, (int)(Value == SAIG_TER_ONE) );
         }
         if ( (pPars->nStart && f < pPars->nStart) || (nJumpFrame && f < nJumpFrame) )
             continue;
@@ -1626,7 +1592,8 @@ clkOther += Abc_Clock() - clk2;
                     Abc_Print( 1, "Reached timeout (%d seconds).\n",  pPars->nTimeOut );
                 goto finish;
             }
-            if ( p->pPars->pFuncStop && p->pPars->pFuncStop(p->pPars->RunId) )
+            if ( (p->pPars->pFuncStop && p->pPars->pFuncStop(p->pPars->RunId)) || (p->pPars->pStop && *p->pPars->pStop) ||
+                 (p->pPars->pStopFrame && f > *p->pPars->pStopFrame) )
             {
                 if ( !pPars->fSilent )
                     Abc_Print( 1, "Bmc3 got callbacks.\n" );
@@ -0,0 +1,446 @@
+/**CFile****************************************************************
+
+  FileName    [bmcBmc3Par.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT-based bounded model checking.]
+
+  Synopsis    [Multi-threaded BMC of output clusters.]
+
+  Author      [LSV-PA contributors]
+  
+  Affiliation []
+
+  Date        [Ver. 1.0.]
+
+  Revision    [$Id: bmcBmc3Par.c $]
+
+***********************************************************************/
+
+#include "bmc.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define BMC3_THR_MAX 100
+
+typedef struct Bmc3_ParMan_t_ Bmc3_ParMan_t;
+typedef struct Bmc3_ThData_t_ Bmc3_ThData_t;
+struct Bmc3_ThData_t_
+{
+    Bmc3_ParMan_t * pMan;       // the manager of this run
+    Aig_Man_t *     pCone;      // sequential cone of the cluster
+    Vec_Int_t *     vPos;       // original POs of the cone
+    Vec_Int_t *     vPis;       // original PIs of the cone
+    Saig_ParBmc_t   Pars;       // private copy of the parameters
+    int             RetValue;   // the result of BMC
+    abctime         clkTotal;   // runtime of BMC
+};
+struct Bmc3_ParMan_t_
+{
+    Bmc3_ThData_t   ThData[BMC3_THR_MAX]; // data of the threads
+    int             iFrameStop; // the earliest CEX frame found by the threads (used when one CEX is enough)
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t Mutex;      // protects the frame above
+#endif
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Collects flops in the sequential cone of the output.]
+
+  Description [The resulting array of flop numbers is sorted.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Saig_ManBmcParSupport_rec( Aig_Man_t * p, Aig_Obj_t * pObj, Vec_Int_t * vRegs )
+{
+    if ( Aig_ObjIsTravIdCurrent(p, pObj) )
+        return;
+    Aig_ObjSetTravIdCurrent(p, pObj);
+    if ( Aig_ObjIsNode(pObj) )
+    {
+        Saig_ManBmcParSupport_rec( p, Aig_ObjFanin0(pObj), vRegs );
+        Saig_ManBmcParSupport_rec( p, Aig_ObjFanin1(pObj), vRegs );
+    }
+    else if ( Aig_ObjIsCo(pObj) )
+        Saig_ManBmcParSupport_rec( p, Aig_ObjFanin0(pObj), vRegs );
+    else if ( Saig_ObjIsLo(p, pObj) )
+        Vec_IntPush( vRegs, Aig_ObjCioId(pObj) - Saig_ManPiNum(p) );
+}
+Vec_Int_t * Saig_ManBmcParSupport( Aig_Man_t * p, int iPo )
+{
+    Vec_Int_t * vRegs = Vec_IntAlloc( 100 );
+    int i;
+    Aig_ManIncrementTravId( p );
+    Aig_ObjSetTravIdCurrent( p, Aig_ManConst1(p) );
+    Saig_ManBmcParSupport_rec( p, Aig_ManCo(p, iPo), vRegs );
+    for ( i = 0; i < Vec_IntSize(vRegs); i++ )
+        Saig_ManBmcParSupport_rec( p, Saig_ManLi(p, Vec_IntEntry(vRegs, i)), vRegs );
+    Vec_IntSort( vRegs, 0 );
+    return vRegs;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Groups outputs into clusters with overlapping cones.]
+
+  Description [Outputs are visited in the order of decreasing support.
+  Each output goes to the cluster whose flop support grows the least,
+  which keeps the outputs sharing their logic in the same unrolling.
+  The clusters are limited to the same number of outputs, so that
+  the threads get comparable amount of work.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wec_t * Saig_ManBmcParClusters( Aig_Man_t * p, int nClusters )
+{
+    Vec_Wec_t * vClusters = Vec_WecStart( nClusters );
+    Vec_Ptr_t * vSupps = Vec_PtrAlloc( Saig_ManPoNum(p) );
+    Vec_Int_t * vSupp, * vCluster;
+    int nRegs = Abc_MaxInt( Saig_ManRegNum(p), 1 );
+    int nPosMax = (Saig_ManPoNum(p) + nClusters - 1) / nClusters;
+    char * pMarks = ABC_CALLOC( char, nClusters * nRegs );
+    int * pCosts = ABC_ALLOC( int, Saig_ManPoNum(p) );
+    int * pPerm, i, j, k, c, iReg, Cost, CostBest, iBest;
+    for ( i = 0; i < Saig_ManPoNum(p); i++ )
+    {
+        Vec_PtrPush( vSupps, (vSupp = Saig_ManBmcParSupport(p, i)) );
+        pCosts[i] = -Vec_IntSize(vSupp);
+    }
+    pPerm = Abc_MergeSortCost( pCosts, Saig_ManPoNum(p) );
+    for ( k = 0; k < Saig_ManPoNum(p); k++ )
+    {
+        i = pPerm[k];
+        vSupp = (Vec_Int_t *)Vec_PtrEntry( vSupps, i );
+        iBest = -1; CostBest = ABC_INFINITY;
+        for ( c = 0; c < nClusters; c++ )
+        {
+            vCluster = Vec_WecEntry( vClusters, c );
+            if ( Vec_IntSize(vCluster) >= nPosMax )
+                continue;
+            Cost = 0;
+            Vec_IntForEachEntry( vSupp, iReg, j )
+                Cost += !pMarks[c * nRegs + iReg];
+            if ( iBest == -1 || Cost < CostBest || (Cost == CostBest && Vec_IntSize(vCluster) < Vec_IntSize(Vec_WecEntry(vClusters, iBest))) )
+                iBest = c, CostBest = Cost;
+        }
+        assert( iBest >= 0 );
+        Vec_WecPush( vClusters, iBest, i );
+        Vec_IntForEachEntry( vSupp, iReg, j )
+            pMarks[iBest * nRegs + iReg] = 1;
+    }
+    Vec_WecForEachLevel( vClusters, vCluster, c )
+        Vec_IntSort( vCluster, 0 );
+    Vec_WecRemoveEmpty( vClusters );
+    Vec_VecFree( (Vec_Vec_t *)vSupps );
+    ABC_FREE( pMarks );
+    ABC_FREE( pCosts );
+    ABC_FREE( pPerm );
+    return vClusters;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the sequential cone of the cluster.]
+
+  Description [Returns the cone and the mapping of its PIs into
+  the PIs of the original AIG.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Aig_Man_t * Saig_ManBmcParCone( Aig_Man_t * p, Vec_Int_t * vPos, Vec_Int_t ** pvPis )
+{
+    Aig_Man_t * pCone;
+    Aig_Obj_t * pObj;
+    int i;
+    pCone = Saig_ManDupCones( p, Vec_IntArray(vPos), Vec_IntSize(vPos) );
+    // the PIs of the cone are marked with the current traversal ID
+    *pvPis = Vec_IntStartFull( Saig_ManPiNum(pCone) );
+    Saig_ManForEachPi( p, pObj, i )
+        if ( Aig_ObjIsTravIdCurrent(p, pObj) )
+            Vec_IntWriteEntry( *pvPis, Aig_ObjCioId((Aig_Obj_t *)pObj->pData), i );
+    assert( Vec_IntFind(*pvPis, -1) == -1 );
+    return pCone;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Translates the CEX of the cone into that of the AIG.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Cex_t * Saig_ManBmcParRemapCex( Aig_Man_t * p, Bmc3_ThData_t * pThData, Abc_Cex_t * pCex )
+{
+    Abc_Cex_t * pCexNew;
+    int f, k, iPi;
+    pCexNew = Abc_CexAlloc( Saig_ManRegNum(p), Saig_ManPiNum(p), pCex->iFrame + 1 );
+    pCexNew->iPo    = Vec_IntEntry( pThData->vPos, pCex->iPo );
+    pCexNew->iFrame = pCex->iFrame;
+    for ( f = 0; f <= pCex->iFrame; f++ )
+        Vec_IntForEachEntry( pThData->vPis, iPi, k )
+            if ( Abc_InfoHasBit(pCex->pData, pCex->nRegs + pCex->nPis * f + k) )
+                Abc_InfoSetBit( pCexNew->pData, pCexNew->nRegs + pCexNew->nPis * f + iPi );
+    return pCexNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs BMC on one cluster.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Saig_ManBmcParWorkerThread( void * pArg )
+{
+    Bmc3_ThData_t * pThData = (Bmc3_ThData_t *)pArg;
+    abctime clk = Abc_Clock();
+    pThData->RetValue = Saig_ManBmcScalable( pThData->pCone, &pThData->Pars );
+    // the other threads still explore the frames up to this one, so that
+    // the earliest CEX is found regardless of the order of the threads
+    if ( pThData->RetValue == 0 && !pThData->Pars.fSolveAll )
+    {
+        Bmc3_ParMan_t * p = pThData->pMan;
+#ifdef ABC_USE_PTHREADS
+        pthread_mutex_lock( &p->Mutex );
+#endif
+        p->iFrameStop = Abc_MinInt( p->iFrameStop, pThData->pCone->pSeqModel->iFrame );
+#ifdef ABC_USE_PTHREADS
+        pthread_mutex_unlock( &p->Mutex );
+#endif
+    }
+    pThData->clkTotal = Abc_Clock() - clk;
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs BMC with output clusters solved concurrently.]
+
+  Description [Outputs are grouped by the overlap of their sequential
+  cones. Each cluster is extracted once as a structurally hashed cone,
+  which is then unrolled by its own thread using its own SAT solver.
+  Results are merged into those of the original AIG, which is left
+  unchanged. The depth reached by each output is reported.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Saig_ManBmcScalablePar( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
+{
+    Bmc3_ParMan_t * p;
+    Bmc3_ThData_t * ThData;
+    Vec_Wec_t * vClusters;
+    Vec_Int_t * vDepths, * vStatus;
+    Abc_Cex_t * pCex, * pCexBest = NULL;
+    int nOutDigits = Abc_Base10Log( Saig_ManPoNum(pAig) );
+    int i, k, iPo, nClusters, RetValue = -1, nProved = 0, iFrameMin = ABC_INFINITY, iFrameMax = -1;
+    abctime clkTotal = Abc_Clock();
+#ifdef ABC_USE_PTHREADS
+    pthread_t WorkerThread[BMC3_THR_MAX];
+    int status;
+#endif
+    // these modes report results of individual outputs while solving
+    if ( pPars->nProcs <= 1 || Saig_ManPoNum(pAig) < 2 || Saig_ManConstrNum(pAig) > 0 ||
+         pPars->fUseBridge || pPars->pFuncOnFail || pPars->pLogFileName || pPars->pStop || pPars->pStopFrame || pPars->nStart )
+        return Saig_ManBmcScalable( pAig, pPars );
+    nClusters = Abc_MinInt( Abc_MinInt(pPars->nProcs, BMC3_THR_MAX), Saig_ManPoNum(pAig) );
+    vClusters = Saig_ManBmcParClusters( pAig, nClusters );
+    nClusters = Vec_WecSize( vClusters );
+    if ( pPars->fVerbose )
+        Abc_Print( 1, "Running \"bmc3\" with %d threads. PI/PO/Reg = %d/%d/%d. And =%7d. Clusters = %d.\n",
+            pPars->nProcs, Saig_ManPiNum(pAig), Saig_ManPoNum(pAig), Saig_ManRegNum(pAig), Aig_ManNodeNum(pAig), nClusters );
+    // derive the cones before starting the threads
+    p = ABC_CALLOC( Bmc3_ParMan_t, 1 );
+    p->iFrameStop = ABC_INFINITY;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &p->Mutex, NULL );
+#endif
+    ThData = p->ThData;
+    for ( i = 0; i < nClusters; i++ )
+    {
+        ThData[i].pMan            = p;
+        ThData[i].vPos            = Vec_IntDup( Vec_WecEntry(vClusters, i) );
+        ThData[i].pCone           = Saig_ManBmcParCone( pAig, ThData[i].vPos, &ThData[i].vPis );
+        ThData[i].Pars            = *pPars;
+        ThData[i].Pars.nProcs     = 1;
+        ThData[i].Pars.fStoreCex  = 1;
+        ThData[i].Pars.fVerbose   = 0;
+        ThData[i].Pars.fNotVerbose= 1;
+        ThData[i].Pars.fSilent    = 1;
+        ThData[i].Pars.pStopFrame = &p->iFrameStop;
+        ThData[i].RetValue        = -1;
+        ThData[i].clkTotal        = 0;
+    }
+    Vec_WecFree( vClusters );
+#ifdef ABC_USE_PTHREADS
+    for ( i = 0; i < nClusters; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Saig_ManBmcParWorkerThread, (void *)(ThData + i) );
+        assert( status == 0 );
+    }
+    for ( i = 0; i < nClusters; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );
+        assert( status == 0 );
+    }
+#else
+    for ( i = 0; i < nClusters; i++ )
+        Saig_ManBmcParWorkerThread( (void *)(ThData + i) );
+#endif
+    // merge the results
+    vDepths = Vec_IntStartFull( Saig_ManPoNum(pAig) );
+    vStatus = Vec_IntStartFull( Saig_ManPoNum(pAig) );
+    if ( pPars->fSolveAll )
+    {
+        Vec_PtrFreeFree( pAig->vSeqModelVec );
+        pAig->vSeqModelVec = Vec_PtrStart( Saig_ManPoNum(pAig) );
+    }
+    pPars->nFailOuts = pPars->nDropOuts = 0;
+    for ( i = 0; i < nClusters; i++ )
+    {
+        Bmc3_ThData_t * pThData = ThData + i;
+        pPars->nFailOuts += pThData->Pars.nFailOuts;
+        pPars->nDropOuts += pThData->Pars.nDropOuts;
+        if ( pThData->RetValue == 0 )
+            RetValue = 0;
+        nProved += (pThData->RetValue == 1);
+        // clusters with all outputs resolved do not limit the depth
+        if ( pThData->RetValue == 1 || pThData->Pars.nFailOuts + pThData->Pars.nDropOuts >= Vec_IntSize(pThData->vPos) )
+            iFrameMax = Abc_MaxInt( iFrameMax, pThData->Pars.iFrame );
+        else
+            iFrameMin = Abc_MinInt( iFrameMin, pThData->Pars.iFrame );
+        // outputs without CEX are explored up to the last frame of their cluster
+        Vec_IntForEachEntry( pThData->vPos, iPo, k )
+        {
+            Vec_IntWriteEntry( vDepths, iPo, pThData->Pars.iFrame );
+            Vec_IntWriteEntry( vStatus, iPo, pThData->RetValue == 1 ? 1 : -1 );
+        }
+        if ( pThData->pCone->pSeqModel )
+        {
+            pCex = Saig_ManBmcParRemapCex( pAig, pThData, pThData->pCone->pSeqModel );
+            Vec_IntWriteEntry( vDepths, pCex->iPo, pCex->iFrame );
+            Vec_IntWriteEntry( vStatus, pCex->iPo, 0 );
+            if ( pCexBest == NULL || pCexBest->iFrame > pCex->iFrame || (pCexBest->iFrame == pCex->iFrame && pCexBest->iPo > pCex->iPo) )
+                ABC_SWAP( Abc_Cex_t *, pCex, pCexBest );
+            Abc_CexFreeP( &pCex );
+        }
+        if ( pThData->pCone->vSeqModelVec )
+        {
+            Vec_PtrForEachEntry( Abc_Cex_t *, pThData->pCone->vSeqModelVec, pCex, k )
+            {
+                if ( pCex == NULL )
+                    continue;
+                iPo = Vec_IntEntry( pThData->vPos, k );
+                Vec_IntWriteEntry( vDepths, iPo, pCex->iFrame );
+                Vec_IntWriteEntry( vStatus, iPo, 0 );
+                if ( pPars->fStoreCex )
+                    Vec_PtrWriteEntry( pAig->vSeqModelVec, iPo, Saig_ManBmcParRemapCex(pAig, pThData, pCex) );
+                else
+                    Vec_PtrWriteEntry( pAig->vSeqModelVec, iPo, (Abc_Cex_t *)(ABC_PTRINT_T)1 );
+            }
+        }
+    }
+    if ( pCexBest )
+    {
+        ABC_FREE( pAig->pSeqModel );
+        pAig->pSeqModel = pCexBest;
+        pPars->iFrame = pCexBest->iFrame - 1;
+    }
+    else
+    {
+        if ( nProved == nClusters )
+            RetValue = 1;
+        pPars->iFrame = iFrameMin < ABC_INFINITY ? iFrameMin : iFrameMax;
+    }
+    // report the outputs
+    if ( pPars->fSolveAll && !pPars->fNotVerbose )
+    {
+        int nFailed = 0;
+        Vec_IntForEachEntry( vStatus, k, iPo )
+            if ( k == 0 )
+                Abc_Print( 1, "Output %*d was asserted in frame %2d (solved %*d out of %*d outputs).\n",
+                    nOutDigits, iPo, Vec_IntEntry(vDepths, iPo), nOutDigits, ++nFailed, nOutDigits, Saig_ManPoNum(pAig) );
+    }
+    if ( pPars->fVerbose )
+    {
+        for ( i = 0; i < nClusters; i++ )
+        {
+            Bmc3_ThData_t * pThData = ThData + i;
+            Abc_Print( 1, "Cluster %3d : PO =%6d. PI =%6d. Reg =%6d. And =%8d. Frames =%6d. Status = %-6s ",
+                i, Saig_ManPoNum(pThData->pCone), Saig_ManPiNum(pThData->pCone), Saig_ManRegNum(pThData->pCone), Aig_ManNodeNum(pThData->pCone),
+                pThData->Pars.iFrame + 1, pThData->RetValue == 1 ? "proved" : pThData->RetValue == 0 ? "sat" : "undec" );
+            Abc_PrintTime( 1, "Time", pThData->clkTotal );
+        }
+        Vec_IntForEachEntry( vStatus, k, iPo )
+        {
+            if ( k == 0 )
+                Abc_Print( 1, "Output %*d : asserted in frame %d.\n", nOutDigits, iPo, Vec_IntEntry(vDepths, iPo) );
+            else if ( k == 1 )
+                Abc_Print( 1, "Output %*d : explored all reachable states.\n", nOutDigits, iPo );
+            else
+                Abc_Print( 1, "Output %*d : no CEX in %d frames.\n", nOutDigits, iPo, Vec_IntEntry(vDepths, iPo) + 1 );
+        }
+        Abc_PrintTime( 1, "Total time", Abc_Clock() - clkTotal );
+    }
+    for ( i = 0; i < nClusters; i++ )
+    {
+        Aig_ManStop( ThData[i].pCone );
+        Vec_IntFree( ThData[i].vPos );
+        Vec_IntFree( ThData[i].vPis );
+    }
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_destroy( &p->Mutex );
+#endif
+    ABC_FREE( p );
+    Vec_IntFree( vDepths );
+    Vec_IntFree( vStatus );
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
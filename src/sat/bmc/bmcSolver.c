@@ -0,0 +1,689 @@
+/**CFile****************************************************************
+
+  FileName    [bmcSolver.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT-based bounded model checking.]
+
+  Synopsis    [Unified interface to incremental SAT solvers.]
+
+  Author      [LSV-PA contributors]
+  
+  Affiliation []
+
+  Date        [Ver. 1.0.]
+
+  Revision    [$Id: bmcSolver.c $]
+
+***********************************************************************/
+
+#include "bmc.h"
+#include "sat/bsat/satSolver.h"
+#include "sat/satoko/satoko.h"
+#include "sat/glucose2/AbcGlucose2.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/time.h>
+#endif
+
+#ifdef __cplusplus
+#include <atomic>
+using namespace std;
+#else
+#include <stdatomic.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define BMC_SAT_MAX   16
+
+typedef struct Bmc_SatPort_t_ Bmc_SatPort_t;
+typedef struct Bmc_SatThData_t_ Bmc_SatThData_t;
+
+struct Bmc_Sat_t_
+{
+    int               Type;          // solver type (Bmc_SatType_t)
+    int               Seed;          // the configuration number of this solver
+    void *            pSolver;       // the backend solver
+    int               nVars;         // the number of variables
+    int               nConfLimit;    // conflict limit for one call (0 = no limit)
+    int *             pStop;         // external flag to terminate
+    int               fUnsat;        // the clauses are unsatisfiable without assumptions
+    Vec_Int_t *       vTemp;         // temporary literals
+    // portfolio
+    int               nMembers;      // the number of racing solvers
+    Bmc_Sat_t *       pMembers[BMC_SAT_MAX]; // the racing solvers
+    int               pWins[BMC_SAT_MAX];    // the number of calls won by each solver
+    int               iWinner;       // the solver that answered the last call
+#ifdef ABC_USE_PTHREADS
+    atomic_int        fStopRace;     // the flag to terminate the losers (read by the solvers while they run)
+#else
+    int               fStopRace;     // the flag to terminate the losers
+#endif
+    Bmc_SatPort_t *   pPort;         // the threads of the portfolio
+};
+
+static void Bmc_SatPortStart( Bmc_Sat_t * p );
+static void Bmc_SatPortStop( Bmc_Sat_t * p );
+static int  Bmc_SatPortSolve( Bmc_Sat_t * p, int * pLits, int nLits );
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts one backend solver.]
+
+  Description [Seed selects one of the configurations of the backend,
+  which are used to make the solvers of the portfolio different.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Bmc_Sat_t * Bmc_SatStartOne( int Type, int Seed )
+{
+    Bmc_Sat_t * p = ABC_CALLOC( Bmc_Sat_t, 1 );
+    p->Type    = Type;
+    p->Seed    = Seed;
+    p->iWinner = -1;
+    p->vTemp   = Vec_IntAlloc( 100 );
+    if ( Type == BMC_SAT_BSAT )
+    {
+        sat_solver * pSat = sat_solver_new();
+        if ( Seed > 0 )
+            pSat->random_seed = 91648253 + 7919 * Seed;
+        p->pSolver = pSat;
+    }
+    else if ( Type == BMC_SAT_SATOKO )
+    {
+        satoko_opts_t opts;
+        satoko_default_opts( &opts );
+        // the same variation as in the multi-solver BMC (bmcBmcS.c)
+        opts.f_rst = 0.8 - Seed * 0.05;
+        opts.b_rst = 1.4 - Seed * 0.05;
+        opts.garbage_max_ratio = (float) 0.3 + Seed * 0.05;
+        p->pSolver = satoko_create();
+        satoko_configure( (satoko_t *)p->pSolver, &opts );
+    }
+    else if ( Type == BMC_SAT_GLUCOSE2 )
+        p->pSolver = bmcg2_sat_solver_start();
+    else assert( 0 );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the solver.]
+
+  Description [Type is one of BMC_SAT_BSAT, BMC_SAT_SATOKO and
+  BMC_SAT_GLUCOSE2. For the portfolio, use Bmc_SatStartPortfolio().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Bmc_Sat_t * Bmc_SatStart( int Type )
+{
+    if ( Type == BMC_SAT_PORTFOLIO )
+        return Bmc_SatStartPortfolio( 3 );
+    return Bmc_SatStartOne( Type, 0 );
+}
+void Bmc_SatStop( Bmc_Sat_t * p )
+{
+    int i;
+    if ( p->Type == BMC_SAT_PORTFOLIO )
+    {
+        Bmc_SatPortStop( p );
+        for ( i = 0; i < p->nMembers; i++ )
+            Bmc_SatStop( p->pMembers[i] );
+    }
+    else if ( p->Type == BMC_SAT_BSAT )
+        sat_solver_delete( (sat_solver *)p->pSolver );
+    else if ( p->Type == BMC_SAT_SATOKO )
+        satoko_destroy( (satoko_t *)p->pSolver );
+    else if ( p->Type == BMC_SAT_GLUCOSE2 )
+        bmcg2_sat_solver_stop( (bmcg2_sat_solver *)p->pSolver );
+    Vec_IntFree( p->vTemp );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the name of the solver type.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Bmc_SatTypeName( int Type )
+{
+    if ( Type == BMC_SAT_BSAT )
+        return "bsat";
+    if ( Type == BMC_SAT_SATOKO )
+        return "satoko";
+    if ( Type == BMC_SAT_GLUCOSE2 )
+        return "glucose2";
+    if ( Type == BMC_SAT_PORTFOLIO )
+        return "portfolio";
+    return "unknown";
+}
+int Bmc_SatType( Bmc_Sat_t * p )
+{
+    return p->Type;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds variables.]
+
+  Description [Bmc_SatSetVarNum() makes sure that the solver has at
+  least the given number of variables. Bmc_SatAddVar() adds one
+  variable and returns its number.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_SatSetVarNum( Bmc_Sat_t * p, int nVars )
+{
+    int i;
+    if ( nVars <= p->nVars )
+        return;
+    if ( p->Type == BMC_SAT_PORTFOLIO )
+    {
+        for ( i = 0; i < p->nMembers; i++ )
+            Bmc_SatSetVarNum( p->pMembers[i], nVars );
+    }
+    else if ( p->Type == BMC_SAT_BSAT )
+        sat_solver_setnvars( (sat_solver *)p->pSolver, nVars );
+    else if ( p->Type == BMC_SAT_SATOKO )
+    {
+        for ( i = p->nVars; i < nVars; i++ )
+            satoko_add_variable( (satoko_t *)p->pSolver, 0 );
+    }
+    else if ( p->Type == BMC_SAT_GLUCOSE2 )
+        bmcg2_sat_solver_set_nvars( (bmcg2_sat_solver *)p->pSolver, nVars );
+    p->nVars = nVars;
+}
+int Bmc_SatAddVar( Bmc_Sat_t * p )
+{
+    Bmc_SatSetVarNum( p, p->nVars + 1 );
+    return p->nVars - 1;
+}
+int Bmc_SatVarNum( Bmc_Sat_t * p )
+{
+    return p->nVars;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the clause.]
+
+  Description [The literals are not changed. Returns 0 if the problem
+  became unsatisfiable.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_SatAddClause( Bmc_Sat_t * p, int * pLits, int nLits )
+{
+    int i, iVarMax = -1, RetValue = 1;
+    for ( i = 0; i < nLits; i++ )
+        iVarMax = Abc_MaxInt( iVarMax, Abc_Lit2Var(pLits[i]) );
+    Bmc_SatSetVarNum( p, iVarMax + 1 );
+    if ( p->Type == BMC_SAT_PORTFOLIO )
+    {
+        for ( i = 0; i < p->nMembers; i++ )
+            RetValue &= Bmc_SatAddClause( p->pMembers[i], pLits, nLits );
+        return RetValue;
+    }
+    // the backends may reorder the literals
+    Vec_IntClear( p->vTemp );
+    Vec_IntPushArray( p->vTemp, pLits, nLits );
+    if ( p->fUnsat )
+        return 0;
+    if ( p->Type == BMC_SAT_BSAT )
+        RetValue = sat_solver_addclause( (sat_solver *)p->pSolver, Vec_IntArray(p->vTemp), Vec_IntLimit(p->vTemp) );
+    else if ( p->Type == BMC_SAT_SATOKO )
+        RetValue = satoko_add_clause( (satoko_t *)p->pSolver, Vec_IntArray(p->vTemp), nLits );
+    else if ( p->Type == BMC_SAT_GLUCOSE2 )
+        RetValue = bmcg2_sat_solver_addclause( (bmcg2_sat_solver *)p->pSolver, Vec_IntArray(p->vTemp), nLits );
+    else assert( 0 );
+    // remember the conflict because Satoko cannot solve after it
+    p->fUnsat = !RetValue;
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sets the limits.]
+
+  Description [The conflict limit applies to each call separately
+  (0 means no limit). The solver terminates when the external flag
+  becomes non-zero.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_SatSetConflictLimit( Bmc_Sat_t * p, int nConfLimit )
+{
+    int i;
+    p->nConfLimit = nConfLimit;
+    for ( i = 0; i < p->nMembers; i++ )
+        Bmc_SatSetConflictLimit( p->pMembers[i], nConfLimit );
+}
+void Bmc_SatSetStop( Bmc_Sat_t * p, int * pStop )
+{
+    p->pStop = pStop;
+    if ( p->Type == BMC_SAT_BSAT )
+        sat_solver_set_stop( (sat_solver *)p->pSolver, pStop );
+    else if ( p->Type == BMC_SAT_SATOKO )
+        satoko_set_stop( (satoko_t *)p->pSolver, pStop );
+    else if ( p->Type == BMC_SAT_GLUCOSE2 )
+        bmcg2_sat_solver_set_stop( (bmcg2_sat_solver *)p->pSolver, pStop );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the problem under the assumptions.]
+
+  Description [Returns 1 (SAT), -1 (UNSAT) or 0 (undecided). The
+  assumptions are not changed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_SatSolve( Bmc_Sat_t * p, int * pLits, int nLits )
+{
+    int i;
+    for ( i = 0; i < nLits; i++ )
+        Bmc_SatSetVarNum( p, Abc_Lit2Var(pLits[i]) + 1 );
+    if ( p->Type == BMC_SAT_PORTFOLIO )
+        return Bmc_SatPortSolve( p, pLits, nLits );
+    if ( p->fUnsat )
+        return -1;
+    Vec_IntClear( p->vTemp );
+    Vec_IntPushArray( p->vTemp, pLits, nLits );
+    if ( p->Type == BMC_SAT_BSAT )
+        return sat_solver_solve( (sat_solver *)p->pSolver, Vec_IntArray(p->vTemp), Vec_IntLimit(p->vTemp), (ABC_INT64_T)p->nConfLimit, 0, 0, 0 );
+    if ( p->Type == BMC_SAT_SATOKO )
+        return satoko_solve_assumptions_limit( (satoko_t *)p->pSolver, Vec_IntArray(p->vTemp), nLits, p->nConfLimit );
+    if ( p->Type == BMC_SAT_GLUCOSE2 )
+    {
+        bmcg2_sat_solver_set_conflict_budget( (bmcg2_sat_solver *)p->pSolver, p->nConfLimit );
+        return bmcg2_sat_solver_solve( (bmcg2_sat_solver *)p->pSolver, Vec_IntArray(p->vTemp), nLits );
+    }
+    assert( 0 );
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the results of the last call.]
+
+  Description [Bmc_SatVarValue() returns the value of the variable in
+  the satisfying assignment. Bmc_SatFinal() returns the final conflict,
+  which consists of the complemented assumption literals responsible
+  for unsatisfiability.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_SatVarValue( Bmc_Sat_t * p, int iVar )
+{
+    if ( p->Type == BMC_SAT_PORTFOLIO )
+        return Bmc_SatVarValue( p->pMembers[Abc_MaxInt(p->iWinner, 0)], iVar );
+    if ( p->Type == BMC_SAT_BSAT )
+        return sat_solver_var_value( (sat_solver *)p->pSolver, iVar );
+    if ( p->Type == BMC_SAT_SATOKO )
+        return satoko_read_cex_varvalue( (satoko_t *)p->pSolver, iVar );
+    if ( p->Type == BMC_SAT_GLUCOSE2 )
+        return bmcg2_sat_solver_read_cex_varvalue( (bmcg2_sat_solver *)p->pSolver, iVar );
+    assert( 0 );
+    return 0;
+}
+int Bmc_SatFinal( Bmc_Sat_t * p, int ** ppLits )
+{
+    if ( p->Type == BMC_SAT_PORTFOLIO )
+        return Bmc_SatFinal( p->pMembers[Abc_MaxInt(p->iWinner, 0)], ppLits );
+    if ( p->fUnsat )
+    {
+        *ppLits = Vec_IntArray( p->vTemp );
+        return 0;
+    }
+    if ( p->Type == BMC_SAT_BSAT )
+        return sat_solver_final( (sat_solver *)p->pSolver, ppLits );
+    if ( p->Type == BMC_SAT_SATOKO )
+        return satoko_final_conflict( (satoko_t *)p->pSolver, ppLits );
+    if ( p->Type == BMC_SAT_GLUCOSE2 )
+        return bmcg2_sat_solver_final( (bmcg2_sat_solver *)p->pSolver, ppLits );
+    assert( 0 );
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the statistics.]
+
+  Description [For the portfolio, the conflicts of all solvers are
+  added up.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_SatConflictNum( Bmc_Sat_t * p )
+{
+    int i, Count = 0;
+    if ( p->Type == BMC_SAT_PORTFOLIO )
+    {
+        for ( i = 0; i < p->nMembers; i++ )
+            Count += Bmc_SatConflictNum( p->pMembers[i] );
+        return Count;
+    }
+    if ( p->Type == BMC_SAT_BSAT )
+        return sat_solver_nconflicts( (sat_solver *)p->pSolver );
+    if ( p->Type == BMC_SAT_SATOKO )
+        return satoko_conflictnum( (satoko_t *)p->pSolver );
+    if ( p->Type == BMC_SAT_GLUCOSE2 )
+        return bmcg2_sat_solver_conflictnum( (bmcg2_sat_solver *)p->pSolver );
+    assert( 0 );
+    return 0;
+}
+int Bmc_SatWinner( Bmc_Sat_t * p )
+{
+    return p->iWinner;
+}
+void Bmc_SatPrintStats( Bmc_Sat_t * p )
+{
+    int i;
+    if ( p->Type != BMC_SAT_PORTFOLIO )
+    {
+        printf( "Solver %s: Vars = %d. Conflicts = %d.\n", Bmc_SatTypeName(p->Type), p->nVars, Bmc_SatConflictNum(p) );
+        return;
+    }
+    printf( "Portfolio of %d solvers: Vars = %d.\n", p->nMembers, p->nVars );
+    for ( i = 0; i < p->nMembers; i++ )
+        printf( "  %2d : %-8s (config %d)  Conflicts = %9d.  Wins = %6d.\n", i,
+            Bmc_SatTypeName(p->pMembers[i]->Type), p->pMembers[i]->Seed,
+            Bmc_SatConflictNum(p->pMembers[i]), p->pWins[i] );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the portfolio of solvers.]
+
+  Description [The first three solvers are glucose2, satoko and bsat.
+  Other solvers alternate between satoko and bsat with different
+  configurations. Each call to Bmc_SatSolve() runs all solvers
+  concurrently on the same problem. The first solver to return a
+  definite answer wins, and the other solvers are terminated.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Bmc_Sat_t * Bmc_SatStartPortfolio( int nSolvers )
+{
+    static int pTypes[3] = { BMC_SAT_GLUCOSE2, BMC_SAT_SATOKO, BMC_SAT_BSAT };
+    Bmc_Sat_t * p = ABC_CALLOC( Bmc_Sat_t, 1 );
+    int i, Type, Seed;
+    assert( nSolvers >= 1 && nSolvers <= BMC_SAT_MAX );
+    p->Type     = BMC_SAT_PORTFOLIO;
+    p->iWinner  = -1;
+    p->vTemp    = Vec_IntAlloc( 100 );
+    p->nMembers = nSolvers;
+    for ( i = 0; i < nSolvers; i++ )
+    {
+        Type = i < 3 ? pTypes[i] : (i & 1 ? BMC_SAT_SATOKO : BMC_SAT_BSAT);
+        Seed = i < 3 ? 0 : (i - 1) / 2;
+        p->pMembers[i] = Bmc_SatStartOne( Type, Seed );
+        // the solvers poll the flag through their stop pointers
+        Bmc_SatSetStop( p->pMembers[i], (int *)&p->fStopRace );
+    }
+    Bmc_SatPortStart( p );
+    return p;
+}
+
+#ifndef ABC_USE_PTHREADS
+
+struct Bmc_SatPort_t_
+{
+    int               nDummy;
+};
+static void Bmc_SatPortStart( Bmc_Sat_t * p )  {}
+static void Bmc_SatPortStop( Bmc_Sat_t * p )   {}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the problem using the portfolio.]
+
+  Description [Without threads, the solvers are tried one after another
+  until one of them returns a definite answer.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Bmc_SatPortSolve( Bmc_Sat_t * p, int * pLits, int nLits )
+{
+    int i, status = 0;
+    p->iWinner = -1;
+    for ( i = 0; i < p->nMembers; i++ )
+    {
+        if ( p->pStop && *p->pStop )
+            break;
+        status = Bmc_SatSolve( p->pMembers[i], pLits, nLits );
+        if ( status == 0 )
+            continue;
+        p->iWinner = i;
+        p->pWins[i]++;
+        break;
+    }
+    return status;
+}
+
+#else // pthreads are used
+
+// the thread running one solver of the portfolio
+struct Bmc_SatThData_t_
+{
+    Bmc_SatPort_t *   pPort;         // the threads of the portfolio
+    int               iSolver;       // the solver of this thread
+    pthread_t         Thread;        // the thread
+};
+
+// the threads of the portfolio waiting for the next problem
+struct Bmc_SatPort_t_
+{
+    Bmc_SatThData_t   ThData[BMC_SAT_MAX];   // one thread for each solver
+    int               pStatus[BMC_SAT_MAX];  // the answers of the solvers
+    pthread_mutex_t   Mutex;         // protects the fields below
+    pthread_cond_t    CondStart;     // signals that a new problem is ready
+    pthread_cond_t    CondDone;      // signals that a solver has finished
+    Bmc_Sat_t *       pSat;          // the portfolio
+    int *             pLits;         // the assumptions of the current problem
+    int               nLits;         // the number of assumptions
+    int               iRound;        // the number of the current problem
+    int               nRunning;      // the number of solvers still working
+    int               fQuit;         // signals that the threads should exit
+};
+
+/**Function*************************************************************
+
+  Synopsis    [The thread running one solver of the portfolio.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Bmc_SatPortThread( void * pArg )
+{
+    Bmc_SatThData_t * pThData = (Bmc_SatThData_t *)pArg;
+    Bmc_SatPort_t * pPort = pThData->pPort;
+    Bmc_Sat_t * p = pPort->pSat;
+    int iSolver = pThData->iSolver;
+    int iRound = 0, status;
+    pthread_mutex_lock( &pPort->Mutex );
+    while ( 1 )
+    {
+        while ( pPort->iRound == iRound && !pPort->fQuit )
+            pthread_cond_wait( &pPort->CondStart, &pPort->Mutex );
+        if ( pPort->fQuit )
+            break;
+        iRound = pPort->iRound;
+        pthread_mutex_unlock( &pPort->Mutex );
+        status = Bmc_SatSolve( p->pMembers[iSolver], pPort->pLits, pPort->nLits );
+        pthread_mutex_lock( &pPort->Mutex );
+        pPort->pStatus[iSolver] = status;
+        if ( status != 0 && p->iWinner == -1 )
+        {
+            p->iWinner = iSolver;
+            atomic_store_explicit( &p->fStopRace, 1, memory_order_release );
+        }
+        pPort->nRunning--;
+        pthread_cond_signal( &pPort->CondDone );
+    }
+    pthread_mutex_unlock( &pPort->Mutex );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the threads of the portfolio.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Bmc_SatPortStart( Bmc_Sat_t * p )
+{
+    Bmc_SatPort_t * pPort = ABC_CALLOC( Bmc_SatPort_t, 1 );
+    int i, status;
+    pPort->pSat = p;
+    pthread_mutex_init( &pPort->Mutex, NULL );
+    pthread_cond_init( &pPort->CondStart, NULL );
+    pthread_cond_init( &pPort->CondDone, NULL );
+    p->pPort = pPort;
+    for ( i = 0; i < p->nMembers; i++ )
+    {
+        pPort->ThData[i].pPort   = pPort;
+        pPort->ThData[i].iSolver = i;
+        status = pthread_create( &pPort->ThData[i].Thread, NULL, Bmc_SatPortThread, (void *)(pPort->ThData + i) );  assert( status == 0 );
+    }
+}
+static void Bmc_SatPortStop( Bmc_Sat_t * p )
+{
+    Bmc_SatPort_t * pPort = p->pPort;
+    int i;
+    if ( pPort == NULL )
+        return;
+    pthread_mutex_lock( &pPort->Mutex );
+    pPort->fQuit = 1;
+    pthread_cond_broadcast( &pPort->CondStart );
+    pthread_mutex_unlock( &pPort->Mutex );
+    for ( i = 0; i < p->nMembers; i++ )
+        pthread_join( pPort->ThData[i].Thread, NULL );
+    pthread_cond_destroy( &pPort->CondStart );
+    pthread_cond_destroy( &pPort->CondDone );
+    pthread_mutex_destroy( &pPort->Mutex );
+    ABC_FREE( p->pPort );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the problem using the portfolio.]
+
+  Description [Wakes up the threads and waits until one of them returns
+  a definite answer, or all of them give up. The external stop flag is
+  checked every 10 milliseconds.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Bmc_SatPortSolve( Bmc_Sat_t * p, int * pLits, int nLits )
+{
+    Bmc_SatPort_t * pPort = p->pPort;
+    struct timespec Deadline;
+    struct timeval Now;
+    int status = 0;
+    pthread_mutex_lock( &pPort->Mutex );
+    pPort->pLits    = pLits;
+    pPort->nLits    = nLits;
+    pPort->nRunning = p->nMembers;
+    p->iWinner      = -1;
+    atomic_store_explicit( &p->fStopRace, 0, memory_order_release );
+    pPort->iRound++;
+    pthread_cond_broadcast( &pPort->CondStart );
+    while ( pPort->nRunning > 0 )
+    {
+        if ( p->pStop == NULL )
+        {
+            pthread_cond_wait( &pPort->CondDone, &pPort->Mutex );
+            continue;
+        }
+        if ( *p->pStop )
+            atomic_store_explicit( &p->fStopRace, 1, memory_order_release );
+        gettimeofday( &Now, NULL );
+        Deadline.tv_sec  = Now.tv_sec + (Now.tv_usec + 10000) / 1000000;
+        Deadline.tv_nsec = ((Now.tv_usec + 10000) % 1000000) * 1000;
+        pthread_cond_timedwait( &pPort->CondDone, &pPort->Mutex, &Deadline );
+    }
+    if ( p->iWinner >= 0 )
+    {
+        status = pPort->pStatus[p->iWinner];
+        p->pWins[p->iWinner]++;
+    }
+    atomic_store_explicit( &p->fStopRace, 0, memory_order_release );
+    pthread_mutex_unlock( &pPort->Mutex );
+    return status;
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -206,6 +206,7 @@ struct sat_solver_t
     // termination callback
     int         RunId;          // SAT id in this run
     int(*pFuncStop)(int);       // callback to terminate
+    int *       pStop;          // external flag to terminate
 };
 
 static inline clause * clause_read( sat_solver * s, cla h )          
@@ -361,6 +362,10 @@ static inline void sat_solver_set_stop_func( sat_solver *s, int (*fnct)(int) )
 { 
     s->pFuncStop = fnct; 
 }
+static inline void sat_solver_set_stop( sat_solver *s, int * pStop ) 
+{ 
+    s->pStop = pStop; 
+}
 
 static inline int sat_solver_add_const( sat_solver * pSat, int iVar, int fCompl )
 {
@@ -125,6 +125,11 @@ static inline void         Cnf_ObjSetBestCut( Aig_Obj_t * pObj, Cnf_Cut_t * pCut
 ///                    FUNCTION DECLARATIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/*=== cnfCache.c ========================================================*/
+extern word            Cnf_CacheAigHash( Aig_Man_t * p );
+extern Vec_Int_t *     Cnf_DeriveMappingArrayCache( Aig_Man_t * pAig );
+extern Cnf_Dat_t *     Cnf_DeriveWithManCache( Cnf_Man_t * p, Aig_Man_t * pAig, int nOutputs );
+extern Cnf_Dat_t *     Cnf_DeriveOtherWithManCache( Cnf_Man_t * p, Aig_Man_t * pAig, int fSkipTtMin );
 /*=== cnfCore.c ========================================================*/
 extern Vec_Int_t *     Cnf_DeriveMappingArray( Aig_Man_t * pAig );
 extern Cnf_Dat_t *     Cnf_Derive( Aig_Man_t * pAig, int nOutputs );
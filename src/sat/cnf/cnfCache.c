@@ -0,0 +1,394 @@
+/**CFile****************************************************************
+
+  FileName    [cnfCache.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [AIG-to-CNF conversion.]
+
+  Synopsis    [On-disk cache of CNF derived for the same AIG.]
+
+  Author      [LSV-PA contributors]
+  
+  Affiliation []
+
+  Date        [Ver. 1.0.]
+
+  Revision    [$Id: cnfCache.c $]
+
+***********************************************************************/
+
+#include "cnf.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+/*
+    The cache is enabled by "set cachedir <dir>" (see Abc_CacheMap()).
+    The key of the entry is the hash of the AIG structure and the kind
+    of CNF. The payload is an array of 32-bit integers, which starts with
+    the header below and the structure of the AIG (the type and the fanin
+    literals of each object), which is compared with that of the given AIG.
+    It continues with the clause literals, the clause starts, the optional
+    object-to-variable and object-to-clause maps, and the optional mapping.
+*/
+
+#define CNF_CACHE_KIND     0x434E4643  // "CNFC"
+#define CNF_CACHE_VERSION  2
+#define CNF_CACHE_HEADER   12
+
+enum {
+    CNF_CACHE_MAPPING = 1,             // Cnf_DeriveMappingArray()
+    CNF_CACHE_CNF     = 2,             // Cnf_DeriveWithMan()
+    CNF_CACHE_OTHER   = 3              // Cnf_DeriveOtherWithMan()
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the structure of the AIG.]
+
+  Description [Depends on object IDs, because the CNF refers to them.
+  The result is the start of the payload, the remaining header entries
+  are filled with zeros.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Vec_Int_t * Cnf_CacheAigStructure( Aig_Man_t * p, int Kind, int Param )
+{
+    Vec_Int_t * vData;
+    Aig_Obj_t * pObj;
+    int i, nObjs = Aig_ManObjNumMax(p);
+    vData = Vec_IntStart( CNF_CACHE_HEADER );
+    Vec_IntWriteEntry( vData, 0, Kind );
+    Vec_IntWriteEntry( vData, 1, Param );
+    Vec_IntWriteEntry( vData, 2, nObjs );
+    Vec_IntWriteEntry( vData, 3, Aig_ManCiNum(p) );
+    Vec_IntWriteEntry( vData, 4, Aig_ManCoNum(p) );
+    Vec_IntWriteEntry( vData, 5, Aig_ManRegNum(p) );
+    for ( i = 0; i < nObjs; i++ )
+    {
+        pObj = Aig_ManObj( p, i );
+        Vec_IntPush( vData, pObj ? (int)pObj->Type : -1 );
+        Vec_IntPush( vData, pObj && Aig_ObjFanin0(pObj) ? Abc_Var2Lit(Aig_ObjFaninId0(pObj), Aig_ObjFaninC0(pObj)) : -1 );
+        Vec_IntPush( vData, pObj && Aig_ObjFanin1(pObj) ? Abc_Var2Lit(Aig_ObjFaninId1(pObj), Aig_ObjFaninC1(pObj)) : -1 );
+    }
+    return vData;
+}
+static word Cnf_CacheStructureHash( Vec_Int_t * vData )
+{
+    word Hash = CNF_CACHE_VERSION;
+    int i, Entry;
+    Vec_IntForEachEntry( vData, Entry, i )
+        Hash = Abc_CacheHashWord( Hash, (word)(unsigned)Entry );
+    return Hash;
+}
+word Cnf_CacheAigHash( Aig_Man_t * p )
+{
+    Vec_Int_t * vData = Cnf_CacheAigStructure( p, 0, 0 );
+    word Hash = Cnf_CacheStructureHash( vData );
+    Vec_IntFree( vData );
+    return Hash;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the cached data and checks the structure.]
+
+  Description [Returns NULL if there is no usable data. Otherwise, returns
+  the payload, which should be released by Abc_CacheUnmap().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int * Cnf_CacheRead( Vec_Int_t * vStr, int * pnInts )
+{
+    size_t nSize;
+    int * pData = (int *)Abc_CacheMap( (char *)"cnfc", CNF_CACHE_KIND, CNF_CACHE_VERSION, Cnf_CacheStructureHash(vStr), &nSize );
+    *pnInts = (int)(nSize / sizeof(int));
+    if ( pData == NULL )
+        return NULL;
+    if ( nSize % sizeof(int) || *pnInts < Vec_IntSize(vStr) ||
+         memcmp( pData, Vec_IntArray(vStr), sizeof(int) * 6 ) ||
+         memcmp( pData + CNF_CACHE_HEADER, Vec_IntArray(vStr) + CNF_CACHE_HEADER, sizeof(int) * (Vec_IntSize(vStr) - CNF_CACHE_HEADER) ) )
+    {
+        Abc_CacheUnmap( pData, nSize );
+        return NULL;
+    }
+    return pData;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the data into the cache.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cnf_CacheWrite( Vec_Int_t * vStr, Cnf_Dat_t * pCnf, Vec_Int_t * vMapping )
+{
+    Vec_Int_t * vData;
+    int i, nObjs = Vec_IntEntry( vStr, 2 );
+    vData = Vec_IntAlloc( Vec_IntSize(vStr) + (pCnf ? pCnf->nLiterals + pCnf->nClauses + 3 * nObjs : 0) + (vMapping ? Vec_IntSize(vMapping) : 0) );
+    Vec_IntAppend( vData, vStr );
+    Vec_IntWriteEntry( vData, 6, pCnf ? pCnf->nVars : 0 );
+    Vec_IntWriteEntry( vData, 7, pCnf ? pCnf->nClauses : 0 );
+    Vec_IntWriteEntry( vData, 8, pCnf ? pCnf->nLiterals : 0 );
+    Vec_IntWriteEntry( vData, 9, pCnf && pCnf->pVarNums != NULL );
+    Vec_IntWriteEntry( vData, 10, pCnf && pCnf->pObj2Clause != NULL );
+    Vec_IntWriteEntry( vData, 11, vMapping ? Vec_IntSize(vMapping) : -1 );
+    if ( pCnf )
+    {
+        for ( i = 0; i < pCnf->nLiterals; i++ )
+            Vec_IntPush( vData, pCnf->pClauses[0][i] );
+        for ( i = 0; i < pCnf->nClauses; i++ )
+            Vec_IntPush( vData, (int)(pCnf->pClauses[i] - pCnf->pClauses[0]) );
+        if ( pCnf->pVarNums )
+            for ( i = 0; i < nObjs; i++ )
+                Vec_IntPush( vData, pCnf->pVarNums[i] );
+        if ( pCnf->pObj2Clause )
+            for ( i = 0; i < nObjs; i++ )
+                Vec_IntPush( vData, pCnf->pObj2Clause[i] );
+        if ( pCnf->pObj2Clause )
+            for ( i = 0; i < nObjs; i++ )
+                Vec_IntPush( vData, pCnf->pObj2Count[i] );
+    }
+    if ( vMapping )
+        Vec_IntAppend( vData, vMapping );
+    Abc_CacheWrite( (char *)"cnfc", CNF_CACHE_KIND, CNF_CACHE_VERSION, Cnf_CacheStructureHash(vStr), Vec_IntArray(vData), sizeof(int) * Vec_IntSize(vData) );
+    Vec_IntFree( vData );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks the cached data.]
+
+  Description [Checks that the literals refer to the variables, the clause
+  starts are increasing and within the literals, the object-to-clause map
+  refers to the clauses, and the mapping refers to its cuts and objects.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cnf_CacheCheckCnf( int * pData, int nInts )
+{
+    int * pLits, * pStarts, * pMap;
+    int nObjs     = pData[2];
+    int nVars     = pData[6];
+    int nClauses  = pData[7];
+    int nLiterals = pData[8];
+    int fVarNums  = pData[9];
+    int fObj2Cla  = pData[10];
+    int nMapping  = pData[11];
+    int i, k, Prev = 0;
+    if ( nVars < 0 || nClauses < 0 || nLiterals < 0 || (fVarNums & ~1) || (fObj2Cla & ~1) || nMapping < -1 )
+        return 0;
+    if ( (word)CNF_CACHE_HEADER + 3 * (word)nObjs + (word)nLiterals + (word)nClauses + (word)(fVarNums + 2 * fObj2Cla) * nObjs + (word)Abc_MaxInt(nMapping, 0) != (word)nInts )
+        return 0;
+    pLits   = pData + CNF_CACHE_HEADER + 3 * nObjs;
+    pStarts = pLits + nLiterals;
+    for ( i = 0; i < nLiterals; i++ )
+        if ( pLits[i] < 0 || pLits[i] >= 2 * nVars )
+            return 0;
+    for ( i = 0; i < nClauses; i++ )
+    {
+        if ( pStarts[i] < Prev || pStarts[i] > nLiterals || (i == 0 && pStarts[i] != 0) )
+            return 0;
+        Prev = pStarts[i];
+    }
+    pMap = pStarts + nClauses;
+    if ( fVarNums )
+    {
+        for ( i = 0; i < nObjs; i++ )
+            if ( pMap[i] < -1 || pMap[i] >= nVars )
+                return 0;
+        pMap += nObjs;
+    }
+    if ( fObj2Cla )
+    {
+        for ( i = 0; i < nObjs; i++ )
+            if ( pMap[i] != -1 && (pMap[i] < 0 || pMap[nObjs+i] < 0 || pMap[i] + pMap[nObjs+i] > nClauses) )
+                return 0;
+        pMap += 2 * nObjs;
+    }
+    if ( nMapping >= 0 )
+    {
+        if ( nMapping < nObjs )
+            return 0;
+        for ( i = 0; i < nObjs; i++ )
+        {
+            if ( pMap[i] == 0 )
+                continue;
+            if ( pMap[i] < nObjs || pMap[i] > nMapping - 5 )
+                return 0;
+            for ( k = 1; k < 5; k++ )
+                if ( pMap[pMap[i] + k] < -1 || pMap[pMap[i] + k] >= nObjs )
+                    return 0;
+        }
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Restores CNF from the cached data.]
+
+  Description [Returns NULL if the data does not pass the checks.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Cnf_Dat_t * Cnf_CacheDeriveCnf( Aig_Man_t * p, int * pData, int nInts, Vec_Int_t ** pvMapping )
+{
+    Cnf_Dat_t * pCnf;
+    int * pStop   = pData + nInts;
+    int nObjs     = pData[2];
+    int nVars     = pData[6];
+    int nClauses  = pData[7];
+    int nLiterals = pData[8];
+    int fVarNums  = pData[9];
+    int fObj2Cla  = pData[10];
+    int nMapping  = pData[11];
+    int i;
+    if ( !Cnf_CacheCheckCnf( pData, nInts ) )
+        return NULL;
+    pData += CNF_CACHE_HEADER + 3 * nObjs;
+    pCnf = ABC_CALLOC( Cnf_Dat_t, 1 );
+    pCnf->pMan      = p;
+    pCnf->nVars     = nVars;
+    pCnf->nLiterals = nLiterals;
+    pCnf->nClauses  = nClauses;
+    pCnf->pClauses  = ABC_ALLOC( int *, nClauses + 1 );
+    pCnf->pClauses[0] = ABC_ALLOC( int, Abc_MaxInt(nLiterals, 1) );
+    memcpy( pCnf->pClauses[0], pData, sizeof(int) * nLiterals );
+    pData += nLiterals;
+    for ( i = 0; i < nClauses; i++ )
+        pCnf->pClauses[i] = pCnf->pClauses[0] + pData[i];
+    pCnf->pClauses[nClauses] = pCnf->pClauses[0] + nLiterals;
+    pData += nClauses;
+    if ( fVarNums )
+    {
+        pCnf->pVarNums = ABC_ALLOC( int, nObjs );
+        memcpy( pCnf->pVarNums, pData, sizeof(int) * nObjs );
+        pData += nObjs;
+    }
+    if ( fObj2Cla )
+    {
+        pCnf->pObj2Clause = ABC_ALLOC( int, nObjs );
+        memcpy( pCnf->pObj2Clause, pData, sizeof(int) * nObjs );
+        pData += nObjs;
+        pCnf->pObj2Count = ABC_ALLOC( int, nObjs );
+        memcpy( pCnf->pObj2Count, pData, sizeof(int) * nObjs );
+        pData += nObjs;
+    }
+    if ( nMapping >= 0 )
+    {
+        if ( pvMapping )
+            *pvMapping = Vec_IntAllocArrayCopy( pData, nMapping );
+        pData += nMapping;
+    }
+    assert( pData == pStop );
+    return pCnf;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Cached versions of the CNF derivation procedures.]
+
+  Description [If the cache is disabled or does not contain the data,
+  derive the data and save it in the cache.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Cnf_DeriveMappingArrayCache( Aig_Man_t * pAig )
+{
+    Vec_Int_t * vStr = Cnf_CacheAigStructure( pAig, CNF_CACHE_MAPPING, 0 );
+    Vec_Int_t * vMapping = NULL;
+    Cnf_Dat_t * pCnf;
+    int nInts, * pData = Cnf_CacheRead( vStr, &nInts );
+    if ( pData )
+    {
+        pCnf = Cnf_CacheDeriveCnf( pAig, pData, nInts, &vMapping );
+        Abc_CacheUnmap( pData, sizeof(int) * nInts );
+        if ( pCnf )
+            Cnf_DataFree( pCnf );
+        if ( vMapping )
+        {
+            Vec_IntFree( vStr );
+            return vMapping;
+        }
+    }
+    vMapping = Cnf_DeriveMappingArray( pAig );
+    Cnf_CacheWrite( vStr, NULL, vMapping );
+    Vec_IntFree( vStr );
+    return vMapping;
+}
+Cnf_Dat_t * Cnf_DeriveWithManCache( Cnf_Man_t * p, Aig_Man_t * pAig, int nOutputs )
+{
+    Vec_Int_t * vStr = Cnf_CacheAigStructure( pAig, CNF_CACHE_CNF, nOutputs );
+    Cnf_Dat_t * pCnf = NULL;
+    int nInts, * pData = Cnf_CacheRead( vStr, &nInts );
+    if ( pData )
+    {
+        pCnf = Cnf_CacheDeriveCnf( pAig, pData, nInts, NULL );
+        Abc_CacheUnmap( pData, sizeof(int) * nInts );
+    }
+    if ( pCnf == NULL )
+    {
+        pCnf = Cnf_DeriveWithMan( p, pAig, nOutputs );
+        Cnf_CacheWrite( vStr, pCnf, NULL );
+    }
+    Vec_IntFree( vStr );
+    return pCnf;
+}
+Cnf_Dat_t * Cnf_DeriveOtherWithManCache( Cnf_Man_t * p, Aig_Man_t * pAig, int fSkipTtMin )
+{
+    Vec_Int_t * vStr = Cnf_CacheAigStructure( pAig, CNF_CACHE_OTHER, fSkipTtMin );
+    Vec_Int_t * vMapping = NULL;
+    Cnf_Dat_t * pCnf = NULL;
+    int nInts, * pData = Cnf_CacheRead( vStr, &nInts );
+    if ( pData )
+    {
+        pCnf = Cnf_CacheDeriveCnf( pAig, pData, nInts, &vMapping );
+        Abc_CacheUnmap( pData, sizeof(int) * nInts );
+        if ( pCnf )
+            pCnf->vMapping = vMapping;
+    }
+    if ( pCnf == NULL )
+    {
+        pCnf = Cnf_DeriveOtherWithMan( p, pAig, fSkipTtMin );
+        Cnf_CacheWrite( vStr, pCnf, pCnf->vMapping );
+    }
+    Vec_IntFree( vStr );
+    return pCnf;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
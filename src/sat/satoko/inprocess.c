@@ -0,0 +1,566 @@
+//===--- inprocess.c --------------------------------------------------------===
+//
+//                     satoko: Satisfiability solver
+//
+// This file is distributed under the BSD 2-Clause License.
+// See LICENSE for details.
+//
+//===------------------------------------------------------------------------===
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "solver.h"
+
+#include "misc/util/abc_global.h"
+ABC_NAMESPACE_IMPL_START
+
+/* Max n.of literal visits spent on backward subsumption per round */
+#define SUBSUME_STEPS_LIMIT 20000000
+
+/* Inprocessing only rewrites clauses and variables added after the bookmark,
+ * so that 'satoko_rollback' keeps restoring a consistent database. */
+struct inproc {
+    unsigned first_orig;
+    unsigned first_lrnt;
+    unsigned first_var;
+    vec_uint_t **occurs;   /* Per literal: in-scope clauses containing it */
+    vec_uint_t *lits;
+    vec_uint_t *stamps;    /* Per literal stamps */
+    unsigned stamp;
+};
+
+//===------------------------------------------------------------------------===
+// Inprocessing internal functions
+//===------------------------------------------------------------------------===
+static inline void clause_delete(solver_t *s, unsigned cref, int f_watched)
+{
+    struct clause *clause = clause_fetch(s, cref);
+
+    assert(clause->f_mark == 0);
+    if (f_watched)
+        clause_unwatch(s, cref);
+    clause->f_mark = 1;
+    if (clause->f_learnt)
+        s->stats.n_learnt_lits -= clause->size;
+    else
+        s->stats.n_original_lits -= clause->size;
+    cdb_remove(s->all_clauses, clause);
+}
+
+static inline int clause_is_root_sat(solver_t *s, struct clause *clause)
+{
+    unsigned i;
+    for (i = 0; i < clause->size; i++)
+        if (lit_value(s, clause->data[i].lit) == SATOKO_LIT_TRUE)
+            return 1;
+    return 0;
+}
+
+static inline void clause_vec_compact(solver_t *s, vec_uint_t *crefs, unsigned start)
+{
+    unsigned i, j, cref;
+
+    for (i = j = start; i < vec_uint_size(crefs); i++) {
+        cref = vec_uint_at(crefs, i);
+        if (!clause_fetch(s, cref)->f_mark)
+            vec_uint_assign(crefs, j++, cref);
+    }
+    vec_uint_shrink(crefs, j);
+}
+
+/** Adds a level-0 unit and propagates it; returns SATOKO_ERR on conflict */
+static inline int solver_add_unit(solver_t *s, unsigned lit)
+{
+    if (lit_value(s, lit) == SATOKO_LIT_TRUE)
+        return SATOKO_OK;
+    if (lit_value(s, lit) == SATOKO_LIT_FALSE)
+        return SATOKO_ERR;
+    solver_enqueue(s, lit, UNDEF);
+    return solver_propagate(s) == UNDEF ? SATOKO_OK : SATOKO_ERR;
+}
+
+static inline void solver_clean_root_reasons(solver_t *s)
+{
+    unsigned i;
+    for (i = 0; i < vec_uint_size(s->trail); i++)
+        vec_uint_assign(s->reasons, lit2var(vec_uint_at(s->trail, i)), UNDEF);
+}
+
+static inline void occurs_push(struct inproc *p, solver_t *s, unsigned cref)
+{
+    unsigned i;
+    struct clause *clause = clause_fetch(s, cref);
+    for (i = 0; i < clause->size; i++)
+        vec_uint_push_back(p->occurs[clause->data[i].lit], cref);
+}
+
+/** Builds occurrence lists of the in-scope clauses, dropping the satisfied ones */
+static void occurs_build(struct inproc *p, solver_t *s)
+{
+    unsigned i, cref;
+
+    for (i = 0; i < 2 * vec_char_size(s->assigns); i++)
+        vec_uint_clear(p->occurs[i]);
+    vec_uint_foreach_start(s->originals, cref, i, p->first_orig) {
+        struct clause *clause = clause_fetch(s, cref);
+        if (clause->f_mark)
+            continue;
+        if (clause_is_root_sat(s, clause))
+            clause_delete(s, cref, 1);
+        else
+            occurs_push(p, s, cref);
+    }
+    vec_uint_foreach_start(s->learnts, cref, i, p->first_lrnt) {
+        struct clause *clause = clause_fetch(s, cref);
+        if (clause->f_mark)
+            continue;
+        if (clause_is_root_sat(s, clause))
+            clause_delete(s, cref, 1);
+        else
+            occurs_push(p, s, cref);
+    }
+}
+
+//===------------------------------------------------------------------------===
+// Vivification
+//===------------------------------------------------------------------------===
+/** Shrinks a clause by propagating the negation of its literals one by one */
+static int clause_vivify(solver_t *s, struct inproc *p, unsigned cref)
+{
+    struct clause *clause = clause_fetch(s, cref);
+    unsigned i, lit, lbd = clause->lbd, size = clause->size;
+    unsigned f_learnt = clause->f_learnt;
+    int f_sat = 0;
+
+    vec_uint_clear(p->lits);
+    clause_unwatch(s, cref);
+    for (i = 0; i < size; i++) {
+        lit = clause->data[i].lit;
+        if (lit_value(s, lit) == SATOKO_LIT_FALSE)
+            continue;
+        if (lit_value(s, lit) == SATOKO_LIT_TRUE) {
+            if (lit_dlevel(s, lit) == 0)
+                f_sat = 1;
+            else
+                vec_uint_push_back(p->lits, lit);
+            break;
+        }
+        vec_uint_push_back(p->lits, lit);
+        if (i == size - 1)
+            break;
+        vec_uint_push_back(s->trail_lim, vec_uint_size(s->trail));
+        solver_enqueue(s, lit_compl(lit), UNDEF);
+        if (solver_propagate(s) != UNDEF)
+            break;
+    }
+    solver_cancel_until(s, 0);
+    if (!f_sat && vec_uint_size(p->lits) == size) {
+        clause_watch(s, cref);
+        return SATOKO_OK;
+    }
+    clause_delete(s, cref, 0);
+    if (f_sat)
+        return SATOKO_OK;
+    s->stats.n_vivified++;
+    if (vec_uint_size(p->lits) == 0)
+        return SATOKO_ERR;
+    if (vec_uint_size(p->lits) == 1)
+        return solver_add_unit(s, vec_uint_at(p->lits, 0));
+    cref = solver_clause_create(s, p->lits, f_learnt);
+    clause = clause_fetch(s, cref);
+    if (f_learnt)
+        clause->lbd = lbd < clause->size ? lbd : clause->size;
+    clause_watch(s, cref);
+    return SATOKO_OK;
+}
+
+static int solver_vivify(solver_t *s, struct inproc *p)
+{
+    long n_props_limit = s->stats.n_propagations_all + s->opts.n_props_vivify;
+    unsigned i, n_learnts = vec_uint_size(s->learnts);
+    unsigned n_originals = vec_uint_size(s->originals);
+
+    /* Recent learnt clauses first, newly created clauses are not revisited */
+    for (i = n_learnts; i --> p->first_lrnt;) {
+        struct clause *clause = clause_fetch(s, vec_uint_at(s->learnts, i));
+        if (s->stats.n_propagations_all > n_props_limit)
+            return SATOKO_OK;
+        if (clause->f_mark || clause->size < 3)
+            continue;
+        if (clause_vivify(s, p, vec_uint_at(s->learnts, i)) == SATOKO_ERR)
+            return SATOKO_ERR;
+    }
+    for (i = p->first_orig; i < n_originals; i++) {
+        struct clause *clause = clause_fetch(s, vec_uint_at(s->originals, i));
+        if (s->stats.n_propagations_all > n_props_limit)
+            return SATOKO_OK;
+        if (clause->f_mark || clause->size < 3)
+            continue;
+        if (clause_vivify(s, p, vec_uint_at(s->originals, i)) == SATOKO_ERR)
+            return SATOKO_ERR;
+    }
+    return SATOKO_OK;
+}
+
+//===------------------------------------------------------------------------===
+// Backward subsumption
+//===------------------------------------------------------------------------===
+static int clause_size_compare(const void *p1, const void *p2)
+{
+    const struct clause *c1 = *(const struct clause **)p1;
+    const struct clause *c2 = *(const struct clause **)p2;
+    return (int)(c1->size > c2->size) - (int)(c1->size < c2->size);
+}
+
+static void solver_subsume(solver_t *s, struct inproc *p)
+{
+    long n_steps = 0;
+    unsigned i, j, k, cref, n_clauses = 0;
+    struct clause **clauses;
+
+    occurs_build(p, s);
+    clauses = satoko_alloc(struct clause *, vec_uint_size(s->originals) + vec_uint_size(s->learnts));
+    vec_uint_foreach_start(s->originals, cref, i, p->first_orig)
+        if (!clause_fetch(s, cref)->f_mark)
+            clauses[n_clauses++] = clause_fetch(s, cref);
+    vec_uint_foreach_start(s->learnts, cref, i, p->first_lrnt)
+        if (!clause_fetch(s, cref)->f_mark)
+            clauses[n_clauses++] = clause_fetch(s, cref);
+    qsort((void *)clauses, (size_t)n_clauses, sizeof(struct clause *), clause_size_compare);
+
+    for (i = 0; i < n_clauses && n_steps < SUBSUME_STEPS_LIMIT; i++) {
+        struct clause *clause = clauses[i];
+        unsigned min_lit = UNDEF;
+        vec_uint_t *occurs;
+
+        if (clause->f_mark)
+            continue;
+        p->stamp++;
+        for (j = 0; j < clause->size; j++) {
+            unsigned lit = clause->data[j].lit;
+            vec_uint_assign(p->stamps, lit, p->stamp);
+            if (min_lit == UNDEF || vec_uint_size(p->occurs[lit]) < vec_uint_size(p->occurs[min_lit]))
+                min_lit = lit;
+        }
+        cref = cdb_cref(s->all_clauses, (unsigned *)clause);
+        occurs = p->occurs[min_lit];
+        for (j = 0; j < vec_uint_size(occurs); j++) {
+            unsigned other_cref = vec_uint_at(occurs, j);
+            struct clause *other = clause_fetch(s, other_cref);
+            unsigned n_found = 0;
+
+            if (other_cref == cref || other->f_mark || other->size < clause->size)
+                continue;
+            /* A learnt clause cannot replace an original one */
+            if (clause->f_learnt && !other->f_learnt)
+                continue;
+            n_steps += other->size;
+            for (k = 0; k < other->size; k++)
+                n_found += (vec_uint_at(p->stamps, other->data[k].lit) == p->stamp);
+            if (n_found < clause->size)
+                continue;
+            clause_delete(s, other_cref, 1);
+            s->stats.n_subsumed++;
+        }
+    }
+    satoko_free(clauses);
+}
+
+//===------------------------------------------------------------------------===
+// Bounded variable elimination
+//===------------------------------------------------------------------------===
+/** Computes the resolvent on 'var' in p->lits; returns 0 if it is satisfied */
+static int clause_resolve(solver_t *s, struct inproc *p, unsigned pos_cref, unsigned neg_cref, unsigned var)
+{
+    struct clause *pos = clause_fetch(s, pos_cref);
+    struct clause *neg = clause_fetch(s, neg_cref);
+    unsigned i, lit;
+
+    vec_uint_clear(p->lits);
+    p->stamp++;
+    for (i = 0; i < pos->size; i++) {
+        lit = pos->data[i].lit;
+        if (lit2var(lit) == var || lit_value(s, lit) == SATOKO_LIT_FALSE)
+            continue;
+        if (lit_value(s, lit) == SATOKO_LIT_TRUE)
+            return 0;
+        vec_uint_assign(p->stamps, lit, p->stamp);
+        vec_uint_push_back(p->lits, lit);
+    }
+    for (i = 0; i < neg->size; i++) {
+        lit = neg->data[i].lit;
+        if (lit2var(lit) == var || lit_value(s, lit) == SATOKO_LIT_FALSE)
+            continue;
+        if (lit_value(s, lit) == SATOKO_LIT_TRUE ||
+            vec_uint_at(p->stamps, lit_compl(lit)) == p->stamp)
+            return 0;
+        if (vec_uint_at(p->stamps, lit) != p->stamp)
+            vec_uint_push_back(p->lits, lit);
+    }
+    return 1;
+}
+
+/** Collects the live original clauses in which 'lit' occurs */
+static void occurs_collect(solver_t *s, vec_uint_t *occurs, vec_uint_t *crefs)
+{
+    unsigned i, cref;
+
+    vec_uint_clear(crefs);
+    vec_uint_foreach(occurs, cref, i) {
+        struct clause *clause = clause_fetch(s, cref);
+        if (!clause->f_mark && !clause->f_learnt)
+            vec_uint_push_back(crefs, cref);
+    }
+}
+
+static inline void elim_stack_push_clause(solver_t *s, unsigned cref, unsigned lit)
+{
+    struct clause *clause = clause_fetch(s, cref);
+    unsigned i;
+
+    vec_uint_push_back(s->elim_stack, lit);
+    for (i = 0; i < clause->size; i++)
+        if (clause->data[i].lit != lit)
+            vec_uint_push_back(s->elim_stack, clause->data[i].lit);
+    vec_uint_push_back(s->elim_stack, clause->size);
+}
+
+static int var_try_eliminate(solver_t *s, struct inproc *p, unsigned var, vec_uint_t *pos, vec_uint_t *neg)
+{
+    unsigned i, j, cref, n_resolvents = 0;
+    unsigned pos_lit = var2lit(var, 0), neg_lit = var2lit(var, 1);
+
+    occurs_collect(s, p->occurs[pos_lit], pos);
+    occurs_collect(s, p->occurs[neg_lit], neg);
+    if (vec_uint_size(pos) > s->opts.bve_max_occ || vec_uint_size(neg) > s->opts.bve_max_occ)
+        return SATOKO_OK;
+    for (i = 0; i < vec_uint_size(pos); i++)
+        for (j = 0; j < vec_uint_size(neg); j++) {
+            if (!clause_resolve(s, p, vec_uint_at(pos, i), vec_uint_at(neg, j), var))
+                continue;
+            if (vec_uint_size(p->lits) > s->opts.bve_max_resolvent ||
+                ++n_resolvents > vec_uint_size(pos) + vec_uint_size(neg))
+                return SATOKO_OK;
+        }
+
+    /* Save the clauses for model extension and replace them by resolvents */
+    vec_uint_foreach(pos, cref, i)
+        elim_stack_push_clause(s, cref, pos_lit);
+    vec_uint_foreach(neg, cref, i)
+        elim_stack_push_clause(s, cref, neg_lit);
+    vec_uint_push_back(s->elim_stack, vec_uint_size(pos) + vec_uint_size(neg));
+    vec_uint_push_back(s->elim_stack, var);
+    vec_char_assign(s->eliminated, var, 1);
+    s->stats.n_eliminated++;
+    for (i = 0; i < 2; i++) {
+        vec_uint_t *occurs = p->occurs[var2lit(var, (char)i)];
+        vec_uint_foreach(occurs, cref, j)
+            if (!clause_fetch(s, cref)->f_mark)
+                clause_delete(s, cref, 1);
+    }
+    for (i = 0; i < vec_uint_size(pos); i++)
+        for (j = 0; j < vec_uint_size(neg); j++) {
+            if (!clause_resolve(s, p, vec_uint_at(pos, i), vec_uint_at(neg, j), var))
+                continue;
+            if (vec_uint_size(p->lits) == 0)
+                return SATOKO_ERR;
+            if (vec_uint_size(p->lits) == 1) {
+                if (solver_add_unit(s, vec_uint_at(p->lits, 0)) == SATOKO_ERR)
+                    return SATOKO_ERR;
+                continue;
+            }
+            cref = solver_clause_create(s, p->lits, 0);
+            clause_watch(s, cref);
+            occurs_push(p, s, cref);
+        }
+    return SATOKO_OK;
+}
+
+static int var_cost_compare(const void *p1, const void *p2)
+{
+    const unsigned *e1 = (const unsigned *)p1;
+    const unsigned *e2 = (const unsigned *)p2;
+    return (int)(e1[0] > e2[0]) - (int)(e1[0] < e2[0]);
+}
+
+static int solver_eliminate(solver_t *s, struct inproc *p)
+{
+    unsigned var, i, n_cands = 0;
+    unsigned *cands = satoko_alloc(unsigned, 2 * vec_char_size(s->assigns));
+    vec_uint_t *pos = vec_uint_alloc(0);
+    vec_uint_t *neg = vec_uint_alloc(0);
+    int status = SATOKO_OK;
+
+    occurs_build(p, s);
+    /* Cheapest variables first: pairs of (n.of occurrences, var) */
+    for (var = p->first_var; var < vec_char_size(s->assigns); var++) {
+        unsigned n_pos = vec_uint_size(p->occurs[var2lit(var, 0)]);
+        unsigned n_neg = vec_uint_size(p->occurs[var2lit(var, 1)]);
+        if (var_frozen(s, var) || var_eliminated(s, var) || var_value(s, var) != SATOKO_VAR_UNASSING)
+            continue;
+        if (n_pos + n_neg == 0 || n_pos > 2 * s->opts.bve_max_occ || n_neg > 2 * s->opts.bve_max_occ)
+            continue;
+        cands[2 * n_cands] = n_pos * n_neg;
+        cands[2 * n_cands + 1] = var;
+        n_cands++;
+    }
+    qsort((void *)cands, (size_t)n_cands, 2 * sizeof(unsigned), var_cost_compare);
+    for (i = 0; i < n_cands && !solver_stop(s); i++) {
+        var = cands[2 * i + 1];
+        if (var_value(s, var) != SATOKO_VAR_UNASSING)
+            continue;
+        if ((status = var_try_eliminate(s, p, var, pos, neg)) == SATOKO_ERR)
+            break;
+    }
+    vec_uint_free(pos);
+    vec_uint_free(neg);
+    satoko_free(cands);
+    return status;
+}
+
+/** Pops the blocks of restored variables from the top of the stack */
+static void elim_stack_trim(solver_t *s)
+{
+    unsigned size = vec_uint_size(s->elim_stack);
+
+    while (size > 0 && vec_uint_at(s->elim_stack, size - 1) == UNDEF) {
+        unsigned n_clauses = vec_uint_at(s->elim_stack, size - 2);
+        size -= 2;
+        while (n_clauses--)
+            size -= vec_uint_at(s->elim_stack, size - 1) + 1;
+    }
+    vec_uint_shrink(s->elim_stack, size);
+}
+
+//===------------------------------------------------------------------------===
+// Solver external functions
+//===------------------------------------------------------------------------===
+int solver_inprocess(solver_t *s)
+{
+    struct inproc p;
+    unsigned i, var, n_lits = 2 * vec_char_size(s->assigns);
+    int status = SATOKO_OK;
+
+    assert(solver_dlevel(s) == 0);
+    if (s->status == SATOKO_ERR || solver_propagate(s) != UNDEF)
+        return (s->status = SATOKO_ERR);
+    if (solver_has_marks(s))
+        return SATOKO_OK;
+    s->stats.n_inprocess++;
+    solver_clean_root_reasons(s);
+    if (vec_uint_size(s->elim_stack) > s->book_elim)
+        elim_stack_trim(s);
+
+    p.first_orig = s->book_vars ? s->book_cl_orig : 0;
+    p.first_lrnt = s->book_vars ? s->book_cl_lrnt : 0;
+    p.first_var = s->book_vars;
+    p.occurs = satoko_alloc(vec_uint_t *, n_lits);
+    for (i = 0; i < n_lits; i++)
+        p.occurs[i] = vec_uint_alloc(0);
+    p.lits = vec_uint_alloc(0);
+    p.stamps = vec_uint_init(n_lits, 0);
+    p.stamp = 0;
+
+    if (s->opts.n_props_vivify)
+        status = solver_vivify(s, &p);
+    if (status == SATOKO_OK)
+        solver_subsume(s, &p);
+    if (status == SATOKO_OK && s->opts.bve_max_occ)
+        status = solver_eliminate(s, &p);
+
+    for (i = 0; i < n_lits; i++)
+        vec_uint_free(p.occurs[i]);
+    satoko_free(p.occurs);
+    vec_uint_free(p.lits);
+    vec_uint_free(p.stamps);
+
+    clause_vec_compact(s, s->originals, p.first_orig);
+    clause_vec_compact(s, s->learnts, p.first_lrnt);
+    if (status == SATOKO_ERR)
+        return (s->status = SATOKO_ERR);
+    solver_clean_root_reasons(s);
+    /* Rebuild the decision heap without the eliminated variables */
+    vec_uint_clear(s->temp_lits);
+    for (var = 0; var < vec_char_size(s->assigns); var++)
+        if (var_value(s, var) == SATOKO_VAR_UNASSING && !var_eliminated(s, var))
+            vec_uint_push_back(s->temp_lits, var);
+    heap_build(s->var_order, s->temp_lits);
+    if (s->opts.verbose)
+        printf("inprocess: %ld vivified, %ld subsumed, %ld eliminated\n",
+               s->stats.n_vivified, s->stats.n_subsumed, s->stats.n_eliminated);
+    return SATOKO_OK;
+}
+
+/** Assigns the eliminated variables, latest elimination first */
+void solver_extend_model(solver_t *s)
+{
+    unsigned i = vec_uint_size(s->elim_stack);
+
+    while (i > 0) {
+        unsigned var = vec_uint_at(s->elim_stack, i - 1);
+        unsigned n_clauses = vec_uint_at(s->elim_stack, i - 2);
+        i -= 2;
+        while (n_clauses--) {
+            unsigned size = vec_uint_at(s->elim_stack, i - 1);
+            unsigned first = i - 1 - size, k;
+            i = first;
+            if (var == UNDEF)
+                continue;
+            for (k = first; k < first + size; k++) {
+                unsigned lit = vec_uint_at(s->elim_stack, k);
+                if (satoko_var_polarity(s, lit2var(lit)) == lit_polarity(lit))
+                    break;
+            }
+            if (k == first + size)
+                vec_char_assign(s->polarity, var, lit_polarity(vec_uint_at(s->elim_stack, first)));
+        }
+    }
+}
+
+/** Brings an eliminated variable back together with its clauses */
+void solver_restore_var(solver_t *s, unsigned var)
+{
+    unsigned i = vec_uint_size(s->elim_stack);
+    vec_uint_t *lits;
+
+    assert(var_eliminated(s, var));
+    solver_cancel_until(s, 0);
+    vec_char_assign(s->eliminated, var, 0);
+    if (!heap_in_heap(s->var_order, var))
+        heap_insert(s->var_order, var);
+    lits = vec_uint_alloc(0);
+    while (i > 0) {
+        unsigned block_var = vec_uint_at(s->elim_stack, i - 1);
+        unsigned n_clauses = vec_uint_at(s->elim_stack, i - 2);
+        i -= 2;
+        if (block_var == var)
+            vec_uint_assign(s->elim_stack, i + 1, UNDEF);
+        while (n_clauses--) {
+            unsigned size = vec_uint_at(s->elim_stack, i - 1);
+            i -= size + 1;
+            if (block_var != var)
+                continue;
+            /* Re-adding may restore other variables, but never pops the stack */
+            vec_uint_clear(lits);
+            vec_uint_resize(lits, size);
+            memcpy(vec_uint_data(lits), vec_uint_data(s->elim_stack) + i, sizeof(unsigned) * size);
+            satoko_add_clause(s, (int *)vec_uint_data(lits), (int)size);
+        }
+        if (block_var == var)
+            break;
+    }
+    vec_uint_free(lits);
+}
+
+void solver_restore_all(solver_t *s)
+{
+    unsigned var;
+
+    for (var = 0; var < vec_char_size(s->eliminated); var++)
+        if (var_eliminated(s, var))
+            solver_restore_var(s, var);
+    vec_uint_clear(s->elim_stack);
+}
+
+ABC_NAMESPACE_IMPL_END
@@ -64,6 +64,14 @@ struct satoko_opts {
     /* Binary resolution */
     unsigned clause_max_sz_bin_resol;
     unsigned clause_min_lbd_bin_resol;
+
+    /* Inprocessing (vivification, subsumption and variable elimination) */
+    char inprocess;              /* Enables inprocessing at decision level 0 */
+    unsigned n_conf_inprocess;   /* N.of conflicts between inprocessing rounds */
+    unsigned n_props_vivify;     /* Max n.of propagations spent on vivification per round */
+    unsigned bve_max_occ;        /* Max n.of occurrences of a literal of an eliminated variable */
+    unsigned bve_max_resolvent;  /* Max size of a resolvent of an eliminated variable */
+
     float garbage_max_ratio;
     char verbose;
     char no_simplify;
@@ -83,6 +91,11 @@ struct satoko_stats {
 
     long n_original_lits;
     long n_learnt_lits;
+
+    unsigned n_inprocess;
+    long n_vivified;
+    long n_subsumed;
+    long n_eliminated;
 };
 
 
@@ -106,6 +119,12 @@ extern int  satoko_solve_assumptions_limit(satoko_t *s, int * plits, int nlits,
 extern int  satoko_minimize_assumptions(satoko_t *s, int * plits, int nlits, int nconflim);
 extern void satoko_mark_cone(satoko_t *, int *, int);
 extern void satoko_unmark_cone(satoko_t *, int *, int);
+/* Inprocessing simplifies the clause database at decision level 0. Variable
+ * elimination never removes frozen variables; variables used in assumptions
+ * are frozen automatically. An eliminated variable is brought back with its
+ * clauses when it appears in a new clause, an assumption or a cone. */
+extern void satoko_freeze_var(satoko_t *, int, int);
+extern int  satoko_inprocess(satoko_t *);
 
 extern void satoko_rollback(satoko_t *);
 extern void satoko_bookmark(satoko_t *);
@@ -194,6 +194,8 @@ static inline unsigned solver_decide(solver_t *s)
         next_var = heap_remove_min(s->var_order);
         if (solver_has_marks(s) && !var_mark(s, next_var))
             next_var = UNDEF;
+        else if (var_eliminated(s, next_var))
+            next_var = UNDEF;
     }
     return var2lit(next_var, satoko_var_polarity(s, next_var));
 }
@@ -429,14 +431,15 @@ static inline void solver_garbage_collect(solver_t *s)
 static inline void solver_reduce_cdb(solver_t *s)
 {
     unsigned i, limit;
-    unsigned n_learnts = vec_uint_size(s->learnts);
+    unsigned n_learnts = vec_uint_size(s->learnts) - s->book_cl_lrnt;
     unsigned cref;
     struct clause *clause;
     struct clause **learnts_cls;
 
+    /* Learnt clauses before the bookmark are kept in place */
     learnts_cls = satoko_alloc(struct clause *, n_learnts);
     vec_uint_foreach_start(s->learnts, cref, i, s->book_cl_lrnt)
-        learnts_cls[i] = clause_fetch(s, cref);
+        learnts_cls[i - s->book_cl_lrnt] = clause_fetch(s, cref);
 
     limit = (unsigned)(n_learnts * s->opts.learnt_ratio);
 
@@ -448,7 +451,7 @@ static inline void solver_reduce_cdb(solver_t *s)
     if (learnts_cls[n_learnts - 1]->lbd <= 6)
         s->RC2 += s->opts.inc_special_reduce;
 
-    vec_uint_clear(s->learnts);
+    vec_uint_shrink(s->learnts, s->book_cl_lrnt);
     for (i = 0; i < n_learnts; i++) {
         clause = learnts_cls[i];
         cref = cdb_cref(s->all_clauses, (unsigned *)clause);
@@ -653,8 +656,16 @@ char solver_search(solver_t *s)
             if (!s->opts.no_simplify && solver_dlevel(s) == 0)
                 satoko_simplify(s);
 
+            /* Vivify, subsume and eliminate variables between restarts */
+            if (s->opts.inprocess && solver_dlevel(s) == 0 &&
+                s->stats.n_conflicts_all >= s->n_confl_bfr_inprocess) {
+                if (solver_inprocess(s) == SATOKO_ERR)
+                    return SATOKO_UNSAT;
+                s->n_confl_bfr_inprocess = s->stats.n_conflicts_all + s->opts.n_conf_inprocess;
+            }
+
             /* Reduce the set of learnt clauses */
-            if (s->opts.learnt_ratio && vec_uint_size(s->learnts) > 100 &&
+            if (s->opts.learnt_ratio && vec_uint_size(s->learnts) - s->book_cl_lrnt > 100 &&
                 s->stats.n_conflicts >= s->n_confl_bfr_reduce) {
                 s->RC1 = (s->stats.n_conflicts / s->RC2) + 1;
                 solver_reduce_cdb(s);
@@ -99,6 +99,13 @@ struct solver_t_ {
 
     /* Temporary data used for solving cones */
     vec_char_t *marks;
+
+    /* Inprocessing */
+    vec_char_t *frozen;      /* Variables that cannot be eliminated */
+    vec_char_t *eliminated;  /* Variables removed by variable elimination */
+    vec_uint_t *elim_stack;  /* Clauses removed by variable elimination */
+    unsigned book_elim;      /* Bookmark elimination stack size */
+    long n_confl_bfr_inprocess;
     
     /* Callbacks to stop the solver */
     abctime nRuntimeLimit;
@@ -116,6 +123,12 @@ extern char solver_search(solver_t *);
 extern void solver_cancel_until(solver_t *, unsigned);
 extern unsigned solver_propagate(solver_t *);
 
+/* Inprocessing */
+extern int  solver_inprocess(solver_t *);
+extern void solver_extend_model(solver_t *);
+extern void solver_restore_var(solver_t *, unsigned);
+extern void solver_restore_all(solver_t *);
+
 /* Debuging */
 extern void solver_debug_check(solver_t *, int);
 extern void solver_debug_check_trail(solver_t *);
@@ -162,6 +175,14 @@ static inline void var_clean_mark(solver_t *s, unsigned var)
 {
     vec_char_assign(s->marks, var, 0);
 }
+static inline int var_frozen(solver_t *s, unsigned var)
+{
+    return (int)vec_char_at(s->frozen, var);
+}
+static inline int var_eliminated(solver_t *s, unsigned var)
+{
+    return (int)vec_char_at(s->eliminated, var);
+}
 //===------------------------------------------------------------------------===
 // Inline lit functions
 //===------------------------------------------------------------------------===
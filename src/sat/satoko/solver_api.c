@@ -27,7 +27,7 @@ static inline void solver_rebuild_order(solver_t *s)
     vec_uint_t *vars = vec_uint_alloc(vec_char_size(s->assigns));
 
     for (var = 0; var < vec_char_size(s->assigns); var++)
-        if (var_value(s, var) == SATOKO_VAR_UNASSING)
+        if (var_value(s, var) == SATOKO_VAR_UNASSING && !var_eliminated(s, var))
             vec_uint_push_back(vars, var);
     heap_build(s->var_order, vars);
     vec_uint_free(vars);
@@ -80,6 +80,12 @@ static inline void print_stats(solver_t *s)
     printf("conflicts     : %10ld\n", s->stats.n_conflicts);
     printf("decisions     : %10ld\n", s->stats.n_decisions);
     printf("propagations  : %10ld\n", s->stats.n_propagations);
+    if (s->stats.n_inprocess) {
+        printf("inprocessing  : %10d\n", s->stats.n_inprocess);
+        printf("  vivified    : %10ld\n", s->stats.n_vivified);
+        printf("  subsumed    : %10ld\n", s->stats.n_subsumed);
+        printf("  eliminated  : %10ld\n", s->stats.n_eliminated);
+    }
 }
 
 //===------------------------------------------------------------------------===
@@ -126,6 +132,11 @@ solver_t * satoko_create()
     s->last_dlevel = vec_uint_alloc(0);
     /* Misc temporary */
     s->stamps = vec_uint_alloc(0);
+    /* Inprocessing */
+    s->frozen = vec_char_alloc(0);
+    s->eliminated = vec_char_alloc(0);
+    s->elim_stack = vec_uint_alloc(0);
+    s->n_confl_bfr_inprocess = 0;
     return s;
 }
 
@@ -153,6 +164,9 @@ void satoko_destroy(solver_t *s)
     vec_uint_free(s->stack);
     vec_uint_free(s->last_dlevel);
     vec_uint_free(s->stamps);
+    vec_char_free(s->frozen);
+    vec_char_free(s->eliminated);
+    vec_uint_free(s->elim_stack);
     if (s->marks)
         vec_char_free(s->marks);
     satoko_free(s);
@@ -186,6 +200,12 @@ void satoko_default_opts(satoko_opts_t *opts)
     /* Binary resolution */
     opts->clause_max_sz_bin_resol = 30;
     opts->clause_min_lbd_bin_resol = 6;
+    /* Inprocessing */
+    opts->inprocess = 0;
+    opts->n_conf_inprocess = 10000;
+    opts->n_props_vivify = 1000000;
+    opts->bve_max_occ = 16;
+    opts->bve_max_resolvent = 20;
 
     opts->garbage_max_ratio = (float) 0.3;
 }
@@ -246,6 +266,8 @@ int satoko_add_variable(solver_t *s, char sign)
     vec_uint_push_back(s->reasons, UNDEF);
     vec_uint_push_back(s->stamps, 0);
     vec_char_push_back(s->seen, 0);
+    vec_char_push_back(s->frozen, 0);
+    vec_char_push_back(s->eliminated, 0);
     heap_insert(s->var_order, var);
     if (s->marks)
         vec_char_push_back(s->marks, 0);
@@ -263,6 +285,9 @@ int satoko_add_clause(solver_t *s, int *lits, int size)
     max_var = lit2var(lits[size - 1]);
     while (max_var >= vec_act_size(s->activity))
         satoko_add_variable(s, SATOKO_LIT_FALSE);
+    for (i = 0; i < (unsigned)size; i++)
+        if (var_eliminated(s, lit2var(lits[i])))
+            solver_restore_var(s, lit2var(lits[i]));
 
     vec_uint_clear(s->temp_lits);
     j = 0;
@@ -299,6 +324,7 @@ void satoko_assump_push(solver_t *s, int lit)
 {
     assert(lit2var(lit) < (unsigned)satoko_varnum(s));
     // printf("[Satoko] Push assumption: %d\n", lit);
+    satoko_freeze_var(s, lit2var(lit), 1);
     vec_uint_push_back(s->assumptions, lit);
     vec_char_assign(s->polarity, lit2var(lit), lit_polarity(lit));
 }
@@ -337,6 +363,8 @@ int satoko_solve(solver_t *s)
         if (s->pFuncStop && s->pFuncStop(s->RunId))
             break;
     }
+    if (status == SATOKO_SAT && vec_uint_size(s->elim_stack))
+        solver_extend_model(s);
     if (s->opts.verbose)
         print_stats(s);
     
@@ -445,6 +473,9 @@ void satoko_bookmark(satoko_t *s)
     // printf("[Satoko] Bookmark.\n");
     assert(s->status == SATOKO_OK);
     assert(solver_dlevel(s) == 0);
+    /* Variables eliminated before the bookmark may be needed afterwards */
+    solver_restore_all(s);
+    s->book_elim = vec_uint_size(s->elim_stack);
     s->book_cl_orig = vec_uint_size(s->originals);
     s->book_cl_lrnt = vec_uint_size(s->learnts);
     s->book_vars = vec_char_size(s->assigns);
@@ -462,6 +493,7 @@ void satoko_unbookmark(satoko_t *s)
     s->book_cdb = 0;
     s->book_vars = 0;
     s->book_trail = 0;
+    s->book_elim = 0;
     // s->book_qhead = 0;
     s->opts.no_simplify = 0;
 }
@@ -491,6 +523,9 @@ void satoko_reset(satoko_t *s)
     vec_uint_clear(s->stack);
     vec_uint_clear(s->last_dlevel);
     vec_uint_clear(s->stamps);
+    vec_char_clear(s->frozen);
+    vec_char_clear(s->eliminated);
+    vec_uint_clear(s->elim_stack);
     s->status = SATOKO_OK;
     s->var_act_inc = VAR_ACT_INIT_INC;
     s->clause_act_inc = CLAUSE_ACT_INIT_INC;
@@ -502,7 +537,9 @@ void satoko_reset(satoko_t *s)
     s->book_cdb = 0;
     s->book_vars = 0;
     s->book_trail = 0;
+    s->book_elim = 0;
     s->i_qhead = 0;
+    s->n_confl_bfr_inprocess = s->stats.n_conflicts_all;
 }
 
 void satoko_rollback(satoko_t *s)
@@ -522,9 +559,9 @@ void satoko_rollback(satoko_t *s)
     cl_to_remove = satoko_alloc(struct clause *, n_originals + n_learnts);
     /* Mark clauses */
     vec_uint_foreach_start(s->originals, cref, i, s->book_cl_orig)
-        cl_to_remove[i] = clause_fetch(s, cref);
+        cl_to_remove[i - s->book_cl_orig] = clause_fetch(s, cref);
     vec_uint_foreach_start(s->learnts, cref, i, s->book_cl_lrnt)
-        cl_to_remove[n_originals + i] = clause_fetch(s, cref);
+        cl_to_remove[n_originals + i - s->book_cl_lrnt] = clause_fetch(s, cref);
     for (i = 0; i < n_originals + n_learnts; i++) {
         clause_unwatch(s, cdb_cref(s->all_clauses, (unsigned *)cl_to_remove[i]));
         cl_to_remove[i]->f_mark = 1;
@@ -533,12 +570,12 @@ void satoko_rollback(satoko_t *s)
     vec_uint_shrink(s->originals, s->book_cl_orig);
     vec_uint_shrink(s->learnts, s->book_cl_lrnt);
     /* Shrink variable related vectors */
-    for (i = s->book_vars; i < 2 * vec_char_size(s->assigns); i++) {
+    for (i = 2 * s->book_vars; i < 2 * vec_char_size(s->assigns); i++) {
         vec_wl_at(s->watches, i)->size = 0;
         vec_wl_at(s->watches, i)->n_bin = 0;
     }
     // s->i_qhead = s->book_qhead;
-    s->watches->size = s->book_vars;
+    s->watches->size = 2 * s->book_vars;
     vec_act_shrink(s->activity, s->book_vars);
     vec_uint_shrink(s->levels, s->book_vars);
     vec_uint_shrink(s->reasons, s->book_vars);
@@ -546,16 +583,30 @@ void satoko_rollback(satoko_t *s)
     vec_char_shrink(s->assigns, s->book_vars);
     vec_char_shrink(s->seen, s->book_vars);
     vec_char_shrink(s->polarity, s->book_vars);
-    solver_rebuild_order(s);
+    vec_char_shrink(s->frozen, s->book_vars);
+    vec_char_shrink(s->eliminated, s->book_vars);
+    vec_uint_shrink(s->elim_stack, s->book_elim);
+    if (s->marks)
+        vec_char_shrink(s->marks, s->book_vars);
     /* Rewind solver and cancel level 0 assignments to the trail */
     solver_cancel_until(s, 0);
+    for (i = s->book_trail; i < vec_uint_size(s->trail); i++) {
+        unsigned var = lit2var(vec_uint_at(s->trail, i));
+        if (var < s->book_vars) {
+            vec_char_assign(s->assigns, var, SATOKO_VAR_UNASSING);
+            vec_uint_assign(s->reasons, var, UNDEF);
+        }
+    }
     vec_uint_shrink(s->trail, s->book_trail);
+    s->i_qhead = s->book_trail;
+    solver_rebuild_order(s);
     if (s->book_cdb)
         s->all_clauses->size = s->book_cdb;
     s->book_cl_orig = 0;
     s->book_cl_lrnt = 0;
     s->book_vars = 0;
     s->book_trail = 0;
+    s->book_elim = 0;
     // s->book_qhead = 0;
 }
 
@@ -565,6 +616,8 @@ void satoko_mark_cone(satoko_t *s, int * pvars, int n_vars)
     if (!solver_has_marks(s))
         s->marks = vec_char_init(satoko_varnum(s), 0);
     for (i = 0; i < n_vars; i++) {
+        if (var_eliminated(s, pvars[i]))
+            solver_restore_var(s, pvars[i]);
         var_set_mark(s, pvars[i]);
         vec_sdbl_assign(s->activity, pvars[i], 0);
         if (!heap_in_heap(s->var_order, pvars[i]))
@@ -580,6 +633,21 @@ void satoko_unmark_cone(satoko_t *s, int *pvars, int n_vars)
         var_clean_mark(s, pvars[i]);
 }
 
+void satoko_freeze_var(satoko_t *s, int var, int freeze)
+{
+    assert(var < satoko_varnum(s));
+    vec_char_assign(s->frozen, var, (char)(freeze != 0));
+    if (freeze && var_eliminated(s, var))
+        solver_restore_var(s, var);
+}
+
+int satoko_inprocess(satoko_t *s)
+{
+    if (solver_dlevel(s) > 0)
+        solver_cancel_until(s, 0);
+    return solver_inprocess(s);
+}
+
 void satoko_write_dimacs(satoko_t *s, char *fname, int wrt_lrnt, int zero_var)
 {
     FILE *file;
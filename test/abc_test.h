@@ -0,0 +1,55 @@
+#ifndef ABC__test__abc_test_h
+#define ABC__test__abc_test_h
+
+#include <fstream>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "base/abc/abc.h"
+#include "base/main/main.h"
+#include "base/cmd/cmd.h"
+
+ABC_NAMESPACE_HEADER_START
+
+// Runs ABC commands in a fresh global frame, so that the tests can
+// compare the results of a new option with those of the original path.
+class AbcCommandTest : public testing::Test {
+ protected:
+  void SetUp() override { Abc_Start(); }
+  void TearDown() override { Abc_Stop(); }
+
+  // executes the command line; returns 0 on success
+  int Run(const std::string& command) {
+    return Cmd_CommandExecute(Abc_FrameGetGlobalFrame(), command.c_str());
+  }
+  // the status of the last verification command (1 = UNSAT, 0 = SAT, -1 = undecided)
+  int Status() { return Abc_FrameReadProbStatus(Abc_FrameGetGlobalFrame()); }
+  Abc_Ntk_t* Ntk() { return Abc_FrameReadNtk(Abc_FrameGetGlobalFrame()); }
+  Gia_Man_t* Gia() { return Abc_FrameReadGia(Abc_FrameGetGlobalFrame()); }
+  Abc_Cex_t* Cex() { return (Abc_Cex_t*)Abc_FrameReadCex(Abc_FrameGetGlobalFrame()); }
+
+  // a file from the source tree
+  static std::string DataFile(const std::string& name) {
+    return std::string(ABC_TEST_SOURCE_DIR) + "/" + name;
+  }
+  // a scratch file unique to the current test
+  static std::string TempFile(const std::string& name) {
+    const testing::TestInfo* info = testing::UnitTest::GetInstance()->current_test_info();
+    return testing::TempDir() + "abc_" + info->test_suite_name() + "_" + info->name() + "_" + name;
+  }
+  // writes the text into a scratch file and returns its name
+  static std::string WriteTempFile(const std::string& name, const std::string& text) {
+    std::string file = TempFile(name);
+    std::ofstream(file) << text;
+    return file;
+  }
+  // returns 1 if the current &-space AIG is equivalent to the AIGER file
+  int EquivalentToFile(const std::string& file) {
+    return Run("&cec -s " + file) == 0 && Status() == 1;
+  }
+};
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
@@ -0,0 +1,116 @@
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "abc_test.h"
+#include "bdd/cudd/cuddInt.h"
+
+ABC_NAMESPACE_IMPL_START
+
+class BddTest : public AbcCommandTest {
+ protected:
+  // the hidden weighted bit function: x[w-1] where w is the number of ones
+  static DdNode* Hwb(DdManager* dd, int nVars) {
+    int nBits = 1;
+    while ((1 << nBits) <= nVars) nBits++;
+    std::vector<DdNode*> vSum(nBits, Cudd_ReadLogicZero(dd));
+    for (DdNode* bBit : vSum) Cudd_Ref(bBit);
+    for (int i = 0; i < nVars; i++) {
+      DdNode* bCarry = Cudd_bddIthVar(dd, i);
+      Cudd_Ref(bCarry);
+      for (int b = 0; b < nBits; b++) {
+        DdNode* bSum = Cudd_bddXor(dd, vSum[b], bCarry);
+        Cudd_Ref(bSum);
+        DdNode* bNext = Cudd_bddAnd(dd, vSum[b], bCarry);
+        Cudd_Ref(bNext);
+        Cudd_RecursiveDeref(dd, vSum[b]);
+        Cudd_RecursiveDeref(dd, bCarry);
+        vSum[b] = bSum;
+        bCarry = bNext;
+      }
+      Cudd_RecursiveDeref(dd, bCarry);
+    }
+    DdNode* bRes = Cudd_ReadLogicZero(dd);
+    Cudd_Ref(bRes);
+    for (int w = 1; w <= nVars; w++) {
+      DdNode* bCube = Cudd_bddIthVar(dd, w - 1);
+      Cudd_Ref(bCube);
+      for (int b = 0; b < nBits; b++) {
+        DdNode* bTemp = Cudd_bddAnd(dd, bCube, Cudd_NotCond(vSum[b], !((w >> b) & 1)));
+        Cudd_Ref(bTemp);
+        Cudd_RecursiveDeref(dd, bCube);
+        bCube = bTemp;
+      }
+      DdNode* bTemp = Cudd_bddOr(dd, bRes, bCube);
+      Cudd_Ref(bTemp);
+      Cudd_RecursiveDeref(dd, bRes);
+      Cudd_RecursiveDeref(dd, bCube);
+      bRes = bTemp;
+    }
+    for (DdNode* bBit : vSum) Cudd_RecursiveDeref(dd, bBit);
+    return bRes;
+  }
+};
+
+// a computed table that is too small for the working set is grown while
+// the results are inserted, and the results do not depend on its size
+TEST_F(BddTest, ComputedTableGrowsWhenThrashing) {
+  const int nVars = 14;
+  DdManager* ddSmall = Cudd_Init(nVars, 0, CUDD_UNIQUE_SLOTS, 64, 0);
+  DdManager* ddLarge = Cudd_Init(nVars, 0, CUDD_UNIQUE_SLOTS, 1 << 18, 0);
+  unsigned nSlots = Cudd_ReadCacheSlots(ddSmall);
+  DdNode* bSmall = Hwb(ddSmall, nVars);
+  DdNode* bSmall2 = Hwb(ddSmall, nVars);
+  DdNode* bLarge = Hwb(ddLarge, nVars);
+  EXPECT_GT(ddSmall->cacheResizes, 0);
+  EXPECT_GT(Cudd_ReadCacheSlots(ddSmall), nSlots);
+  EXPECT_EQ(bSmall, bSmall2);
+  DdNode* bMoved = Cudd_bddTransfer(ddSmall, ddLarge, bSmall);
+  Cudd_Ref(bMoved);
+  EXPECT_EQ(bMoved, bLarge);
+  EXPECT_EQ(Cudd_CountMinterm(ddLarge, bLarge, nVars), Cudd_CountMinterm(ddSmall, bSmall, nVars));
+  Cudd_RecursiveDeref(ddLarge, bMoved);
+  Cudd_RecursiveDeref(ddLarge, bLarge);
+  Cudd_RecursiveDeref(ddSmall, bSmall);
+  Cudd_RecursiveDeref(ddSmall, bSmall2);
+  EXPECT_EQ(Cudd_CheckZeroRef(ddSmall), 0);
+  EXPECT_EQ(Cudd_CheckZeroRef(ddLarge), 0);
+  Cudd_Quit(ddSmall);
+  Cudd_Quit(ddLarge);
+}
+
+// "collapse -v" prints the profile of the BDD manager, and the result is
+// equivalent to the original network
+TEST_F(BddTest, CollapseProfile) {
+  std::string orig = TempFile("orig.aig");
+  ASSERT_EQ(Run("read " + DataFile("lsv/pa1/benchmarks/int2float.blif") + "; strash; &get; &w " + orig), 0);
+  testing::internal::CaptureStdout();
+  ASSERT_EQ(Run("collapse -v"), 0);
+  std::string output = testing::internal::GetCapturedStdout();
+  EXPECT_NE(output.find("Collapse BDD profile: "), std::string::npos);
+  EXPECT_NE(output.find(" resizes). "), std::string::npos);
+  ASSERT_EQ(Run("strash; &get"), 0);
+  EXPECT_TRUE(EquivalentToFile(orig));
+  std::remove(orig.c_str());
+}
+
+// garbage collection does not resize the computed table, even when the
+// insertions counted so far would make the next insertion grow it
+TEST_F(BddTest, GarbageCollectionKeepsComputedTable) {
+  DdManager* dd = Cudd_Init(4, 0, CUDD_UNIQUE_SLOTS, 64, 0);
+  unsigned nSlots = Cudd_ReadCacheSlots(dd);
+  int nResizes = dd->cacheResizes;
+  dd->cacheinserts = dd->cacheLastInserts + 4.0 * nSlots;
+  dd->cachecollisions = dd->cacheLastCollisions + 4.0 * nSlots;
+  cuddGarbageCollect(dd, 1);
+  EXPECT_EQ(dd->cacheResizes, nResizes);
+  EXPECT_EQ(Cudd_ReadCacheSlots(dd), nSlots);
+  DdNode* bAnd = Cudd_bddAnd(dd, Cudd_bddIthVar(dd, 0), Cudd_bddIthVar(dd, 1));
+  Cudd_Ref(bAnd);
+  EXPECT_EQ(dd->cacheResizes, nResizes + 1);
+  EXPECT_EQ(Cudd_ReadCacheSlots(dd), 2 * nSlots);
+  Cudd_RecursiveDeref(dd, bAnd);
+  Cudd_Quit(dd);
+}
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,103 @@
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "abc_test.h"
+#include "base/io/ioAbc.h"
+
+ABC_NAMESPACE_IMPL_START
+
+class BlifTest : public AbcCommandTest {
+ protected:
+  // the names of the PIs, POs and latch outputs
+  // (the latch inputs of the one-pass reader are named by their IDs)
+  std::vector<std::string> CioNames() {
+    std::vector<std::string> vNames;
+    Abc_Obj_t* pObj;
+    int i;
+    Abc_NtkForEachPi(Ntk(), pObj, i) vNames.push_back(Abc_ObjName(pObj));
+    Abc_NtkForEachPo(Ntk(), pObj, i) vNames.push_back(Abc_ObjName(pObj));
+    Abc_NtkForEachLatchOutput(Ntk(), pObj, i) vNames.push_back(Abc_ObjName(pObj));
+    return vNames;
+  }
+  // reads the file with the netlist reader and in one pass ("read_blif -s")
+  // and checks that the networks have the same interface and function
+  void CheckOnePassReader(const std::string& file) {
+    std::string orig = TempFile("orig.aig");
+    ASSERT_EQ(Run("read_blif " + file + "; strash; &get; &w " + orig), 0);
+    std::vector<std::string> vNames = CioNames();
+    ASSERT_EQ(Run("read_blif -s " + file), 0);
+    ASSERT_TRUE(Abc_NtkIsLogic(Ntk()));
+    ASSERT_EQ(Run("strash"), 0);
+    EXPECT_EQ(CioNames(), vNames);
+    ASSERT_EQ(Run("&get"), 0);
+    EXPECT_TRUE(EquivalentToFile(orig));
+    std::remove(orig.c_str());
+  }
+};
+
+TEST_F(BlifTest, OnePassReaderOnBenchmarks) {
+  for (const char* name : {"adder", "router", "int2float", "mem_ctrl"}) {
+    SCOPED_TRACE(name);
+    CheckOnePassReader(DataFile("lsv/pa1/benchmarks/") + name + ".blif");
+  }
+}
+
+// latches, nets used before they are driven, and a net without a driver
+TEST_F(BlifTest, OnePassReaderForwardNetsAndLatches) {
+  std::string file = TempFile("seq.blif");
+  std::ofstream(file) << ".model seq\n"
+                         ".inputs a b\n"
+                         ".outputs y z\n"
+                         ".latch n1 q 0\n"
+                         ".names q n2 y\n11 1\n"
+                         ".names a b n1\n10 1\n01 1\n"
+                         ".names n1 undriven n2\n1- 1\n-1 1\n"
+                         ".names a z\n0 1\n"
+                         ".end\n";
+  CheckOnePassReader(file);
+  std::remove(file.c_str());
+}
+
+// the files with other directives are read by the netlist reader
+TEST_F(BlifTest, OnePassReaderFallsBack) {
+  std::string file = TempFile("exdc.blif");
+  std::ofstream(file) << ".model top\n"
+                         ".inputs a b\n"
+                         ".outputs y\n"
+                         ".names a b y\n11 1\n"
+                         ".exdc\n"
+                         ".inputs a b\n"
+                         ".outputs y\n"
+                         ".names a b y\n00 1\n"
+                         ".end\n";
+  ASSERT_EQ(Run("read_blif -s " + file), 0);
+  EXPECT_EQ(Abc_NtkPiNum(Ntk()), 2);
+  EXPECT_NE(Ntk()->pExdc, nullptr);
+  std::remove(file.c_str());
+}
+
+// the unsupported constructs are found before the one-pass reader starts
+TEST_F(BlifTest, OnePassReaderDetectsUnsupported) {
+  std::string file = TempFile("scan.blif");
+  const std::string body = ".inputs a b\n.outputs y\n.names a b y\n11 1\n";
+  auto IsFlat = [&](const std::string& text) {
+    std::ofstream(file, std::ios::binary | std::ios::trunc) << text;
+    return Io_ReadBlifIsFlat((char*)file.c_str());
+  };
+  for (const char* name : {"adder", "router", "int2float", "mem_ctrl"})
+    EXPECT_EQ(Io_ReadBlifIsFlat((char*)DataFile(std::string("lsv/pa1/benchmarks/") + name + ".blif").c_str()), 1) << name;
+  EXPECT_EQ(IsFlat(".model top\n" + body + ".end\n"), 1);
+  EXPECT_EQ(IsFlat(".model top\r\n  .inputs a \\\r\n .b\r\n.outputs y\r\n.names a .b y\r\n11 1\r\n.end"), 1);
+  EXPECT_EQ(IsFlat("# .subckt in a comment\n.model top\n" + body + ".end\n"), 1);
+  EXPECT_EQ(IsFlat(".model top\n" + body + ".exdc\n" + body + ".end\n"), 0);
+  EXPECT_EQ(IsFlat(".model top\n" + body + ".subckt sub a=a\n.end\n"), 0);
+  EXPECT_EQ(IsFlat(".model top\n" + body + ".gate and2 A=a B=b O=y\n.end\n"), 0);
+  EXPECT_EQ(IsFlat(".model top\n" + body + ".end\n.model sub\n" + body + ".end\n"), 0);
+  EXPECT_EQ(IsFlat(".model top\n.input_arrival a 1 1\n" + body + ".end\n"), 0);
+  EXPECT_EQ(IsFlat(".model top\n.names_x\n.end\n"), 0);
+  std::remove(file.c_str());
+}
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,70 @@
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "abc_test.h"
+
+ABC_NAMESPACE_IMPL_START
+
+class LevelTest : public AbcCommandTest {
+ protected:
+  // runs the command with -c and returns the number of replacements
+  // verified by the level checker; the number of errors is returned in
+  // nErrors (-1 if the checker did not report)
+  int RunChecked(const std::string& command, int* nErrors) {
+    testing::internal::CaptureStdout();
+    EXPECT_EQ(Run(command), 0) << command;
+    std::string output = testing::internal::GetCapturedStdout();
+    int nChecks = -1;
+    *nErrors = -1;
+    size_t pos = output.find("Level check:");
+    if (pos != std::string::npos)
+      sscanf(output.c_str() + pos, "Level check: Verified %d replacements. Found %d incorrect levels.", &nChecks, nErrors);
+    return nChecks;
+  }
+  // the stored levels of the objects
+  std::vector<int> Levels() {
+    std::vector<int> vLevels;
+    Abc_Obj_t* pObj;
+    int i;
+    Abc_NtkForEachObj(Ntk(), pObj, i)
+      vLevels.push_back(pObj->Level);
+    return vLevels;
+  }
+};
+
+// With -c, the incremental levels are verified after each move; the levels
+// left by the command should agree with the levels recomputed from scratch.
+// Rewrite and resub update the levels by default (-l turns it off).
+TEST_F(LevelTest, RewriteAndResubKeepLevels) {
+  std::string orig = TempFile("orig.aig");
+  ASSERT_EQ(Run("read " + DataFile("lsv/pa1/benchmarks/int2float.blif") + "; strash; &get; &w " + orig), 0);
+  for (std::string command : {"rewrite -c", "resub -c"}) {
+    SCOPED_TRACE(command);
+    int nErrors;
+    EXPECT_GT(RunChecked(command, &nErrors), 0);
+    EXPECT_EQ(nErrors, 0);
+    // the levels are compared before anything recomputes them
+    std::vector<int> vLevels = Levels();
+    EXPECT_EQ(Abc_NtkCheckLevels(Ntk()), 0);
+    Abc_NtkLevel(Ntk());
+    EXPECT_EQ(Levels(), vLevels);
+  }
+  ASSERT_EQ(Run("&get"), 0);
+  EXPECT_TRUE(EquivalentToFile(orig));
+  std::remove(orig.c_str());
+}
+
+// drw updates the levels only with -l
+TEST_F(LevelTest, DrwWithLevelCheck) {
+  std::string orig = TempFile("orig.aig");
+  ASSERT_EQ(Run("read " + DataFile("lsv/pa1/benchmarks/int2float.blif") + "; strash; &get; &w " + orig), 0);
+  int nErrors;
+  EXPECT_GT(RunChecked("drw -l -c", &nErrors), 0);
+  EXPECT_EQ(nErrors, 0);
+  ASSERT_EQ(Run("&get"), 0);
+  EXPECT_TRUE(EquivalentToFile(orig));
+  std::remove(orig.c_str());
+}
+
+ABC_NAMESPACE_IMPL_END
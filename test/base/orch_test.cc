@@ -0,0 +1,102 @@
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+
+#include "abc_test.h"
+
+ABC_NAMESPACE_IMPL_START
+
+class OrchestrateTest : public AbcCommandTest {
+ protected:
+  static std::string ReadFile(const std::string& file) {
+    std::ifstream in(file);
+    return std::string((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+  }
+  // the sum of the win counters in the policy file
+  static int WinCount(const std::string& file) {
+    std::ifstream in(file);
+    std::string line, truth;
+    int count = 0, wins;
+    while (std::getline(in, line)) {
+      if (line.empty() || line[0] == '#')
+        continue;
+      std::istringstream words(line);
+      for (words >> truth; words >> wins;)
+        count += wins;
+    }
+    return count;
+  }
+};
+
+// The policy only changes which operators are tried, so the result should
+// stay equivalent to the original network, also when a saved policy is reused.
+TEST_F(OrchestrateTest, PolicyPreservesEquivalence) {
+  std::string orig = TempFile("orig.aig"), policy = TempFile("policy.txt");
+  std::remove(policy.c_str());
+  ASSERT_EQ(Run("read " + DataFile("lsv/pa1/benchmarks/adder.blif") + "; strash; &get; &w " + orig), 0);
+  ASSERT_EQ(Run("orchestrate -P " + policy), 0);
+  ASSERT_EQ(Run("&get"), 0);
+  EXPECT_TRUE(EquivalentToFile(orig));
+  ASSERT_EQ(Run("orchestrate -P " + policy + " -M 1"), 0);
+  ASSERT_EQ(Run("&get"), 0);
+  EXPECT_TRUE(EquivalentToFile(orig));
+  std::remove(orig.c_str());
+  std::remove(policy.c_str());
+}
+
+// Truth tables that do not fit into one word are skipped when loading.
+TEST_F(OrchestrateTest, PolicyFileWithLongTruthTable) {
+  std::string orig = TempFile("orig.aig"), policy = TempFile("policy.txt");
+  {
+    std::ofstream out(policy);
+    out << "# truth rwr res ref none\n";
+    out << std::string(200, 'f') << " 1 2 3 4\n";
+    out << "0123456789abcdef0123 5 0 0 0\n";
+    out << "8888888888888888 7 0 0 0\n";
+  }
+  ASSERT_EQ(Run("read " + DataFile("lsv/pa1/benchmarks/adder.blif") + "; strash; &get; &w " + orig), 0);
+  ASSERT_EQ(Run("orchestrate -P " + policy), 0);
+  ASSERT_EQ(Run("&get"), 0);
+  EXPECT_TRUE(EquivalentToFile(orig));
+  std::ifstream in(policy);
+  std::string line;
+  while (std::getline(in, line))
+    EXPECT_LE(line.find(' '), 16u) << line;
+  std::remove(orig.c_str());
+  std::remove(policy.c_str());
+}
+
+// Loading the policy file again in the same session replaces the counters
+// instead of adding them to those loaded by the previous run.
+TEST_F(OrchestrateTest, PolicyFileReloaded) {
+  std::string policy = TempFile("policy.txt"), copy = TempFile("copy.txt");
+  std::string read = "read " + DataFile("lsv/pa1/benchmarks/adder.blif") + "; strash; ";
+  std::remove(policy.c_str());
+  ASSERT_EQ(Run(read + "orchestrate -P " + policy), 0);
+  std::string first = ReadFile(policy);
+  int nWins = WinCount(policy);
+  ASSERT_GT(nWins, 0);
+  std::ofstream(copy) << first;
+  ASSERT_EQ(Run(read + "orchestrate -P " + policy), 0);
+  EXPECT_LT(WinCount(policy), 2 * nWins);
+  // the second run is the same as the one in a new session
+  Abc_Stop();
+  Abc_Start();
+  ASSERT_EQ(Run(read + "orchestrate -P " + copy), 0);
+  EXPECT_EQ(ReadFile(copy), ReadFile(policy));
+  // another file does not keep the counters of the one loaded before
+  std::string second = ReadFile(policy);
+  ASSERT_EQ(Run(read + "orchestrate -P " + copy + "; " + read + "orchestrate -P " + policy), 0);
+  std::string third = ReadFile(policy);
+  std::ofstream(policy) << second;
+  Abc_Stop();
+  Abc_Start();
+  ASSERT_EQ(Run(read + "orchestrate -P " + policy), 0);
+  EXPECT_EQ(ReadFile(policy), third);
+  std::remove(policy.c_str());
+  std::remove(copy.c_str());
+}
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,30 @@
+#include <cstdio>
+#include <string>
+
+#include "abc_test.h"
+
+ABC_NAMESPACE_IMPL_START
+
+class StrashTest : public AbcCommandTest {};
+
+// concurrent factoring gives the same AIG as strash without threads
+// up to the order of the AND nodes
+TEST_F(StrashTest, ConcurrentMatchesSerial) {
+  for (const char* name : {"router", "int2float", "sqrt"}) {
+    SCOPED_TRACE(name);
+    std::string file = DataFile("lsv/pa1/benchmarks/") + name + ".blif";
+    std::string orig = TempFile("orig.aig");
+    ASSERT_EQ(Run("read " + file + "; strash; &get; &w " + orig), 0);
+    int nNodes = Abc_NtkNodeNum(Ntk());
+    for (const char* options : {"-P 2", "-P 4", "-P 2 -r"}) {
+      SCOPED_TRACE(options);
+      ASSERT_EQ(Run("read " + file + "; strash " + options), 0);
+      EXPECT_EQ(Abc_NtkNodeNum(Ntk()), nNodes);
+      ASSERT_EQ(Run("&get"), 0);
+      EXPECT_TRUE(EquivalentToFile(orig));
+    }
+    std::remove(orig.c_str());
+  }
+}
+
+ABC_NAMESPACE_IMPL_END
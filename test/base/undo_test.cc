@@ -0,0 +1,57 @@
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "abc_test.h"
+
+ABC_NAMESPACE_IMPL_START
+
+extern "C" int Abc_NtkResubstitute(Abc_Ntk_t* pNtk, int nCutMax, int nStepsMax, int nMinSaved, int nLevelsOdc, int fUpdateLevel, int fVerbose, int fVeryVerbose);
+
+class UndoTest : public AbcCommandTest {
+ protected:
+  static std::vector<int> Levels(Abc_Ntk_t* pNtk) {
+    std::vector<int> vLevels;
+    Abc_Obj_t* pObj;
+    int i;
+    Abc_NtkForEachObj(pNtk, pObj, i) vLevels.push_back((int)pObj->Level);
+    return vLevels;
+  }
+  // Rolling back an in-place optimization restores the structure and the
+  // levels, including those overwritten by a full level pass. The
+  // optimization is followed by a reverse level pass, which overwrites
+  // all levels.
+  void CheckRollback(const std::string& benchmark, const std::function<int(Abc_Ntk_t*)>& Optimize) {
+    std::string orig = TempFile("orig.aig");
+    ASSERT_EQ(Run("read " + DataFile("lsv/pa1/benchmarks/" + benchmark) + "; strash; &get; &w " + orig), 0);
+    Abc_Ntk_t* pNtk = Ntk();
+    int nObjs = Abc_NtkObjNum(pNtk);
+    std::vector<int> vLevels = Levels(pNtk);
+    Abc_NtkUndoStart(pNtk);
+    ASSERT_GT(Optimize(pNtk), 0);
+    ASSERT_NE(Abc_NtkObjNum(pNtk), nObjs);
+    Abc_NtkLevelReverse(pNtk);
+    ASSERT_TRUE(Abc_NtkUndoIsValid(pNtk));
+    ASSERT_EQ(Abc_NtkUndoRollback(pNtk), 1);
+    EXPECT_EQ(pNtk->pUndo, nullptr);
+    EXPECT_EQ(Abc_NtkObjNum(pNtk), nObjs);
+    EXPECT_EQ(Levels(pNtk), vLevels);
+    EXPECT_EQ(Abc_NtkCheckLevels(pNtk), 0);
+    EXPECT_TRUE(Abc_NtkCheck(pNtk));
+    ASSERT_EQ(Run("&get"), 0);
+    EXPECT_TRUE(EquivalentToFile(orig));
+    std::remove(orig.c_str());
+  }
+};
+
+// rewriting renumbers the objects at the end
+TEST_F(UndoTest, RollbackAfterRewrite) {
+  CheckRollback("router.blif", [](Abc_Ntk_t* pNtk) { return Abc_NtkRewrite(pNtk, 1, 0, 0, 0, 0); });
+}
+
+TEST_F(UndoTest, RollbackAfterResub) {
+  CheckRollback("int2float.blif", [](Abc_Ntk_t* pNtk) { return Abc_NtkResubstitute(pNtk, 8, 1, 0, 0, 1, 0, 0); });
+}
+
+ABC_NAMESPACE_IMPL_END
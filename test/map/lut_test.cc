@@ -0,0 +1,115 @@
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include "abc_test.h"
+
+ABC_NAMESPACE_IMPL_START
+
+class LutTest : public AbcCommandTest {
+ protected:
+  // runs the command and returns what it printed
+  std::string Output(const std::string& command) {
+    testing::internal::CaptureStdout();
+    EXPECT_EQ(Run(command), 0) << command;
+    return testing::internal::GetCapturedStdout();
+  }
+  // maps the network prepared by the script and returns the mapped network
+  // without the first line, which has the time stamp
+  std::string Map(const std::string& script, const std::string& mapper) {
+    std::string mapped = TempFile("mapped.blif");
+    std::string put = mapper[0] == '&' ? "; &put" : "";
+    EXPECT_EQ(Run(script + "; " + mapper + put + "; write_blif " + mapped), 0);
+    std::ifstream in(mapped);
+    std::string text((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    std::remove(mapped.c_str());
+    return text.substr(text.find('\n') + 1);
+  }
+};
+
+// the threaded cut enumeration of &jf gives the same mapping as the
+// serial one, also on an AIG with choices
+TEST_F(LutTest, JfThreadsMatchSerial) {
+  for (std::string script : {"read " + DataFile("lsv/pa1/benchmarks/square.blif") + "; strash; &get -n",
+                             "read " + DataFile("lsv/pa1/benchmarks/int2float.blif") + "; strash; dch; &get -n"}) {
+    for (std::string jf : {"&jf -K 6", "&jf -K 4 -C 16"}) {
+      SCOPED_TRACE(script + "; " + jf);
+      std::string serial = Map(script, jf);
+      ASSERT_NE(serial.find(".names"), std::string::npos);
+      EXPECT_EQ(Map(script, jf + " -P 2"), serial);
+      EXPECT_EQ(Map(script, jf + " -P 4"), serial);
+    }
+  }
+  EXPECT_EQ(Run("&jf -P 1"), 0);
+  EXPECT_NE(Run("&jf -P 0"), 0);
+}
+
+// the memory budget lowers the cut limit, and the mapping stays correct;
+// a budget too small to meet is reported
+TEST_F(LutTest, MemoryBudget) {
+  std::string orig = TempFile("orig.aig");
+  std::string script = "read " + DataFile("lsv/pa1/benchmarks/square.blif") + "; strash; &get -n; &w " + orig;
+  for (std::string mapper : {"&jf -K 6 -C 16 -B 9", "&jf -K 6 -C 16 -B 9 -P 2", "&lf -B 2"}) {
+    SCOPED_TRACE(mapper);
+    std::string output = Output(script + "; " + mapper + " -v; &cec " + orig);
+    EXPECT_NE(output.find("reducing the cut limit"), std::string::npos);
+    EXPECT_EQ(output.find("Warning"), std::string::npos);
+    EXPECT_NE(output.find("Networks are equivalent"), std::string::npos);
+  }
+  for (std::string mapper : {"&jf -B 1", "&lf -B 1"}) {
+    SCOPED_TRACE(mapper);
+    EXPECT_NE(Output(script + "; " + mapper).find("exceeds the memory budget of 1 MB"), std::string::npos);
+  }
+  std::remove(orig.c_str());
+}
+
+// the cut-function cache gives the same mapping as computing the
+// functions, when it is reused by the next call on the same or another
+// network, and when it runs out of memory
+TEST_F(LutTest, IfCacheMatchesUncached) {
+  std::string int2float = "read " + DataFile("lsv/pa1/benchmarks/int2float.blif") + "; strash";
+  std::string adder = "read " + DataFile("lsv/pa1/benchmarks/adder.blif") + "; strash";
+  for (std::string mapper : {"if -K 6 -m", "&if -K 6 -m"}) {
+    SCOPED_TRACE(mapper);
+    std::string get = mapper[0] == '&' ? "; &get" : "";
+    // the kept cache is freed when the frame is stopped
+    Abc_Stop();
+    Abc_Start();
+    std::string uncached = Map(int2float + get, mapper);
+    ASSERT_NE(uncached.find(".names"), std::string::npos);
+    // the cache of the previous call is taken over
+    std::string output = Output(int2float + get + "; " + mapper + " -M 10 -v");
+    EXPECT_NE(output.find("Cut-function cache:"), std::string::npos);
+    EXPECT_EQ(output.find("Reused."), std::string::npos);
+    output = Output(int2float + get + "; " + mapper + " -M 10 -v");
+    EXPECT_NE(output.find("(100.00 %)"), std::string::npos);
+    EXPECT_NE(output.find("Reused."), std::string::npos);
+    EXPECT_EQ(Map(int2float + get, mapper + " -M 10"), uncached);
+    EXPECT_EQ(Map(int2float + get, mapper + " -M 10"), uncached);
+    // the cache kept for another network is still valid
+    std::string uncachedAdder = Map(adder + get, mapper);
+    EXPECT_EQ(Map(int2float + get, mapper + " -M 10"), uncached);
+    EXPECT_EQ(Map(adder + get, mapper + " -M 10"), uncachedAdder);
+    EXPECT_EQ(Map(int2float + get, mapper + " -M 10"), uncached);
+  }
+  // with -w (-U for &if), the cache is not kept for the next call
+  Output(int2float + "; if -K 6 -m -M 10 -w");
+  EXPECT_EQ(Output(int2float + "; if -K 6 -m -M 10 -v").find("Reused."), std::string::npos);
+  Output(int2float + "; &get; &if -K 6 -m -M 10 -U");
+  EXPECT_EQ(Output(int2float + "; &get; &if -K 6 -m -M 10 -v").find("Reused."), std::string::npos);
+  // a full cache stops taking new entries
+  std::string square = "read " + DataFile("lsv/pa1/benchmarks/square.blif") + "; strash";
+  std::string uncached = Map(square, "if -K 6 -m");
+  EXPECT_NE(Output(square + "; if -K 6 -m -M 1 -v -w").find("Full."), std::string::npos);
+  EXPECT_EQ(Map(square, "if -K 6 -m -M 1 -w"), uncached);
+  // the cache is not kept when it exceeds the limit with its truth tables
+  std::string output = Output(square + "; if -K 6 -m -M 1 -v");
+  EXPECT_NE(output.find("Full."), std::string::npos);
+  size_t pos = output.find("Memory = ", output.find("Cut-function cache:"));
+  ASSERT_NE(pos, std::string::npos);
+  EXPECT_GT(std::stod(output.substr(pos + 9)), 1.0);
+  EXPECT_EQ(Output(square + "; if -K 6 -m -M 1 -v").find("Reused."), std::string::npos);
+}
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,82 @@
+#ifndef ABC__test__map__map_libraries_h
+#define ABC__test__map__map_libraries_h
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// A small genlib library with inverting and non-inverting gates of
+// different areas and delays, so that the mappers have choices to make.
+static inline std::string SmallGenlib() {
+  return "GATE zero  0 Y=CONST0;\n"
+         "GATE one   0 Y=CONST1;\n"
+         "GATE buf   1 Y=A;           PIN * NONINV  1 999 1   0 1   0\n"
+         "GATE inv   1 Y=!A;          PIN * INV     1 999 1   0 1   0\n"
+         "GATE nand2 2 Y=!(A*B);      PIN * INV     1 999 1   0 1   0\n"
+         "GATE nor2  2 Y=!(A+B);      PIN * INV     1 999 1   0 1   0\n"
+         "GATE and2  3 Y=A*B;         PIN * NONINV  1 999 1.5 0 1.5 0\n"
+         "GATE or2   3 Y=A+B;         PIN * NONINV  1 999 1.5 0 1.5 0\n"
+         "GATE xor2  5 Y=A*!B+!A*B;   PIN * UNKNOWN 2 999 2   0 2   0\n"
+         "GATE xnor2 5 Y=A*B+!A*!B;   PIN * UNKNOWN 2 999 2   0 2   0\n"
+         "GATE aoi21 3 Y=!(A*B+C);    PIN * INV     1 999 1.6 0 1.6 0\n"
+         "GATE oai21 3 Y=!((A+B)*C);  PIN * INV     1 999 1.6 0 1.6 0\n"
+         "GATE mux2  6 Y=A*S+B*!S;    PIN * UNKNOWN 1 999 2   0 2   0\n";
+}
+
+// A small Liberty library with NLDM tables, whose delays and slews grow
+// linearly with the input slew and the load, and with three sizes of each
+// gate (cells "<gate>_X1", "_X2", "_X4" with inputs A, B, C and output Y).
+static inline std::string SmallLiberty() {
+  struct Gate { const char* name; const char* func; int nIns; double delay; const char* sense; };
+  static const Gate gates[] = {
+      {"INV", "!A", 1, 0.02, "negative_unate"},           {"BUF", "A", 1, 0.04, "positive_unate"},
+      {"NAND2", "!(A&B)", 2, 0.03, "negative_unate"},     {"NOR2", "!(A|B)", 2, 0.035, "negative_unate"},
+      {"AND2", "(A&B)", 2, 0.05, "positive_unate"},       {"OR2", "(A|B)", 2, 0.055, "positive_unate"},
+      {"XOR2", "(A^B)", 2, 0.07, "non_unate"},            {"AOI21", "!((A&B)|C)", 3, 0.045, "negative_unate"},
+      {"OAI21", "!((A|B)&C)", 3, 0.045, "negative_unate"}};
+  static const std::vector<double> slews = {0.01, 0.03, 0.08, 0.2, 0.5, 1.0, 2.0};
+  static const std::vector<double> loads = {0.001, 0.003, 0.008, 0.02, 0.05, 0.1, 0.2};
+  auto Num = [](double x) {
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%.5f", x);
+    return std::string(buffer);
+  };
+  auto Index = [&Num](const std::vector<double>& values) {
+    std::string s;
+    for (double v : values) s += (s.empty() ? "" : ", ") + Num(v);
+    return s;
+  };
+  auto Table = [&](const char* name, double base, double kSlew, double kLoad, int drive) {
+    std::string s = std::string("        ") + name + "(tmpl) {\n          values( ";
+    for (size_t i = 0; i < slews.size(); i++) {
+      std::string row;
+      for (double load : loads) row += (row.empty() ? "" : ", ") + Num(base + kSlew * slews[i] + kLoad * load / drive);
+      s += (i ? ", \\\n            \"" : "\"") + row + "\"";
+    }
+    return s + " );\n        }\n";
+  };
+  std::string s = "library(small) {\n  delay_model : table_lookup;\n  time_unit : \"1ns\";\n"
+                  "  capacitive_load_unit (1,pf);\n  default_max_transition : 2.0;\n"
+                  "  lu_table_template(tmpl) {\n    variable_1 : input_net_transition;\n"
+                  "    variable_2 : total_output_net_capacitance;\n"
+                  "    index_1 (\"" + Index(slews) + "\");\n    index_2 (\"" + Index(loads) + "\");\n  }\n";
+  for (const Gate& g : gates) {
+    for (int x : {1, 2, 4}) {
+      s += "  cell(" + std::string(g.name) + "_X" + std::to_string(x) + ") {\n    area : " + Num((1 + g.nIns) * x * 0.5 + 0.5) + ";\n";
+      for (int i = 0; i < g.nIns; i++)
+        s += "    pin(" + std::string(1, 'A' + i) + ") {\n      direction : input;\n      capacitance : " + Num(0.0015 * x * (1 + 0.1 * i)) + ";\n    }\n";
+      s += "    pin(Y) {\n      direction : output;\n      function : \"" + std::string(g.func) + "\";\n      max_capacitance : " + Num(0.1 * x) + ";\n";
+      for (int i = 0; i < g.nIns; i++) {
+        double d = g.delay * (1 + 0.15 * i);
+        s += "      timing() {\n        related_pin : \"" + std::string(1, 'A' + i) + "\";\n        timing_sense : " + g.sense + ";\n";
+        s += Table("cell_rise", d, 0.3, 4.0, x) + Table("cell_fall", d * 0.9, 0.25, 3.5, x);
+        s += Table("rise_transition", 0.01, 0.2, 6.0, x) + Table("fall_transition", 0.01, 0.18, 5.0, x);
+        s += "      }\n";
+      }
+      s += "    }\n  }\n";
+    }
+  }
+  return s + "}\n";
+}
+
+#endif
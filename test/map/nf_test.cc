@@ -0,0 +1,105 @@
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "abc_test.h"
+#include "map_libraries.h"
+
+ABC_NAMESPACE_IMPL_START
+
+class NfTest : public AbcCommandTest {
+ protected:
+  // maps the AIG prepared by the script and returns the mapped network
+  // without the first line, which has the time stamp
+  std::string Map(const std::string& genlib, const std::string& script, const std::string& nf) {
+    std::string mapped = TempFile("mapped.blif");
+    EXPECT_EQ(Run("read_genlib " + genlib + "; " + script + "; " + nf + "; &put; write_blif " + mapped), 0);
+    std::ifstream in(mapped);
+    std::string text((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    std::remove(mapped.c_str());
+    return text.substr(text.find('\n') + 1);
+  }
+  static std::vector<int> ReadInts(const std::string& file) {
+    std::ifstream in(file, std::ios::binary);
+    std::vector<char> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    std::vector<int> ints(bytes.size() / sizeof(int));
+    std::memcpy(ints.data(), bytes.data(), ints.size() * sizeof(int));
+    return ints;
+  }
+  static void WriteInts(const std::string& file, const std::vector<int>& ints) {
+    std::ofstream out(file, std::ios::binary | std::ios::trunc);
+    out.write((const char*)ints.data(), ints.size() * sizeof(int));
+  }
+  // the file header is 8 ints, the payload starts with 4 ints of its own
+  static const int nHeader = 8, nNfHeader = 4;
+};
+
+// the threads process the nodes of each level, which gives the mapping
+// of the serial mapper, with and without choices
+TEST_F(NfTest, ThreadsMatchSerial) {
+  std::string genlib = WriteTempFile("small.genlib", SmallGenlib());
+  std::string benchmarks = DataFile("lsv/pa1/benchmarks/");
+  for (const std::string& script : {"read " + benchmarks + "square.blif; strash; &get",
+                                    "read " + benchmarks + "int2float.blif; strash; dch; &get -n"}) {
+    SCOPED_TRACE(script);
+    std::string mapped = Map(genlib, script, "&nf");
+    ASSERT_NE(mapped.find(".gate"), std::string::npos);
+    for (const char* nf : {"&nf -P 2", "&nf -P 4"}) {
+      EXPECT_EQ(Map(genlib, script, nf), mapped) << nf;
+    }
+  }
+  std::remove(genlib.c_str());
+}
+
+// the cached matches give the same mapping, and malformed entries are
+// derived and written again
+TEST_F(NfTest, CachedMatchesUncached) {
+  std::string genlib = WriteTempFile("small.genlib", SmallGenlib());
+  std::string dir = TempFile("cache");
+  std::string script = "read " + DataFile("lsv/pa1/benchmarks/int2float.blif") + "; strash; &get";
+  std::filesystem::remove_all(dir);
+  std::filesystem::create_directories(dir);
+  std::string mapped = Map(genlib, script, "&nf");
+  ASSERT_NE(mapped.find(".gate"), std::string::npos);
+  ASSERT_EQ(Run("set cachedir " + dir), 0);
+  EXPECT_EQ(Map(genlib, script, "&nf"), mapped);
+  std::vector<std::string> files;
+  for (const auto& entry : std::filesystem::directory_iterator(dir))
+    files.push_back(entry.path().string());
+  ASSERT_EQ(files.size(), 1u);
+  auto time = std::filesystem::last_write_time(files[0]);
+  EXPECT_EQ(Map(genlib, script, "&nf"), mapped);
+  EXPECT_EQ(std::filesystem::last_write_time(files[0]), time);
+  std::vector<int> ints = ReadInts(files[0]);
+  ASSERT_GT(ints.size(), (size_t)(nHeader + nNfHeader));
+  int nCells = ints[nHeader], nFuncs = ints[nHeader + 1], nInts = ints[nHeader + 2];
+  int iTruths = nHeader + nNfHeader, iSizes = iTruths + 2 * nFuncs, iMatches = iSizes + nFuncs;
+  ASSERT_EQ(ints.size(), (size_t)(iMatches + nInts));
+  int iFunc = 0;
+  while (iFunc < nFuncs && ints[iSizes + iFunc] == 0) iFunc++;
+  ASSERT_LT(iFunc + 1, nFuncs);
+  std::vector<std::vector<int>> corrupted(4, ints);
+  // the sizes add up, but one of them is negative
+  corrupted[0][iSizes + iFunc + 1] += corrupted[0][iSizes + iFunc] + 2;
+  corrupted[0][iSizes + iFunc] = -2;
+  // the gate is not in the library
+  corrupted[1][iMatches] = nCells;
+  // the permutation refers to an input the gate does not have
+  corrupted[2][iMatches + 1] |= 15 << 28;
+  // two functions have the same truth table
+  corrupted[3][iTruths + 2 * nFuncs - 2] = corrupted[3][iTruths + 2 * nFuncs - 4];
+  corrupted[3][iTruths + 2 * nFuncs - 1] = corrupted[3][iTruths + 2 * nFuncs - 3];
+  for (size_t i = 0; i < corrupted.size(); i++) {
+    WriteInts(files[0], corrupted[i]);
+    EXPECT_EQ(Map(genlib, script, "&nf"), mapped) << i;
+    EXPECT_EQ(ReadInts(files[0]), ints) << i;
+  }
+  std::filesystem::remove_all(dir);
+  std::remove(genlib.c_str());
+}
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,123 @@
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "abc_test.h"
+
+ABC_NAMESPACE_IMPL_START
+
+class NpnCacheTest : public AbcCommandTest {
+ protected:
+  void SetUp() override {
+    AbcCommandTest::SetUp();
+    dir = TempFile("cache");
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir);
+  }
+  void TearDown() override {
+    AbcCommandTest::TearDown();
+    std::filesystem::remove_all(dir);
+  }
+  // maps with the truth-table mapper and returns the mapped network
+  // without the first line, which has the time stamp; the cache is saved
+  // when the frame is stopped
+  std::string Map(bool fCache, std::string* pOutput = nullptr) {
+    std::string mapped = TempFile("mapped.blif");
+    if (fCache) {
+      EXPECT_EQ(Run("set cachedir " + dir), 0);
+    }
+    testing::internal::CaptureStdout();
+    EXPECT_EQ(Run("read " + DataFile("lsv/pa1/benchmarks/adder.blif") + "; strash; if -K 8 -c -v; write_blif " + mapped), 0);
+    std::string output = testing::internal::GetCapturedStdout();
+    if (pOutput) {
+      *pOutput = output;
+    }
+    Abc_Stop();
+    Abc_Start();
+    std::ifstream in(mapped);
+    std::string text((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    std::remove(mapped.c_str());
+    return text.substr(text.find('\n') + 1);
+  }
+  // the hit rate printed for the table of the given size, or -1
+  static double HitRate(const std::string& output, int nVars) {
+    std::string prefix = "NPN cache " + std::string(nVars < 10 ? " " : "") + std::to_string(nVars) + " vars:";
+    size_t pos = output.find(prefix);
+    if (pos == std::string::npos || (pos = output.find("Hits =", pos)) == std::string::npos)
+      return -1;
+    return std::stod(output.substr(pos + 6));
+  }
+  std::vector<std::string> CacheFiles() {
+    std::vector<std::string> files;
+    for (const auto& entry : std::filesystem::directory_iterator(dir))
+      files.push_back(entry.path().string());
+    return files;
+  }
+  // writes the entry with the hash of the changed payload, so that it is
+  // checked by the client
+  static void WriteWords(const std::string& file, std::vector<unsigned long long> words) {
+    unsigned Hash = Abc_CacheHashData(words.data() + nHeader, (words.size() - nHeader) * sizeof(unsigned long long));
+    words[1] = (words[1] & 0xFFFFFFFFull) | ((unsigned long long)Hash << 32);
+    std::ofstream(file, std::ios::binary | std::ios::trunc).write((const char*)words.data(), words.size() * sizeof(unsigned long long));
+  }
+  std::string dir;
+  // the file header is 4 words, the first table starts with 2 words
+  static const int nHeader = 4, nTable = 2;
+};
+
+// the cached transforms give the same mapping, and the saved cache is
+// reused by the next run
+TEST_F(NpnCacheTest, CachedMatchesUncached) {
+  std::string mapped = Map(false), output;
+  ASSERT_FALSE(mapped.empty());
+  EXPECT_TRUE(CacheFiles().empty());
+  EXPECT_EQ(Map(true), mapped);
+  ASSERT_EQ(CacheFiles().size(), 1u);
+  std::string file = CacheFiles()[0];
+  auto time = std::filesystem::last_write_time(file);
+  EXPECT_EQ(Map(true, &output), mapped);
+  for (int nVars = 6; nVars <= 8; nVars++) {
+    EXPECT_EQ(HitRate(output, nVars), 100.0) << nVars;
+  }
+  // nothing new is inserted, so the entry is not rewritten
+  EXPECT_EQ(std::filesystem::last_write_time(file), time);
+}
+
+// malformed transforms, damaged and truncated entries are ignored
+TEST_F(NpnCacheTest, RejectsCorruptedEntries) {
+  std::string mapped = Map(true), output;
+  ASSERT_EQ(CacheFiles().size(), 1u);
+  std::string file = CacheFiles()[0];
+  std::vector<unsigned long long> words;
+  {
+    std::ifstream in(file, std::ios::binary);
+    std::vector<char> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    words.resize(bytes.size() / sizeof(unsigned long long));
+    std::memcpy(words.data(), bytes.data(), words.size() * sizeof(unsigned long long));
+  }
+  ASSERT_GT(words.size(), (size_t)(nHeader + nTable + 1));
+  ASSERT_EQ(words[nHeader], 6u);
+  // the first entry of the 6-input table maps the first variable out of range
+  words[nHeader + nTable] |= 15ull << 13;
+  // without the matching hash, the whole entry is not loaded
+  std::ofstream(file, std::ios::binary | std::ios::trunc).write((const char*)words.data(), words.size() * sizeof(unsigned long long));
+  EXPECT_EQ(Map(true, &output), mapped);
+  EXPECT_LT(HitRate(output, 7), 100.0);
+  WriteWords(file, words);
+  EXPECT_EQ(Map(true, &output), mapped);
+  EXPECT_GT(HitRate(output, 6), 0.0);
+  EXPECT_LT(HitRate(output, 6), 100.0);
+  EXPECT_EQ(HitRate(output, 7), 100.0);
+  // the rewritten entry is well-formed again
+  EXPECT_EQ(Map(true, &output), mapped);
+  EXPECT_EQ(HitRate(output, 6), 100.0);
+  // a truncated entry is not loaded
+  std::filesystem::resize_file(file, std::filesystem::file_size(file) - 8);
+  EXPECT_EQ(Map(true, &output), mapped);
+  EXPECT_LT(HitRate(output, 7), 100.0);
+}
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,242 @@
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "abc_test.h"
+#include "map_libraries.h"
+#include "map/scl/sclLib.h"
+
+ABC_NAMESPACE_IMPL_START
+
+class StimeTest : public AbcCommandTest {
+ protected:
+  // runs the command and returns what it printed
+  std::string Output(const std::string& command) {
+    testing::internal::CaptureStdout();
+    EXPECT_EQ(Run(command), 0) << command;
+    return testing::internal::GetCapturedStdout();
+  }
+  // the numbers printed after the given label, in the order of printing
+  static std::vector<double> Numbers(const std::string& output, const std::string& label) {
+    std::vector<double> vNums;
+    std::regex number(label + " *([-0-9.]+)");
+    for (std::sregex_iterator it(output.begin(), output.end(), number), end; it != end; ++it)
+      vNums.push_back(std::stod((*it)[1]));
+    return vNums;
+  }
+};
+
+// sizing keeps the timing up to date incrementally; the delay it reaches
+// agrees with timing the sized network from scratch
+TEST_F(StimeTest, IncrementalSizingMatchesFullTiming) {
+  std::string lib = WriteTempFile("small.lib", SmallLiberty());
+  ASSERT_EQ(Run("read_lib " + lib + "; read " + DataFile("lsv/pa1/benchmarks/square.blif") + "; strash; map; topo"), 0);
+  for (std::string sizing : {"upsize -I 50", "dnsize", "upsize -I 50 -s", "upsize -I 50 -B 5", "dnsize -E 5", "upsize -I 50 -E 5"}) {
+    SCOPED_TRACE(sizing);
+    // upsize restores the best network it has seen
+    std::vector<double> vSizing = Numbers(Output(sizing), sizing.find("upsize") == 0 ? "B:" : "D:");
+    ASSERT_FALSE(vSizing.empty());
+    std::vector<double> vFull = Numbers(Output("stime"), "Delay =");
+    ASSERT_EQ(vFull.size(), 1u);
+    // the changes smaller than -E (0.1 ps by default) are not propagated
+    EXPECT_NEAR(vSizing.back(), vFull[0], sizing.find("-E") == std::string::npos ? 1.0 : 10.0);
+  }
+  std::remove(lib.c_str());
+}
+
+// the batched table lookup returns the same values as the scalar one,
+// inside the table ranges and when extrapolating beyond them
+TEST_F(StimeTest, BatchedLookupMatchesScalar) {
+  std::string lib = WriteTempFile("small.lib", SmallLiberty());
+  ASSERT_EQ(Run("read_lib " + lib), 0);
+  std::remove(lib.c_str());
+  SC_Lib* pLib = (SC_Lib*)Abc_FrameReadLibScl();
+  ASSERT_NE(pLib, nullptr);
+  SC_Cell* pCell;
+  SC_Timing* pTime;
+  int i, k, nSurfs = 0;
+  SC_LibForEachCell(pLib, pCell, i) {
+    for (k = 0; k < pCell->n_inputs; k++) {
+      if (!(pTime = Scl_CellPinTime(pCell, k)))
+        continue;
+      for (SC_Surface* pSurf : {&pTime->pCellRise, &pTime->pCellFall, &pTime->pRiseTrans, &pTime->pFallTrans}) {
+        SCOPED_TRACE(std::string(pCell->pName) + " pin " + std::to_string(k));
+        // the sample points, the midpoints between them, and points
+        // below and above the ranges
+        std::vector<float> vSlews, vLoads;
+        for (Vec_Flt_t* vIndex : {&pSurf->vIndex0, &pSurf->vIndex1}) {
+          std::vector<float>& vPoints = vIndex == &pSurf->vIndex0 ? vSlews : vLoads;
+          float First = Vec_FltEntry(vIndex, 0), Last = Vec_FltEntryLast(vIndex);
+          vPoints = {0, First - 1, Last + 1, 2 * Last};
+          for (int j = 0; j < Vec_FltSize(vIndex); j++) {
+            vPoints.push_back(Vec_FltEntry(vIndex, j));
+            if (j + 1 < Vec_FltSize(vIndex))
+              vPoints.push_back((Vec_FltEntry(vIndex, j) + Vec_FltEntry(vIndex, j + 1)) / 2);
+          }
+        }
+        // all combinations, so that the batch has several chunks and a padded tail
+        std::vector<float> vSlew, vLoad;
+        for (float Slew : vSlews)
+          for (float Load : vLoads)
+            vSlew.push_back(Slew), vLoad.push_back(Load);
+        ASSERT_GT(vSlew.size(), 64u);
+        std::vector<float> vRes(vSlew.size());
+        Scl_LibLookupBatch(pSurf, vSlew.data(), vLoad.data(), vRes.data(), (int)vRes.size());
+        for (size_t j = 0; j < vRes.size(); j++) {
+          EXPECT_EQ(vRes[j], Scl_LibLookup(pSurf, vSlew[j], vLoad[j])) << vSlew[j] << " " << vLoad[j];
+        }
+        nSurfs++;
+      }
+    }
+  }
+  EXPECT_GT(nSurfs, 0);
+}
+
+// a mapped network with nLevels levels of nWidth gates, each gate taking
+// pseudo-random fanins from the previous level
+static std::string WideMappedBlif(int nWidth, int nLevels) {
+  static const char* pGates[4] = {"NAND2_X1", "NOR2_X2", "XOR2_X1", "INV_X1"};
+  unsigned Seed = 1;
+  auto Random = [&Seed]() { return (Seed = Seed * 1103515245 + 12345) >> 8; };
+  std::string text = ".model wide\n.inputs";
+  for (int j = 0; j < nWidth; j++)
+    text += " n0_" + std::to_string(j);
+  text += "\n.outputs";
+  for (int j = 0; j < nWidth; j++)
+    text += " n" + std::to_string(nLevels) + "_" + std::to_string(j);
+  text += "\n";
+  for (int d = 1; d <= nLevels; d++) {
+    for (int j = 0; j < nWidth; j++) {
+      std::string prev = "n" + std::to_string(d - 1) + "_";
+      int g = Random() % 4;
+      text += std::string(".gate ") + pGates[g] + " A=" + prev + std::to_string(Random() % nWidth);
+      if (g < 3)
+        text += " B=" + prev + std::to_string(Random() % nWidth);
+      text += " Y=n" + std::to_string(d) + "_" + std::to_string(j) + "\n";
+    }
+  }
+  return text + ".end\n";
+}
+
+// the level-parallel timing reports the same arrival times, slews and
+// departure times as the serial one, also with a library whose tables
+// are decoded when the timing starts
+TEST_F(StimeTest, ThreadsMatchSerial) {
+  std::string lib = WriteTempFile("small.lib", SmallLiberty());
+  std::string scl = TempFile("small.scl");
+  std::string wide = WriteTempFile("wide.blif", WideMappedBlif(2000, 6));
+  for (std::string read : {"read_lib " + lib, "read_lib " + lib + "; write_scl " + scl + "; read_scl " + scl}) {
+    SCOPED_TRACE(read);
+    ASSERT_EQ(Run(read + "; read " + wide + "; topo"), 0);
+    ASSERT_GT(Abc_NtkNodeNum(Abc_FrameReadNtk(Abc_FrameGetGlobalFrame())), 6 * 1024);
+    std::string serial = Output("stime -a -P 1");
+    ASSERT_GT(Numbers(serial, "Dr =").size(), 6u * 1024);
+    for (int nThreads : {2, 4}) {
+      EXPECT_EQ(Output("stime -a -P " + std::to_string(nThreads)), serial) << nThreads;
+      EXPECT_EQ(Output("stime -p -P " + std::to_string(nThreads)), Output("stime -p -P 1")) << nThreads;
+    }
+  }
+  std::remove(lib.c_str());
+  std::remove(scl.c_str());
+  std::remove(wide.c_str());
+}
+
+// the first timing of the library, whose tables may not be decoded yet
+static SC_Timing* FirstTiming(SC_Lib* pLib) {
+  SC_Cell* pCell;
+  SC_Timing* pTime;
+  int i, k;
+  SC_LibForEachCell(pLib, pCell, i) {
+    for (k = 0; k < pCell->n_inputs; k++) {
+      SC_Pin* pPin = SC_CellPin(pCell, pCell->n_inputs);
+      SC_Timings* pRTime = (SC_Timings*)Vec_PtrEntry(&pPin->vRTimings, k);
+      if (Vec_PtrSize(&pRTime->vTimings) && (pTime = (SC_Timing*)Vec_PtrEntry(&pRTime->vTimings, 0)))
+        return pTime;
+    }
+  }
+  return nullptr;
+}
+
+// the tables of a library read by read_scl are decoded on first use, and
+// scaled then if the library is not in ps and ff; the library prints and
+// times the same as the one read from Liberty
+TEST_F(StimeTest, LazyDecodingMatchesLiberty) {
+  std::string lib = WriteTempFile("small.lib", SmallLiberty());
+  std::string scl = TempFile("small.scl");
+  std::string design = "read " + DataFile("lsv/pa1/benchmarks/square.blif") + "; strash; map; topo; stime";
+  ASSERT_EQ(Run("read_lib " + lib), 0);
+  std::string expected = Output("print_lib; " + design);
+  ASSERT_FALSE(Numbers(expected, "Delay =").empty());
+  for (int fScale : {0, 1}) {
+    SCOPED_TRACE(fScale ? "ns and pf" : "ps and ff");
+    ASSERT_EQ(Run("read_lib " + lib), 0);
+    if (fScale) {
+      // divides the times and the loads by 1000 and keeps them in ns and pf
+      SC_Lib* pLib = (SC_Lib*)Abc_FrameReadLibScl();
+      pLib->unit_time = 15, pLib->unit_cap_fst = 1, pLib->unit_cap_snd = 18;
+      Abc_SclLibNormalize(pLib);
+      pLib->unit_time = 9, pLib->unit_cap_snd = 12;
+    }
+    ASSERT_EQ(Run("write_scl " + scl), 0);
+    // read_scl decodes the tables when deriving the genlib library
+    SC_Lib* pLib = Abc_SclReadFromFile((char*)scl.c_str());
+    ASSERT_NE(pLib, nullptr);
+    SC_Timing* pTime = FirstTiming(pLib);
+    ASSERT_NE(pTime, nullptr);
+    EXPECT_NE(pTime->pLazy, nullptr);
+    EXPECT_EQ(pTime->LazyScale[0], fScale ? 1000 : 1);
+    EXPECT_EQ(pTime->LazyScale[1], fScale ? 1000 : 1);
+    Abc_SclTimingDecode(pTime);
+    EXPECT_EQ(pTime->pLazy, nullptr);
+    Abc_SclLibFree(pLib);
+    ASSERT_EQ(Run("read_scl " + scl), 0);
+    std::string output = Output("print_lib; " + design);
+    if (!fScale) {
+      EXPECT_EQ(output, expected);
+      continue;
+    }
+    // the scaled values may differ in the last printed digit
+    std::istringstream words(output), wordsExp(expected);
+    std::string word, wordExp;
+    int nWords = 0;
+    for (; words >> word && wordsExp >> wordExp; nWords++) {
+      char *pEnd, *pEndExp;
+      double Num = std::strtod(word.c_str(), &pEnd), NumExp = std::strtod(wordExp.c_str(), &pEndExp);
+      if (*pEnd || *pEndExp || pEnd == word.c_str())
+        EXPECT_EQ(word, wordExp);
+      else
+        EXPECT_NEAR(Num, NumExp, 0.11) << nWords;
+    }
+    EXPECT_FALSE(words >> word);
+    EXPECT_FALSE(wordsExp >> wordExp);
+    EXPECT_EQ(Numbers(output, "Delay ="), Numbers(expected, "Delay ="));
+  }
+  std::remove(lib.c_str());
+  std::remove(scl.c_str());
+}
+
+// a file whose timing tables are cut off is rejected when it is read
+TEST_F(StimeTest, TruncatedSclFails) {
+  std::string lib = WriteTempFile("small.lib", SmallLiberty());
+  std::string scl = TempFile("small.scl");
+  ASSERT_EQ(Run("read_lib " + lib + "; write_scl " + scl), 0);
+  std::string data;
+  {
+    std::ifstream in(scl, std::ios::binary);
+    data.assign((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+  }
+  ASSERT_GT(data.size(), 100u);
+  std::ofstream(scl, std::ios::binary) << data.substr(0, data.size() - 8);
+  testing::internal::CaptureStdout();
+  EXPECT_NE(Run("read_scl " + scl), 0);
+  EXPECT_NE(testing::internal::GetCapturedStdout().find("do not fit"), std::string::npos);
+  std::remove(lib.c_str());
+  std::remove(scl.c_str());
+}
+
+ABC_NAMESPACE_IMPL_END
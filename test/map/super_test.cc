@@ -0,0 +1,111 @@
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "abc_test.h"
+#include "map_libraries.h"
+
+ABC_NAMESPACE_IMPL_START
+
+class SuperTest : public AbcCommandTest {
+ protected:
+  void SetUp() override {
+    AbcCommandTest::SetUp();
+    genlib = WriteTempFile("small.genlib", SmallGenlib());
+    dir = TempFile("cache");
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir);
+  }
+  void TearDown() override {
+    AbcCommandTest::TearDown();
+    std::filesystem::remove_all(dir);
+    std::remove(genlib.c_str());
+    std::remove(Library().c_str());
+  }
+  // the supergate library is written next to the genlib file
+  std::string Library() { return genlib.substr(0, genlib.rfind('.')) + ".super"; }
+  // computes the supergates in a fresh frame, so that the libraries cached
+  // in memory are not reused, and returns the library without the comments,
+  // which have the date and the runtime
+  std::string Super(const std::string& options, bool fCache, std::string* pOutput = nullptr) {
+    Abc_Stop();
+    Abc_Start();
+    if (fCache) {
+      EXPECT_EQ(Run("set cachedir " + dir), 0);
+    }
+    testing::internal::CaptureStdout();
+    EXPECT_EQ(Run("super " + options + " -v " + genlib), 0);
+    std::string output = testing::internal::GetCapturedStdout();
+    if (pOutput) {
+      *pOutput = output;
+    }
+    std::ifstream in(Library());
+    std::string line, text;
+    while (std::getline(in, line))
+      if (line.empty() || line[0] != '#')
+        text += line + "\n";
+    return text;
+  }
+  std::vector<std::string> CacheFiles() {
+    std::vector<std::string> files;
+    for (const auto& entry : std::filesystem::directory_iterator(dir))
+      files.push_back(entry.path().string());
+    return files;
+  }
+  std::string genlib, dir;
+};
+
+// the levels computed by several threads give the same supergates
+TEST_F(SuperTest, ThreadsMatchSerial) {
+  for (std::string options : {"-I 4 -L 2", "-I 4 -L 3 -D 3", "-I 4 -L 3 -A 8"}) {
+    SCOPED_TRACE(options);
+    std::string serial = Super(options + " -P 1", false);
+    ASSERT_GT(serial.size(), 1000u);
+    EXPECT_EQ(Super(options + " -P 2", false), serial);
+    EXPECT_EQ(Super(options + " -P 4", false), serial);
+  }
+}
+
+// the libraries are reused from memory in the same session and from the
+// cache directory in the next one; malformed entries are recomputed
+TEST_F(SuperTest, CacheMatchesComputed) {
+  std::string options = "-I 4 -L 3 -D 3", output;
+  std::string computed = Super(options, false);
+  ASSERT_GT(computed.size(), 1000u);
+  EXPECT_TRUE(CacheFiles().empty());
+  EXPECT_EQ(Super(options, true, &output), computed);
+  EXPECT_EQ(output.find("from the cache"), std::string::npos);
+  ASSERT_EQ(CacheFiles().size(), 1u);
+  std::string file = CacheFiles()[0];
+  auto size = std::filesystem::file_size(file);
+  // the same session keeps the library in memory
+  testing::internal::CaptureStdout();
+  EXPECT_EQ(Run("unset cachedir; super " + options + " -v " + genlib), 0);
+  EXPECT_NE(testing::internal::GetCapturedStdout().find("from the cache"), std::string::npos);
+  // the next session loads it from the cache directory
+  EXPECT_EQ(Super(options, true, &output), computed);
+  EXPECT_NE(output.find("from the cache"), std::string::npos);
+  // other parameters are another entry
+  EXPECT_NE(Super("-I 4 -L 3 -A 8", true, &output), computed);
+  EXPECT_EQ(output.find("from the cache"), std::string::npos);
+  EXPECT_EQ(CacheFiles().size(), 2u);
+  // a truncated entry is not loaded and is written again
+  std::filesystem::resize_file(file, size - 1);
+  EXPECT_EQ(Super(options, true, &output), computed);
+  EXPECT_EQ(output.find("from the cache"), std::string::npos);
+  EXPECT_EQ(std::filesystem::file_size(file), size);
+  // an entry with another signature is not loaded
+  {
+    std::fstream io(file, std::ios::in | std::ios::out | std::ios::binary);
+    io.seekp(0);
+    io.put('X');
+  }
+  EXPECT_EQ(Super(options, true, &output), computed);
+  EXPECT_EQ(output.find("from the cache"), std::string::npos);
+  EXPECT_EQ(Super(options, true, &output), computed);
+  EXPECT_NE(output.find("from the cache"), std::string::npos);
+}
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,189 @@
+#include <algorithm>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "misc/vec/vec.h"
+#include "misc/tim/tim.h"
+#include "misc/tim/timInt.h"
+
+ABC_NAMESPACE_IMPL_START
+
+// A chain of white boxes with the logic around them modeled by the
+// arrival time of each CO being the latest arrival time among a few
+// earlier CIs plus a gate delay. The timing manager is compared with a
+// direct computation over several rounds, in which a few gate delays
+// and primary input and output times change, as in mapping rounds.
+class TimTest : public testing::Test {
+ protected:
+  static const int nPis = 8, nPos = 6, nBoxes = 60, nIns = 3, nOuts = 2, nTables = 3;
+
+  void SetUp() override {
+    nCis = nPis + nBoxes * nOuts;
+    nCos = nBoxes * nIns + nPos;
+    p = Tim_ManStart(nCis, nCos);
+    // the delay tables have missing arcs, and the second output of the
+    // last table does not depend on any input
+    Vec_Ptr_t* vTables = Vec_PtrAlloc(nTables);
+    vDelays.resize(nTables);
+    for (int t = 0; t < nTables; t++) {
+      float* pTable = ABC_ALLOC(float, 3 + nIns * nOuts);
+      pTable[0] = t, pTable[1] = nIns, pTable[2] = nOuts;
+      for (int k = 0; k < nIns * nOuts; k++) {
+        bool fMissing = Random() % 5 == 0 || (t == nTables - 1 && k >= nIns);
+        pTable[3 + k] = fMissing ? -ABC_INFINITY : (float)(1 + Random() % 9);
+      }
+      vDelays[t].assign(pTable + 3, pTable + 3 + nIns * nOuts);
+      Vec_PtrPush(vTables, pTable);
+    }
+    Tim_ManSetDelayTables(p, vTables);
+    for (int b = 0; b < nBoxes; b++) {
+      Tim_ManCreateBox(p, b * nIns, nIns, nPis + b * nOuts, nOuts, b % nTables, 0);
+    }
+    // each CO depends on two CIs before it
+    vFanins.resize(nCos);
+    for (int c = 0; c < nCos; c++) {
+      int nLimit = c < nBoxes * nIns ? nPis + (c / nIns) * nOuts : nCis;
+      vFanins[c] = {(int)(Random() % nLimit), (int)(Random() % nLimit)};
+    }
+    vGate.assign(nCos, 1);
+    vCiArr.assign(nCis, 0);
+    vCoReq.assign(nCos, (float)TIM_ETERNITY);
+  }
+  void TearDown() override { Tim_ManStop(p); }
+
+  unsigned Random() { return (Seed = Seed * 1103515245 + 12345) >> 8; }
+  float Delay(int iBox, int iOut, int iIn, int fUnitDelay) {
+    float Delay = vDelays[iBox % nTables][iOut * nIns + iIn];
+    return fUnitDelay && Delay != -ABC_INFINITY ? 1 : Delay;
+  }
+
+  // propagates arrival times through the manager and checks them
+  void CheckArrivals(Tim_Man_t* pMan, int fUnitDelay) {
+    std::vector<float> vArr(nCis), vCoArr(nCos);
+    Tim_ManIncrementTravId(pMan);
+    for (int i = 0; i < nPis; i++) {
+      Tim_ManInitPiArrival(pMan, i, vCiArr[i]);
+      vArr[i] = Tim_ManGetCiArrival(pMan, i);
+      EXPECT_EQ(vArr[i], vCiArr[i]);
+    }
+    for (int b = 0; b < nBoxes; b++) {
+      for (int j = 0; j < nIns; j++) {
+        int c = b * nIns + j;
+        vCoArr[c] = std::max(vArr[vFanins[c][0]], vArr[vFanins[c][1]]) + vGate[c];
+        Tim_ManSetCoArrival(pMan, c, vCoArr[c]);
+      }
+      for (int k = 0; k < nOuts; k++) {
+        float Expected = -TIM_ETERNITY;
+        for (int j = 0; j < nIns; j++)
+          if (Delay(b, k, j, fUnitDelay) != -ABC_INFINITY)
+            Expected = std::max(Expected, vCoArr[b * nIns + j] + Delay(b, k, j, fUnitDelay));
+        int iCi = nPis + b * nOuts + k;
+        vArr[iCi] = Tim_ManGetCiArrival(pMan, iCi);
+        EXPECT_EQ(vArr[iCi], Expected) << "box " << b << " output " << k;
+      }
+    }
+  }
+  // propagates required times through the manager and checks them
+  void CheckRequired(Tim_Man_t* pMan, int fUnitDelay) {
+    std::vector<float> vReq(nCos, (float)TIM_ETERNITY);
+    Tim_ManIncrementTravId(pMan);
+    for (int o = 0; o < nPos; o++) {
+      int c = nBoxes * nIns + o;
+      Tim_ManSetCoRequired(pMan, c, vCoReq[c]);
+      vReq[c] = Tim_ManGetCoRequired(pMan, c);
+      EXPECT_EQ(vReq[c], vCoReq[c]);
+    }
+    for (int b = nBoxes - 1; b >= 0; b--) {
+      std::vector<float> vOutReq(nOuts, (float)TIM_ETERNITY);
+      for (int k = 0; k < nOuts; k++) {
+        int iCi = nPis + b * nOuts + k;
+        for (int c = (b + 1) * nIns; c < nCos; c++)
+          if (vFanins[c][0] == iCi || vFanins[c][1] == iCi)
+            vOutReq[k] = std::min(vOutReq[k], vReq[c] - vGate[c]);
+        Tim_ManSetCiRequired(pMan, iCi, vOutReq[k]);
+      }
+      for (int j = 0; j < nIns; j++) {
+        float Expected = TIM_ETERNITY;
+        for (int k = 0; k < nOuts; k++)
+          if (Delay(b, k, j, fUnitDelay) != -ABC_INFINITY)
+            Expected = std::min(Expected, vOutReq[k] - Delay(b, k, j, fUnitDelay));
+        int c = b * nIns + j;
+        vReq[c] = Tim_ManGetCoRequired(pMan, c);
+        EXPECT_EQ(vReq[c], Expected) << "box " << b << " input " << j;
+      }
+    }
+  }
+  // changes a few gate delays and primary input and output times
+  void Perturb(int nChanges) {
+    for (int i = 0; i < nChanges; i++) {
+      vGate[Random() % nCos] = 1 + Random() % 3;
+      vCiArr[Random() % nPis] = Random() % 10;
+      vCoReq[nBoxes * nIns + Random() % nPos] = 100 + Random() % 10;
+    }
+  }
+
+  Tim_Man_t* p = nullptr;
+  int nCis = 0, nCos = 0;
+  unsigned Seed = 1;
+  std::vector<std::vector<float>> vDelays;
+  std::vector<std::vector<int>> vFanins;
+  std::vector<float> vGate, vCiArr, vCoReq;
+};
+
+// the boxes, whose inputs did not change, are not recomputed, and the
+// times stay the same as computed directly
+TEST_F(TimTest, IncrementalBoxTimingMatchesDirect) {
+  for (int r = 0; r < 20; r++) {
+    SCOPED_TRACE(r);
+    // some rounds change nothing
+    Perturb(r % 4 == 3 ? 0 : 1 + r % 5);
+    CheckArrivals(p, 0);
+    CheckRequired(p, 0);
+  }
+}
+
+// the timing of a box is computed again only when the arrival times of
+// its inputs or the required times of its outputs change
+TEST_F(TimTest, UnchangedBoxesAreSkipped) {
+  // an input of the last box with a finite arrival time
+  vFanins[(nBoxes - 1) * nIns] = {0, 1};
+  Perturb(3);
+  CheckArrivals(p, 0);
+  CheckRequired(p, 0);
+  p->nBoxUpdates = 0;
+  CheckArrivals(p, 0);
+  CheckRequired(p, 0);
+  EXPECT_EQ(p->nBoxUpdates, 0);
+  // the outputs of the last box feed only primary outputs
+  vGate[(nBoxes - 1) * nIns] += 1;
+  CheckArrivals(p, 0);
+  EXPECT_EQ(p->nBoxUpdates, 1);
+  CheckRequired(p, 0);
+  // the inputs of the first box are fed only by primary inputs
+  vGate[0] += 1;
+  p->nBoxUpdates = 0;
+  CheckRequired(p, 0);
+  EXPECT_EQ(p->nBoxUpdates, 0);
+  CheckArrivals(p, 0);
+  EXPECT_GE(p->nBoxUpdates, 1);
+}
+
+// the duplicated manager with unit delays uses its own delay tables
+TEST_F(TimTest, UnitDelayDuplicate) {
+  Perturb(3);
+  CheckArrivals(p, 0);
+  CheckRequired(p, 0);
+  Tim_Man_t* pNew = Tim_ManDup(p, 1);
+  for (int r = 0; r < 5; r++) {
+    SCOPED_TRACE(r);
+    CheckArrivals(pNew, 1);
+    CheckRequired(pNew, 1);
+    CheckArrivals(p, 0);
+    CheckRequired(p, 0);
+    Perturb(2);
+  }
+  Tim_ManStop(pNew);
+}
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,144 @@
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "abc_test.h"
+#include "seq_designs.h"
+#include "aig/saig/saig.h"
+#include "base/main/main.h"
+#include "misc/util/utilCex.h"
+
+ABC_NAMESPACE_IMPL_START
+
+class BmcTest : public AbcCommandTest {
+ protected:
+  // the frames of the counter-examples stored by "bmc3 -a -x" (-1 for the outputs without one)
+  std::vector<int> CexFrames() {
+    std::vector<int> vFrames;
+    Vec_Ptr_t* vCexes = Abc_FrameReadCexVec(Abc_FrameGetGlobalFrame());
+    Abc_Cex_t* pCex;
+    int i;
+    if (vCexes == NULL) return vFrames;
+    Vec_PtrForEachEntry(Abc_Cex_t*, vCexes, pCex, i)
+      vFrames.push_back(pCex ? pCex->iFrame : -1);
+    return vFrames;
+  }
+};
+
+// "bmc3 -N" finds the earliest counter-example among the clusters, which is
+// the one found by the serial engine, and solves all outputs with -a
+TEST_F(BmcTest, Bmc3ThreadsMatchSerial) {
+  std::string file = WriteTempFile("counters.blif", CountersBlif(4, {{16, 11}, {8, 5}, {10, 11}, {16, 13}}));
+  ASSERT_EQ(Run("read " + file + "; strash; bmc3 -F 20"), 0);
+  EXPECT_EQ(Status(), 0);
+  ASSERT_NE(Cex(), nullptr);
+  int iPo = Cex()->iPo, iFrame = Cex()->iFrame;
+  EXPECT_EQ(iPo, 1);
+  EXPECT_EQ(iFrame, 5);
+  ASSERT_EQ(Run("read " + file + "; strash; bmc3 -a -x -F 20"), 0);
+  std::vector<int> vFrames = CexFrames();
+  EXPECT_EQ(vFrames, std::vector<int>({11, 5, -1, 13}));
+  for (const char* options : {"-N 2", "-N 4", "-N 8"}) {
+    SCOPED_TRACE(options);
+    ASSERT_EQ(Run("read " + file + "; strash; bmc3 -F 20 " + std::string(options)), 0);
+    EXPECT_EQ(Status(), 0);
+    ASSERT_NE(Cex(), nullptr);
+    EXPECT_EQ(Cex()->iPo, iPo);
+    EXPECT_EQ(Cex()->iFrame, iFrame);
+    ASSERT_EQ(Run("read " + file + "; strash; bmc3 -a -x -F 20 " + std::string(options)), 0);
+    EXPECT_EQ(CexFrames(), vFrames);
+  }
+  std::remove(file.c_str());
+}
+
+// two runs in a row start with a cleared stop request
+TEST_F(BmcTest, Bmc3ThreadsStopPerRun) {
+  std::string sat = WriteTempFile("sat.blif", CountersBlif(4, {{16, 3}, {16, 11}}));
+  std::string unsat = WriteTempFile("unsat.blif", CountersBlif(4, {{10, 11}, {8, 9}}));
+  for (int i = 0; i < 2; i++) {
+    ASSERT_EQ(Run("read " + sat + "; strash; bmc3 -F 20 -N 2"), 0);
+    EXPECT_EQ(Status(), 0);
+    ASSERT_NE(Cex(), nullptr);
+    EXPECT_EQ(Cex()->iFrame, 3);
+    ASSERT_EQ(Run("read " + unsat + "; strash; bmc3 -F 20 -N 2"), 0);
+    EXPECT_EQ(Status(), 1);
+  }
+  std::remove(sat.c_str());
+  std::remove(unsat.c_str());
+}
+
+// a cluster of combinational outputs yields a cone without flops, whose
+// ternary simulation has an empty state
+TEST_F(BmcTest, Bmc3ThreadsCombinationalOutput) {
+  std::string file = WriteTempFile("comb.blif",
+      ".model comb\n.inputs a b\n.outputs o1 o2\n.latch d q 0\n"
+      ".names a q d\n11 1\n.names q b o1\n11 1\n.names a b o2\n11 1\n.end\n");
+  ASSERT_EQ(Run("read " + file + "; strash; bmc3 -F 5"), 0);
+  EXPECT_EQ(Status(), 0);
+  ASSERT_NE(Cex(), nullptr);
+  EXPECT_EQ(Cex()->iPo, 1);
+  EXPECT_EQ(Cex()->iFrame, 0);
+  for (const char* options : {"-N 2", "-N 2 -v", "-N 2 -s", "-N 2 -a -x"}) {
+    SCOPED_TRACE(options);
+    ASSERT_EQ(Run("read " + file + "; strash; bmc3 -F 5 " + std::string(options)), 0);
+    EXPECT_EQ(Status(), 0);
+    if (std::string(options).find("-a") != std::string::npos)
+      EXPECT_EQ(CexFrames(), std::vector<int>({-1, 0}));
+    else {
+      ASSERT_NE(Cex(), nullptr);
+      EXPECT_EQ(Cex()->iPo, 1);
+      EXPECT_EQ(Cex()->iFrame, 0);
+    }
+  }
+  std::remove(file.c_str());
+}
+
+// the word-parallel ternary simulation agrees with the evaluation of one
+// object at a time, for the nodes, the outputs and the next states
+TEST_F(BmcTest, TernarySimulationMatchesScalar) {
+  const int nPis = 3, nRegs = 70, nNodes = 600;
+  Aig_Man_t* p = Aig_ManStart(nNodes);
+  std::vector<Aig_Obj_t*> vObjs;
+  unsigned Seed = 1;
+  auto Rand = [&Seed](unsigned n) { return (Seed = Seed * 1103515245 + 12345) / 16 % n; };
+  for (int i = 0; i < nPis + nRegs; i++) vObjs.push_back(Aig_ObjCreateCi(p));
+  for (int i = 0; i < nNodes; i++) {
+    // the inputs are used rarely to keep some flops binary
+    Aig_Obj_t* pFan0 = vObjs[nPis + Rand(vObjs.size() - nPis)];
+    Aig_Obj_t* pFan1 = Rand(8) ? vObjs[nPis + Rand(vObjs.size() - nPis)] : vObjs[Rand(nPis)];
+    vObjs.push_back(Aig_And(p, Aig_NotCond(pFan0, Rand(2)), Aig_NotCond(pFan1, Rand(2))));
+  }
+  Aig_ObjCreateCo(p, Aig_Not(vObjs.back()));
+  for (int i = 0; i < nRegs; i++) Aig_ObjCreateCo(p, Aig_NotCond(vObjs[vObjs.size() - 1 - 3 * i], i & 1));
+  Aig_ManSetRegNum(p, nRegs);
+  Aig_ManCleanup(p);
+  Saig_Ter_t* pTer = Saig_TerStart(p);
+  int nFrames = Saig_TerSimulate(pTer, 50), nRegWords = Abc_Bit6WordNum(nRegs), nBinary = 0;
+  ASSERT_GT(nFrames, 2);
+  for (int f = 0; f + 1 < nFrames; f++) {
+    std::vector<word> vState(Saig_TerState(pTer, f), Saig_TerState(pTer, f) + 2 * nRegWords);
+    std::vector<word> vNext(Saig_TerState(pTer, f + 1), Saig_TerState(pTer, f + 1) + 2 * nRegWords);
+    std::vector<int> vValues(Aig_ManObjNumMax(p));
+    Aig_Obj_t* pObj;
+    int i;
+    nBinary += Saig_TerStateCountBinary(pTer, vState.data());
+    Saig_TerSimulateFrame(pTer, vState.data());
+    vValues[Aig_ObjId(Aig_ManConst1(p))] = SAIG_TER_ONE;
+    Saig_ManForEachPi(p, pObj, i) vValues[Aig_ObjId(pObj)] = SAIG_TER_UND;
+    Saig_ManForEachLo(p, pObj, i) vValues[Aig_ObjId(pObj)] = Saig_TerStateValue(vState.data(), nRegWords, i);
+    Aig_ManForEachNode(p, pObj, i) {
+      vValues[i] = Saig_TerAnd(Saig_TerNotCond(vValues[Aig_ObjFaninId0(pObj)], Aig_ObjFaninC0(pObj)),
+                               Saig_TerNotCond(vValues[Aig_ObjFaninId1(pObj)], Aig_ObjFaninC1(pObj)));
+      ASSERT_EQ(Saig_TerObjValue(pTer, pObj), vValues[i]) << "frame " << f << " node " << i;
+    }
+    Aig_ManForEachCo(p, pObj, i)
+      ASSERT_EQ(Saig_TerObjValue(pTer, pObj), Saig_TerNotCond(vValues[Aig_ObjFaninId0(pObj)], Aig_ObjFaninC0(pObj)));
+    Saig_ManForEachLi(p, pObj, i)
+      ASSERT_EQ(Saig_TerStateValue(vNext.data(), nRegWords, i), Saig_TerObjValue(pTer, pObj)) << "frame " << f << " flop " << i;
+  }
+  EXPECT_GT(nBinary, 0);
+  Saig_TerStop(pTer);
+  Aig_ManStop(p);
+}
+
+ABC_NAMESPACE_IMPL_END
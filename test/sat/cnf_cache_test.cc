@@ -0,0 +1,182 @@
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "abc_test.h"
+#include "seq_designs.h"
+
+ABC_NAMESPACE_IMPL_START
+
+class CnfCacheTest : public AbcCommandTest {
+ protected:
+  void SetUp() override {
+    AbcCommandTest::SetUp();
+    dir = TempFile("cache");
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir);
+  }
+  void TearDown() override {
+    std::filesystem::remove_all(dir);
+    AbcCommandTest::TearDown();
+  }
+  std::set<std::string> CacheFiles() {
+    std::set<std::string> files;
+    for (const auto& entry : std::filesystem::directory_iterator(dir))
+      files.insert(entry.path().string());
+    return files;
+  }
+  std::vector<std::filesystem::file_time_type> WriteTimes() {
+    std::vector<std::filesystem::file_time_type> vTimes;
+    for (const std::string& file : CacheFiles())
+      vTimes.push_back(std::filesystem::last_write_time(file));
+    return vTimes;
+  }
+  static std::vector<int> ReadInts(const std::string& file) {
+    std::ifstream in(file, std::ios::binary);
+    std::vector<char> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    std::vector<int> ints(bytes.size() / sizeof(int));
+    std::memcpy(ints.data(), bytes.data(), ints.size() * sizeof(int));
+    return ints;
+  }
+  // writes the entry with the hash of the changed payload, so that it is
+  // checked by the client
+  static void WriteInts(const std::string& file, std::vector<int> ints) {
+    ints[3] = (int)Abc_CacheHashData(ints.data() + nHeader, (ints.size() - nHeader) * sizeof(int));
+    std::ofstream out(file, std::ios::binary | std::ios::trunc);
+    out.write((const char*)ints.data(), ints.size() * sizeof(int));
+  }
+  // the verdicts and the CEX frames of bmc3 and pdr
+  std::vector<int> Results(const std::string& file, const char* pdr) {
+    std::vector<int> vRes;
+    EXPECT_EQ(Run("read " + file + "; strash; bmc3 -F 20"), 0);
+    vRes.push_back(Status());
+    vRes.push_back(Cex() ? Cex()->iFrame : -1);
+    EXPECT_EQ(Run("read " + file + "; strash; " + pdr), 0);
+    vRes.push_back(Status());
+    vRes.push_back(Cex() ? Cex()->iFrame : -1);
+    return vRes;
+  }
+  std::string dir;
+  // the file header is 8 ints, the payload starts with 12 ints of its own
+  static const int nHeader = 8, nCnfHeader = 12;
+};
+
+// the cached mapping and CNF give the same results as the uncached ones
+TEST_F(CnfCacheTest, CachedMatchesUncached) {
+  std::string reach = WriteTempFile("reach.blif", CounterBlif(4, 16, 11));
+  std::string unreach = WriteTempFile("unreach.blif", CounterBlif(4, 10, 11));
+  for (const char* pdr : {"pdr", "pdr -m"}) {
+    SCOPED_TRACE(pdr);
+    std::vector<int> vReach = Results(reach, pdr), vUnreach = Results(unreach, pdr);
+    EXPECT_EQ(vReach, std::vector<int>({0, 11, 0, 11}));
+    EXPECT_EQ(vUnreach, std::vector<int>({1, -1, 1, -1}));
+    ASSERT_EQ(Run("set cachedir " + dir), 0);
+    std::vector<std::filesystem::file_time_type> vTimes;
+    for (int i = 0; i < 2; i++) {
+      EXPECT_EQ(Results(reach, pdr), vReach);
+      EXPECT_EQ(Results(unreach, pdr), vUnreach);
+      // the entries are reused rather than rewritten
+      if (i == 1) {
+        EXPECT_EQ(WriteTimes(), vTimes);
+      }
+      vTimes = WriteTimes();
+    }
+    ASSERT_EQ(Run("unset cachedir"), 0);
+  }
+  // the mapping and two kinds of CNF for each design
+  EXPECT_EQ(CacheFiles().size(), 6u);
+  std::remove(reach.c_str());
+  std::remove(unreach.c_str());
+}
+
+// an entry of another AIG, whose key is the same, and corrupted entries are
+// not used
+TEST_F(CnfCacheTest, RejectsMismatchedAndCorruptedEntries) {
+  std::string fileA = WriteTempFile("a.blif", CounterBlif(4, 16, 11));
+  std::string fileB = WriteTempFile("b.blif", CounterBlif(4, 16, 13));
+  ASSERT_EQ(Run("set cachedir " + dir), 0);
+  ASSERT_EQ(Run("read " + fileA + "; strash; bmc3 -F 20"), 0);
+  std::set<std::string> filesA = CacheFiles();
+  ASSERT_EQ(filesA.size(), 1u);
+  ASSERT_EQ(Run("read " + fileB + "; strash; bmc3 -F 20"), 0);
+  std::set<std::string> filesB = CacheFiles();
+  ASSERT_EQ(filesB.size(), 2u);
+  std::string entryA = *filesA.begin(), entryB;
+  for (const std::string& file : filesB)
+    if (file != entryA) entryB = file;
+  std::vector<int> intsA = ReadInts(entryA), intsB = ReadInts(entryB);
+  ASSERT_GT(intsA.size(), (size_t)nHeader + nCnfHeader);
+  // the entry of A under the key of B
+  std::vector<int> ints = intsA;
+  std::copy(intsB.begin() + 4, intsB.begin() + 6, ints.begin() + 4);
+  WriteInts(entryB, ints);
+  ASSERT_EQ(Run("read " + fileB + "; strash; bmc3 -F 20"), 0);
+  EXPECT_EQ(Status(), 0);
+  ASSERT_NE(Cex(), nullptr);
+  EXPECT_EQ(Cex()->iFrame, 13);
+  // the mapping of B with the cut offsets out of range
+  ints = intsB;
+  int nObjs = ints[nHeader + 2], * pMap = ints.data() + nHeader + nCnfHeader + 3 * nObjs;
+  for (int i = 0; i < nObjs; i++)
+    if (pMap[i]) pMap[i] = 0x7FFFFFFF;
+  WriteInts(entryB, ints);
+  ASSERT_EQ(Run("read " + fileB + "; strash; bmc3 -F 20"), 0);
+  EXPECT_EQ(Status(), 0);
+  ASSERT_NE(Cex(), nullptr);
+  EXPECT_EQ(Cex()->iFrame, 13);
+  // the CNF of B with the literals or the clause starts out of range
+  for (int fStarts = 0; fStarts < 2; fStarts++) {
+    SCOPED_TRACE(fStarts);
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir);
+    ASSERT_EQ(Run("read " + fileB + "; strash; pdr"), 0);
+    for (const std::string& file : CacheFiles()) {
+      ints = ReadInts(file);
+      int* pData = ints.data() + nHeader;
+      int nLits = pData[8], nClauses = pData[7];
+      int* pLits = pData + nCnfHeader + 3 * pData[2];
+      if (fStarts)
+        for (int i = 1; i < nClauses; i++) pLits[nLits + i] = 0x7FFFFFFF - i;
+      else
+        for (int i = 0; i < nLits; i++) pLits[i] = 0x7FFFFFFF;
+      WriteInts(file, ints);
+    }
+    ASSERT_EQ(Run("read " + fileB + "; strash; pdr"), 0);
+    EXPECT_EQ(Status(), 0);
+    ASSERT_NE(Cex(), nullptr);
+    EXPECT_EQ(Cex()->iFrame, 13);
+  }
+  std::remove(fileA.c_str());
+  std::remove(fileB.c_str());
+}
+
+// an entry is not returned if its payload does not match the hash in the
+// header, and the matching entry is returned again
+TEST_F(CnfCacheTest, RejectsDamagedPayload) {
+  std::vector<int> data = {1, 2, 3, 4, 5, 6, 7};
+  size_t nSize;
+  ASSERT_EQ(Run("set cachedir " + dir), 0);
+  ASSERT_EQ(Abc_CacheWrite((char*)"test", 1, 2, 3, data.data(), sizeof(int) * data.size()), 1);
+  int* pData = (int*)Abc_CacheMap((char*)"test", 1, 2, 3, &nSize);
+  ASSERT_NE(pData, nullptr);
+  EXPECT_EQ(std::vector<int>(pData, pData + nSize / sizeof(int)), data);
+  Abc_CacheUnmap(pData, nSize);
+  ASSERT_EQ(CacheFiles().size(), 1u);
+  std::string file = *CacheFiles().begin();
+  std::vector<int> ints = ReadInts(file), damaged = ints;
+  damaged[nHeader + 4] ^= 0x100;
+  std::ofstream(file, std::ios::binary | std::ios::trunc).write((const char*)damaged.data(), damaged.size() * sizeof(int));
+  EXPECT_EQ(Abc_CacheMap((char*)"test", 1, 2, 3, &nSize), nullptr);
+  EXPECT_EQ(nSize, 0u);
+  std::ofstream(file, std::ios::binary | std::ios::trunc).write((const char*)ints.data(), ints.size() * sizeof(int));
+  pData = (int*)Abc_CacheMap((char*)"test", 1, 2, 3, &nSize);
+  ASSERT_NE(pData, nullptr);
+  Abc_CacheUnmap(pData, nSize);
+}
+
+ABC_NAMESPACE_IMPL_END
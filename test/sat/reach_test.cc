@@ -0,0 +1,63 @@
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "abc_test.h"
+#include "seq_designs.h"
+#include "aig/gia/gia.h"
+
+ABC_NAMESPACE_IMPL_START
+
+class ReachTest : public AbcCommandTest {
+ protected:
+  // the verdict, the number of frames, and the CEX frame of the engine;
+  // the CEX is checked by simulation
+  std::vector<int> Results(const std::string& file, const std::string& command) {
+    EXPECT_EQ(Run("read " + file + "; strash; &get; " + command), 0);
+    if (Cex()) {
+      EXPECT_EQ(Gia_ManVerifyCex(Gia(), Cex(), 0), 1);
+    }
+    return {Status(), Abc_FrameReadBmcFrames(Abc_FrameGetGlobalFrame()), Cex() ? Cex()->iFrame : -1};
+  }
+};
+
+// the threaded image computation of llb2 and llb4 reaches the same verdicts
+// after the same number of iterations as the serial one
+TEST_F(ReachTest, ThreadsMatchSerial) {
+  std::string reach = WriteTempFile("reach.blif", CountersBlif(5, {{32, 25}, {20, 21}, {30, 31}}));
+  std::string unreach = WriteTempFile("unreach.blif", CountersBlif(5, {{24, 25}, {20, 21}, {30, 31}}));
+  // without -T, &reachp times out before the first image
+  for (const char* engine : {"&reachp -T 100", "&reachy"}) {
+    SCOPED_TRACE(engine);
+    std::vector<int> vReach = Results(reach, engine), vUnreach = Results(unreach, engine);
+    EXPECT_EQ(vReach[0], 0);
+    EXPECT_EQ(vReach[2], 25);
+    EXPECT_EQ(vUnreach[0], 1);
+    for (const char* procs : {" -P 2", " -P 4"}) {
+      SCOPED_TRACE(procs);
+      EXPECT_EQ(Results(reach, engine + std::string(procs)), vReach);
+      EXPECT_EQ(Results(unreach, engine + std::string(procs)), vUnreach);
+    }
+  }
+  std::remove(reach.c_str());
+  std::remove(unreach.c_str());
+}
+
+// dividing the partitions of the transition relation among the threads
+// gives the same images as the serial computation
+TEST_F(ReachTest, ThreadedPartitionsMatchSerial) {
+  std::string reach = WriteTempFile("reach.blif", CountersBlif(5, {{32, 25}, {20, 21}, {30, 31}}));
+  std::string unreach = WriteTempFile("unreach.blif", CountersBlif(5, {{24, 25}, {20, 21}, {30, 31}}));
+  for (const char* engine : {"&reachp -T 100", "&reachy"}) {
+    SCOPED_TRACE(engine);
+    std::vector<int> vReach = Results(reach, engine), vUnreach = Results(unreach, engine);
+    EXPECT_EQ(vReach[0], 0);
+    EXPECT_EQ(vUnreach[0], 1);
+    EXPECT_EQ(Results(reach, engine + std::string(" -P 3 -s")), vReach);
+    EXPECT_EQ(Results(unreach, engine + std::string(" -P 3 -s")), vUnreach);
+  }
+  std::remove(reach.c_str());
+  std::remove(unreach.c_str());
+}
+
+ABC_NAMESPACE_IMPL_END
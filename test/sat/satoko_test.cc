@@ -0,0 +1,93 @@
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "abc_test.h"
+#include "seq_designs.h"
+#include "aig/gia/gia.h"
+#include "sat/cnf/cnf.h"
+#include "sat/satoko/satoko.h"
+
+ABC_NAMESPACE_IMPL_START
+
+class SatokoTest : public AbcCommandTest {
+ protected:
+  // solves each output of the multi-output miter under an assumption;
+  // the satisfying assignments are checked against all clauses
+  std::vector<int> SolveOutputs(Gia_Man_t* p, int fInprocess, int fPhase) {
+    Cnf_Dat_t* pCnf = (Cnf_Dat_t*)Mf_ManGenerateCnf(p, 8, 0, 0, 0, 0);
+    satoko_opts_t opts;
+    satoko_default_opts(&opts);
+    opts.inprocess = fInprocess;
+    opts.n_conf_inprocess = 5;
+    satoko_t* pSat = satoko_create();
+    satoko_configure(pSat, &opts);
+    std::vector<int> vStatus;
+    int i, k;
+    for (i = 0; i < pCnf->nClauses; i++)
+      if (!satoko_add_clause(pSat, pCnf->pClauses[i], pCnf->pClauses[i + 1] - pCnf->pClauses[i]))
+        break;
+    EXPECT_EQ(i, pCnf->nClauses);
+    for (i = 0; i < Gia_ManCoNum(p); i++) {
+      int Lit = Abc_Var2Lit(i + 1, fPhase);
+      int status = satoko_solve_assumptions(pSat, &Lit, 1);
+      vStatus.push_back(status);
+      if (status != SATOKO_SAT) continue;
+      EXPECT_EQ(satoko_read_cex_varvalue(pSat, i + 1), !fPhase);
+      for (k = 0; k < pCnf->nClauses; k++) {
+        int* pLit;
+        int fSat = 0;
+        for (pLit = pCnf->pClauses[k]; pLit < pCnf->pClauses[k + 1]; pLit++)
+          fSat |= satoko_read_cex_varvalue(pSat, Abc_Lit2Var(*pLit)) != Abc_LitIsCompl(*pLit);
+        EXPECT_TRUE(fSat) << "clause " << k;
+      }
+    }
+    nInprocess += satoko_stats(pSat)->n_inprocess;
+    satoko_destroy(pSat);
+    Cnf_DataFree(pCnf);
+    return vStatus;
+  }
+  unsigned nInprocess = 0;
+};
+
+// inprocessing does not change the verdicts, and the models extended
+// over the eliminated variables satisfy the original clauses
+TEST_F(SatokoTest, InprocessingKeepsVerdictsAndModels) {
+  std::string orig = TempFile("orig.aig"), opt = TempFile("opt.aig");
+  for (const char* name : {"router", "int2float"}) {
+    SCOPED_TRACE(name);
+    std::string file = DataFile("lsv/pa1/benchmarks/") + name + ".blif";
+    ASSERT_EQ(Run("read " + file + "; strash; write " + orig + "; dc2; write " + opt), 0);
+    ASSERT_EQ(Run("miter -m " + orig + " " + opt + "; &get"), 0);
+    for (int fPhase = 0; fPhase < 2; fPhase++) {
+      unsigned nBefore = nInprocess;
+      std::vector<int> vBase = SolveOutputs(Gia(), 0, fPhase);
+      EXPECT_EQ(nInprocess, nBefore);
+      EXPECT_EQ(SolveOutputs(Gia(), 1, fPhase), vBase);
+      for (int status : vBase) EXPECT_EQ(status, fPhase ? SATOKO_SAT : SATOKO_UNSAT);
+    }
+  }
+  EXPECT_GT(nInprocess, 0u);
+  std::remove(orig.c_str());
+  std::remove(opt.c_str());
+}
+
+// "bmc3 -s -i" finds the same counter-example as bmc3 and proves the
+// unreachable output after visiting all states
+TEST_F(SatokoTest, Bmc3WithInprocessing) {
+  std::string reach = WriteTempFile("reach.blif", CounterBlif(4, 16, 11));
+  std::string unreach = WriteTempFile("unreach.blif", CounterBlif(4, 10, 11));
+  for (const char* options : {"", "-s", "-s -i"}) {
+    SCOPED_TRACE(options);
+    ASSERT_EQ(Run("read " + reach + "; strash; bmc3 -F 20 " + options), 0);
+    EXPECT_EQ(Status(), 0);
+    ASSERT_NE(Cex(), nullptr);
+    EXPECT_EQ(Cex()->iFrame, 11);
+    ASSERT_EQ(Run("read " + unreach + "; strash; bmc3 -F 20 " + options), 0);
+    EXPECT_EQ(Status(), 1);
+  }
+  std::remove(reach.c_str());
+  std::remove(unreach.c_str());
+}
+
+ABC_NAMESPACE_IMPL_END
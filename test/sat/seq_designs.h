@@ -0,0 +1,54 @@
+#ifndef ABC__test__sat__seq_designs_h
+#define ABC__test__sat__seq_designs_h
+
+#include <string>
+#include <utility>
+#include <vector>
+
+// The logic of a counter with enable input "<p>en" and output "<p>bad"
+// (see CounterBlif), with all internal names prefixed by p.
+static inline std::string CounterLogic(const std::string& p, int nBits, int nLimit, int nTarget) {
+  auto Pattern = [nBits](int Value) {
+    std::string s;
+    for (int i = 0; i < nBits; i++) s += ((Value >> i) & 1) ? '1' : '0';
+    return s;
+  };
+  auto Name = [&p](const char* base, int i) { return p + base + std::to_string(i); };
+  std::string s;
+  for (int i = 0; i < nBits; i++)
+    s += ".latch " + Name("d", i) + " " + Name("q", i) + " 0\n";
+  s += ".names " + p + "en " + Name("c", 0) + "\n1 1\n";
+  for (int i = 0; i < nBits; i++) {
+    s += ".names " + Name("q", i) + " " + Name("c", i) + " " + Name("n", i) + "\n10 1\n01 1\n";
+    s += ".names " + Name("q", i) + " " + Name("c", i) + " " + Name("c", i + 1) + "\n11 1\n";
+  }
+  std::string qs;
+  for (int i = 0; i < nBits; i++) qs += Name("q", i) + " ";
+  s += ".names " + qs + p + "en " + p + "r\n" + Pattern(nLimit - 1) + "1 1\n";
+  for (int i = 0; i < nBits; i++)
+    s += ".names " + Name("n", i) + " " + p + "r " + Name("d", i) + "\n10 1\n";
+  s += ".names " + qs + p + "bad\n" + Pattern(nTarget) + " 1\n";
+  return s;
+}
+
+// A BLIF counter with enable input "en". The counter counts modulo nLimit,
+// and the output "bad" is 1 when it reaches nTarget. The output can be
+// asserted in frame nTarget if nTarget < nLimit and never otherwise.
+static inline std::string CounterBlif(int nBits, int nLimit, int nTarget) {
+  return ".model counter\n.inputs en\n.outputs bad\n" + CounterLogic("", nBits, nLimit, nTarget) + ".end\n";
+}
+
+// Independent counters, each given by its limit and target, with inputs
+// "k_en" and outputs "k_bad" for the k-th counter.
+static inline std::string CountersBlif(int nBits, const std::vector<std::pair<int, int>>& vCounters) {
+  std::string ins = ".inputs", outs = ".outputs", logic;
+  for (size_t k = 0; k < vCounters.size(); k++) {
+    std::string p = std::to_string(k) + "_";
+    ins += " " + p + "en";
+    outs += " " + p + "bad";
+    logic += CounterLogic(p, nBits, vCounters[k].first, vCounters[k].second);
+  }
+  return ".model counters\n" + ins + "\n" + outs + "\n" + logic + ".end\n";
+}
+
+#endif
@@ -0,0 +1,170 @@
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "abc_test.h"
+#include "sat/bmc/bmc.h"
+
+// defined in src/ext-lsv/lsvCmd.cpp; the reference also links the object
+// file that registers the LSV commands
+int Lsv_NtkIsAndNode(Abc_Ntk_t* pNtk, int n);
+
+ABC_NAMESPACE_IMPL_START
+
+class SolverTest : public AbcCommandTest {
+ protected:
+  // returns the output of the command, or "error" if it fails
+  std::string Output(const std::string& command) {
+    testing::internal::CaptureStdout();
+    int RetValue = Run(command);
+    std::string output = testing::internal::GetCapturedStdout();
+    return RetValue ? "error" : output;
+  }
+};
+
+// every engine of the unified SAT interface gives the same don't cares
+TEST_F(SolverTest, DontCaresAgreeAcrossEngines) {
+  ASSERT_EQ(Run("read " + DataFile("lsv/example/ctrl.aig")), 0);
+  int nChecked = 0;
+  for (int n = 0; n < Abc_NtkObjNumMax(Ntk()) && nChecked < 10; n += 7) {
+    if (!Lsv_NtkIsAndNode(Ntk(), n)) continue;
+    SCOPED_TRACE(n);
+    for (const char* command : {"lsv_sdc", "lsv_odc"}) {
+      std::string base = Output(std::string(command) + " " + std::to_string(n));
+      ASSERT_NE(base, "error");
+      for (int s = 1; s <= 3; s++)
+        EXPECT_EQ(Output(std::string(command) + " -S " + std::to_string(s) + " " + std::to_string(n)), base);
+    }
+    nChecked++;
+  }
+  EXPECT_EQ(nChecked, 10);
+}
+
+TEST_F(SolverTest, DontCareCommandsCheckArguments) {
+  ASSERT_EQ(Run("read " + DataFile("lsv/example/ctrl.aig")), 0);
+  for (const char* command : {"lsv_sdc", "lsv_odc"}) {
+    SCOPED_TRACE(command);
+    EXPECT_NE(Run(command), 0);
+    EXPECT_NE(Run(std::string(command) + " -S"), 0);
+    EXPECT_NE(Run(std::string(command) + " -S 4 20"), 0);
+    EXPECT_NE(Run(std::string(command) + " 1"), 0);
+    EXPECT_NE(Run(std::string(command) + " 1000000"), 0);
+  }
+  // the cut size follows the options
+  EXPECT_NE(Output("lsv_printcut 2"), "error");
+  EXPECT_EQ(Run("lsv_printcut"), 1);
+}
+
+// the watch lists with blocking literals give the same verdicts, and the
+// counter-examples of the satisfiable miters are valid
+TEST_F(SolverTest, BsatMiterVerdicts) {
+  std::string orig = TempFile("orig.aig"), opt = TempFile("opt.aig"), mutant = TempFile("mutant.aig");
+  for (const char* name : {"adder", "router", "int2float"}) {
+    SCOPED_TRACE(name);
+    std::string file = DataFile("lsv/pa1/benchmarks/") + name + ".blif";
+    ASSERT_EQ(Run("read " + file + "; strash; write " + orig + "; dc2; write " + opt), 0);
+    ASSERT_EQ(Run("read " + file + "; strash -i; write " + mutant), 0);
+    ASSERT_EQ(Run("miter " + orig + " " + opt + "; sat"), 0);
+    EXPECT_EQ(Status(), 1);
+    ASSERT_EQ(Run("miter " + orig + " " + mutant + "; sat"), 0);
+    ASSERT_EQ(Status(), 0);
+    int* pSimInfo = Abc_NtkVerifySimulatePattern(Ntk(), Ntk()->pModel);
+    EXPECT_EQ(pSimInfo[0], 1);
+    ABC_FREE(pSimInfo);
+  }
+  std::remove(orig.c_str());
+  std::remove(opt.c_str());
+  std::remove(mutant.c_str());
+}
+
+// The unified interface is called directly for each backend and for the
+// portfolio of all three.
+class BmcSatTest : public testing::TestWithParam<int> {
+ protected:
+  void SetUp() override { p = GetParam() == BMC_SAT_PORTFOLIO ? Bmc_SatStartPortfolio(3) : Bmc_SatStart(GetParam()); }
+  void TearDown() override { Bmc_SatStop(p); }
+  int AddClause(std::vector<int> vLits) { return Bmc_SatAddClause(p, vLits.data(), (int)vLits.size()); }
+  int Solve(std::vector<int> vLits) { return Bmc_SatSolve(p, vLits.data(), (int)vLits.size()); }
+  std::vector<int> Final() {
+    int* pLits;
+    int nLits = Bmc_SatFinal(p, &pLits);
+    std::vector<int> vLits(pLits, pLits + nLits);
+    std::sort(vLits.begin(), vLits.end());
+    return vLits;
+  }
+  // the pigeon-hole problem with n+1 pigeons and n holes, which is UNSAT
+  // and takes many conflicts
+  void AddPigeons(int n) {
+    auto Var = [n](int i, int h) { return 1000 + i * n + h; };
+    for (int i = 0; i <= n; i++) {
+      std::vector<int> vLits;
+      for (int h = 0; h < n; h++) vLits.push_back(Abc_Var2Lit(Var(i, h), 0));
+      AddClause(vLits);
+    }
+    for (int h = 0; h < n; h++)
+      for (int i = 0; i <= n; i++)
+        for (int k = i + 1; k <= n; k++)
+          AddClause({Abc_Var2Lit(Var(i, h), 1), Abc_Var2Lit(Var(k, h), 1)});
+  }
+  Bmc_Sat_t* p = nullptr;
+  // variables a, b, c
+  const int a = 0, b = 1, c = 2;
+};
+
+TEST_P(BmcSatTest, AssumptionsAndModel) {
+  EXPECT_EQ(Bmc_SatAddVar(p), 0);
+  ASSERT_EQ(AddClause({Abc_Var2Lit(a, 0), Abc_Var2Lit(b, 0)}), 1);
+  ASSERT_EQ(AddClause({Abc_Var2Lit(a, 1), Abc_Var2Lit(c, 0)}), 1);
+  EXPECT_EQ(Bmc_SatVarNum(p), 3);
+  ASSERT_EQ(Solve({Abc_Var2Lit(b, 1)}), 1);
+  EXPECT_EQ(Bmc_SatVarValue(p, a), 1);
+  EXPECT_EQ(Bmc_SatVarValue(p, b), 0);
+  EXPECT_EQ(Bmc_SatVarValue(p, c), 1);
+  ASSERT_EQ(Solve({Abc_Var2Lit(b, 1), Abc_Var2Lit(c, 1)}), -1);
+  // the assumptions are not kept for the next call
+  ASSERT_EQ(Solve({Abc_Var2Lit(a, 1)}), 1);
+  EXPECT_EQ(Bmc_SatVarValue(p, b), 1);
+  EXPECT_EQ(Bmc_SatAddVar(p), 3);
+}
+
+// the final conflict has the complements of the responsible assumptions
+TEST_P(BmcSatTest, FinalConflict) {
+  ASSERT_EQ(AddClause({Abc_Var2Lit(a, 1), Abc_Var2Lit(b, 1)}), 1);
+  ASSERT_EQ(Solve({Abc_Var2Lit(c, 0), Abc_Var2Lit(a, 0), Abc_Var2Lit(b, 0)}), -1);
+  EXPECT_EQ(Final(), std::vector<int>({Abc_Var2Lit(a, 1), Abc_Var2Lit(b, 1)}));
+  ASSERT_EQ(Solve({Abc_Var2Lit(a, 0), Abc_Var2Lit(c, 0)}), 1);
+  // an unsatisfiable problem without assumptions has an empty conflict
+  ASSERT_EQ(AddClause({Abc_Var2Lit(a, 0)}), 1);
+  AddClause({Abc_Var2Lit(b, 0)});
+  ASSERT_EQ(Solve({Abc_Var2Lit(c, 0)}), -1);
+  EXPECT_EQ(Final(), std::vector<int>());
+}
+
+TEST_P(BmcSatTest, ConflictLimit) {
+  AddPigeons(7);
+  Bmc_SatSetConflictLimit(p, 10);
+  EXPECT_EQ(Solve({}), 0);
+  EXPECT_GT(Bmc_SatConflictNum(p), 0);
+  Bmc_SatSetConflictLimit(p, 0);
+  EXPECT_EQ(Solve({}), -1);
+}
+
+// the stop flag cancels the call; the solver can be used after clearing it
+TEST_P(BmcSatTest, Cancel) {
+  int fStop = 1;
+  AddPigeons(6);
+  AddClause({Abc_Var2Lit(a, 0), Abc_Var2Lit(b, 0)});
+  Bmc_SatSetStop(p, &fStop);
+  EXPECT_EQ(Solve({}), 0);
+  fStop = 0;
+  EXPECT_EQ(Solve({}), -1);
+  if (GetParam() == BMC_SAT_PORTFOLIO) {
+    EXPECT_GE(Bmc_SatWinner(p), 0);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(Backends, BmcSatTest,
+                         testing::Values(BMC_SAT_BSAT, BMC_SAT_SATOKO, BMC_SAT_GLUCOSE2, BMC_SAT_PORTFOLIO),
+                         [](const testing::TestParamInfo<int>& info) { return std::string(Bmc_SatTypeName(info.param)); });
+
+ABC_NAMESPACE_IMPL_END